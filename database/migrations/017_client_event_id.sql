@@ -0,0 +1,29 @@
+-- Migration: 017_client_event_id.sql
+-- Description: Adds client-generated event ids to activity_log and login_audit
+-- Date: 2026-10-18
+-- Purpose: Events spooled while the backend was down may be posted more than
+--          once on replay; the unique id lets the database keep exactly one copy
+
+-- =============================================================================
+-- DDL: client_event_id columns
+-- =============================================================================
+
+ALTER TABLE activity_log ADD COLUMN IF NOT EXISTS client_event_id VARCHAR(36);
+ALTER TABLE login_audit ADD COLUMN IF NOT EXISTS client_event_id VARCHAR(36);
+
+-- Rows logged before this migration have no id; NULLs do not collide
+CREATE UNIQUE INDEX IF NOT EXISTS idx_activity_log_client_event_id
+    ON activity_log(client_event_id);
+CREATE UNIQUE INDEX IF NOT EXISTS idx_login_audit_client_event_id
+    ON login_audit(client_event_id);
+
+-- =============================================================================
+-- Comments for documentation
+-- =============================================================================
+
+COMMENT ON COLUMN activity_log.client_event_id IS 'UUID set by the application; a repeated post of the same event is refused';
+COMMENT ON COLUMN login_audit.client_event_id IS 'UUID set by the application; a repeated post of the same event is refused';
+
+-- =============================================================================
+-- End of Migration
+-- =============================================================================
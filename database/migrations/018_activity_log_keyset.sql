@@ -0,0 +1,16 @@
+-- Migration: 018_activity_log_keyset.sql
+-- Description: Index for keyset pagination of the activity log
+-- Date: 2026-10-18
+-- Purpose: The activity list pages by (created_at, id) instead of an offset,
+--          and the live tail reads activities by id; both seek this index
+
+-- =============================================================================
+-- DDL: keyset index
+-- =============================================================================
+
+CREATE INDEX IF NOT EXISTS idx_activity_log_created_id
+    ON activity_log(created_at DESC, id DESC);
+
+-- =============================================================================
+-- End of Migration
+-- =============================================================================
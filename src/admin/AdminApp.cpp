@@ -2,6 +2,7 @@
 #include <Wt/WBootstrap5Theme.h>
 #include <Wt/WText.h>
 #include "utils/Logger.h"
+#include "api/AdminStatisticsService.h"
 
 namespace StudentIntake {
 namespace Admin {
@@ -738,6 +739,7 @@ void AdminApp::handleRevokeAccess(int studentId) {
         auto response = apiService_->getApiClient()->patch(endpoint, updateData);
 
         if (response.success) {
+            Api::AdminStatisticsService::getInstance().applyStudentResponse(response);
             LOG_INFO("AdminApp", "Access revoked successfully");
             // Refresh the student list to reflect the change
             studentListWidget_->refresh();
@@ -768,6 +770,7 @@ void AdminApp::handleRestoreAccess(int studentId) {
         auto response = apiService_->getApiClient()->patch(endpoint, updateData);
 
         if (response.success) {
+            Api::AdminStatisticsService::getInstance().applyStudentResponse(response);
             LOG_INFO("AdminApp", "Access restored successfully");
             // Refresh the student list to reflect the change
             studentListWidget_->refresh();
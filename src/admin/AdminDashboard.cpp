@@ -1,8 +1,5 @@
 #include "AdminDashboard.h"
 #include <Wt/WBreak.h>
-#include <nlohmann/json.hpp>
-#include <chrono>
-#include <ctime>
 #include "utils/Logger.h"
 #include "admin/activity/ActivityListWidget.h"
 
@@ -19,13 +16,15 @@ AdminDashboard::AdminDashboard()
     , todaysStudentsText_(nullptr)
     , completedOnboardingText_(nullptr)
     , programCountText_(nullptr)
+    , statsUpdatedText_(nullptr)
     , activityContainer_(nullptr)
     , quickActionsContainer_(nullptr)
     , activityListWidget_(nullptr)
     , totalStudents_(0)
     , todaysStudents_(0)
     , completedOnboarding_(0)
-    , activePrograms_(0) {
+    , activePrograms_(0)
+    , statisticsAgeSeconds_(-1) {
     setupUI();
 }
 
@@ -107,6 +106,9 @@ void AdminDashboard::setupUI() {
     auto programsLabel = programsCard->addWidget(std::make_unique<Wt::WText>("Active Programs"));
     programsLabel->addStyleClass("admin-stat-label");
 
+    statsUpdatedText_ = addWidget(std::make_unique<Wt::WText>(""));
+    statsUpdatedText_->addStyleClass("admin-stats-updated");
+
     // Main content area - two columns
     auto mainContent = addWidget(std::make_unique<Wt::WContainerWidget>());
     mainContent->addStyleClass("admin-main-content");
@@ -189,68 +191,29 @@ void AdminDashboard::loadStatistics() {
     todaysStudents_ = 0;
     completedOnboarding_ = 0;
     activePrograms_ = 0;
-
-    if (!apiService_) {
-        LOG_ERROR("AdminDashboard", "API service not available");
+    statisticsAgeSeconds_ = -1;
+
+    // Counters are kept up to date in the background for all admin sessions
+    auto& statistics = Api::AdminStatisticsService::getInstance();
+    auto snapshot = statistics.getSnapshot();
+    if (!snapshot->valid) {
+        // First visit before the refresher has loaded anything; never rebuild here
+        statistics.requestRefresh();
+        LOG_DEBUG("AdminDashboard", "Statistics not loaded yet");
         return;
     }
 
-    try {
-        // Fetch all students and calculate statistics
-        auto studentsResponse = apiService_->getApiClient()->get("/Student");
-        if (studentsResponse.success) {
-            auto jsonResponse = nlohmann::json::parse(studentsResponse.body);
-            if (jsonResponse.contains("data") && jsonResponse["data"].is_array()) {
-                auto& students = jsonResponse["data"];
-                totalStudents_ = static_cast<int>(students.size());
-
-                // Get today's date in YYYY-MM-DD format
-                auto now = std::chrono::system_clock::now();
-                auto time = std::chrono::system_clock::to_time_t(now);
-                std::tm tm = *std::localtime(&time);
-                char todayStr[11];
-                std::strftime(todayStr, sizeof(todayStr), "%Y-%m-%d", &tm);
-                std::string today(todayStr);
-
-                for (const auto& student : students) {
-                    const auto& attrs = student.contains("attributes") ? student["attributes"] : student;
-
-                    // Count today's registrations
-                    if (attrs.contains("created_at") && !attrs["created_at"].is_null()) {
-                        std::string createdAt = attrs["created_at"].get<std::string>();
-                        if (createdAt.substr(0, 10) == today) {
-                            todaysStudents_++;
-                        }
-                    }
-
-                    // Count completed onboarding
-                    if (attrs.contains("intake_status") && !attrs["intake_status"].is_null()) {
-                        std::string status = attrs["intake_status"].get<std::string>();
-                        if (status == "completed" || status == "approved") {
-                            completedOnboarding_++;
-                        }
-                    }
-                }
-            }
-        }
-
-        // Fetch active programs count
-        auto curriculumResponse = apiService_->getApiClient()->get("/Curriculum?filter[is_active]=true");
-        if (curriculumResponse.success) {
-            auto jsonResponse = nlohmann::json::parse(curriculumResponse.body);
-            if (jsonResponse.contains("data") && jsonResponse["data"].is_array()) {
-                activePrograms_ = static_cast<int>(jsonResponse["data"].size());
-            }
-        }
-
-        LOG_DEBUG("AdminDashboard", "Loaded statistics - Total: " << totalStudents_
-                  << ", Today: " << todaysStudents_
-                  << ", Completed: " << completedOnboarding_
-                  << ", Programs: " << activePrograms_);
-
-    } catch (const std::exception& e) {
-        LOG_ERROR("AdminDashboard", "Error loading statistics: " << e.what());
-    }
+    totalStudents_ = snapshot->totalStudents;
+    todaysStudents_ = snapshot->todaysStudents;
+    completedOnboarding_ = snapshot->completedIntakes;
+    activePrograms_ = snapshot->activePrograms;
+    statisticsAgeSeconds_ = snapshot->ageSeconds();
+
+    LOG_DEBUG("AdminDashboard", "Loaded statistics - Total: " << totalStudents_
+              << ", Today: " << todaysStudents_
+              << ", Completed: " << completedOnboarding_
+              << ", Programs: " << activePrograms_
+              << " (" << statisticsAgeSeconds_ << "s old)");
 }
 
 void AdminDashboard::updateDisplay() {
@@ -265,6 +228,14 @@ void AdminDashboard::updateDisplay() {
     todaysStudentsText_->setText(std::to_string(todaysStudents_));
     completedOnboardingText_->setText(std::to_string(completedOnboarding_));
     programCountText_->setText(std::to_string(activePrograms_));
+
+    if (statisticsAgeSeconds_ < 0) {
+        statsUpdatedText_->setText("Statistics are loading");
+    } else if (statisticsAgeSeconds_ < 60) {
+        statsUpdatedText_->setText("Updated " + std::to_string(statisticsAgeSeconds_) + "s ago");
+    } else {
+        statsUpdatedText_->setText("Updated " + std::to_string(statisticsAgeSeconds_ / 60) + " min ago");
+    }
 }
 
 } // namespace Admin
@@ -9,6 +9,7 @@
 #include "admin/models/AdminSession.h"
 #include "api/FormSubmissionService.h"
 #include "api/ActivityLogService.h"
+#include "api/AdminStatisticsService.h"
 
 namespace StudentIntake {
 namespace Admin {
@@ -58,6 +59,7 @@ private:
     Wt::WText* todaysStudentsText_;
     Wt::WText* completedOnboardingText_;
     Wt::WText* programCountText_;
+    Wt::WText* statsUpdatedText_;
     Wt::WContainerWidget* activityContainer_;
     Wt::WContainerWidget* quickActionsContainer_;
     ActivityListWidget* activityListWidget_;
@@ -67,6 +69,7 @@ private:
     int todaysStudents_;
     int completedOnboarding_;
     int activePrograms_;
+    long long statisticsAgeSeconds_;    // -1 until a snapshot has been loaded
 
     // Signals
     Wt::Signal<> viewStudentsClicked_;
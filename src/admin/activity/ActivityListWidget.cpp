@@ -1,7 +1,11 @@
 #include "ActivityListWidget.h"
 #include <Wt/WBreak.h>
+#include <Wt/WApplication.h>
+#include <Wt/WServer.h>
+#include <algorithm>
 #include <chrono>
 #include <ctime>
+#include "api/ActivityFeed.h"
 #include "utils/Logger.h"
 
 namespace StudentIntake {
@@ -12,6 +16,11 @@ ActivityListWidget::ActivityListWidget(DisplayMode mode)
     , activityService_(nullptr)
     , displayMode_(mode)
     , limit_(mode == DisplayMode::Compact ? 5 : 50)
+    , liveTail_(true)
+    , hasMore_(false)
+    , liveSubscription_(0)
+    , liveSequence_(0)
+    , newestShownId_(0)
     , totalCount_(0)
     , todayCount_(0)
     , authCount_(0)
@@ -37,6 +46,8 @@ ActivityListWidget::ActivityListWidget(DisplayMode mode)
     , refreshButton_(nullptr)
     , clearButton_(nullptr)
     , viewAllButton_(nullptr)
+    , loadMoreButton_(nullptr)
+    , liveToggle_(nullptr)
     , emptyMessage_(nullptr)
     , loadingIndicator_(nullptr)
     , resultCount_(nullptr) {
@@ -44,6 +55,7 @@ ActivityListWidget::ActivityListWidget(DisplayMode mode)
 }
 
 ActivityListWidget::~ActivityListWidget() {
+    unsubscribeLive();
 }
 
 void ActivityListWidget::setActivityService(std::shared_ptr<ActivityLogServiceType> service) {
@@ -90,6 +102,14 @@ void ActivityListWidget::setupFullUI() {
     auto headerRight = headerRow->addWidget(std::make_unique<Wt::WContainerWidget>());
     headerRight->addStyleClass("admin-header-right");
 
+    liveToggle_ = headerRight->addWidget(std::make_unique<Wt::WCheckBox>("Live"));
+    liveToggle_->addStyleClass("activity-live-toggle");
+    liveToggle_->setToolTip("Show new activities as they happen");
+    liveToggle_->setChecked(liveTail_);
+    liveToggle_->changed().connect([this]() {
+        setLiveTail(liveToggle_->isChecked());
+    });
+
     refreshButton_ = headerRight->addWidget(std::make_unique<Wt::WPushButton>("↻ Refresh"));
     refreshButton_->addStyleClass("btn btn-outline-primary");
     refreshButton_->clicked().connect([this]() {
@@ -109,7 +129,7 @@ void ActivityListWidget::setupFullUI() {
     // Activity list container
     setupActivityList();
 
-    // Footer for pagination (future)
+    // Footer with "Load older activities"
     setupFooter();
 }
 
@@ -281,14 +301,18 @@ void ActivityListWidget::setupActivityList() {
 }
 
 void ActivityListWidget::setupFooter() {
-    // Footer only needed in full mode for pagination (future)
+    // Footer only needed in full mode for pagination
     if (displayMode_ == DisplayMode::Full) {
         footerContainer_ = addWidget(std::make_unique<Wt::WContainerWidget>());
         footerContainer_->addStyleClass("activity-list-footer");
         footerContainer_->setAttributeValue("style", "padding:10px 12px;border-top:1px solid #e5e7eb;text-align:center;color:#6b7280;font-size:13px;");
 
-        auto footerText = footerContainer_->addWidget(std::make_unique<Wt::WText>(
-            "Showing most recent activities. Use filters to narrow results."));
+        loadMoreButton_ = footerContainer_->addWidget(std::make_unique<Wt::WPushButton>("Load older activities"));
+        loadMoreButton_->addStyleClass("btn btn-outline-secondary");
+        loadMoreButton_->clicked().connect([this]() {
+            loadMore();
+        });
+        loadMoreButton_->hide();
     }
 }
 
@@ -299,7 +323,12 @@ void ActivityListWidget::refresh() {
 void ActivityListWidget::reload() {
     // Clear existing items
     activities_.clear();
+    clearItems();
+
+    loadActivities();
+}
 
+void ActivityListWidget::clearItems() {
     // Remove all activity items (keep loading indicator and empty message)
     auto children = listContainer_->children();
     for (auto it = children.rbegin(); it != children.rend(); ++it) {
@@ -308,8 +337,24 @@ void ActivityListWidget::reload() {
             listContainer_->removeWidget(child);
         }
     }
+}
 
-    loadActivities();
+ActivityFilter ActivityListWidget::currentFilter() const {
+    ActivityFilter filter;
+    filter.limit = limit_;
+
+    if (displayMode_ == DisplayMode::Full) {
+        if (categoryFilter_ && categoryFilter_->currentIndex() > 0) {
+            std::string categories[] = {"", "authentication", "forms", "profile", "admin", "system"};
+            filter.actionCategory = categories[categoryFilter_->currentIndex()];
+        }
+
+        if (actorTypeFilter_ && actorTypeFilter_->currentIndex() > 0) {
+            std::string actors[] = {"", "student", "instructor", "admin", "system"};
+            filter.actorType = actors[actorTypeFilter_->currentIndex()];
+        }
+    }
+    return filter;
 }
 
 void ActivityListWidget::loadActivities() {
@@ -325,38 +370,35 @@ void ActivityListWidget::loadActivities() {
     emptyMessage_->hide();
 
     try {
-        // Build filter based on current selections
-        ActivityFilter filter;
-        filter.limit = limit_;
-
-        if (displayMode_ == DisplayMode::Full) {
-            if (categoryFilter_ && categoryFilter_->currentIndex() > 0) {
-                std::string categories[] = {"", "authentication", "forms", "profile", "admin", "system"};
-                filter.actionCategory = categories[categoryFilter_->currentIndex()];
-            }
-
-            if (actorTypeFilter_ && actorTypeFilter_->currentIndex() > 0) {
-                std::string actors[] = {"", "student", "instructor", "admin", "system"};
-                filter.actorType = actors[actorTypeFilter_->currentIndex()];
-            }
+        // Subscribe before reading the first page so nothing stored in
+        // between is missed; anything shown twice is dropped by id
+        if (liveTail_ && liveSubscription_ == 0) {
+            subscribeLive();
         }
+        liveSequence_ = Api::ActivityFeed::getInstance().getLatestSequence();
+
+        // Fetch the newest page (synchronous for now)
+        ActivityPage page = activityService_->getActivityPage(currentFilter());
+        activities_ = std::move(page.activities);
+        nextPage_ = page.next;
+        hasMore_ = page.hasMore;
 
-        // Fetch activities (synchronous for now)
-        activities_ = activityService_->getActivities(filter);
+        newestShownId_ = 0;
+        for (const auto& activity : activities_) {
+            newestShownId_ = std::max(newestShownId_, activity.getId());
+        }
 
         // Hide loading indicator
         loadingIndicator_->hide();
 
         // Remove previous activity items (keep loading and empty message)
-        auto children = listContainer_->children();
-        for (auto it = children.rbegin(); it != children.rend(); ++it) {
-            Wt::WWidget* child = *it;
-            if (child != loadingIndicator_ && child != emptyMessage_) {
-                listContainer_->removeWidget(child);
-            }
-        }
+        clearItems();
 
-        if (activities_.empty()) {
+        if (!page.success) {
+            emptyMessage_->setText("Error loading activities. Please try again.");
+            emptyMessage_->show();
+        } else if (activities_.empty()) {
+            emptyMessage_->setText("No activities found matching your criteria.");
             emptyMessage_->show();
         } else {
             emptyMessage_->hide();
@@ -370,10 +412,7 @@ void ActivityListWidget::loadActivities() {
             }
         }
 
-        // Update result count in full mode
-        if (displayMode_ == DisplayMode::Full && resultCount_) {
-            resultCount_->setText("Showing " + std::to_string(activities_.size()) + " activities");
-        }
+        updateListStatus();
 
         // Update statistics
         updateStats();
@@ -388,6 +427,130 @@ void ActivityListWidget::loadActivities() {
     }
 }
 
+void ActivityListWidget::loadMore() {
+    if (!activityService_ || !hasMore_) {
+        return;
+    }
+
+    ActivityPage page = activityService_->getActivityPage(currentFilter(), nextPage_);
+    if (!page.success) {
+        LOG_WARN("ActivityListWidget", "Could not load older activities");
+        return;
+    }
+
+    int index = static_cast<int>(activities_.size());
+    for (auto& activity : page.activities) {
+        auto item = createActivityItem(activity, index++);
+        listContainer_->addWidget(std::unique_ptr<Wt::WContainerWidget>(item));
+        activities_.push_back(std::move(activity));
+    }
+    nextPage_ = page.next;
+    hasMore_ = page.hasMore;
+
+    updateListStatus();
+    updateStats();
+}
+
+void ActivityListWidget::updateListStatus() {
+    // Update result count in full mode
+    if (displayMode_ == DisplayMode::Full && resultCount_) {
+        resultCount_->setText("Showing " + std::to_string(activities_.size()) + " activities");
+    }
+    if (loadMoreButton_) {
+        loadMoreButton_->setHidden(!hasMore_);
+    }
+}
+
+// =============================================================================
+// Live Tail
+// =============================================================================
+
+void ActivityListWidget::setLiveTail(bool enabled) {
+    if (liveTail_ == enabled) {
+        return;
+    }
+    liveTail_ = enabled;
+    if (liveToggle_) {
+        liveToggle_->setChecked(enabled);
+    }
+
+    if (enabled) {
+        // Catch up on anything missed while paused
+        reload();
+    } else {
+        unsubscribeLive();
+    }
+}
+
+void ActivityListWidget::subscribeLive() {
+    // The shared feed reads new activities on its own thread; redraw on the session thread
+    auto app = Wt::WApplication::instance();
+    if (!app) {
+        return;
+    }
+    app->enableUpdates(true);
+    std::string sessionId = app->sessionId();
+    // bindSafe: a post already queued must not reach the widget once it is deleted
+    auto show = app->bind(bindSafe([this]() {
+        showLiveActivities();
+    }));
+
+    liveSubscription_ = Api::ActivityFeed::getInstance().subscribe([sessionId, show]() {
+        Wt::WServer::instance()->post(sessionId, show);
+    });
+}
+
+void ActivityListWidget::unsubscribeLive() {
+    if (liveSubscription_ != 0) {
+        Api::ActivityFeed::getInstance().unsubscribe(liveSubscription_);
+        liveSubscription_ = 0;
+
+        // enableUpdates() is counted; release the one taken in subscribeLive()
+        if (auto app = Wt::WApplication::instance()) {
+            app->enableUpdates(false);
+        }
+    }
+}
+
+void ActivityListWidget::showLiveActivities() {
+    if (liveSubscription_ == 0) {
+        return;
+    }
+
+    ActivityFilter filter = currentFilter();
+    std::vector<ActivityLogModel> arrived;
+    for (auto& activity : Api::ActivityFeed::getInstance().getSince(liveSequence_)) {
+        if (activity.getId() > newestShownId_ && filter.matches(activity)) {
+            newestShownId_ = activity.getId();
+            arrived.push_back(std::move(activity));
+        }
+    }
+    if (arrived.empty()) {
+        return;
+    }
+
+    // Newest first: insert each arrival directly above the previous top item
+    int top = listContainer_->indexOf(emptyMessage_) + 1;
+    for (auto& activity : arrived) {
+        auto item = createActivityItem(activity, static_cast<int>(activities_.size()));
+        listContainer_->insertWidget(top, std::unique_ptr<Wt::WContainerWidget>(item));
+        activities_.insert(activities_.begin(), std::move(activity));
+    }
+    emptyMessage_->hide();
+
+    // The dashboard view only keeps its most recent few
+    if (displayMode_ == DisplayMode::Compact) {
+        while (static_cast<int>(activities_.size()) > limit_) {
+            activities_.pop_back();
+            listContainer_->removeWidget(listContainer_->widget(listContainer_->count() - 1));
+        }
+    }
+
+    updateListStatus();
+    updateStats();
+    Wt::WApplication::instance()->triggerUpdate();
+}
+
 void ActivityListWidget::updateStats() {
     if (displayMode_ != DisplayMode::Full) return;
 
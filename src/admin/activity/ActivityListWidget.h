@@ -6,9 +6,11 @@
 #include <Wt/WLineEdit.h>
 #include <Wt/WComboBox.h>
 #include <Wt/WPushButton.h>
+#include <Wt/WCheckBox.h>
 #include <Wt/WSignal.h>
 #include <vector>
 #include <memory>
+#include <cstdint>
 #include "../../models/ActivityLog.h"
 #include "../../api/ActivityLogService.h"
 
@@ -23,6 +25,8 @@ using ActivityCategory = ::StudentIntake::Models::ActivityCategory;
 using ActorType = ::StudentIntake::Models::ActorType;
 using ActivityLogServiceType = ::StudentIntake::Api::ActivityLogService;
 using ActivityFilter = ::StudentIntake::Api::ActivityFilter;
+using ActivityCursor = ::StudentIntake::Api::ActivityCursor;
+using ActivityPage = ::StudentIntake::Api::ActivityPage;
 
 /**
  * @brief Readonly widget displaying recent activity/audit trail entries
@@ -34,6 +38,8 @@ using ActivityFilter = ::StudentIntake::Api::ActivityFilter;
  * - Readonly display (no editing capability)
  * - Immutable data presentation
  * - Category filtering
+ * - Keyset pagination ("Load older activities", full mode)
+ * - Live tail: new activities are pushed from the shared ActivityFeed
  * - Refresh functionality
  * - Click-through to activity details
  * - Severity-based styling (info, success, warning, error)
@@ -71,6 +77,12 @@ public:
      */
     DisplayMode getDisplayMode() const { return displayMode_; }
 
+    /**
+     * @brief Show new activities as they arrive (on by default)
+     */
+    void setLiveTail(bool enabled);
+    bool isLiveTail() const { return liveTail_; }
+
     // =========================================================================
     // Actions
     // =========================================================================
@@ -111,10 +123,35 @@ private:
     void setupFooter();
 
     /**
-     * @brief Load activities from the service
+     * @brief Load the first page of activities from the service
      */
     void loadActivities();
 
+    /**
+     * @brief Append the next page of older activities
+     */
+    void loadMore();
+
+    /**
+     * @brief Build the filter for the current selections
+     */
+    ActivityFilter currentFilter() const;
+
+    /**
+     * @brief Remove all rendered activity items
+     */
+    void clearItems();
+
+    /**
+     * @brief Update result count and "Load older" button after a change
+     */
+    void updateListStatus();
+
+    // Live tail through the shared ActivityFeed
+    void subscribeLive();
+    void unsubscribeLive();
+    void showLiveActivities();
+
     /**
      * @brief Update statistics placards with current data
      */
@@ -158,9 +195,17 @@ private:
     // Configuration
     DisplayMode displayMode_;
     int limit_;
+    bool liveTail_;
 
     // Data (immutable once loaded)
     std::vector<ActivityLogModel> activities_;
+    ActivityCursor nextPage_;
+    bool hasMore_;
+
+    // Live tail state
+    int liveSubscription_;          // 0 when not subscribed
+    uint64_t liveSequence_;         // last ActivityFeed sequence shown
+    int newestShownId_;
 
     // Statistics
     int totalCount_;
@@ -194,6 +239,8 @@ private:
     Wt::WPushButton* refreshButton_;
     Wt::WPushButton* clearButton_;
     Wt::WPushButton* viewAllButton_;
+    Wt::WPushButton* loadMoreButton_;
+    Wt::WCheckBox* liveToggle_;
     Wt::WText* emptyMessage_;
     Wt::WText* loadingIndicator_;
     Wt::WText* resultCount_;
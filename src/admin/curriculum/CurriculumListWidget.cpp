@@ -4,6 +4,7 @@
 #include "utils/Logger.h"
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <nlohmann/json.hpp>
 
 namespace StudentIntake {
@@ -15,6 +16,8 @@ using StudentIntake::Models::Curriculum;
 CurriculumListWidget::CurriculumListWidget()
     : WContainerWidget()
     , apiService_(nullptr)
+    , sharedIndex_(Api::SearchIndexRegistry::getInstance().getIndex("curricula"))
+    , searchIndex_(sharedIndex_)
     , statsContainer_(nullptr)
     , activeCountText_(nullptr)
     , inactiveCountText_(nullptr)
@@ -348,10 +351,12 @@ void CurriculumListWidget::loadCurriculums() {
         automotive.setRequiredForms({"personal_info", "consent"});
         curriculums_.push_back(automotive);
 
+        updateSearchIndex(false);
         applyFilters();
         return;
     }
 
+    bool loaded = false;
     try {
         auto response = apiService_->getApiClient()->get("/Curriculum");
         if (response.success) {
@@ -365,6 +370,7 @@ void CurriculumListWidget::loadCurriculums() {
             for (const auto& item : items) {
                 curriculums_.push_back(Curriculum::fromJson(item));
             }
+            loaded = true;
         }
         LOG_DEBUG("CurriculumListWidget", "Loaded " << curriculums_.size() << " curriculums");
 
@@ -396,14 +402,43 @@ void CurriculumListWidget::loadCurriculums() {
         departmentFilter_->addItem(dept);
     }
 
+    updateSearchIndex(loaded);
     applyFilters();
 }
 
+void CurriculumListWidget::updateSearchIndex(bool fromBackend) {
+    // Only a successful load may replace what other admin sessions search;
+    // sample data or a failed load is searched in a private index
+    if (fromBackend) {
+        searchIndex_ = sharedIndex_;
+    } else if (searchIndex_ == sharedIndex_) {
+        searchIndex_ = std::make_shared<Api::TextSearchIndex>();
+    }
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> searchRecords;
+    searchRecords.reserve(curriculums_.size());
+    for (const auto& curriculum : curriculums_) {
+        searchRecords.push_back({curriculum.getId(),
+                                 {curriculum.getName(), curriculum.getDescription(), curriculum.getId()}});
+    }
+
+    size_t changed = searchIndex_->sync(searchRecords);
+    LOG_DEBUG("CurriculumListWidget", "Search index updated (" << changed << " changes)");
+}
+
 void CurriculumListWidget::applyFilters() {
     filteredCurriculums_.clear();
 
     std::string searchText = searchInput_->text().toUTF8();
-    std::transform(searchText.begin(), searchText.end(), searchText.begin(), ::tolower);
+
+    // Ranked ids from the shared index; rank orders the filtered list
+    std::unordered_map<std::string, size_t> searchRank;
+    bool searching = searchText.find_first_not_of(" \t") != std::string::npos;
+    if (searching) {
+        for (const auto& match : searchIndex_->search(searchText)) {
+            searchRank.emplace(match.id, searchRank.size());
+        }
+    }
 
     int deptIndex = departmentFilter_->currentIndex();
     std::string selectedDept = (deptIndex > 0) ? departmentFilter_->currentText().toUTF8() : "";
@@ -420,19 +455,8 @@ void CurriculumListWidget::applyFilters() {
 
     for (const auto& curriculum : curriculums_) {
         // Search filter
-        if (!searchText.empty()) {
-            std::string name = curriculum.getName();
-            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
-            std::string desc = curriculum.getDescription();
-            std::transform(desc.begin(), desc.end(), desc.begin(), ::tolower);
-            std::string id = curriculum.getId();
-            std::transform(id.begin(), id.end(), id.begin(), ::tolower);
-
-            if (name.find(searchText) == std::string::npos &&
-                desc.find(searchText) == std::string::npos &&
-                id.find(searchText) == std::string::npos) {
-                continue;
-            }
+        if (searching && searchRank.count(curriculum.getId()) == 0) {
+            continue;
         }
 
         // Department filter
@@ -456,6 +480,13 @@ void CurriculumListWidget::applyFilters() {
         filteredCurriculums_.push_back(curriculum);
     }
 
+    if (searching) {
+        std::stable_sort(filteredCurriculums_.begin(), filteredCurriculums_.end(),
+                         [&searchRank](const Curriculum& a, const Curriculum& b) {
+                             return searchRank[a.getId()] < searchRank[b.getId()];
+                         });
+    }
+
     updateTable();
     updateStats();
 }
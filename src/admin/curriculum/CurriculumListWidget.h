@@ -11,6 +11,7 @@
 #include <memory>
 #include <vector>
 #include "../../api/FormSubmissionService.h"
+#include "../../api/TextSearchIndex.h"
 #include "../../models/Curriculum.h"
 
 namespace StudentIntake {
@@ -42,6 +43,7 @@ private:
     void applyFilters();
     void updateStats();
     void resetFilters();
+    void updateSearchIndex(bool fromBackend);
     std::string getStatusBadgeClass(bool isActive);
     std::string getDegreeTypeBadgeClass(const std::string& degreeType);
 
@@ -49,6 +51,8 @@ private:
     std::vector<StudentIntake::Models::Curriculum> curriculums_;
     std::vector<StudentIntake::Models::Curriculum> filteredCurriculums_;
     std::map<int, std::string> departmentMap_; // Maps department_id -> name
+    std::shared_ptr<Api::TextSearchIndex> sharedIndex_;  // name/description/id, shared by admin sessions
+    std::shared_ptr<Api::TextSearchIndex> searchIndex_;  // sharedIndex_, or a private index over fallback data
 
     // UI Elements - Stats
     Wt::WContainerWidget* statsContainer_;
@@ -0,0 +1,222 @@
+#include "CohortExportDialog.h"
+#include <Wt/WApplication.h>
+#include <Wt/WDate.h>
+#include <Wt/WServer.h>
+#include "api/SubmissionIndex.h"
+#include "utils/Logger.h"
+#include <sstream>
+
+namespace StudentIntake {
+namespace Admin {
+
+CohortExportDialog::CohortExportDialog(std::shared_ptr<Api::FormSubmissionService> apiService, int curriculumId)
+    : WDialog("Export Intake Packets")
+    , apiService_(apiService)
+    , updatesEnabled_(false)
+    , programFilter_(nullptr)
+    , fromDate_(nullptr)
+    , toDate_(nullptr)
+    , cohortSize_(nullptr)
+    , progressBar_(nullptr)
+    , statusText_(nullptr)
+    , startBtn_(nullptr)
+    , closeBtn_(nullptr) {
+    setupUI(curriculumId);
+}
+
+CohortExportDialog::~CohortExportDialog() {
+    // Dropping the resource cancels an export still in progress
+    if (resource_) {
+        resource_->cancel();
+    }
+    releaseUpdates();
+}
+
+void CohortExportDialog::setupUI(int curriculumId) {
+    setModal(true);
+    setClosable(true);
+    setResizable(false);
+    rejectWhenEscapePressed();
+    addStyleClass("cohort-export-dialog");
+
+    auto content = contents();
+    content->addStyleClass("admin-form");
+
+    // Program
+    auto programGroup = content->addWidget(std::make_unique<Wt::WContainerWidget>());
+    programGroup->addStyleClass("admin-filter-group");
+    auto programLabel = programGroup->addWidget(std::make_unique<Wt::WText>("Program"));
+    programLabel->addStyleClass("admin-filter-label");
+    programFilter_ = programGroup->addWidget(std::make_unique<Wt::WComboBox>());
+    programFilter_->addStyleClass("admin-filter-select");
+    programFilter_->addItem("All Programs");
+
+    programs_ = Api::SubmissionIndex::getInstance().getPrograms();
+    for (size_t i = 0; i < programs_.size(); ++i) {
+        programFilter_->addItem(programs_[i].second);
+        if (programs_[i].first == curriculumId) {
+            programFilter_->setCurrentIndex(static_cast<int>(i) + 1);
+        }
+    }
+    programFilter_->changed().connect(this, &CohortExportDialog::updateCohortSize);
+
+    // Submission date range
+    auto dateGroup = content->addWidget(std::make_unique<Wt::WContainerWidget>());
+    dateGroup->addStyleClass("admin-filter-group");
+    auto dateLabel = dateGroup->addWidget(std::make_unique<Wt::WText>("Submitted between"));
+    dateLabel->addStyleClass("admin-filter-label");
+    fromDate_ = dateGroup->addWidget(std::make_unique<Wt::WDateEdit>());
+    fromDate_->setFormat("yyyy-MM-dd");
+    fromDate_->setPlaceholderText("Any date");
+    fromDate_->changed().connect(this, &CohortExportDialog::updateCohortSize);
+    toDate_ = dateGroup->addWidget(std::make_unique<Wt::WDateEdit>());
+    toDate_->setFormat("yyyy-MM-dd");
+    toDate_->setPlaceholderText("Any date");
+    toDate_->changed().connect(this, &CohortExportDialog::updateCohortSize);
+
+    cohortSize_ = content->addWidget(std::make_unique<Wt::WText>(""));
+    cohortSize_->addStyleClass("admin-result-count");
+
+    progressBar_ = content->addWidget(std::make_unique<Wt::WProgressBar>());
+    progressBar_->hide();
+
+    statusText_ = content->addWidget(std::make_unique<Wt::WText>(""));
+    statusText_->addStyleClass("text-muted");
+
+    // Buttons
+    startBtn_ = footer()->addWidget(std::make_unique<Wt::WPushButton>("Start Export"));
+    startBtn_->addStyleClass("btn btn-primary");
+    startBtn_->clicked().connect(this, &CohortExportDialog::startExport);
+
+    closeBtn_ = footer()->addWidget(std::make_unique<Wt::WPushButton>("Close"));
+    closeBtn_->addStyleClass("btn btn-secondary");
+    closeBtn_->clicked().connect([this]() {
+        reject();
+    });
+
+    updateCohortSize();
+}
+
+Api::CohortFilter CohortExportDialog::currentFilter() const {
+    Api::CohortFilter filter;
+    int programIndex = programFilter_->currentIndex();
+    if (programIndex > 0 && programIndex - 1 < static_cast<int>(programs_.size())) {
+        filter.curriculumId = programs_[programIndex - 1].first;
+    }
+    if (fromDate_->date().isValid()) {
+        filter.submittedFrom = fromDate_->date().toString("yyyy-MM-dd").toUTF8();
+    }
+    if (toDate_->date().isValid()) {
+        filter.submittedTo = toDate_->date().toString("yyyy-MM-dd").toUTF8();
+    }
+    return filter;
+}
+
+std::vector<int> CohortExportDialog::selectCohort() const {
+    Api::CohortFilter filter = currentFilter();
+
+    // The index narrows by program; the date range is applied per submission
+    Api::SubmissionFilter submissions;
+    submissions.curriculumId = filter.curriculumId;
+    return Api::CohortPdfExporter::selectStudents(
+        Api::SubmissionIndex::getInstance().query(submissions), filter);
+}
+
+void CohortExportDialog::updateCohortSize() {
+    size_t students = selectCohort().size();
+    cohortSize_->setText(std::to_string(students) + (students == 1 ? " student" : " students"));
+    if (!resource_) {
+        startBtn_->setEnabled(students > 0 && Api::PdfGenerator::isAvailable());
+    }
+    if (!Api::PdfGenerator::isAvailable()) {
+        statusText_->setText("PDF generation is not available on this server.");
+    }
+}
+
+void CohortExportDialog::startExport() {
+    std::vector<int> studentIds = selectCohort();
+    if (studentIds.empty() || !apiService_) {
+        return;
+    }
+
+    auto exporter = std::make_unique<Api::CohortPdfExporter>(apiService_->getApiClient());
+    auto settings = apiService_->getInstitutionSettings();
+    exporter->setInstitution(settings.getInstitutionName(), settings.getTagline());
+
+    // Progress is reported on the export thread and pushed to this session
+    auto app = Wt::WApplication::instance();
+    if (!updatesEnabled_) {
+        app->enableUpdates(true);
+        updatesEnabled_ = true;
+    }
+    std::string sessionId = app->sessionId();
+    progressUpdate_ = app->bind(bindSafe([this]() {
+        showProgress();
+    }));
+    exporter->setProgressCallback([sessionId, update = progressUpdate_](const Api::CohortExportProgress&) {
+        Wt::WServer::instance()->post(sessionId, update);
+    });
+
+    size_t total = studentIds.size();
+    LOG_INFO("CohortExportDialog", "Starting cohort export of " << total << " students");
+    resource_ = std::make_shared<CohortExportResource>(std::move(exporter), std::move(studentIds));
+
+    std::string filename = "intake_packets_" + Wt::WDate::currentServerDate().toString("yyyy-MM-dd").toUTF8() + ".zip";
+    resource_->suggestFileName(filename, Wt::ContentDisposition::Attachment);
+
+    programFilter_->setEnabled(false);
+    fromDate_->setEnabled(false);
+    toDate_->setEnabled(false);
+    startBtn_->setEnabled(false);
+    progressBar_->setRange(0, static_cast<double>(total));
+    progressBar_->setValue(0);
+    progressBar_->show();
+    statusText_->setText("Rendering packets...");
+
+    // The export runs while the browser downloads it
+    Wt::WApplication::instance()->doJavaScript(
+        "window.open('" + resource_->url() + "', '_blank');"
+    );
+}
+
+void CohortExportDialog::showProgress() {
+    if (!resource_) {
+        return;
+    }
+
+    Api::CohortExportProgress progress = resource_->getProgress();
+    if (progress.total == 0) {
+        // Posted before the export thread has started
+        return;
+    }
+    progressBar_->setRange(0, static_cast<double>(progress.total));
+    progressBar_->setValue(static_cast<double>(progress.completed));
+
+    std::ostringstream status;
+    if (progress.finished) {
+        status << (progress.cancelled ? "Export stopped after " : "Exported ")
+               << (progress.completed - progress.failed) << " of " << progress.total << " packets";
+    } else {
+        status << "Rendered " << progress.completed << " of " << progress.total << " packets";
+    }
+    if (progress.failed > 0) {
+        status << " (" << progress.failed << " failed, see export_errors.txt)";
+    }
+    status << " - " << (progress.bytesWritten / (1024 * 1024)) << " MB";
+    statusText_->setText(status.str());
+
+    Wt::WApplication::instance()->triggerUpdate();
+    if (progress.finished) {
+        releaseUpdates();
+    }
+}
+
+void CohortExportDialog::releaseUpdates() {
+    if (updatesEnabled_) {
+        Wt::WApplication::instance()->enableUpdates(false);
+        updatesEnabled_ = false;
+    }
+}
+
+} // namespace Admin
+} // namespace StudentIntake
@@ -0,0 +1,62 @@
+#ifndef COHORT_EXPORT_DIALOG_H
+#define COHORT_EXPORT_DIALOG_H
+
+#include <Wt/WDialog.h>
+#include <Wt/WComboBox.h>
+#include <Wt/WDateEdit.h>
+#include <Wt/WProgressBar.h>
+#include <Wt/WPushButton.h>
+#include <Wt/WText.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../api/FormSubmissionService.h"
+#include "CohortExportResource.h"
+
+namespace StudentIntake {
+namespace Admin {
+
+/**
+ * @brief Dialog that exports the intake packets of a cohort as one ZIP download
+ *
+ * The cohort is chosen by program and submission date range from the
+ * shared SubmissionIndex. The download starts immediately and fills as
+ * packets are rendered; progress is pushed to the dialog as it goes.
+ * Closing the dialog cancels an export that has not finished.
+ */
+class CohortExportDialog : public Wt::WDialog {
+public:
+    CohortExportDialog(std::shared_ptr<Api::FormSubmissionService> apiService, int curriculumId = 0);
+    ~CohortExportDialog() override;
+
+private:
+    void setupUI(int curriculumId);
+    Api::CohortFilter currentFilter() const;
+    std::vector<int> selectCohort() const;
+    void updateCohortSize();
+    void startExport();
+    void showProgress();
+    void releaseUpdates();
+
+    std::shared_ptr<Api::FormSubmissionService> apiService_;
+    std::vector<std::pair<int, std::string>> programs_;  // (curriculum_id, name)
+    std::shared_ptr<CohortExportResource> resource_;
+    std::function<void()> progressUpdate_;               // Bound to this dialog's session
+    bool updatesEnabled_;                                // Holds an enableUpdates(true) until the export ends
+
+    // UI Elements
+    Wt::WComboBox* programFilter_;
+    Wt::WDateEdit* fromDate_;
+    Wt::WDateEdit* toDate_;
+    Wt::WText* cohortSize_;
+    Wt::WProgressBar* progressBar_;
+    Wt::WText* statusText_;
+    Wt::WPushButton* startBtn_;
+    Wt::WPushButton* closeBtn_;
+};
+
+} // namespace Admin
+} // namespace StudentIntake
+
+#endif // COHORT_EXPORT_DIALOG_H
@@ -0,0 +1,155 @@
+#include "CohortExportResource.h"
+#include "utils/Logger.h"
+#include <algorithm>
+
+namespace StudentIntake {
+namespace Admin {
+
+namespace {
+
+// Archive bytes are buffered in pieces of at most this size
+const size_t kChunkSize = 64 * 1024;
+
+} // namespace
+
+CohortExportResource::CohortExportResource(std::unique_ptr<Api::CohortPdfExporter> exporter,
+                                           std::vector<int> studentIds,
+                                           size_t maxBufferedBytes)
+    : WResource()
+    , exporter_(std::move(exporter))
+    , studentIds_(std::move(studentIds))
+    , maxBufferedBytes_(std::max(maxBufferedBytes, kChunkSize))
+    , bufferedBytes_(0)
+    , started_(false)
+    , done_(false)
+    , cancelled_(false) {
+}
+
+CohortExportResource::~CohortExportResource() {
+    cancel();
+    beingDeleted();
+    if (producer_.joinable()) {
+        producer_.join();
+    }
+}
+
+Api::CohortExportProgress CohortExportResource::getProgress() const {
+    return exporter_->getProgress();
+}
+
+void CohortExportResource::cancel() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+        chunks_.clear();
+        bufferedBytes_ = 0;
+        waiting_.reset();
+    }
+    exporter_->cancel();
+    spaceAvailable_.notify_all();
+}
+
+// =============================================================================
+// Producer
+// =============================================================================
+
+void CohortExportResource::produce() {
+    exporter_->run(studentIds_, [this](const char* data, size_t size) {
+        return pushChunk(data, size);
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_ = true;
+    }
+    wakeResponse();
+}
+
+bool CohortExportResource::pushChunk(const char* data, size_t size) {
+    while (size > 0) {
+        size_t length = std::min(size, kChunkSize);
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            spaceAvailable_.wait(lock, [this]() {
+                return cancelled_ || bufferedBytes_ < maxBufferedBytes_;
+            });
+            if (cancelled_) {
+                return false;
+            }
+            chunks_.emplace_back(data, length);
+            bufferedBytes_ += length;
+        }
+        wakeResponse();
+        data += length;
+        size -= length;
+    }
+    return true;
+}
+
+void CohortExportResource::wakeResponse() {
+    Wt::Http::ResponseContinuationPtr continuation;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        continuation = std::move(waiting_);
+        waiting_.reset();
+    }
+    // Outside the lock: Wt may call handleRequest() from here
+    if (continuation) {
+        continuation->haveMoreData();
+    }
+}
+
+// =============================================================================
+// Response
+// =============================================================================
+
+void CohortExportResource::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) {
+    if (!request.continuation()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (started_ || cancelled_) {
+                // The archive is generated once, for the first request
+                response.setStatus(409);
+                return;
+            }
+            started_ = true;
+        }
+
+        response.setMimeType("application/zip");
+        response.addHeader("Cache-Control", "private, no-store");
+        producer_ = std::thread(&CohortExportResource::produce, this);
+    }
+
+    std::deque<std::string> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready.swap(chunks_);
+        bufferedBytes_ = 0;
+    }
+    spaceAvailable_.notify_all();
+
+    for (const auto& chunk : ready) {
+        response.out().write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cancelled_ || (done_ && chunks_.empty())) {
+        // Returning without a continuation completes the response
+        return;
+    }
+
+    Wt::Http::ResponseContinuation* continuation = response.createContinuation();
+    if (chunks_.empty()) {
+        // Parked until the producer calls haveMoreData()
+        continuation->waitForMoreData();
+        waiting_ = continuation->shared_from_this();
+    }
+}
+
+void CohortExportResource::handleAbort(const Wt::Http::Request& request) {
+    LOG_INFO("CohortExportResource", "Cohort export download aborted by the client");
+    cancel();
+}
+
+} // namespace Admin
+} // namespace StudentIntake
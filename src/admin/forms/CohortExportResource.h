@@ -0,0 +1,67 @@
+#ifndef COHORT_EXPORT_RESOURCE_H
+#define COHORT_EXPORT_RESOURCE_H
+
+#include <Wt/WResource.h>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include <Wt/Http/ResponseContinuation.h>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include "../../api/CohortPdfExporter.h"
+
+namespace StudentIntake {
+namespace Admin {
+
+/**
+ * @brief Streams a cohort ZIP to the browser while it is being rendered
+ *
+ * The first request starts the export on a producer thread. Archive bytes
+ * go through a small chunk buffer that is flushed with response
+ * continuations; when the buffer is full the producer (and with it the
+ * render workers) waits for the client to catch up. One download per
+ * resource; an aborted download cancels the export.
+ */
+class CohortExportResource : public Wt::WResource {
+public:
+    static constexpr size_t kDefaultMaxBufferedBytes = 4 * 1024 * 1024;
+
+    CohortExportResource(std::unique_ptr<Api::CohortPdfExporter> exporter,
+                         std::vector<int> studentIds,
+                         size_t maxBufferedBytes = kDefaultMaxBufferedBytes);
+    ~CohortExportResource() override;
+
+    Api::CohortExportProgress getProgress() const;
+    void cancel();
+
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+    void handleAbort(const Wt::Http::Request& request) override;
+
+private:
+    void produce();
+    bool pushChunk(const char* data, size_t size);   // Producer side; blocks while the buffer is full
+    void wakeResponse();
+
+    std::unique_ptr<Api::CohortPdfExporter> exporter_;
+    std::vector<int> studentIds_;
+    size_t maxBufferedBytes_;
+
+    std::deque<std::string> chunks_;
+    size_t bufferedBytes_;
+    bool started_;
+    bool done_;
+    bool cancelled_;
+    Wt::Http::ResponseContinuationPtr waiting_;   // Continuation parked until more data arrives
+    std::thread producer_;
+    std::condition_variable spaceAvailable_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Admin
+} // namespace StudentIntake
+
+#endif // COHORT_EXPORT_RESOURCE_H
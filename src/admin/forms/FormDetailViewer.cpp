@@ -1,5 +1,6 @@
 #include "FormDetailViewer.h"
 #include <Wt/WBreak.h>
+#include "api/SubmissionIndex.h"
 #include "utils/Logger.h"
 #include <algorithm>
 #include <chrono>
@@ -575,6 +576,8 @@ void FormDetailViewer::handleApprove() {
     if (success) {
         updateStatusDisplay("approved");
         reviewedByText_->setText("Admin");
+        Api::SubmissionIndex::getInstance().updateStatus(
+            currentSubmissionId_, "approved", getCurrentIsoTimestamp(), "Admin");
         reviewedAtText_->setText(formatDate(getCurrentIsoTimestamp()));
     }
     approveClicked_.emit(currentSubmissionId_);
@@ -617,6 +620,8 @@ void FormDetailViewer::handleReject() {
     if (success) {
         updateStatusDisplay("rejected");
         reviewedByText_->setText("Admin");
+        Api::SubmissionIndex::getInstance().updateStatus(
+            currentSubmissionId_, "rejected", getCurrentIsoTimestamp(), "Admin");
         reviewedAtText_->setText(formatDate(getCurrentIsoTimestamp()));
     }
     rejectClicked_.emit(currentSubmissionId_);
@@ -659,6 +664,8 @@ void FormDetailViewer::handleRequestRevision() {
     if (success) {
         updateStatusDisplay("needs_revision");
         reviewedByText_->setText("Admin");
+        Api::SubmissionIndex::getInstance().updateStatus(
+            currentSubmissionId_, "needs_revision", getCurrentIsoTimestamp(), "Admin");
         reviewedAtText_->setText(formatDate(getCurrentIsoTimestamp()));
     }
     requestRevisionClicked_.emit(currentSubmissionId_);
@@ -2,6 +2,8 @@
 #include <Wt/WBreak.h>
 #include <Wt/WImage.h>
 #include <Wt/WApplication.h>
+#include "api/PdfCache.h"
+#include "api/SubmissionIndex.h"
 #include "utils/Logger.h"
 #include <sstream>
 #include <iomanip>
@@ -13,10 +15,37 @@
 namespace StudentIntake {
 namespace Admin {
 
+namespace {
+
+struct FormTitles {
+    std::string document;   // heading on the page
+    std::string window;     // dialog title
+};
+
+FormTitles formTitles(const std::string& formType) {
+    static const std::map<std::string, std::string> windowTitles = {
+        {"personal_info", "Personal Information"},
+        {"emergency_contact", "Emergency Contact"},
+        {"medical_info", "Medical Information"},
+        {"academic_history", "Academic History"},
+        {"financial_aid", "Financial Aid"},
+        {"documents", "Document Upload"},
+        {"consent", "Consent"}
+    };
+    auto it = windowTitles.find(formType);
+    return {Api::StudentDossierLoader::formTitle(formType),
+            it != windowTitles.end() ? it->second : "Form Preview"};
+}
+
+} // namespace
+
 FormPdfPreviewWidget::FormPdfPreviewWidget()
     : WDialog("Form Preview")
     , apiService_(nullptr)
     , pdfGenerator_(std::make_unique<Api::PdfGenerator>())
+    , pdfResource_(std::make_shared<PdfDocumentResource>())
+    , studentId_(0)
+    , submissionId_(0)
     , toolbar_(nullptr)
     , printBtn_(nullptr)
     , downloadBtn_(nullptr)
@@ -67,15 +96,10 @@ void FormPdfPreviewWidget::setupUI() {
     printBtn_->addStyleClass("btn btn-primary");
     printBtn_->clicked().connect([this]() {
         if (Api::PdfGenerator::isAvailable()) {
-            // Generate PDF and open in new tab for printing
-            std::string pdfPath = generatePdf();
-            if (!pdfPath.empty()) {
-                // Create a file resource and store as member to keep it alive
-                auto app = Wt::WApplication::instance();
-                pdfResource_ = std::make_shared<Wt::WFileResource>("application/pdf", pdfPath);
-                pdfResource_->suggestFileName(formTitle_ + ".pdf");
-                // Open in new tab for printing
-                app->doJavaScript(
+            // Render the PDF in memory and open it inline in a new tab for printing
+            if (generatePdf()) {
+                pdfResource_->suggestFileName(formTitle_ + ".pdf", Wt::ContentDisposition::Inline);
+                Wt::WApplication::instance()->doJavaScript(
                     "window.open('" + pdfResource_->url() + "', '_blank');"
                 );
             }
@@ -144,6 +168,9 @@ void FormPdfPreviewWidget::setFormData(const std::string& formType,
     studentEmail_ = studentEmail;
     submissionDate_ = submissionDate;
     fields_ = fields;
+    pdfForms_.clear();
+    studentId_ = 0;
+    submissionId_ = 0;
 
     buildPreview();
 }
@@ -173,727 +200,75 @@ void FormPdfPreviewWidget::loadFormSubmissionData(int submissionId) {
     LOG_DEBUG("FormPdfPreviewWidget", "Loading form submission: " << submissionId);
 
     try {
-        // Load the form submission
-        auto response = apiService_->getApiClient()->get("/FormSubmission/" + std::to_string(submissionId));
-        if (response.success) {
+        // The review queue index usually knows the student; otherwise ask the backend
+        int studentId = 0;
+        Api::SubmissionView indexed;
+        if (Api::SubmissionIndex::getInstance().getSubmission(submissionId, indexed)) {
+            studentId = indexed.studentId;
+        } else {
+            auto response = apiService_->getApiClient()->get("/FormSubmission/" + std::to_string(submissionId));
+            if (!response.success) {
+                LOG_ERROR("FormPdfPreviewWidget", "Failed to load form submission: " << response.errorMessage);
+                return;
+            }
             auto json = nlohmann::json::parse(response.body);
-
-            // Handle JSON:API format
             nlohmann::json data = json.contains("data") ? json["data"] : json;
             nlohmann::json attrs = data.contains("attributes") ? data["attributes"] : data;
+            studentId = attrs.value("student_id", 0);
+        }
 
-            int studentId = attrs.value("student_id", 0);
-            int formTypeId = attrs.value("form_type_id", 0);
-            std::string status = attrs.value("status", "pending");
-            std::string submittedAt = attrs.value("submitted_at", "");
-
-            LOG_DEBUG("FormPdfPreviewWidget", "Submission " << submissionId
-                      << " - student_id: " << studentId
-                      << ", form_type_id: " << formTypeId
-                      << ", status: " << status);
-
-            // Map form_type_id to form type name and display title
-            // Each entry: {form_type_key, {document_title, window_title}}
-            std::map<int, std::tuple<std::string, std::string, std::string>> formTypeMap = {
-                {1, {"personal_info", "Personal Information Form", "Personal Information"}},
-                {2, {"emergency_contact", "Emergency Contact Form", "Emergency Contact"}},
-                {3, {"medical_info", "Medical Information Form", "Medical Information"}},
-                {4, {"academic_history", "Academic History Form", "Academic History"}},
-                {5, {"financial_aid", "Financial Aid Form", "Financial Aid"}},
-                {6, {"documents", "Document Upload Form", "Document Upload"}},
-                {7, {"consent", "Consent Form", "Consent"}}
-            };
-
-            auto formIt = formTypeMap.find(formTypeId);
-            std::string formType = formIt != formTypeMap.end() ? std::get<0>(formIt->second) : "unknown";
-            std::string formTitle = formIt != formTypeMap.end() ? std::get<1>(formIt->second) : "Form";
-            std::string windowTitle = formIt != formTypeMap.end() ? std::get<2>(formIt->second) : "Form Preview";
-
-            // Set the window title to the form name with icon
-            setWindowTitle("📋 " + windowTitle);
-
-            LOG_DEBUG("FormPdfPreviewWidget", "Form type: " << formType << ", title: " << formTitle);
-
-            // Load student data
-            std::string studentName = "Unknown Student";
-            std::string studentEmail = "";
-
-            auto studentResponse = apiService_->getApiClient()->get("/Student/" + std::to_string(studentId));
-            if (studentResponse.success) {
-                auto studentJson = nlohmann::json::parse(studentResponse.body);
-                nlohmann::json studentData = studentJson.contains("data") ? studentJson["data"] : studentJson;
-                nlohmann::json studentAttrs = studentData.contains("attributes") ? studentData["attributes"] : studentData;
-
-                std::string firstName = studentAttrs.value("first_name", "");
-                std::string lastName = studentAttrs.value("last_name", "");
-                studentName = firstName + " " + lastName;
-                studentEmail = studentAttrs.value("email", "");
-            }
-
-            // Build form fields based on form type
-            std::vector<FormFieldData> fields;
-
-            // Load form-specific data based on formType
-            if (formType == "personal_info") {
-                // Load from Student table
-                auto personalResponse = apiService_->getApiClient()->get("/Student/" + std::to_string(studentId));
-                if (personalResponse.success) {
-                    auto pJson = nlohmann::json::parse(personalResponse.body);
-                    nlohmann::json pData = pJson.contains("data") ? pJson["data"] : pJson;
-                    nlohmann::json pAttrs = pData.contains("attributes") ? pData["attributes"] : pData;
-
-                    fields.push_back({"First Name", pAttrs.value("first_name", ""), "text"});
-                    fields.push_back({"Last Name", pAttrs.value("last_name", ""), "text"});
-                    fields.push_back({"Email", pAttrs.value("email", ""), "email"});
-                    fields.push_back({"Phone", pAttrs.value("phone_number", ""), "phone"});
-                    fields.push_back({"Date of Birth", pAttrs.value("date_of_birth", ""), "date"});
-                    fields.push_back({"Gender", pAttrs.value("gender", ""), "text"});
-                    fields.push_back({"Preferred Pronouns", pAttrs.value("preferred_pronouns", ""), "text"});
-                    fields.push_back({"Citizenship Status", pAttrs.value("citizenship_status", ""), "text"});
-                }
-            } else if (formType == "emergency_contact") {
-                std::string ecUrl = "/EmergencyContact?filter[student_id]=" + std::to_string(studentId);
-                LOG_DEBUG("FormPdfPreviewWidget", "Loading emergency contacts from: " << ecUrl);
-                auto ecResponse = apiService_->getApiClient()->get(ecUrl);
-                LOG_DEBUG("FormPdfPreviewWidget", "EC response success: " << ecResponse.success
-                          << ", status: " << ecResponse.statusCode
-                          << ", body length: " << ecResponse.body.length());
-                if (ecResponse.success && !ecResponse.body.empty()) {
-                    LOG_DEBUG("FormPdfPreviewWidget", "EC response body: " << ecResponse.body.substr(0, 500));
-                    auto ecJson = nlohmann::json::parse(ecResponse.body);
-
-                    // Handle different JSON response formats
-                    nlohmann::json ecItems = nlohmann::json::array();
-                    if (ecJson.is_array()) {
-                        ecItems = ecJson;
-                    } else if (ecJson.contains("data")) {
-                        if (ecJson["data"].is_array()) {
-                            ecItems = ecJson["data"];
-                        } else if (ecJson["data"].is_object()) {
-                            // Single object - wrap in array
-                            ecItems.push_back(ecJson["data"]);
-                        }
-                    }
-                    LOG_DEBUG("FormPdfPreviewWidget", "Found " << ecItems.size() << " emergency contacts");
-
-                    int contactNum = 1;
-                    for (const auto& ec : ecItems) {
-                        nlohmann::json ecAttrs = ec.contains("attributes") ? ec["attributes"] : ec;
-
-                        // Helper lambda to safely get string from JSON (handles null values)
-                        auto safeGetString = [&ecAttrs](const std::string& key) -> std::string {
-                            if (ecAttrs.contains(key) && !ecAttrs[key].is_null()) {
-                                if (ecAttrs[key].is_string()) {
-                                    return ecAttrs[key].get<std::string>();
-                                } else if (ecAttrs[key].is_number()) {
-                                    return std::to_string(ecAttrs[key].get<int>());
-                                }
-                            }
-                            return "";
-                        };
-
-                        // Determine contact label
-                        std::string contactLabel;
-                        bool isPrimary = ecAttrs.contains("is_primary") && !ecAttrs["is_primary"].is_null() && ecAttrs["is_primary"].get<bool>();
-                        int priority = ecAttrs.contains("priority") && !ecAttrs["priority"].is_null() && ecAttrs["priority"].is_number() ? ecAttrs["priority"].get<int>() : 0;
-
-                        if (isPrimary || priority == 1) {
-                            contactLabel = "Primary Contact";
-                        } else if (priority == 2) {
-                            contactLabel = "Secondary Contact";
-                        } else {
-                            contactLabel = "Contact #" + std::to_string(contactNum);
-                        }
-
-                        if (contactNum > 1) {
-                            fields.push_back({"", "", "text"});
-                        }
-                        fields.push_back({contactLabel, "", "header"});
-
-                        std::string firstName = safeGetString("first_name");
-                        std::string lastName = safeGetString("last_name");
-                        std::string fullName = firstName;
-                        if (!lastName.empty()) {
-                            fullName += (fullName.empty() ? "" : " ") + lastName;
-                        }
-                        if (!fullName.empty()) {
-                            fields.push_back({"Name", fullName, "text"});
-                        }
-
-                        std::string relationship = safeGetString("contact_relationship");
-                        if (!relationship.empty()) {
-                            fields.push_back({"Relationship", relationship, "text"});
-                        }
-
-                        std::string phone = safeGetString("phone");
-                        if (!phone.empty()) {
-                            fields.push_back({"Phone", phone, "phone"});
-                        }
-
-                        std::string altPhone = safeGetString("alternate_phone");
-                        if (!altPhone.empty()) {
-                            fields.push_back({"Alternate Phone", altPhone, "phone"});
-                        }
-
-                        std::string email = safeGetString("email");
-                        if (!email.empty()) {
-                            fields.push_back({"Email", email, "email"});
-                        }
-
-                        // Build address
-                        std::string street1 = safeGetString("street1");
-                        std::string street2 = safeGetString("street2");
-                        std::string city = safeGetString("city");
-                        std::string state = safeGetString("state");
-                        std::string postalCode = safeGetString("postal_code");
-                        std::string country = safeGetString("country");
-
-                        if (!street1.empty()) {
-                            std::string fullAddress = street1;
-                            if (!street2.empty()) fullAddress += ", " + street2;
-                            fields.push_back({"Street Address", fullAddress, "text"});
-                        }
-                        if (!city.empty() || !state.empty() || !postalCode.empty()) {
-                            std::string cityStateZip = city;
-                            if (!state.empty()) cityStateZip += (!cityStateZip.empty() ? ", " : "") + state;
-                            if (!postalCode.empty()) cityStateZip += " " + postalCode;
-                            fields.push_back({"City, State, Zip", cityStateZip, "text"});
-                        }
-                        if (!country.empty() && country != "USA" && country != "US" && country != "United States") {
-                            fields.push_back({"Country", country, "text"});
-                        }
-
-                        contactNum++;
-                    }
-
-                    if (ecItems.empty()) {
-                        fields.push_back({"No Emergency Contacts", "No emergency contacts have been added yet.", "text"});
-                    }
-                } else {
-                    LOG_DEBUG("FormPdfPreviewWidget", "EC: No emergency contacts found in response");
-                    fields.push_back({"No Emergency Contacts", "No emergency contacts have been added yet.", "text"});
-                }
-            } else if (formType == "academic_history") {
-                std::string ahUrl = "/AcademicHistory?filter[student_id]=" + std::to_string(studentId);
-                LOG_DEBUG("FormPdfPreviewWidget", "Loading academic history from: " << ahUrl);
-                auto ahResponse = apiService_->getApiClient()->get(ahUrl);
-                LOG_DEBUG("FormPdfPreviewWidget", "AH response success: " << ahResponse.success
-                          << ", status: " << ahResponse.statusCode);
-                if (ahResponse.success && !ahResponse.body.empty()) {
-                    LOG_DEBUG("FormPdfPreviewWidget", "AH response body: " << ahResponse.body.substr(0, 500));
-                    auto ahJson = nlohmann::json::parse(ahResponse.body);
-
-                    // Handle different JSON response formats
-                    nlohmann::json ahItems = nlohmann::json::array();
-                    if (ahJson.is_array()) {
-                        ahItems = ahJson;
-                    } else if (ahJson.contains("data")) {
-                        if (ahJson["data"].is_array()) {
-                            ahItems = ahJson["data"];
-                        } else if (ahJson["data"].is_object()) {
-                            ahItems.push_back(ahJson["data"]);
-                        }
-                    }
-                    LOG_DEBUG("FormPdfPreviewWidget", "Found " << ahItems.size() << " academic history records");
-
-                    // Group by institution type
-                    std::vector<std::string> institutionTypes = {"High School", "College", "University", "Trade School"};
-                    std::map<std::string, std::vector<nlohmann::json>> groupedRecords;
-
-                    for (const auto& ah : ahItems) {
-                        nlohmann::json ahAttrs = ah.contains("attributes") ? ah["attributes"] : ah;
-                        std::string instType = ahAttrs.value("institution_type", "Other");
-                        groupedRecords[instType].push_back(ahAttrs);
-                    }
-
-                    bool firstGroup = true;
-                    for (const auto& instType : institutionTypes) {
-                        if (groupedRecords.find(instType) != groupedRecords.end()) {
-                            if (!firstGroup) {
-                                fields.push_back({"", "", "text"}); // Separator
-                            }
-                            fields.push_back({instType + " Education", "", "header"});
-                            firstGroup = false;
-
-                            int recordNum = 1;
-                            for (const auto& ahAttrs : groupedRecords[instType]) {
-                                if (recordNum > 1) {
-                                    fields.push_back({"", "", "text"});
-                                }
-
-                                fields.push_back({"Institution Name", ahAttrs.value("institution_name", ""), "text"});
-
-                                // Location
-                                std::string city = ahAttrs.value("institution_city", "");
-                                std::string state = ahAttrs.value("institution_state", "");
-                                std::string country = ahAttrs.value("institution_country", "");
-                                std::string location;
-                                if (!city.empty()) location = city;
-                                if (!state.empty()) location += (!location.empty() ? ", " : "") + state;
-                                if (!country.empty() && country != "USA" && country != "US" && country != "United States") {
-                                    location += (!location.empty() ? ", " : "") + country;
-                                }
-                                if (!location.empty()) {
-                                    fields.push_back({"Location", location, "text"});
-                                }
-
-                                // Degree and major/minor
-                                std::string degree = ahAttrs.value("degree_earned", "");
-                                if (!degree.empty()) {
-                                    fields.push_back({"Degree Earned", degree, "text"});
-                                }
-                                std::string major = ahAttrs.value("major", "");
-                                if (!major.empty()) {
-                                    fields.push_back({"Major", major, "text"});
-                                }
-                                std::string minor = ahAttrs.value("minor", "");
-                                if (!minor.empty()) {
-                                    fields.push_back({"Minor", minor, "text"});
-                                }
-
-                                // GPA
-                                if (ahAttrs.contains("gpa") && !ahAttrs["gpa"].is_null()) {
-                                    double gpa = ahAttrs.value("gpa", 0.0);
-                                    double gpaScale = ahAttrs.value("gpa_scale", 4.0);
-                                    std::ostringstream gpaStr;
-                                    gpaStr << std::fixed << std::setprecision(2) << gpa << " / " << gpaScale;
-                                    fields.push_back({"GPA", gpaStr.str(), "text"});
-                                }
-
-                                // Dates
-                                std::string startDate = ahAttrs.value("start_date", "");
-                                std::string endDate = ahAttrs.value("end_date", "");
-                                bool currentlyAttending = ahAttrs.value("is_currently_attending", false);
-
-                                if (!startDate.empty() || !endDate.empty()) {
-                                    std::string dateRange = formatDate(startDate) + " - ";
-                                    if (currentlyAttending) {
-                                        dateRange += "Present";
-                                    } else if (!endDate.empty()) {
-                                        dateRange += formatDate(endDate);
-                                    }
-                                    fields.push_back({"Attendance Period", dateRange, "text"});
-                                }
-
-                                std::string gradDate = ahAttrs.value("graduation_date", "");
-                                if (!gradDate.empty()) {
-                                    fields.push_back({"Graduation Date", gradDate, "date"});
-                                }
-
-                                // Transcript status
-                                bool transcriptReceived = ahAttrs.value("transcript_received", false);
-                                fields.push_back({"Transcript Received", transcriptReceived ? "Yes" : "No", "text"});
-
-                                recordNum++;
-                            }
-                        }
-                    }
-
-                    // Handle any "Other" types not in the standard list
-                    for (const auto& pair : groupedRecords) {
-                        if (std::find(institutionTypes.begin(), institutionTypes.end(), pair.first) == institutionTypes.end()) {
-                            if (!firstGroup) {
-                                fields.push_back({"", "", "text"});
-                            }
-                            fields.push_back({pair.first + " Education", "", "header"});
-                            firstGroup = false;
-
-                            for (const auto& ahAttrs : pair.second) {
-                                fields.push_back({"Institution Name", ahAttrs.value("institution_name", ""), "text"});
-                                fields.push_back({"Degree Earned", ahAttrs.value("degree_earned", ""), "text"});
-                                fields.push_back({"Graduation Date", ahAttrs.value("graduation_date", ""), "date"});
-                            }
-                        }
-                    }
-                }
-            } else if (formType == "medical_info") {
-                std::string medUrl = "/MedicalInfo?filter[student_id]=" + std::to_string(studentId);
-                LOG_DEBUG("FormPdfPreviewWidget", "Loading medical info from: " << medUrl);
-                auto medResponse = apiService_->getApiClient()->get(medUrl);
-                LOG_DEBUG("FormPdfPreviewWidget", "Med response success: " << medResponse.success
-                          << ", status: " << medResponse.statusCode);
-                if (medResponse.success && !medResponse.body.empty()) {
-                    LOG_DEBUG("FormPdfPreviewWidget", "Med response body: " << medResponse.body.substr(0, 500));
-                    auto medJson = nlohmann::json::parse(medResponse.body);
-
-                    // Handle different JSON response formats
-                    nlohmann::json medItems = nlohmann::json::array();
-                    if (medJson.is_array()) {
-                        medItems = medJson;
-                    } else if (medJson.contains("data")) {
-                        if (medJson["data"].is_array()) {
-                            medItems = medJson["data"];
-                        } else if (medJson["data"].is_object()) {
-                            medItems.push_back(medJson["data"]);
-                        }
-                    }
-                    LOG_DEBUG("FormPdfPreviewWidget", "Found " << medItems.size() << " medical info records");
-                    if (!medItems.empty()) {
-                        nlohmann::json med = medItems[0];
-                        nlohmann::json medAttrs = med.contains("attributes") ? med["attributes"] : med;
-
-                        // Basic medical info
-                        fields.push_back({"Medical Information", "", "header"});
-                        fields.push_back({"Blood Type", medAttrs.value("blood_type", ""), "text"});
-
-                        // Allergies
-                        bool hasAllergies = medAttrs.value("has_allergies", false);
-                        fields.push_back({"Has Allergies", hasAllergies ? "Yes" : "No", "text"});
-                        if (hasAllergies) {
-                            fields.push_back({"Allergies", medAttrs.value("allergies", ""), "text"});
-                        }
-
-                        // Medications
-                        bool hasMedications = medAttrs.value("has_medications", false);
-                        fields.push_back({"Currently on Medications", hasMedications ? "Yes" : "No", "text"});
-                        if (hasMedications) {
-                            fields.push_back({"Medications", medAttrs.value("medications", ""), "text"});
-                        }
-
-                        // Chronic conditions
-                        bool hasChronicConditions = medAttrs.value("has_chronic_conditions", false);
-                        fields.push_back({"Has Chronic Conditions", hasChronicConditions ? "Yes" : "No", "text"});
-                        if (hasChronicConditions) {
-                            fields.push_back({"Chronic Conditions", medAttrs.value("chronic_conditions", ""), "text"});
-                        }
-
-                        // Disabilities
-                        bool hasDisabilities = medAttrs.value("has_disabilities", false);
-                        fields.push_back({"Has Disabilities", hasDisabilities ? "Yes" : "No", "text"});
-                        if (hasDisabilities) {
-                            fields.push_back({"Disabilities", medAttrs.value("disabilities", ""), "text"});
-                        }
-
-                        // Accommodations
-                        bool requiresAccommodations = medAttrs.value("requires_accommodations", false);
-                        fields.push_back({"Requires Accommodations", requiresAccommodations ? "Yes" : "No", "text"});
-                        if (requiresAccommodations) {
-                            fields.push_back({"Accommodations Needed", medAttrs.value("accommodations_needed", ""), "text"});
-                        }
-
-                        // Immunizations
-                        bool immunizationsUpToDate = medAttrs.value("immunizations_up_to_date", false);
-                        fields.push_back({"Immunizations Up To Date", immunizationsUpToDate ? "Yes" : "No", "text"});
-
-                        // Insurance information
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Insurance Information", "", "header"});
-                        fields.push_back({"Insurance Provider", medAttrs.value("insurance_provider", ""), "text"});
-                        fields.push_back({"Policy Number", medAttrs.value("insurance_policy_number", ""), "text"});
-                        fields.push_back({"Group Number", medAttrs.value("insurance_group_number", ""), "text"});
-                        fields.push_back({"Insurance Phone", medAttrs.value("insurance_phone", ""), "phone"});
-
-                        // Physician info
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Primary Care Physician", "", "header"});
-                        fields.push_back({"Physician Name", medAttrs.value("primary_physician", ""), "text"});
-                        fields.push_back({"Physician Phone", medAttrs.value("physician_phone", ""), "phone"});
-                    }
-                }
-            } else if (formType == "financial_aid") {
-                std::string faUrl = "/FinancialAid?filter[student_id]=" + std::to_string(studentId);
-                LOG_DEBUG("FormPdfPreviewWidget", "Loading financial aid from: " << faUrl);
-                auto faResponse = apiService_->getApiClient()->get(faUrl);
-                LOG_DEBUG("FormPdfPreviewWidget", "FA response success: " << faResponse.success
-                          << ", status: " << faResponse.statusCode);
-                if (faResponse.success && !faResponse.body.empty()) {
-                    LOG_DEBUG("FormPdfPreviewWidget", "FA response body: " << faResponse.body.substr(0, 500));
-                    auto faJson = nlohmann::json::parse(faResponse.body);
-
-                    // Handle different JSON response formats
-                    nlohmann::json faItems = nlohmann::json::array();
-                    if (faJson.is_array()) {
-                        faItems = faJson;
-                    } else if (faJson.contains("data")) {
-                        if (faJson["data"].is_array()) {
-                            faItems = faJson["data"];
-                        } else if (faJson["data"].is_object()) {
-                            faItems.push_back(faJson["data"]);
-                        }
-                    }
-                    LOG_DEBUG("FormPdfPreviewWidget", "Found " << faItems.size() << " financial aid records");
-                    if (!faItems.empty()) {
-                        nlohmann::json fa = faItems[0];
-                        nlohmann::json faAttrs = fa.contains("attributes") ? fa["attributes"] : fa;
-
-                        // Helper lambdas for safe JSON access
-                        auto safeGetString = [&faAttrs](const std::string& key) -> std::string {
-                            if (faAttrs.contains(key) && faAttrs[key].is_string()) {
-                                return faAttrs[key].get<std::string>();
-                            }
-                            return "";
-                        };
-                        auto safeGetBool = [&faAttrs](const std::string& key, bool defaultVal = false) -> bool {
-                            if (faAttrs.contains(key) && faAttrs[key].is_boolean()) {
-                                return faAttrs[key].get<bool>();
-                            }
-                            return defaultVal;
-                        };
-
-                        // General Information
-                        fields.push_back({"General Information", "", "header"});
-                        fields.push_back({"Applying for Financial Aid", safeGetBool("applying_for_aid", true) ? "Yes" : "No", "text"});
-
-                        // FAFSA Information
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"FAFSA Information", "", "header"});
-                        fields.push_back({"FAFSA Completed", safeGetBool("fafsa_completed") ? "Yes" : "No", "text"});
-                        if (faAttrs.contains("efc") && !faAttrs["efc"].is_null()) {
-                            std::ostringstream efcStr;
-                            efcStr << std::fixed << std::setprecision(2) << faAttrs.value("efc", 0.0);
-                            fields.push_back({"Student Aid Index (SAI/EFC)", efcStr.str(), "text"});
-                        }
-
-                        // Employment Information
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Employment Information", "", "header"});
-                        std::string empStatus = safeGetString("employment_status");
-                        fields.push_back({"Employment Status", empStatus.empty() ? "Not specified" : empStatus, "text"});
-                        std::string employer = safeGetString("employer_name");
-                        if (!employer.empty()) {
-                            fields.push_back({"Employer Name", employer, "text"});
-                        }
-
-                        // Household Information
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Household Information", "", "header"});
-                        std::string incomeRange = safeGetString("household_income_range");
-                        fields.push_back({"Household Income Range", incomeRange.empty() ? "Not specified" : incomeRange, "text"});
-                        if (faAttrs.contains("dependents_count") && !faAttrs["dependents_count"].is_null()) {
-                            fields.push_back({"Number of Dependents", std::to_string(faAttrs.value("dependents_count", 0)), "text"});
-                        }
-                        fields.push_back({"Veteran Benefits Eligible", safeGetBool("veteran_benefits") ? "Yes" : "No", "text"});
-
-                        // Aid Types Interested In
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Types of Aid Interested In", "", "header"});
-                        fields.push_back({"Scholarships and Grants", safeGetBool("scholarship_interest") ? "Yes" : "No", "text"});
-                        fields.push_back({"Federal Work-Study", safeGetBool("work_study_interest") ? "Yes" : "No", "text"});
-                        fields.push_back({"Student Loans", safeGetBool("loan_interest") ? "Yes" : "No", "text"});
-
-                        // Current Scholarships
-                        std::string scholarships = safeGetString("scholarship_applications");
-                        if (!scholarships.empty()) {
-                            fields.push_back({"", "", "text"});
-                            fields.push_back({"Current Scholarships", "", "header"});
-                            fields.push_back({"Scholarships", scholarships, "text"});
-                        }
-
-                        // Special Circumstances
-                        std::string specialCirc = safeGetString("special_circumstances");
-                        if (!specialCirc.empty()) {
-                            fields.push_back({"", "", "text"});
-                            fields.push_back({"Special Circumstances", "", "header"});
-                            fields.push_back({"Details", specialCirc, "text"});
-                        }
-                    } else {
-                        fields.push_back({"No Financial Aid Data", "No financial aid information has been submitted.", "text"});
-                    }
-                } else {
-                    fields.push_back({"No Financial Aid Data", "No financial aid information has been submitted.", "text"});
-                }
-            } else if (formType == "documents") {
-                std::string docUrl = "/Document?filter[student_id]=" + std::to_string(studentId);
-                LOG_DEBUG("FormPdfPreviewWidget", "Loading documents from: " << docUrl);
-                auto docResponse = apiService_->getApiClient()->get(docUrl);
-                LOG_DEBUG("FormPdfPreviewWidget", "Doc response success: " << docResponse.success
-                          << ", status: " << docResponse.statusCode);
-                if (docResponse.success && !docResponse.body.empty()) {
-                    LOG_DEBUG("FormPdfPreviewWidget", "Doc response body: " << docResponse.body.substr(0, 500));
-                    auto docJson = nlohmann::json::parse(docResponse.body);
-
-                    // Handle different JSON response formats
-                    nlohmann::json docItems = nlohmann::json::array();
-                    if (docJson.is_array()) {
-                        docItems = docJson;
-                    } else if (docJson.contains("data")) {
-                        if (docJson["data"].is_array()) {
-                            docItems = docJson["data"];
-                        } else if (docJson["data"].is_object()) {
-                            docItems.push_back(docJson["data"]);
-                        }
-                    }
-                    LOG_DEBUG("FormPdfPreviewWidget", "Found " << docItems.size() << " document records");
-
-                    if (!docItems.empty()) {
-                        int docNum = 1;
-                        for (const auto& doc : docItems) {
-                            nlohmann::json docAttrs = doc.contains("attributes") ? doc["attributes"] : doc;
-
-                            // Helper lambda to safely get string from JSON (handles null values)
-                            auto safeGetString = [&docAttrs](const std::string& key) -> std::string {
-                                if (docAttrs.contains(key) && docAttrs[key].is_string()) {
-                                    return docAttrs[key].get<std::string>();
-                                }
-                                return "";
-                            };
-
-                            if (docNum > 1) {
-                                fields.push_back({"", "", "text"});
-                            }
-                            fields.push_back({"Document #" + std::to_string(docNum), "", "header"});
-
-                            fields.push_back({"Document Type", safeGetString("document_type"), "text"});
-                            fields.push_back({"File Name", safeGetString("file_name"), "text"});
-
-                            // File size in KB/MB
-                            int fileSize = docAttrs.contains("file_size") && docAttrs["file_size"].is_number() ?
-                                docAttrs["file_size"].get<int>() : 0;
-                            std::string sizeStr;
-                            if (fileSize >= 1048576) {
-                                std::ostringstream ss;
-                                ss << std::fixed << std::setprecision(2) << (fileSize / 1048576.0) << " MB";
-                                sizeStr = ss.str();
-                            } else if (fileSize >= 1024) {
-                                std::ostringstream ss;
-                                ss << std::fixed << std::setprecision(1) << (fileSize / 1024.0) << " KB";
-                                sizeStr = ss.str();
-                            } else {
-                                sizeStr = std::to_string(fileSize) + " bytes";
-                            }
-                            fields.push_back({"File Size", sizeStr, "text"});
-
-                            fields.push_back({"Status", safeGetString("status"), "text"});
-
-                            std::string verifiedAt = safeGetString("verified_at");
-                            if (!verifiedAt.empty()) {
-                                fields.push_back({"Verified On", verifiedAt, "date"});
-                                fields.push_back({"Verified By", safeGetString("verified_by"), "text"});
-                            }
-
-                            std::string notes = safeGetString("notes");
-                            if (!notes.empty()) {
-                                fields.push_back({"Notes", notes, "text"});
-                            }
-
-                            docNum++;
-                        }
-                    } else {
-                        fields.push_back({"No Documents", "No documents uploaded yet", "text"});
-                    }
-                }
-            } else if (formType == "consent") {
-                std::string consentUrl = "/Consent?filter[student_id]=" + std::to_string(studentId);
-                LOG_DEBUG("FormPdfPreviewWidget", "Loading consent from: " << consentUrl);
-                auto cResponse = apiService_->getApiClient()->get(consentUrl);
-                LOG_DEBUG("FormPdfPreviewWidget", "Consent response success: " << cResponse.success
-                          << ", status: " << cResponse.statusCode);
-                if (cResponse.success && !cResponse.body.empty()) {
-                    LOG_DEBUG("FormPdfPreviewWidget", "Consent response body: " << cResponse.body.substr(0, 500));
-                    auto cJson = nlohmann::json::parse(cResponse.body);
-
-                    // Handle different JSON response formats
-                    nlohmann::json cItems = nlohmann::json::array();
-                    if (cJson.is_array()) {
-                        cItems = cJson;
-                    } else if (cJson.contains("data")) {
-                        if (cJson["data"].is_array()) {
-                            cItems = cJson["data"];
-                        } else if (cJson["data"].is_object()) {
-                            cItems.push_back(cJson["data"]);
-                        }
-                    }
-                    LOG_DEBUG("FormPdfPreviewWidget", "Found " << cItems.size() << " consent records");
-
-                    // Build a map of consent_type -> is_accepted and extract signature
-                    std::map<std::string, bool> consentMap;
-                    std::string signature;
-                    std::string signatureDate;
-
-                    for (const auto& c : cItems) {
-                        nlohmann::json cAttrs = c.contains("attributes") ? c["attributes"] : c;
-
-                        std::string consentType;
-                        if (cAttrs.contains("consent_type") && cAttrs["consent_type"].is_string()) {
-                            consentType = cAttrs["consent_type"].get<std::string>();
-                        }
-
-                        bool isAccepted = cAttrs.contains("is_accepted") && !cAttrs["is_accepted"].is_null() ?
-                            cAttrs.value("is_accepted", false) : false;
-
-                        if (consentType == "student_signature") {
-                            // Extract signature data
-                            if (cAttrs.contains("electronic_signature") && cAttrs["electronic_signature"].is_string()) {
-                                signature = cAttrs["electronic_signature"].get<std::string>();
-                            }
-                            if (cAttrs.contains("signature_date") && cAttrs["signature_date"].is_string()) {
-                                signatureDate = cAttrs["signature_date"].get<std::string>();
-                            }
-                        } else if (!consentType.empty()) {
-                            consentMap[consentType] = isAccepted;
-                        }
-                    }
-
-                    // Define consent items with titles and descriptions (matching student form)
-                    struct ConsentItemDef {
-                        std::string type;
-                        std::string title;
-                        std::string description;
-                    };
-
-                    std::vector<ConsentItemDef> consentDefs = {
-                        {"terms_of_service", "Terms of Service",
-                         "By enrolling, I agree to abide by all university policies, procedures, regulations, and applicable laws."},
-                        {"privacy_policy", "Privacy Policy",
-                         "My personal information will be collected, stored, and processed in accordance with the university's Privacy Policy."},
-                        {"ferpa_acknowledgment", "FERPA Rights",
-                         "I understand my rights under the Family Educational Rights and Privacy Act regarding my education records."},
-                        {"code_of_conduct", "Student Code of Conduct",
-                         "I will uphold academic integrity and ethical behavior standards, including refraining from cheating and plagiarism."},
-                        {"communication_consent", "Communication Consent",
-                         "I agree to receive email, SMS, and mail from the university regarding enrollment, academics, and campus events."},
-                        {"photo_release", "Photo/Media Release (Optional)",
-                         "I grant permission for photos and videos taken during university events to be used for promotional purposes."},
-                        {"accuracy_certification", "Accuracy Certification",
-                         "All information provided in this application is accurate and complete. I understand false information may result in disciplinary action."}
-                    };
-
-                    // Add consent acknowledgments section
-                    fields.push_back({"Consent Acknowledgments", "", "header"});
-
-                    for (const auto& def : consentDefs) {
-                        bool isChecked = consentMap.count(def.type) && consentMap[def.type];
-                        std::string checkbox = isChecked ? "☑" : "☐";
-                        std::string title = checkbox + " " + def.title;
-                        fields.push_back({title, def.description, "consent_item"});
-                    }
-
-                    // Add signature section at the bottom
-                    if (!signature.empty()) {
-                        fields.push_back({"", "", "text"});  // Spacer
-                        fields.push_back({"Electronic Signature", "", "header"});
-                        fields.push_back({"Signature", signature, "signature"});
-                        if (!signatureDate.empty()) {
-                            fields.push_back({"Date", signatureDate, "date"});
-                        }
-                    }
-                }
-            }
-
-            // If no fields were loaded, add a fallback message with student basic info
-            if (fields.empty()) {
-                LOG_WARN("FormPdfPreviewWidget", "No fields loaded for form type: " << formType);
-                fields.push_back({"Student Information", "", "header"});
-                fields.push_back({"Student Name", studentName, "text"});
-                fields.push_back({"Email", studentEmail, "text"});
-                fields.push_back({"", "", "text"});
-                fields.push_back({"Form Status", "", "header"});
-                fields.push_back({"Data Status", "No detailed data has been entered for this form yet", "text"});
-                fields.push_back({"Submission Status", status, "text"});
-            }
-
-            // Set the form data and build preview
-            LOG_DEBUG("FormPdfPreviewWidget", "Setting form data - fields count: " << fields.size());
-            setFormData(formType, formTitle, studentName, studentEmail, submittedAt, fields);
+        Api::StudentDossier dossier = Api::StudentDossierLoader(apiService_->getApiClient()).load(studentId);
+        const Api::DossierSubmission* submission = dossier.findSubmission(submissionId);
+        if (!submission) {
+            LOG_ERROR("FormPdfPreviewWidget", "Submission " << submissionId
+                      << " not found for student " << studentId);
+            return;
+        }
 
-        } else {
-            LOG_ERROR("FormPdfPreviewWidget", "Failed to load form submission: " << response.errorMessage);
+        LOG_DEBUG("FormPdfPreviewWidget", "Submission " << submissionId
+                  << " - student_id: " << studentId
+                  << ", form type: " << submission->formType
+                  << ", status: " << submission->status);
+
+        FormTitles titles = formTitles(submission->formType);
+        setWindowTitle("📋 " + titles.window);
+
+        std::string studentName = dossier.studentName();
+        std::string studentEmail = dossier.studentEmail();
+        std::vector<FormFieldData> fields = buildFormFields(dossier, submission->formType);
+
+        // If no fields were loaded, add a fallback message with student basic info
+        if (fields.empty()) {
+            LOG_WARN("FormPdfPreviewWidget", "No fields loaded for form type: " << submission->formType);
+            fields.push_back({"Student Information", "", "header"});
+            fields.push_back({"Student Name", studentName, "text"});
+            fields.push_back({"Email", studentEmail, "text"});
+            fields.push_back({"", "", "text"});
+            fields.push_back({"Form Status", "", "header"});
+            fields.push_back({"Data Status", "No detailed data has been entered for this form yet", "text"});
+            fields.push_back({"Submission Status", submission->status, "text"});
         }
+
+        // Set the form data and build preview
+        LOG_DEBUG("FormPdfPreviewWidget", "Setting form data - fields count: " << fields.size());
+        setFormData(submission->formType, titles.document, studentName, studentEmail,
+                    submission->submittedAt, fields);
+        studentId_ = studentId;
+        submissionId_ = submissionId;
     } catch (const std::exception& e) {
         LOG_ERROR("FormPdfPreviewWidget", "Error loading submission: " << e.what());
     }
 }
 
+std::vector<FormFieldData> FormPdfPreviewWidget::buildFormFields(const Api::StudentDossier& dossier,
+                                                                 const std::string& formType) {
+    std::vector<FormFieldData> fields;
+    for (const auto& field : dossier.formFields(formType)) {
+        fields.push_back({field.label, field.value, field.type});
+    }
+    return fields;
+}
+
 void FormPdfPreviewWidget::loadStudentFormsData(int studentId) {
     LOG_DEBUG("FormPdfPreviewWidget", "Loading all forms for student: " << studentId);
 
@@ -903,38 +278,23 @@ void FormPdfPreviewWidget::loadStudentFormsData(int studentId) {
     }
 
     clearPreview();
+    pdfForms_.clear();
+    studentId_ = studentId;
+    submissionId_ = 0;
 
     try {
-        // First, load student information
-        std::string studentName = "Unknown Student";
-        std::string studentEmail = "";
-
-        auto studentResponse = apiService_->getApiClient()->get("/Student/" + std::to_string(studentId));
-        if (studentResponse.success) {
-            auto studentJson = nlohmann::json::parse(studentResponse.body);
-            nlohmann::json studentData = studentJson.contains("data") ? studentJson["data"] : studentJson;
-            nlohmann::json studentAttrs = studentData.contains("attributes") ? studentData["attributes"] : studentData;
-
-            std::string firstName = studentAttrs.value("first_name", "");
-            std::string lastName = studentAttrs.value("last_name", "");
-            studentName = firstName + " " + lastName;
-            studentEmail = studentAttrs.value("email", "");
-        }
-
-        // Load all form submissions for this student
-        auto submissionsResponse = apiService_->getApiClient()->get(
-            "/FormSubmission?filter[student_id]=" + std::to_string(studentId));
-
-        if (!submissionsResponse.success) {
-            LOG_ERROR("FormPdfPreviewWidget", "Failed to load submissions for student");
-            return;
-        }
-
-        auto submissionsJson = nlohmann::json::parse(submissionsResponse.body);
-        nlohmann::json submissions = submissionsJson.is_array() ? submissionsJson :
-            (submissionsJson.contains("data") ? submissionsJson["data"] : nlohmann::json::array());
-
-        if (submissions.empty()) {
+        // One concurrent round of requests feeds both the preview and the PDF
+        Api::StudentDossier dossier = Api::StudentDossierLoader(apiService_->getApiClient()).load(studentId);
+        std::string studentName = dossier.studentName();
+
+        formType_.clear();
+        formTitle_ = "All Student Forms";
+        studentName_ = studentName;
+        studentEmail_ = dossier.studentEmail();
+        submissionDate_.clear();
+        fields_.clear();
+
+        if (dossier.submissions.empty()) {
             // No submissions found
             auto noDataMsg = documentContent_->addWidget(
                 std::make_unique<Wt::WText>("<p class='text-muted'>No form submissions found for this student.</p>"));
@@ -942,34 +302,18 @@ void FormPdfPreviewWidget::loadStudentFormsData(int studentId) {
             return;
         }
 
-        LOG_DEBUG("FormPdfPreviewWidget", "Found " << submissions.size() << " submissions");
-
-        // Form type mapping
-        std::map<int, std::pair<std::string, std::string>> formTypeMap = {
-            {1, {"personal_info", "Personal Information Form"}},
-            {2, {"emergency_contact", "Emergency Contact Form"}},
-            {3, {"medical_info", "Medical Information Form"}},
-            {4, {"academic_history", "Academic History Form"}},
-            {5, {"financial_aid", "Financial Aid Form"}},
-            {6, {"documents", "Document Upload Form"}},
-            {7, {"consent", "Consent Form"}}
-        };
+        LOG_DEBUG("FormPdfPreviewWidget", "Found " << dossier.submissions.size() << " submissions");
 
         // Calculate total pages for footer
-        int totalPages = static_cast<int>(submissions.size());
+        int totalPages = static_cast<int>(dossier.submissions.size());
 
         // Process each form submission
         int formIndex = 0;
-        for (const auto& submission : submissions) {
-            nlohmann::json attrs = submission.contains("attributes") ? submission["attributes"] : submission;
-
-            int formTypeId = attrs.value("form_type_id", 0);
-            std::string submittedAt = attrs.value("submitted_at", "");
-            std::string status = attrs.value("status", "pending");
-
-            auto formIt = formTypeMap.find(formTypeId);
-            std::string formType = formIt != formTypeMap.end() ? formIt->second.first : "unknown";
-            std::string formTitle = formIt != formTypeMap.end() ? formIt->second.second : "Form";
+        for (const auto& submission : dossier.submissions) {
+            const std::string& formType = submission.formType;
+            const std::string& submittedAt = submission.submittedAt;
+            const std::string& status = submission.status;
+            std::string formTitle = formTitles(formType).document;
 
             // Form section container (each form is a separate page)
             auto formSection = documentContent_->addWidget(std::make_unique<Wt::WContainerWidget>());
@@ -1021,519 +365,7 @@ void FormPdfPreviewWidget::loadStudentFormsData(int studentId) {
             formDateDetails->setTextFormat(Wt::TextFormat::XHTML);
 
             // Load form fields for this submission
-            std::vector<FormFieldData> fields;
-
-            // Load data based on form type (similar to loadFormSubmissionData)
-            if (formType == "personal_info") {
-                // Personal info is in the Student table
-                if (studentResponse.success) {
-                    auto studentJson = nlohmann::json::parse(studentResponse.body);
-                    nlohmann::json studentData = studentJson.contains("data") ? studentJson["data"] : studentJson;
-                    nlohmann::json sAttrs = studentData.contains("attributes") ? studentData["attributes"] : studentData;
-
-                    fields.push_back({"First Name", sAttrs.value("first_name", ""), "text"});
-                    fields.push_back({"Last Name", sAttrs.value("last_name", ""), "text"});
-                    fields.push_back({"Email", sAttrs.value("email", ""), "email"});
-                    fields.push_back({"Date of Birth", sAttrs.value("date_of_birth", ""), "date"});
-                    fields.push_back({"Gender", sAttrs.value("gender", ""), "text"});
-                    fields.push_back({"Citizenship", sAttrs.value("citizenship_status", ""), "text"});
-                }
-            } else if (formType == "emergency_contact") {
-                auto ecResponse = apiService_->getApiClient()->get("/EmergencyContact?filter[student_id]=" + std::to_string(studentId));
-                if (ecResponse.success && !ecResponse.body.empty()) {
-                    auto ecJson = nlohmann::json::parse(ecResponse.body);
-                    nlohmann::json ecItems = nlohmann::json::array();
-                    if (ecJson.is_array()) {
-                        ecItems = ecJson;
-                    } else if (ecJson.contains("data")) {
-                        if (ecJson["data"].is_array()) {
-                            ecItems = ecJson["data"];
-                        } else if (ecJson["data"].is_object()) {
-                            ecItems.push_back(ecJson["data"]);
-                        }
-                    }
-
-                    int contactNum = 1;
-                    for (const auto& ec : ecItems) {
-                        nlohmann::json ecAttrs = ec.contains("attributes") ? ec["attributes"] : ec;
-
-                        // Helper lambda to safely get string from JSON (handles null values)
-                        auto safeGetString = [&ecAttrs](const std::string& key) -> std::string {
-                            if (ecAttrs.contains(key) && !ecAttrs[key].is_null()) {
-                                if (ecAttrs[key].is_string()) {
-                                    return ecAttrs[key].get<std::string>();
-                                } else if (ecAttrs[key].is_number()) {
-                                    return std::to_string(ecAttrs[key].get<int>());
-                                }
-                            }
-                            return "";
-                        };
-
-                        // Determine contact label based on priority or is_primary
-                        std::string contactLabel;
-                        bool isPrimary = ecAttrs.contains("is_primary") && !ecAttrs["is_primary"].is_null() && ecAttrs["is_primary"].get<bool>();
-                        int priority = ecAttrs.contains("priority") && !ecAttrs["priority"].is_null() && ecAttrs["priority"].is_number() ? ecAttrs["priority"].get<int>() : 0;
-
-                        if (isPrimary || priority == 1) {
-                            contactLabel = "Primary Contact";
-                        } else if (priority == 2) {
-                            contactLabel = "Secondary Contact";
-                        } else {
-                            contactLabel = "Contact #" + std::to_string(contactNum);
-                        }
-
-                        // Add section header for each contact
-                        if (contactNum > 1) {
-                            fields.push_back({"", "", "text"}); // Empty row as separator
-                        }
-                        fields.push_back({contactLabel, "", "header"});
-
-                        // Name and relationship
-                        std::string firstName = safeGetString("first_name");
-                        std::string lastName = safeGetString("last_name");
-                        std::string fullName = firstName;
-                        if (!lastName.empty()) {
-                            fullName += (fullName.empty() ? "" : " ") + lastName;
-                        }
-                        if (!fullName.empty()) {
-                            fields.push_back({"Name", fullName, "text"});
-                        }
-
-                        std::string relationship = safeGetString("contact_relationship");
-                        if (!relationship.empty()) {
-                            fields.push_back({"Relationship", relationship, "text"});
-                        }
-
-                        // Contact info
-                        std::string phone = safeGetString("phone");
-                        if (!phone.empty()) {
-                            fields.push_back({"Phone", phone, "phone"});
-                        }
-
-                        std::string altPhone = safeGetString("alternate_phone");
-                        if (!altPhone.empty()) {
-                            fields.push_back({"Alternate Phone", altPhone, "phone"});
-                        }
-
-                        std::string email = safeGetString("email");
-                        if (!email.empty()) {
-                            fields.push_back({"Email", email, "email"});
-                        }
-
-                        // Address
-                        std::string street1 = safeGetString("street1");
-                        std::string street2 = safeGetString("street2");
-                        std::string city = safeGetString("city");
-                        std::string state = safeGetString("state");
-                        std::string postalCode = safeGetString("postal_code");
-                        std::string country = safeGetString("country");
-
-                        if (!street1.empty()) {
-                            std::string fullAddress = street1;
-                            if (!street2.empty()) fullAddress += ", " + street2;
-                            fields.push_back({"Street Address", fullAddress, "text"});
-                        }
-                        if (!city.empty() || !state.empty() || !postalCode.empty()) {
-                            std::string cityStateZip = city;
-                            if (!state.empty()) cityStateZip += (!cityStateZip.empty() ? ", " : "") + state;
-                            if (!postalCode.empty()) cityStateZip += " " + postalCode;
-                            fields.push_back({"City, State, Zip", cityStateZip, "text"});
-                        }
-                        if (!country.empty() && country != "USA" && country != "US" && country != "United States") {
-                            fields.push_back({"Country", country, "text"});
-                        }
-
-                        contactNum++;
-                    }
-
-                    if (ecItems.empty()) {
-                        fields.push_back({"No Emergency Contacts", "No emergency contacts have been added yet.", "text"});
-                    }
-                } else {
-                    fields.push_back({"No Emergency Contacts", "No emergency contacts have been added yet.", "text"});
-                }
-            } else if (formType == "medical_info") {
-                auto medResponse = apiService_->getApiClient()->get("/MedicalInfo?filter[student_id]=" + std::to_string(studentId));
-                if (medResponse.success) {
-                    auto medJson = nlohmann::json::parse(medResponse.body);
-                    nlohmann::json medItems = medJson.is_array() ? medJson : (medJson.contains("data") ? medJson["data"] : nlohmann::json::array());
-                    if (!medItems.empty()) {
-                        nlohmann::json med = medItems[0];
-                        nlohmann::json medAttrs = med.contains("attributes") ? med["attributes"] : med;
-
-                        // Basic medical info
-                        fields.push_back({"Medical Information", "", "header"});
-                        fields.push_back({"Blood Type", medAttrs.value("blood_type", ""), "text"});
-
-                        bool hasAllergies = medAttrs.value("has_allergies", false);
-                        fields.push_back({"Has Allergies", hasAllergies ? "Yes" : "No", "text"});
-                        if (hasAllergies) {
-                            fields.push_back({"Allergies", medAttrs.value("allergies", ""), "text"});
-                        }
-
-                        bool hasMedications = medAttrs.value("has_medications", false);
-                        fields.push_back({"Currently on Medications", hasMedications ? "Yes" : "No", "text"});
-                        if (hasMedications) {
-                            fields.push_back({"Medications", medAttrs.value("medications", ""), "text"});
-                        }
-
-                        bool hasChronicConditions = medAttrs.value("has_chronic_conditions", false);
-                        fields.push_back({"Has Chronic Conditions", hasChronicConditions ? "Yes" : "No", "text"});
-                        if (hasChronicConditions) {
-                            fields.push_back({"Chronic Conditions", medAttrs.value("chronic_conditions", ""), "text"});
-                        }
-
-                        bool hasDisabilities = medAttrs.value("has_disabilities", false);
-                        fields.push_back({"Has Disabilities", hasDisabilities ? "Yes" : "No", "text"});
-                        if (hasDisabilities) {
-                            fields.push_back({"Disabilities", medAttrs.value("disabilities", ""), "text"});
-                        }
-
-                        bool requiresAccommodations = medAttrs.value("requires_accommodations", false);
-                        fields.push_back({"Requires Accommodations", requiresAccommodations ? "Yes" : "No", "text"});
-                        if (requiresAccommodations) {
-                            fields.push_back({"Accommodations Needed", medAttrs.value("accommodations_needed", ""), "text"});
-                        }
-
-                        bool immunizationsUpToDate = medAttrs.value("immunizations_up_to_date", false);
-                        fields.push_back({"Immunizations Up To Date", immunizationsUpToDate ? "Yes" : "No", "text"});
-
-                        // Insurance information
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Insurance Information", "", "header"});
-                        fields.push_back({"Insurance Provider", medAttrs.value("insurance_provider", ""), "text"});
-                        fields.push_back({"Policy Number", medAttrs.value("insurance_policy_number", ""), "text"});
-                        fields.push_back({"Group Number", medAttrs.value("insurance_group_number", ""), "text"});
-                        fields.push_back({"Insurance Phone", medAttrs.value("insurance_phone", ""), "phone"});
-
-                        // Physician info
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Primary Care Physician", "", "header"});
-                        fields.push_back({"Physician Name", medAttrs.value("primary_physician", ""), "text"});
-                        fields.push_back({"Physician Phone", medAttrs.value("physician_phone", ""), "phone"});
-                    }
-                }
-            } else if (formType == "academic_history") {
-                auto ahResponse = apiService_->getApiClient()->get("/AcademicHistory?filter[student_id]=" + std::to_string(studentId));
-                if (ahResponse.success) {
-                    auto ahJson = nlohmann::json::parse(ahResponse.body);
-                    nlohmann::json ahItems = ahJson.is_array() ? ahJson : (ahJson.contains("data") ? ahJson["data"] : nlohmann::json::array());
-
-                    // Group by institution type
-                    std::vector<std::string> institutionTypes = {"High School", "College", "University", "Trade School"};
-                    std::map<std::string, std::vector<nlohmann::json>> groupedRecords;
-
-                    for (const auto& ah : ahItems) {
-                        nlohmann::json ahAttrs = ah.contains("attributes") ? ah["attributes"] : ah;
-                        std::string instType = ahAttrs.value("institution_type", "Other");
-                        groupedRecords[instType].push_back(ahAttrs);
-                    }
-
-                    bool firstGroup = true;
-                    for (const auto& instType : institutionTypes) {
-                        if (groupedRecords.find(instType) != groupedRecords.end()) {
-                            if (!firstGroup) {
-                                fields.push_back({"", "", "text"});
-                            }
-                            fields.push_back({instType + " Education", "", "header"});
-                            firstGroup = false;
-
-                            int recordNum = 1;
-                            for (const auto& ahAttrs : groupedRecords[instType]) {
-                                if (recordNum > 1) {
-                                    fields.push_back({"", "", "text"});
-                                }
-
-                                fields.push_back({"Institution Name", ahAttrs.value("institution_name", ""), "text"});
-
-                                std::string city = ahAttrs.value("institution_city", "");
-                                std::string state = ahAttrs.value("institution_state", "");
-                                std::string country = ahAttrs.value("institution_country", "");
-                                std::string location;
-                                if (!city.empty()) location = city;
-                                if (!state.empty()) location += (!location.empty() ? ", " : "") + state;
-                                if (!country.empty() && country != "USA" && country != "US" && country != "United States") {
-                                    location += (!location.empty() ? ", " : "") + country;
-                                }
-                                if (!location.empty()) {
-                                    fields.push_back({"Location", location, "text"});
-                                }
-
-                                std::string degree = ahAttrs.value("degree_earned", "");
-                                if (!degree.empty()) {
-                                    fields.push_back({"Degree Earned", degree, "text"});
-                                }
-                                std::string major = ahAttrs.value("major", "");
-                                if (!major.empty()) {
-                                    fields.push_back({"Major", major, "text"});
-                                }
-                                std::string minor = ahAttrs.value("minor", "");
-                                if (!minor.empty()) {
-                                    fields.push_back({"Minor", minor, "text"});
-                                }
-
-                                if (ahAttrs.contains("gpa") && !ahAttrs["gpa"].is_null()) {
-                                    double gpa = ahAttrs.value("gpa", 0.0);
-                                    double gpaScale = ahAttrs.value("gpa_scale", 4.0);
-                                    std::ostringstream gpaStr;
-                                    gpaStr << std::fixed << std::setprecision(2) << gpa << " / " << gpaScale;
-                                    fields.push_back({"GPA", gpaStr.str(), "text"});
-                                }
-
-                                std::string startDate = ahAttrs.value("start_date", "");
-                                std::string endDate = ahAttrs.value("end_date", "");
-                                bool currentlyAttending = ahAttrs.value("is_currently_attending", false);
-                                if (!startDate.empty() || !endDate.empty()) {
-                                    std::string dateRange = formatDate(startDate) + " - ";
-                                    if (currentlyAttending) {
-                                        dateRange += "Present";
-                                    } else if (!endDate.empty()) {
-                                        dateRange += formatDate(endDate);
-                                    }
-                                    fields.push_back({"Attendance Period", dateRange, "text"});
-                                }
-
-                                std::string gradDate = ahAttrs.value("graduation_date", "");
-                                if (!gradDate.empty()) {
-                                    fields.push_back({"Graduation Date", gradDate, "date"});
-                                }
-
-                                bool transcriptReceived = ahAttrs.value("transcript_received", false);
-                                fields.push_back({"Transcript Received", transcriptReceived ? "Yes" : "No", "text"});
-
-                                recordNum++;
-                            }
-                        }
-                    }
-
-                    // Handle any "Other" types
-                    for (const auto& pair : groupedRecords) {
-                        if (std::find(institutionTypes.begin(), institutionTypes.end(), pair.first) == institutionTypes.end()) {
-                            if (!firstGroup) {
-                                fields.push_back({"", "", "text"});
-                            }
-                            fields.push_back({pair.first + " Education", "", "header"});
-                            for (const auto& ahAttrs : pair.second) {
-                                fields.push_back({"Institution Name", ahAttrs.value("institution_name", ""), "text"});
-                                fields.push_back({"Degree Earned", ahAttrs.value("degree_earned", ""), "text"});
-                                fields.push_back({"Graduation Date", ahAttrs.value("graduation_date", ""), "date"});
-                            }
-                        }
-                    }
-                }
-            } else if (formType == "financial_aid") {
-                auto faResponse = apiService_->getApiClient()->get("/FinancialAid?filter[student_id]=" + std::to_string(studentId));
-                if (faResponse.success && !faResponse.body.empty()) {
-                    auto faJson = nlohmann::json::parse(faResponse.body);
-                    nlohmann::json faItems = faJson.is_array() ? faJson : (faJson.contains("data") ? faJson["data"] : nlohmann::json::array());
-                    if (!faItems.empty()) {
-                        nlohmann::json fa = faItems[0];
-                        nlohmann::json faAttrs = fa.contains("attributes") ? fa["attributes"] : fa;
-
-                        // Helper lambdas for safe JSON access
-                        auto safeGetString = [&faAttrs](const std::string& key) -> std::string {
-                            if (faAttrs.contains(key) && faAttrs[key].is_string()) {
-                                return faAttrs[key].get<std::string>();
-                            }
-                            return "";
-                        };
-                        auto safeGetBool = [&faAttrs](const std::string& key, bool defaultVal = false) -> bool {
-                            if (faAttrs.contains(key) && faAttrs[key].is_boolean()) {
-                                return faAttrs[key].get<bool>();
-                            }
-                            return defaultVal;
-                        };
-
-                        // General Information
-                        fields.push_back({"General Information", "", "header"});
-                        fields.push_back({"Applying for Financial Aid", safeGetBool("applying_for_aid", true) ? "Yes" : "No", "text"});
-
-                        // FAFSA Information
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"FAFSA Information", "", "header"});
-                        fields.push_back({"FAFSA Completed", safeGetBool("fafsa_completed") ? "Yes" : "No", "text"});
-                        if (faAttrs.contains("efc") && !faAttrs["efc"].is_null()) {
-                            std::ostringstream efcStr;
-                            efcStr << std::fixed << std::setprecision(2) << faAttrs.value("efc", 0.0);
-                            fields.push_back({"Student Aid Index (SAI/EFC)", efcStr.str(), "text"});
-                        }
-
-                        // Employment Information
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Employment Information", "", "header"});
-                        std::string empStatus = safeGetString("employment_status");
-                        fields.push_back({"Employment Status", empStatus.empty() ? "Not specified" : empStatus, "text"});
-                        std::string employer = safeGetString("employer_name");
-                        if (!employer.empty()) {
-                            fields.push_back({"Employer Name", employer, "text"});
-                        }
-
-                        // Household Information
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Household Information", "", "header"});
-                        std::string incomeRange = safeGetString("household_income_range");
-                        fields.push_back({"Household Income Range", incomeRange.empty() ? "Not specified" : incomeRange, "text"});
-                        if (faAttrs.contains("dependents_count") && !faAttrs["dependents_count"].is_null()) {
-                            fields.push_back({"Number of Dependents", std::to_string(faAttrs.value("dependents_count", 0)), "text"});
-                        }
-                        fields.push_back({"Veteran Benefits Eligible", safeGetBool("veteran_benefits") ? "Yes" : "No", "text"});
-
-                        // Aid Types Interested In
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Types of Aid Interested In", "", "header"});
-                        fields.push_back({"Scholarships and Grants", safeGetBool("scholarship_interest") ? "Yes" : "No", "text"});
-                        fields.push_back({"Federal Work-Study", safeGetBool("work_study_interest") ? "Yes" : "No", "text"});
-                        fields.push_back({"Student Loans", safeGetBool("loan_interest") ? "Yes" : "No", "text"});
-
-                        // Current Scholarships
-                        std::string scholarships = safeGetString("scholarship_applications");
-                        if (!scholarships.empty()) {
-                            fields.push_back({"", "", "text"});
-                            fields.push_back({"Current Scholarships", "", "header"});
-                            fields.push_back({"Scholarships", scholarships, "text"});
-                        }
-
-                        // Special Circumstances
-                        std::string specialCirc = safeGetString("special_circumstances");
-                        if (!specialCirc.empty()) {
-                            fields.push_back({"", "", "text"});
-                            fields.push_back({"Special Circumstances", "", "header"});
-                            fields.push_back({"Details", specialCirc, "text"});
-                        }
-                    } else {
-                        fields.push_back({"No Financial Aid Data", "No financial aid information has been submitted.", "text"});
-                    }
-                } else {
-                    fields.push_back({"No Financial Aid Data", "No financial aid information has been submitted.", "text"});
-                }
-            } else if (formType == "documents") {
-                std::string docUrl = "/Document?filter[student_id]=" + std::to_string(studentId);
-                LOG_DEBUG("FormPdfPreviewWidget", "Loading documents from: " << docUrl);
-                auto docResponse = apiService_->getApiClient()->get(docUrl);
-                LOG_DEBUG("FormPdfPreviewWidget", "Doc response success: " << docResponse.success
-                          << ", status: " << docResponse.statusCode);
-                if (docResponse.success && !docResponse.body.empty()) {
-                    LOG_DEBUG("FormPdfPreviewWidget", "Doc response body: " << docResponse.body.substr(0, 500));
-                    auto docJson = nlohmann::json::parse(docResponse.body);
-
-                    // Handle different JSON response formats
-                    nlohmann::json docItems = nlohmann::json::array();
-                    if (docJson.is_array()) {
-                        docItems = docJson;
-                    } else if (docJson.contains("data")) {
-                        if (docJson["data"].is_array()) {
-                            docItems = docJson["data"];
-                        } else if (docJson["data"].is_object()) {
-                            docItems.push_back(docJson["data"]);
-                        }
-                    }
-                    LOG_DEBUG("FormPdfPreviewWidget", "Found " << docItems.size() << " document records");
-
-                    if (!docItems.empty()) {
-                        int docNum = 1;
-                        for (const auto& doc : docItems) {
-                            nlohmann::json docAttrs = doc.contains("attributes") ? doc["attributes"] : doc;
-
-                            if (docNum > 1) {
-                                fields.push_back({"", "", "text"});
-                            }
-                            fields.push_back({"Document #" + std::to_string(docNum), "", "header"});
-
-                            fields.push_back({"Document Type", docAttrs.value("document_type", ""), "text"});
-                            fields.push_back({"File Name", docAttrs.value("file_name", ""), "text"});
-
-                            int fileSize = docAttrs.value("file_size", 0);
-                            std::string sizeStr;
-                            if (fileSize >= 1048576) {
-                                std::ostringstream ss;
-                                ss << std::fixed << std::setprecision(2) << (fileSize / 1048576.0) << " MB";
-                                sizeStr = ss.str();
-                            } else if (fileSize >= 1024) {
-                                std::ostringstream ss;
-                                ss << std::fixed << std::setprecision(1) << (fileSize / 1024.0) << " KB";
-                                sizeStr = ss.str();
-                            } else {
-                                sizeStr = std::to_string(fileSize) + " bytes";
-                            }
-                            fields.push_back({"File Size", sizeStr, "text"});
-
-                            fields.push_back({"Status", docAttrs.value("status", ""), "text"});
-
-                            std::string verifiedAt = docAttrs.value("verified_at", "");
-                            if (!verifiedAt.empty()) {
-                                fields.push_back({"Verified On", verifiedAt, "date"});
-                                fields.push_back({"Verified By", docAttrs.value("verified_by", ""), "text"});
-                            }
-
-                            std::string notes = docAttrs.value("notes", "");
-                            if (!notes.empty()) {
-                                fields.push_back({"Notes", notes, "text"});
-                            }
-
-                            docNum++;
-                        }
-                    } else {
-                        fields.push_back({"No Documents", "No documents uploaded yet", "text"});
-                    }
-                }
-            } else if (formType == "consent") {
-                auto cResponse = apiService_->getApiClient()->get("/Consent?filter[student_id]=" + std::to_string(studentId));
-                if (cResponse.success) {
-                    auto cJson = nlohmann::json::parse(cResponse.body);
-                    nlohmann::json cItems = cJson.is_array() ? cJson : (cJson.contains("data") ? cJson["data"] : nlohmann::json::array());
-
-                    int consentNum = 1;
-                    for (const auto& c : cItems) {
-                        nlohmann::json cAttrs = c.contains("attributes") ? c["attributes"] : c;
-
-                        if (consentNum > 1) {
-                            fields.push_back({"", "", "text"});
-                        }
-
-                        std::string consentType = cAttrs.value("consent_type", "");
-                        std::string consentVersion = cAttrs.value("consent_version", "");
-                        std::string consentLabel = !consentType.empty() ? consentType : "Consent Agreement";
-                        if (!consentVersion.empty()) {
-                            consentLabel += " (v" + consentVersion + ")";
-                        }
-                        fields.push_back({consentLabel, "", "header"});
-
-                        bool isAccepted = cAttrs.value("is_accepted", false);
-                        fields.push_back({"Status", isAccepted ? "Accepted" : "Not Accepted", "text"});
-
-                        std::string acceptedAt = cAttrs.value("accepted_at", "");
-                        if (!acceptedAt.empty()) {
-                            fields.push_back({"Accepted On", acceptedAt, "date"});
-                        }
-
-                        std::string signature = cAttrs.value("electronic_signature", "");
-                        if (!signature.empty()) {
-                            fields.push_back({"Electronic Signature", signature, "signature"});
-                        }
-
-                        std::string sigDate = cAttrs.value("signature_date", "");
-                        if (!sigDate.empty()) {
-                            fields.push_back({"Signature Date", sigDate, "date"});
-                        }
-
-                        std::string ipAddress = cAttrs.value("ip_address", "");
-                        if (!ipAddress.empty()) {
-                            fields.push_back({"IP Address", ipAddress, "text"});
-                        }
-
-                        consentNum++;
-                    }
-
-                    if (!cItems.empty()) {
-                        fields.push_back({"", "", "text"});
-                        fields.push_back({"Consent Acknowledgments", "", "header"});
-                        fields.push_back({"☑ Terms of Service", "Consented - I agree to abide by the institution's terms of service and student conduct policies", "consent_item"});
-                        fields.push_back({"☑ Privacy Policy", "Consented - I acknowledge the institution's privacy policy and data handling practices", "consent_item"});
-                        fields.push_back({"☑ FERPA Rights", "Consented - I understand my rights under the Family Educational Rights and Privacy Act", "consent_item"});
-                        fields.push_back({"☑ Information Accuracy", "Consented - I certify that all information provided is accurate and complete", "consent_item"});
-                    }
-                }
-            }
+            std::vector<FormFieldData> fields = buildFormFields(dossier, formType);
 
             // Build form data table
             if (!fields.empty()) {
@@ -1586,6 +418,7 @@ void FormPdfPreviewWidget::loadStudentFormsData(int studentId) {
                 studentName + " &nbsp;&nbsp;|&nbsp;&nbsp; Page " + std::to_string(currentPage) + " of " + std::to_string(totalPages)));
             pageFooterText->setTextFormat(Wt::TextFormat::XHTML);
 
+            pdfForms_.push_back(buildPdfFormData(formTitle, submittedAt, fields));
             formIndex++;
         }
 
@@ -1763,48 +596,69 @@ void FormPdfPreviewWidget::loadInstitutionSettings() {
     }
 }
 
-Api::PdfFormData FormPdfPreviewWidget::buildPdfFormData() {
+Api::PdfFormData FormPdfPreviewWidget::buildPdfFormData(const std::string& formTitle,
+                                                        const std::string& submissionDate,
+                                                        const std::vector<FormFieldData>& fields) {
     Api::PdfFormData pdfData;
-    pdfData.formTitle = formTitle_;
+    pdfData.formTitle = formTitle;
     pdfData.studentName = studentName_;
     pdfData.studentEmail = studentEmail_;
-    pdfData.submissionDate = submissionDate_;
+    pdfData.submissionDate = submissionDate;
 
     // Use institution settings (with fallback defaults)
     pdfData.institutionName = institutionSettings_.getInstitutionName();
     pdfData.institutionTagline = institutionSettings_.getTagline();
 
     // Convert FormFieldData to PdfFormField
-    for (const auto& field : fields_) {
+    for (const auto& field : fields) {
         pdfData.fields.emplace_back(field.label, field.value, field.type);
     }
 
     return pdfData;
 }
 
-std::string FormPdfPreviewWidget::generatePdf() {
+bool FormPdfPreviewWidget::generatePdf() {
     if (!pdfGenerator_ || !Api::PdfGenerator::isAvailable()) {
         LOG_WARN("FormPdfPreviewWidget", "PDF generation not available");
-        return "";
+        return false;
+    }
+
+    // The all-forms view renders one PDF page set per form from the same data as the preview
+    bool packet = !pdfForms_.empty();
+    std::vector<Api::PdfFormData> singleForm;
+    if (!packet) {
+        singleForm.push_back(buildPdfFormData(formTitle_, submissionDate_, fields_));
+    }
+    const std::vector<Api::PdfFormData>& forms = packet ? pdfForms_ : singleForm;
+
+    // Reopening a preview, or printing then downloading, reuses the rendered document
+    auto& cache = Api::PdfCache::getInstance();
+    std::string key = Api::PdfCache::makeKey(forms, packet, studentName_,
+        Api::PdfCache::settingsVersion(institutionSettings_.getAllSettings()));
+    std::string bytes;
+    if (cache.get(key, bytes)) {
+        LOG_DEBUG("FormPdfPreviewWidget", "Serving cached PDF: " << bytes.size() << " bytes");
+        pdfResource_->setDocument(std::move(bytes));
+        return true;
     }
 
-    Api::PdfFormData pdfData = buildPdfFormData();
-    std::string pdfPath = pdfGenerator_->generateFormPdf(pdfData);
+    bytes = packet ? pdfGenerator_->renderMultiFormPdf(forms, studentName_)
+                   : pdfGenerator_->renderFormPdf(forms.front());
 
-    if (pdfPath.empty()) {
+    if (bytes.empty()) {
         LOG_ERROR("FormPdfPreviewWidget", "Failed to generate PDF: "
                   << pdfGenerator_->getLastError());
-    } else {
-        currentPdfPath_ = pdfPath;
-        LOG_INFO("FormPdfPreviewWidget", "Generated PDF at: " << pdfPath);
+        return false;
     }
 
-    return pdfPath;
+    LOG_INFO("FormPdfPreviewWidget", "Generated PDF: " << bytes.size() << " bytes");
+    cache.put(key, bytes, studentId_, submissionId_);
+    pdfResource_->setDocument(std::move(bytes));
+    return true;
 }
 
 void FormPdfPreviewWidget::downloadPdf() {
-    std::string pdfPath = generatePdf();
-    if (pdfPath.empty()) {
+    if (!generatePdf()) {
         // Show error message
         Wt::WApplication::instance()->doJavaScript(
             "alert('Failed to generate PDF. Please try again.');"
@@ -1812,20 +666,15 @@ void FormPdfPreviewWidget::downloadPdf() {
         return;
     }
 
-    // Create a file resource for download and store as member to keep it alive
-    auto app = Wt::WApplication::instance();
-
     // Generate a clean filename from form title
     std::string filename = formTitle_;
     std::replace(filename.begin(), filename.end(), ' ', '_');
     filename += ".pdf";
 
-    // Use WFileResource to serve the PDF - store as member to persist
-    pdfResource_ = std::make_shared<Wt::WFileResource>("application/pdf", pdfPath);
-    pdfResource_->suggestFileName(filename);
+    pdfResource_->suggestFileName(filename, Wt::ContentDisposition::Attachment);
 
     // Trigger download by opening the resource URL
-    app->doJavaScript(
+    Wt::WApplication::instance()->doJavaScript(
         "window.open('" + pdfResource_->url() + "', '_blank');"
     );
 }
@@ -6,7 +6,6 @@
 #include <Wt/WText.h>
 #include <Wt/WPushButton.h>
 #include <Wt/WTable.h>
-#include <Wt/WFileResource.h>
 #include <Wt/WAnchor.h>
 #include <memory>
 #include <string>
@@ -14,7 +13,9 @@
 #include <map>
 #include "../../api/FormSubmissionService.h"
 #include "../../api/PdfGenerator.h"
+#include "../../api/StudentDossier.h"
 #include "../../models/InstitutionSettings.h"
+#include "PdfDocumentResource.h"
 
 namespace StudentIntake {
 namespace Admin {
@@ -60,18 +61,20 @@ private:
     void clearPreview();
     void loadFormSubmissionData(int submissionId);
     void loadStudentFormsData(int studentId);
+    std::vector<FormFieldData> buildFormFields(const Api::StudentDossier& dossier, const std::string& formType);
     std::string formatDate(const std::string& dateStr);
     std::string formatValue(const std::string& value, const std::string& type);
 
     // PDF generation methods
-    std::string generatePdf();
+    bool generatePdf();       // Renders into pdfResource_
     void downloadPdf();
-    Api::PdfFormData buildPdfFormData();
+    Api::PdfFormData buildPdfFormData(const std::string& formTitle,
+                                      const std::string& submissionDate,
+                                      const std::vector<FormFieldData>& fields);
 
     std::shared_ptr<Api::FormSubmissionService> apiService_;
     std::unique_ptr<Api::PdfGenerator> pdfGenerator_;
-    std::string currentPdfPath_;  // Path to most recently generated PDF
-    std::shared_ptr<Wt::WFileResource> pdfResource_;  // Keep resource alive for download
+    std::shared_ptr<PdfDocumentResource> pdfResource_;  // Serves the most recently generated PDF
 
     // Institution settings for branding
     StudentIntake::Models::InstitutionSettings institutionSettings_;
@@ -84,6 +87,9 @@ private:
     std::string studentEmail_;
     std::string submissionDate_;
     std::vector<FormFieldData> fields_;
+    std::vector<Api::PdfFormData> pdfForms_;  // One per form when showing all of a student's forms
+    int studentId_;                           // Owners of the shown document in the PdfCache, 0 if unknown
+    int submissionId_;
 
     // UI Elements
     Wt::WContainerWidget* toolbar_;
@@ -1,11 +1,11 @@
 #include "FormSubmissionsWidget.h"
+#include "CohortExportDialog.h"
 #include <Wt/WBreak.h>
 #include <Wt/WMessageBox.h>
 #include "utils/Logger.h"
 #include <algorithm>
 #include <chrono>
 #include <ctime>
-#include <map>
 #include <nlohmann/json.hpp>
 
 namespace StudentIntake {
@@ -28,6 +28,7 @@ FormSubmissionsWidget::FormSubmissionsWidget()
     , statusFilter_(nullptr)
     , programFilter_(nullptr)
     , resetBtn_(nullptr)
+    , exportBtn_(nullptr)
     , resultCount_(nullptr)
     , tableContainer_(nullptr)
     , submissionsTable_(nullptr)
@@ -173,6 +174,10 @@ void FormSubmissionsWidget::setupUI() {
     resetBtn_->addStyleClass("btn btn-secondary");
     resetBtn_->clicked().connect(this, &FormSubmissionsWidget::resetFilters);
 
+    exportBtn_ = buttonGroup->addWidget(std::make_unique<Wt::WPushButton>("Export PDFs"));
+    exportBtn_->addStyleClass("btn btn-primary");
+    exportBtn_->clicked().connect(this, &FormSubmissionsWidget::openCohortExport);
+
     // Result count
     resultCount_ = addWidget(std::make_unique<Wt::WText>(""));
     resultCount_->addStyleClass("admin-result-count");
@@ -192,18 +197,25 @@ void FormSubmissionsWidget::setupUI() {
 
 void FormSubmissionsWidget::loadData() {
     LOG_DEBUG("FormSubmissionsWidget", "loadData() called");
-    LOG_DEBUG("FormSubmissionsWidget", "apiService_ is " << (apiService_ ? "SET" : "NULL"));
 
-    // Load form types and programs first (for dropdowns and ID mapping)
+    auto& index = Api::SubmissionIndex::getInstance();
+    if (!index.isLoaded()) {
+        // First use in this process (or the refresher is not running): load it now
+        if (!index.hasApiClient() && apiService_) {
+            index.setApiClient(apiService_->getApiClient());
+        }
+        index.refresh();
+    }
+
+    // Form types and programs come from the index's lookup tables
     loadFormTypes();
     loadPrograms();
     loadSubmissions();
 
-    LOG_INFO("FormSubmissionsWidget", "loadData() complete - loaded " << submissions_.size() << " submissions");
+    LOG_INFO("FormSubmissionsWidget", "loadData() complete - " << index.size() << " submissions indexed");
 }
 
 void FormSubmissionsWidget::clearData() {
-    submissions_.clear();
     filteredSubmissions_.clear();
     if (submissionsTable_) {
         submissionsTable_->clear();
@@ -211,389 +223,66 @@ void FormSubmissionsWidget::clearData() {
 }
 
 void FormSubmissionsWidget::loadFormTypes() {
-    LOG_DEBUG("FormSubmissionsWidget", "loadFormTypes() called");
-    formTypeIdToCode_.clear();
-    formTypeCodeToName_.clear();
+    formTypeCodes_.clear();
+    formTypeFilter_->clear();
+    formTypeFilter_->addItem("All Forms");
 
-    if (!apiService_) {
-        LOG_WARN("FormSubmissionsWidget", "loadFormTypes() - apiService_ is NULL, returning early");
-        return;
-    }
-
-    try {
-        LOG_DEBUG("FormSubmissionsWidget", "Fetching /FormType from API...");
-        auto response = apiService_->getApiClient()->get("/FormType");
-        LOG_DEBUG("FormSubmissionsWidget", "FormType API response - success: " << response.success
-                  << ", status: " << response.statusCode);
-        if (response.success) {
-            auto json = nlohmann::json::parse(response.body);
-            nlohmann::json items;
-
-            if (json.is_array()) {
-                items = json;
-            } else if (json.contains("data") && json["data"].is_array()) {
-                items = json["data"];
-            }
-
-            LOG_DEBUG("FormSubmissionsWidget", "Loading " << items.size() << " form types");
-
-            for (const auto& item : items) {
-                int id = 0;
-                std::string code, name;
-
-                // Get ID
-                if (item.contains("id")) {
-                    if (item["id"].is_string()) {
-                        id = std::stoi(item["id"].get<std::string>());
-                    } else {
-                        id = item["id"].get<int>();
-                    }
-                }
-
-                // Get attributes
-                const auto& attrs = item.contains("attributes") ? item["attributes"] : item;
-                code = attrs.value("code", "");
-                name = attrs.value("name", code);  // Use code as fallback for name
-
-                if (id > 0 && !code.empty()) {
-                    formTypeIdToCode_[id] = code;
-                    formTypeCodeToName_[code] = name;
-                    LOG_DEBUG("FormSubmissionsWidget", "FormType: id=" << id << ", code=" << code << ", name=" << name);
-                }
-            }
-
-            // Update the form type filter dropdown
-            formTypeFilter_->clear();
-            formTypeFilter_->addItem("All Forms");
-            for (const auto& pair : formTypeCodeToName_) {
-                formTypeFilter_->addItem(pair.second);  // Add display name
-            }
-        }
-    } catch (const std::exception& e) {
-        LOG_ERROR("FormSubmissionsWidget", "Error loading form types: " << e.what());
+    for (const auto& formType : Api::SubmissionIndex::getInstance().getFormTypes()) {
+        formTypeCodes_.push_back(formType.code);
+        formTypeFilter_->addItem(formType.name);
     }
 }
 
 void FormSubmissionsWidget::loadPrograms() {
-    programs_.clear();
-
-    if (!apiService_) return;
-
-    try {
-        auto response = apiService_->getApiClient()->get("/Curriculum");
-        if (response.success) {
-            auto json = nlohmann::json::parse(response.body);
-            nlohmann::json items;
-
-            if (json.is_array()) {
-                items = json;
-            } else if (json.contains("data") && json["data"].is_array()) {
-                items = json["data"];
-            }
-
-            LOG_DEBUG("FormSubmissionsWidget", "Loading " << items.size() << " programs");
+    programs_ = Api::SubmissionIndex::getInstance().getPrograms();
+    programFilter_->clear();
+    programFilter_->addItem("All Programs");
 
-            for (const auto& item : items) {
-                int id = 0;
-                std::string name;
-
-                // Get ID
-                if (item.contains("id")) {
-                    if (item["id"].is_string()) {
-                        id = std::stoi(item["id"].get<std::string>());
-                    } else {
-                        id = item["id"].get<int>();
-                    }
-                }
-
-                // Get attributes
-                const auto& attrs = item.contains("attributes") ? item["attributes"] : item;
-                name = attrs.value("name", "");
-
-                if (id > 0 && !name.empty()) {
-                    programs_.push_back({id, name});
-                    LOG_DEBUG("FormSubmissionsWidget", "Program: id=" << id << ", name=" << name);
-                }
-            }
-
-            // Update the program filter dropdown
-            programFilter_->clear();
-            programFilter_->addItem("All Programs");
-            for (const auto& program : programs_) {
-                programFilter_->addItem(program.second);  // Add program name
-            }
-        }
-    } catch (const std::exception& e) {
-        LOG_ERROR("FormSubmissionsWidget", "Error loading programs: " << e.what());
+    for (const auto& program : programs_) {
+        programFilter_->addItem(program.second);
     }
 }
 
 void FormSubmissionsWidget::loadSubmissions() {
-    LOG_DEBUG("FormSubmissionsWidget", "loadSubmissions() called");
-    submissions_.clear();
-
-    // Helper lambdas for safe JSON value extraction (handles null values)
-    auto safeGetInt = [](const nlohmann::json& obj, const std::string& key, int defaultVal) -> int {
-        if (obj.contains(key) && !obj[key].is_null()) {
-            if (obj[key].is_number()) {
-                return obj[key].get<int>();
-            } else if (obj[key].is_string()) {
-                try {
-                    return std::stoi(obj[key].get<std::string>());
-                } catch (...) {}
-            }
-        }
-        return defaultVal;
-    };
-
-    auto safeGetString = [](const nlohmann::json& obj, const std::string& key, const std::string& defaultVal) -> std::string {
-        if (obj.contains(key) && !obj[key].is_null() && obj[key].is_string()) {
-            return obj[key].get<std::string>();
-        }
-        return defaultVal;
-    };
-
-    // Build a cache of student info for efficient lookups
-    std::map<int, std::pair<std::string, std::string>> studentCache;  // id -> (name, email)
-    std::map<int, std::string> curriculumCache;  // id -> name
-
-    // Try to load from API if available
-    if (apiService_) {
-        LOG_DEBUG("FormSubmissionsWidget", "apiService_ is set, loading from API");
-        try {
-            // First, load students to get names and emails
-            auto studentsResponse = apiService_->getApiClient()->get("/Student");
-            if (studentsResponse.success) {
-                auto studentsJson = nlohmann::json::parse(studentsResponse.body);
-                nlohmann::json studentItems;
-                if (studentsJson.is_array()) {
-                    studentItems = studentsJson;
-                } else if (studentsJson.contains("data") && studentsJson["data"].is_array()) {
-                    studentItems = studentsJson["data"];
-                }
-
-                for (const auto& student : studentItems) {
-                    int studentId = 0;
-                    std::string name, email;
-
-                    // Safe ID extraction
-                    if (student.contains("id") && !student["id"].is_null()) {
-                        if (student["id"].is_string()) {
-                            try { studentId = std::stoi(student["id"].get<std::string>()); } catch (...) {}
-                        } else if (student["id"].is_number()) {
-                            studentId = student["id"].get<int>();
-                        }
-                    }
-
-                    const auto& attrs = student.contains("attributes") ? student["attributes"] : student;
-                    std::string firstName = safeGetString(attrs, "first_name", "");
-                    std::string lastName = safeGetString(attrs, "last_name", "");
-                    name = firstName + " " + lastName;
-                    email = safeGetString(attrs, "email", "");
-
-                    if (studentId > 0) {
-                        studentCache[studentId] = {name, email};
-                    }
-                }
-                LOG_DEBUG("FormSubmissionsWidget", "Loaded " << studentCache.size() << " students into cache");
-            }
-
-            // Load curricula for program names
-            auto curriculumResponse = apiService_->getApiClient()->get("/Curriculum");
-            if (curriculumResponse.success) {
-                auto curriculumJson = nlohmann::json::parse(curriculumResponse.body);
-                nlohmann::json curriculumItems;
-                if (curriculumJson.is_array()) {
-                    curriculumItems = curriculumJson;
-                } else if (curriculumJson.contains("data") && curriculumJson["data"].is_array()) {
-                    curriculumItems = curriculumJson["data"];
-                }
-
-                for (const auto& curr : curriculumItems) {
-                    int currId = 0;
-                    std::string currName;
-
-                    // Safe ID extraction
-                    if (curr.contains("id") && !curr["id"].is_null()) {
-                        if (curr["id"].is_string()) {
-                            try { currId = std::stoi(curr["id"].get<std::string>()); } catch (...) {}
-                        } else if (curr["id"].is_number()) {
-                            currId = curr["id"].get<int>();
-                        }
-                    }
-
-                    const auto& attrs = curr.contains("attributes") ? curr["attributes"] : curr;
-                    currName = safeGetString(attrs, "name", "");
-
-                    if (currId > 0) {
-                        curriculumCache[currId] = currName;
-                    }
-                }
-                LOG_DEBUG("FormSubmissionsWidget", "Loaded " << curriculumCache.size() << " curricula into cache");
-            }
-
-            // Now load form submissions
-            auto response = apiService_->getApiClient()->get("/FormSubmission");
-            LOG_DEBUG("FormSubmissionsWidget", "FormSubmission API response - success: " << response.success);
-            if (response.success) {
-                auto jsonResponse = nlohmann::json::parse(response.body);
-                nlohmann::json items;
-                if (jsonResponse.is_array()) {
-                    items = jsonResponse;
-                } else if (jsonResponse.contains("data") && jsonResponse["data"].is_array()) {
-                    items = jsonResponse["data"];
-                }
-                LOG_DEBUG("FormSubmissionsWidget", "Found " << items.size() << " form submission items");
-
-                for (const auto& item : items) {
-                    FormSubmissionRecord record;
-
-                    // Safe ID extraction
-                    if (item.contains("id") && !item["id"].is_null()) {
-                        if (item["id"].is_string()) {
-                            try { record.id = std::stoi(item["id"].get<std::string>()); } catch (...) {}
-                        } else if (item["id"].is_number()) {
-                            record.id = item["id"].get<int>();
-                        }
-                    }
-
-                    // Get attributes with null-safe extraction
-                    const auto& attrs = item.contains("attributes") ? item["attributes"] : item;
-                    record.studentId = safeGetInt(attrs, "student_id", 0);
-                    record.status = safeGetString(attrs, "status", "pending");
-                    record.submittedAt = safeGetString(attrs, "submitted_at", "");
-                    record.reviewedAt = safeGetString(attrs, "approved_at", "");
-                    record.reviewedBy = safeGetString(attrs, "approved_by", "");
-
-                    // Map form_type_id to form type name
-                    int formTypeId = safeGetInt(attrs, "form_type_id", 0);
-                    record.formType = getFormTypeFromId(formTypeId);
-                    record.formName = getFormDisplayName(record.formType);
-
-                    // Look up student info from cache
-                    auto studentIt = studentCache.find(record.studentId);
-                    if (studentIt != studentCache.end()) {
-                        record.studentName = studentIt->second.first;
-                        record.studentEmail = studentIt->second.second;
-                    } else {
-                        record.studentName = "Student #" + std::to_string(record.studentId);
-                        record.studentEmail = "";
-                    }
-
-                    // For program name, we'd need to look up the student's curriculum_id
-                    // For now, leave it empty or populate from a separate query if needed
-                    record.programName = "";
-
-                    submissions_.push_back(record);
-                    LOG_DEBUG("FormSubmissionsWidget", "Added submission: id=" << record.id
-                              << ", student=" << record.studentName << ", form=" << record.formName);
-                }
-            }
-            LOG_INFO("FormSubmissionsWidget", "Loaded " << submissions_.size() << " submissions from API");
-        } catch (const std::exception& e) {
-            LOG_ERROR("FormSubmissionsWidget", "Error loading from API: " << e.what());
-        }
-    }
-
-    // Log when no submissions found (no mock data - this is a real system now)
-    if (submissions_.empty()) {
+    if (Api::SubmissionIndex::getInstance().size() == 0) {
         LOG_INFO("FormSubmissionsWidget", "No form submissions found in database");
     }
-
     applyFilters();
 }
 
 void FormSubmissionsWidget::applyFilters() {
-    filteredSubmissions_.clear();
-
-    std::string searchText = searchInput_->text().toUTF8();
-    std::transform(searchText.begin(), searchText.end(), searchText.begin(), ::tolower);
+    auto& index = Api::SubmissionIndex::getInstance();
+    Api::SubmissionFilter filter;
+    filter.search = searchInput_->text().toUTF8();
 
     int formIndex = formTypeFilter_->currentIndex();
-    std::string selectedForm = "";
-    if (formIndex > 0) {
-        // Get the display name from the dropdown
-        std::string displayName = formTypeFilter_->currentText().toUTF8();
-        // Find the code that matches this display name
-        for (const auto& pair : formTypeCodeToName_) {
-            if (pair.second == displayName) {
-                selectedForm = pair.first;  // Use the code
-                break;
-            }
-        }
+    if (formIndex > 0 && formIndex - 1 < static_cast<int>(formTypeCodes_.size())) {
+        filter.formType = formTypeCodes_[formIndex - 1];
     }
 
     int statusIndex = statusFilter_->currentIndex();
-    std::string selectedStatus = "";
     if (statusIndex > 0) {
         std::vector<std::string> statuses = {"pending", "approved", "rejected", "needs_revision"};
         if (statusIndex - 1 < static_cast<int>(statuses.size())) {
-            selectedStatus = statuses[statusIndex - 1];
+            filter.status = statuses[statusIndex - 1];
         }
     }
 
     int programIndex = programFilter_->currentIndex();
-    std::string selectedProgram = (programIndex > 0) ? programFilter_->currentText().toUTF8() : "";
-
-    // Count statistics
-    int todayCount = 0, pendingCount = 0, approvedCount = 0, rejectedCount = 0, revisionCount = 0;
-
-    for (const auto& submission : submissions_) {
-        // Update counts
-        if (isToday(submission.submittedAt)) todayCount++;
-        if (submission.status == "pending") pendingCount++;
-        else if (submission.status == "approved") approvedCount++;
-        else if (submission.status == "rejected") rejectedCount++;
-        else if (submission.status == "needs_revision") revisionCount++;
-
-        // Search filter
-        if (!searchText.empty()) {
-            std::string name = submission.studentName;
-            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
-            std::string email = submission.studentEmail;
-            std::transform(email.begin(), email.end(), email.begin(), ::tolower);
-
-            if (name.find(searchText) == std::string::npos &&
-                email.find(searchText) == std::string::npos) {
-                continue;
-            }
-        }
-
-        // Form type filter
-        if (!selectedForm.empty() && submission.formType != selectedForm) {
-            continue;
-        }
-
-        // Status filter
-        if (!selectedStatus.empty() && submission.status != selectedStatus) {
-            continue;
-        }
-
-        // Program filter
-        if (!selectedProgram.empty() && submission.programName != selectedProgram) {
-            continue;
-        }
-
-        filteredSubmissions_.push_back(submission);
+    if (programIndex > 0 && programIndex - 1 < static_cast<int>(programs_.size())) {
+        filter.curriculumId = programs_[programIndex - 1].first;
     }
 
-    // Sort by student name (last name, then first name for same last names)
-    std::sort(filteredSubmissions_.begin(), filteredSubmissions_.end(),
-        [](const FormSubmissionRecord& a, const FormSubmissionRecord& b) {
-            // Case-insensitive comparison
-            std::string nameA = a.studentName;
-            std::string nameB = b.studentName;
-            std::transform(nameA.begin(), nameA.end(), nameA.begin(), ::tolower);
-            std::transform(nameB.begin(), nameB.end(), nameB.begin(), ::tolower);
-            return nameA < nameB;
-        });
+    // Already sorted by student name, so each student's forms are adjacent
+    filteredSubmissions_ = index.query(filter);
 
     // Update statistics display
-    todayCountText_->setText(std::to_string(todayCount));
-    pendingCountText_->setText(std::to_string(pendingCount));
-    approvedCountText_->setText(std::to_string(approvedCount));
-    rejectedCountText_->setText(std::to_string(rejectedCount));
-    revisionCountText_->setText(std::to_string(revisionCount));
+    auto counts = index.countByStatus();
+    todayCountText_->setText(std::to_string(index.countSubmittedOn(getTodayDateString())));
+    pendingCountText_->setText(std::to_string(counts["pending"]));
+    approvedCountText_->setText(std::to_string(counts["approved"]));
+    rejectedCountText_->setText(std::to_string(counts["rejected"]));
+    revisionCountText_->setText(std::to_string(counts["needs_revision"]));
 
     updateTable();
 }
@@ -619,7 +308,7 @@ void FormSubmissionsWidget::updateTable() {
     noDataMessage_->hide();
     tableContainer_->show();
     resultCount_->setText("Showing " + std::to_string(filteredSubmissions_.size()) + " of " +
-                          std::to_string(submissions_.size()) + " submissions");
+                          std::to_string(Api::SubmissionIndex::getInstance().size()) + " submissions");
 
     // Header row - icon column first
     submissionsTable_->setHeaderCount(1);
@@ -751,6 +440,21 @@ void FormSubmissionsWidget::updateTable() {
     }
 }
 
+void FormSubmissionsWidget::openCohortExport() {
+    // Start from the program currently selected in the list filter
+    int curriculumId = 0;
+    int programIndex = programFilter_->currentIndex();
+    if (programIndex > 0 && programIndex - 1 < static_cast<int>(programs_.size())) {
+        curriculumId = programs_[programIndex - 1].first;
+    }
+
+    auto dialog = addChild(std::make_unique<CohortExportDialog>(apiService_, curriculumId));
+    dialog->finished().connect([this, dialog]() {
+        removeChild(dialog);
+    });
+    dialog->show();
+}
+
 void FormSubmissionsWidget::approveSubmission(int submissionId) {
     LOG_INFO("FormSubmissionsWidget", "Approving submission: " << submissionId);
 
@@ -760,24 +464,20 @@ void FormSubmissionsWidget::approveSubmission(int submissionId) {
             payload["data"]["type"] = "form_submission";
             payload["data"]["id"] = std::to_string(submissionId);
             payload["data"]["attributes"]["status"] = "approved";
+            std::string reviewedAt = getCurrentIsoTimestamp();
+            payload["data"]["attributes"]["approved_at"] = reviewedAt;
+            payload["data"]["attributes"]["approved_by"] = "Admin";
 
             auto response = apiService_->getApiClient()->patch("/FormSubmission/" + std::to_string(submissionId), payload.dump());
             if (response.success) {
                 LOG_INFO("FormSubmissionsWidget", "Submission approved successfully");
+                Api::SubmissionIndex::getInstance().updateStatus(submissionId, "approved", reviewedAt, "Admin");
             }
         } catch (const std::exception& e) {
             LOG_ERROR("FormSubmissionsWidget", "Error approving submission: " << e.what());
         }
     }
 
-    // Update local state
-    for (auto& submission : submissions_) {
-        if (submission.id == submissionId) {
-            submission.status = "approved";
-            break;
-        }
-    }
-
     approveClicked_.emit(submissionId, "approved");
     applyFilters();
 }
@@ -791,24 +491,20 @@ void FormSubmissionsWidget::rejectSubmission(int submissionId) {
             payload["data"]["type"] = "form_submission";
             payload["data"]["id"] = std::to_string(submissionId);
             payload["data"]["attributes"]["status"] = "rejected";
+            std::string reviewedAt = getCurrentIsoTimestamp();
+            payload["data"]["attributes"]["approved_at"] = reviewedAt;
+            payload["data"]["attributes"]["approved_by"] = "Admin";
 
             auto response = apiService_->getApiClient()->patch("/FormSubmission/" + std::to_string(submissionId), payload.dump());
             if (response.success) {
                 LOG_INFO("FormSubmissionsWidget", "Submission rejected successfully");
+                Api::SubmissionIndex::getInstance().updateStatus(submissionId, "rejected", reviewedAt, "Admin");
             }
         } catch (const std::exception& e) {
             LOG_ERROR("FormSubmissionsWidget", "Error rejecting submission: " << e.what());
         }
     }
 
-    // Update local state
-    for (auto& submission : submissions_) {
-        if (submission.id == submissionId) {
-            submission.status = "rejected";
-            break;
-        }
-    }
-
     rejectClicked_.emit(submissionId, "rejected");
     applyFilters();
 }
@@ -848,30 +544,14 @@ std::string FormSubmissionsWidget::formatDate(const std::string& dateStr) {
     return dateStr;
 }
 
-std::string FormSubmissionsWidget::getFormDisplayName(const std::string& formType) {
-    // Use dynamic map loaded from API
-    auto it = formTypeCodeToName_.find(formType);
-    if (it != formTypeCodeToName_.end()) {
-        return it->second;
-    }
-    // Fallback to hardcoded values for backwards compatibility
-    if (formType == "personal_info") return "Personal Information";
-    if (formType == "emergency_contact") return "Emergency Contacts";
-    if (formType == "medical_info") return "Medical Information";
-    if (formType == "academic_history") return "Academic History";
-    if (formType == "financial_aid") return "Financial Aid";
-    if (formType == "documents") return "Document Upload";
-    if (formType == "consent") return "Terms and Consent";
-    return formType;
-}
+std::string FormSubmissionsWidget::getCurrentIsoTimestamp() {
+    auto now = std::chrono::system_clock::now();
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    std::tm tm_now = *std::gmtime(&time_t_now);
 
-std::string FormSubmissionsWidget::getFormTypeFromId(int formTypeId) {
-    // Use dynamic map loaded from API
-    auto it = formTypeIdToCode_.find(formTypeId);
-    if (it != formTypeIdToCode_.end()) {
-        return it->second;
-    }
-    return "unknown";
+    char buffer[21];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &tm_now);
+    return std::string(buffer);
 }
 
 std::string FormSubmissionsWidget::getTodayDateString() {
@@ -885,17 +565,5 @@ std::string FormSubmissionsWidget::getTodayDateString() {
     return std::string(buffer);
 }
 
-bool FormSubmissionsWidget::isToday(const std::string& dateStr) {
-    if (dateStr.empty() || dateStr.length() < 10) {
-        return false;
-    }
-
-    // Extract YYYY-MM-DD from the ISO date string
-    std::string submissionDate = dateStr.substr(0, 10);
-    std::string today = getTodayDateString();
-
-    return submissionDate == today;
-}
-
 } // namespace Admin
 } // namespace StudentIntake
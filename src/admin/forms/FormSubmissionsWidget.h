@@ -12,26 +12,15 @@
 #include <vector>
 #include <map>
 #include "../../api/FormSubmissionService.h"
+#include "../../api/SubmissionIndex.h"
 
 namespace StudentIntake {
 namespace Admin {
 
 /**
- * @brief Represents a form submission for admin review
+ * @brief A form submission for admin review, as served by the shared SubmissionIndex
  */
-struct FormSubmissionRecord {
-    int id;
-    int studentId;
-    std::string studentName;
-    std::string studentEmail;
-    std::string formType;
-    std::string formName;
-    std::string status;      // pending, approved, rejected, needs_revision
-    std::string submittedAt;
-    std::string reviewedAt;
-    std::string reviewedBy;
-    std::string programName;
-};
+using FormSubmissionRecord = Api::SubmissionView;
 
 /**
  * @brief Widget for displaying and managing form submissions
@@ -53,27 +42,24 @@ public:
 private:
     void setupUI();
     void loadSubmissions();
-    void loadFormTypes();     // Load form types from API
-    void loadPrograms();      // Load programs from API
+    void loadFormTypes();     // Fill the form type filter from the index
+    void loadPrograms();      // Fill the program filter from the index
     void updateTable();
     void applyFilters();
     void resetFilters();
+    void openCohortExport();  // Bulk PDF export of the filtered program
     void approveSubmission(int submissionId);
     void rejectSubmission(int submissionId);
     std::string getStatusBadgeClass(const std::string& status);
     std::string formatDate(const std::string& dateStr);
-    std::string getFormDisplayName(const std::string& formType);
-    std::string getFormTypeFromId(int formTypeId);
-    bool isToday(const std::string& dateStr);
     std::string getTodayDateString();
+    static std::string getCurrentIsoTimestamp();
 
     std::shared_ptr<Api::FormSubmissionService> apiService_;
-    std::vector<FormSubmissionRecord> submissions_;
     std::vector<FormSubmissionRecord> filteredSubmissions_;
 
-    // Form type and program caches loaded from API
-    std::map<int, std::string> formTypeIdToCode_;    // form_type_id -> code
-    std::map<std::string, std::string> formTypeCodeToName_;  // code -> display name
+    // Filter dropdown entries, in dropdown order after the "All" item
+    std::vector<std::string> formTypeCodes_;             // form type code per entry
     std::vector<std::pair<int, std::string>> programs_;  // (curriculum_id, name)
 
     // UI Elements
@@ -91,6 +77,7 @@ private:
     Wt::WComboBox* statusFilter_;
     Wt::WComboBox* programFilter_;
     Wt::WPushButton* resetBtn_;
+    Wt::WPushButton* exportBtn_;
     Wt::WText* resultCount_;
     Wt::WContainerWidget* tableContainer_;
     Wt::WTable* submissionsTable_;
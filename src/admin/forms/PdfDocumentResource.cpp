@@ -0,0 +1,67 @@
+#include "PdfDocumentResource.h"
+#include <functional>
+#include <sstream>
+
+namespace StudentIntake {
+namespace Admin {
+
+PdfDocumentResource::PdfDocumentResource()
+    : WResource() {
+}
+
+PdfDocumentResource::~PdfDocumentResource() {
+    beingDeleted();
+}
+
+void PdfDocumentResource::setDocument(std::string bytes) {
+    std::ostringstream etag;
+    etag << '"' << std::hex << std::hash<std::string>()(bytes) << '-' << bytes.size() << '"';
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bytes_ = std::make_shared<const std::string>(std::move(bytes));
+        etag_ = etag.str();
+    }
+
+    // New URL so the browser does not show a previously opened document
+    setChanged();
+}
+
+bool PdfDocumentResource::hasDocument() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_ && !bytes_->empty();
+}
+
+size_t PdfDocumentResource::documentSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_ ? bytes_->size() : 0;
+}
+
+void PdfDocumentResource::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) {
+    std::shared_ptr<const std::string> bytes;
+    std::string etag;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bytes = bytes_;
+        etag = etag_;
+    }
+
+    if (!bytes || bytes->empty()) {
+        response.setStatus(404);
+        return;
+    }
+
+    response.addHeader("Cache-Control", "private, no-cache");
+    response.addHeader("ETag", etag);
+    if (request.headerValue("If-None-Match") == etag) {
+        response.setStatus(304);
+        return;
+    }
+
+    response.setMimeType("application/pdf");
+    response.setContentLength(bytes->size());
+    response.out().write(bytes->data(), static_cast<std::streamsize>(bytes->size()));
+}
+
+} // namespace Admin
+} // namespace StudentIntake
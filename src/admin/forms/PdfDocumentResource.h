@@ -0,0 +1,42 @@
+#ifndef PDF_DOCUMENT_RESOURCE_H
+#define PDF_DOCUMENT_RESOURCE_H
+
+#include <Wt/WResource.h>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace StudentIntake {
+namespace Admin {
+
+/**
+ * @brief Serves a PDF rendered in memory, without a temporary file
+ *
+ * setDocument() swaps in new bytes and gives the resource a fresh URL.
+ * Responses carry Content-Length and an ETag, and are marked private so
+ * shared caches never keep student records.
+ */
+class PdfDocumentResource : public Wt::WResource {
+public:
+    PdfDocumentResource();
+    ~PdfDocumentResource() override;
+
+    void setDocument(std::string bytes);
+    bool hasDocument() const;
+    size_t documentSize() const;
+
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+
+private:
+    // Replaced, never modified, so requests in flight keep a consistent copy
+    std::shared_ptr<const std::string> bytes_;
+    std::string etag_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Admin
+} // namespace StudentIntake
+
+#endif // PDF_DOCUMENT_RESOURCE_H
@@ -3,6 +3,7 @@
 #include <Wt/WBreak.h>
 #include <algorithm>
 #include "utils/Logger.h"
+#include "api/AdminStatisticsService.h"
 #include <sstream>
 #include <iomanip>
 
@@ -33,6 +34,13 @@ StudentListWidget::~StudentListWidget() {
 
 void StudentListWidget::setApiService(std::shared_ptr<Api::FormSubmissionService> apiService) {
     apiService_ = apiService;
+    if (!apiService_) {
+        return;
+    }
+
+    directory_ = std::make_shared<Api::StudentDirectory>(apiService_->getApiClient());
+    model_ = std::make_shared<StudentTableModel>(directory_);
+    studentTable_->setModel(model_);
 }
 
 void StudentListWidget::setupUI() {
@@ -136,7 +144,7 @@ void StudentListWidget::setupFilters() {
     searchInput_->setPlaceholderText("Search by name or email...");
     searchInput_->addStyleClass("admin-filter-input");
     searchInput_->textInput().connect([this]() {
-        applyFilters();
+        scheduleSearch();
     });
 
     // Program filter
@@ -183,24 +191,33 @@ void StudentListWidget::setupFilters() {
 }
 
 void StudentListWidget::setupTable() {
-    studentTable_ = tableContainer_->addWidget(std::make_unique<Wt::WTable>());
+    // Virtual scrolling: the view only requests rows inside its viewport
+    studentTable_ = tableContainer_->addWidget(std::make_unique<Wt::WTableView>());
     studentTable_->addStyleClass("admin-data-table");
-    studentTable_->setHeaderCount(1);
-
-    // Table headers - icon column first
-    auto iconHeader = studentTable_->elementAt(0, 0)->addWidget(std::make_unique<Wt::WText>(""));
-    iconHeader->addStyleClass("admin-table-icon-header");
-    studentTable_->elementAt(0, 1)->addWidget(std::make_unique<Wt::WText>("ID"));
-    studentTable_->elementAt(0, 2)->addWidget(std::make_unique<Wt::WText>("Name"));
-    studentTable_->elementAt(0, 3)->addWidget(std::make_unique<Wt::WText>("Email"));
-    studentTable_->elementAt(0, 4)->addWidget(std::make_unique<Wt::WText>("Program"));
-    studentTable_->elementAt(0, 5)->addWidget(std::make_unique<Wt::WText>("Status"));
-    studentTable_->elementAt(0, 6)->addWidget(std::make_unique<Wt::WText>("Enrolled"));
-    studentTable_->elementAt(0, 7)->addWidget(std::make_unique<Wt::WText>("Actions"));
-
-    for (int i = 0; i < 8; i++) {
-        studentTable_->elementAt(0, i)->addStyleClass("admin-table-header");
-    }
+    studentTable_->setAlternatingRowColors(true);
+    studentTable_->setSortingEnabled(true);
+    studentTable_->setSelectionMode(Wt::SelectionMode::None);
+    studentTable_->setRowHeight(Wt::WLength(40));
+    studentTable_->setHeight(Wt::WLength(600));
+
+    studentTable_->setColumnWidth(StudentTableModel::IdColumn, Wt::WLength(70));
+    studentTable_->setColumnWidth(StudentTableModel::NameColumn, Wt::WLength(200));
+    studentTable_->setColumnWidth(StudentTableModel::EmailColumn, Wt::WLength(240));
+    studentTable_->setColumnWidth(StudentTableModel::ProgramColumn, Wt::WLength(200));
+    studentTable_->setColumnWidth(StudentTableModel::StatusColumn, Wt::WLength(100));
+    studentTable_->setColumnWidth(StudentTableModel::EnrolledColumn, Wt::WLength(110));
+    studentTable_->setColumnWidth(StudentTableModel::ActionsColumn, Wt::WLength(80));
+    studentTable_->setSortingEnabled(StudentTableModel::ActionsColumn, false);
+
+    studentTable_->clicked().connect([this](const Wt::WModelIndex& index, const Wt::WMouseEvent&) {
+        if (!index.isValid() || !model_) {
+            return;
+        }
+        int studentId = model_->getStudentId(index.row());
+        if (studentId > 0) {
+            onStudentRowClicked(studentId);
+        }
+    });
 }
 
 void StudentListWidget::refresh() {
@@ -224,9 +241,6 @@ void StudentListWidget::loadCurriculum() {
         auto jsonResponse = nlohmann::json::parse(response.body);
         curriculumMap_.clear();
 
-        // Collect unique program names for the filter dropdown
-        std::vector<std::string> programNames;
-
         nlohmann::json items;
         if (jsonResponse.is_array()) {
             items = jsonResponse;
@@ -258,17 +272,23 @@ void StudentListWidget::loadCurriculum() {
 
             if (!id.empty() && !programName.empty()) {
                 curriculumMap_[id] = programName;
-                programNames.push_back(programName);
             }
         }
 
         LOG_DEBUG("StudentList", "Loaded " << curriculumMap_.size() << " curriculum entries");
 
-        // Update the program filter dropdown
+        // Update the program filter dropdown; the filter is sent by id
         programFilter_->clear();
+        programFilterIds_.clear();
         programFilter_->addItem("All Programs");
-        for (const auto& name : programNames) {
+        programFilterIds_.push_back("");
+        for (const auto& [id, name] : curriculumMap_) {
             programFilter_->addItem(name);
+            programFilterIds_.push_back(id);
+        }
+
+        if (model_) {
+            model_->setProgramNames(curriculumMap_);
         }
 
     } catch (const std::exception& e) {
@@ -276,250 +296,101 @@ void StudentListWidget::loadCurriculum() {
     }
 }
 
-std::string StudentListWidget::getProgramName(const std::string& curriculumId) const {
-    auto it = curriculumMap_.find(curriculumId);
-    if (it != curriculumMap_.end()) {
-        return it->second;
-    }
-    return "Unknown Program";
-}
-
 void StudentListWidget::loadStudents() {
-    if (!apiService_) {
+    if (!model_) {
         LOG_WARN("StudentList", "API service not available");
         return;
     }
 
-    try {
-        LOG_DEBUG("StudentList", "Loading students...");
-
-        auto response = apiService_->getApiClient()->get("/Student");
+    LOG_DEBUG("StudentList", "Loading students...");
 
-        if (!response.success) {
-            LOG_ERROR("StudentList", "Failed to load students: " << response.errorMessage);
-            return;
-        }
-
-        auto jsonResponse = nlohmann::json::parse(response.body);
-        allStudents_.clear();
-
-        if (jsonResponse.contains("data") && jsonResponse["data"].is_array()) {
-            for (const auto& studentData : jsonResponse["data"]) {
-                ::StudentIntake::Models::Student student;
-
-                if (studentData.contains("id")) {
-                    if (studentData["id"].is_string()) {
-                        student.setId(studentData["id"].get<std::string>());
-                    } else {
-                        student.setId(std::to_string(studentData["id"].get<int>()));
-                    }
-                }
-
-                if (studentData.contains("attributes")) {
-                    auto& attrs = studentData["attributes"];
-
-                    if (attrs.contains("email") && !attrs["email"].is_null()) {
-                        student.setEmail(attrs["email"].get<std::string>());
-                    }
-                    if (attrs.contains("first_name") && !attrs["first_name"].is_null()) {
-                        student.setFirstName(attrs["first_name"].get<std::string>());
-                    }
-                    if (attrs.contains("last_name") && !attrs["last_name"].is_null()) {
-                        student.setLastName(attrs["last_name"].get<std::string>());
-                    }
-                    if (attrs.contains("created_at") && !attrs["created_at"].is_null()) {
-                        student.setCreatedAt(attrs["created_at"].get<std::string>());
-                    }
-                    // Load curriculum_id
-                    if (attrs.contains("curriculum_id") && !attrs["curriculum_id"].is_null()) {
-                        if (attrs["curriculum_id"].is_string()) {
-                            student.setCurriculumId(attrs["curriculum_id"].get<std::string>());
-                        } else {
-                            student.setCurriculumId(std::to_string(attrs["curriculum_id"].get<int>()));
-                        }
-                    }
-                    // Load status
-                    if (attrs.contains("status") && !attrs["status"].is_null()) {
-                        student.setStatus(attrs["status"].get<std::string>());
-                    } else {
-                        student.setStatus("active");  // Default to active if not specified
-                    }
-
-                    // Check if login is revoked - override status to "revoked" if true
-                    if (attrs.contains("is_login_revoked") && !attrs["is_login_revoked"].is_null()) {
-                        if (attrs["is_login_revoked"].get<bool>()) {
-                            student.setStatus("revoked");
-                        }
-                    }
-                }
-
-                allStudents_.push_back(student);
-            }
-        }
-
-        LOG_DEBUG("StudentList", "Loaded " << allStudents_.size() << " students");
-        updateTable(allStudents_);
-        updateStats();  // Update stat cards with correct counts
+    // Refetch from the first page with whatever filters are still selected
+    directory_->invalidate();
+    applyFilters();
+    updateStats();
+}
 
-    } catch (const std::exception& e) {
-        LOG_ERROR("StudentList", "Exception loading students: " << e.what());
+void StudentListWidget::scheduleSearch() {
+    // Wait for a pause in typing instead of querying on every keystroke
+    if (!searchTimer_) {
+        searchTimer_ = std::make_unique<Wt::WTimer>();
+        searchTimer_->setSingleShot(true);
+        searchTimer_->setInterval(std::chrono::milliseconds(300));
+        searchTimer_->timeout().connect([this] {
+            applyFilters();
+        });
     }
+    searchTimer_->start();
 }
 
 void StudentListWidget::applyFilters() {
-    std::string searchTerm = searchInput_->text().toUTF8();
-    int programIndex = programFilter_->currentIndex();
-    int statusIndex = statusFilter_->currentIndex();
-
-    std::vector<::StudentIntake::Models::Student> filtered;
-
-    for (const auto& student : allStudents_) {
-        bool matches = true;
-
-        // Search filter (name or email)
-        if (!searchTerm.empty()) {
-            std::string fullName = student.getFullName();
-            std::string email = student.getEmail();
-
-            // Case-insensitive search
-            std::transform(fullName.begin(), fullName.end(), fullName.begin(), ::tolower);
-            std::transform(email.begin(), email.end(), email.begin(), ::tolower);
-            std::string searchLower = searchTerm;
-            std::transform(searchLower.begin(), searchLower.end(), searchLower.begin(), ::tolower);
-
-            if (fullName.find(searchLower) == std::string::npos &&
-                email.find(searchLower) == std::string::npos) {
-                matches = false;
-            }
-        }
-
-        // Program filter (index 0 is "All Programs")
-        if (programIndex > 0 && matches) {
-            std::string selectedProgram = programFilter_->currentText().toUTF8();
-            std::string studentProgram = getProgramName(student.getCurriculumId());
-            if (studentProgram != selectedProgram) {
-                matches = false;
-            }
-        }
-
-        // Status filter (index 0 is "All Status")
-        if (statusIndex > 0 && matches) {
-            std::string selectedStatus = statusFilter_->currentText().toUTF8();
-            std::string studentStatus = student.getStatus();
-
-            // Case-insensitive comparison
-            std::transform(selectedStatus.begin(), selectedStatus.end(), selectedStatus.begin(), ::tolower);
-            std::transform(studentStatus.begin(), studentStatus.end(), studentStatus.begin(), ::tolower);
+    if (!model_) {
+        return;
+    }
+    if (searchTimer_) {
+        searchTimer_->stop();
+    }
 
-            if (studentStatus != selectedStatus) {
-                matches = false;
-            }
-        }
+    std::string curriculumId;
+    int programIndex = programFilter_->currentIndex();
+    if (programIndex > 0 && programIndex < static_cast<int>(programFilterIds_.size())) {
+        curriculumId = programFilterIds_[programIndex];
+    }
 
-        if (matches) {
-            filtered.push_back(student);
-        }
+    // Index 0 is "All Status"; the rest match the lowercase status values
+    std::string status;
+    if (statusFilter_->currentIndex() > 0) {
+        status = statusFilter_->currentText().toUTF8();
+        std::transform(status.begin(), status.end(), status.begin(), ::tolower);
     }
 
-    updateTable(filtered);
-    updateStats();
+    model_->setFilter(searchInput_->text().toUTF8(), curriculumId, status);
+    updateResultCount();
 }
 
 void StudentListWidget::updateStats() {
-    int activeCount = 0, pendingCount = 0, completedCount = 0, revokedCount = 0;
-
-    for (const auto& student : allStudents_) {
-        std::string status = student.getStatus();
-        // Convert to lowercase for comparison
-        std::transform(status.begin(), status.end(), status.begin(), ::tolower);
+    // Shared precomputed counters when they are loaded
+    auto snapshot = Api::AdminStatisticsService::getInstance().getSnapshot();
+    if (snapshot->valid) {
+        activeCountText_->setText(std::to_string(snapshot->statusCount("active")));
+        pendingCountText_->setText(std::to_string(snapshot->statusCount("pending")));
+        completedCountText_->setText(std::to_string(snapshot->statusCount("completed")));
+        revokedCountText_->setText(std::to_string(snapshot->statusCount("revoked")));
+        return;
+    }
 
-        if (status == "active") activeCount++;
-        else if (status == "pending") pendingCount++;
-        else if (status == "completed") completedCount++;
-        else if (status == "revoked") revokedCount++;
+    if (!directory_) {
+        return;
     }
 
-    activeCountText_->setText(std::to_string(activeCount));
-    pendingCountText_->setText(std::to_string(pendingCount));
-    completedCountText_->setText(std::to_string(completedCount));
-    revokedCountText_->setText(std::to_string(revokedCount));
+    // Otherwise one single-row count query per card
+    auto countFor = [this](const std::string& status) {
+        Api::StudentQuery query;
+        query.status = status;
+        return std::to_string(directory_->countStudents(query));
+    };
+
+    activeCountText_->setText(countFor("active"));
+    pendingCountText_->setText(countFor("pending"));
+    completedCountText_->setText(countFor("completed"));
+    revokedCountText_->setText(countFor("revoked"));
+}
+
+void StudentListWidget::updateResultCount() {
+    int total = model_ ? model_->rowCount() : 0;
+    if (directory_ && total > 0 && !directory_->isTotalKnown()) {
+        resultCount_->setText("Showing the first " + std::to_string(total) +
+                              " student(s); total unknown");
+        return;
+    }
+    resultCount_->setText("Showing " + std::to_string(total) + " student(s)");
 }
 
 void StudentListWidget::clearFilters() {
     searchInput_->setText("");
     programFilter_->setCurrentIndex(0);
     statusFilter_->setCurrentIndex(0);
-    updateTable(allStudents_);
-}
-
-void StudentListWidget::updateTable(const std::vector<::StudentIntake::Models::Student>& students) {
-    // Clear existing rows (except header)
-    while (studentTable_->rowCount() > 1) {
-        studentTable_->removeRow(1);
-    }
-
-    // Update result count
-    resultCount_->setText("Showing " + std::to_string(students.size()) + " student(s)");
-
-    // Add student rows
-    int row = 1;
-    for (const auto& student : students) {
-        // Student icon
-        auto iconCell = studentTable_->elementAt(row, 0)->addWidget(
-            std::make_unique<Wt::WText>("👤"));
-        iconCell->addStyleClass("admin-row-icon student-icon");
-
-        studentTable_->elementAt(row, 1)->addWidget(
-            std::make_unique<Wt::WText>(student.getId()));
-
-        studentTable_->elementAt(row, 2)->addWidget(
-            std::make_unique<Wt::WText>(student.getFullName()));
-
-        studentTable_->elementAt(row, 3)->addWidget(
-            std::make_unique<Wt::WText>(student.getEmail()));
-
-        // Program - use actual curriculum data
-        std::string programName = getProgramName(student.getCurriculumId());
-        studentTable_->elementAt(row, 4)->addWidget(
-            std::make_unique<Wt::WText>(programName));
-
-        // Status badge - use actual student status
-        std::string status = student.getStatus();
-        if (status.empty()) {
-            status = "Active";
-        } else {
-            // Capitalize first letter for display
-            status[0] = std::toupper(status[0]);
-        }
-        auto statusBadge = studentTable_->elementAt(row, 5)->addWidget(
-            std::make_unique<Wt::WText>(status));
-        statusBadge->addStyleClass(getStatusBadgeClass(student.getStatus()));
-
-        // Enrolled date
-        studentTable_->elementAt(row, 6)->addWidget(
-            std::make_unique<Wt::WText>(formatDate(student.getCreatedAt())));
-
-        // Actions
-        auto actionsContainer = studentTable_->elementAt(row, 7)->addWidget(
-            std::make_unique<Wt::WContainerWidget>());
-        actionsContainer->addStyleClass("admin-table-actions");
-
-        auto viewBtn = actionsContainer->addWidget(
-            std::make_unique<Wt::WPushButton>("View"));
-        viewBtn->addStyleClass("btn btn-sm btn-primary");
-
-        int studentId = std::stoi(student.getId());
-        viewBtn->clicked().connect([this, studentId]() {
-            onStudentRowClicked(studentId);
-        });
-
-        // Style row
-        for (int col = 0; col < 8; col++) {
-            studentTable_->elementAt(row, col)->addStyleClass("admin-table-cell");
-        }
-
-        row++;
-    }
+    applyFilters();
 }
 
 void StudentListWidget::onStudentRowClicked(int studentId) {
@@ -673,23 +544,5 @@ void StudentListWidget::showAddStudentDialog() {
     dialog->show();
 }
 
-std::string StudentListWidget::formatDate(const std::string& dateStr) {
-    if (dateStr.empty()) return "-";
-
-    // Try to extract just the date part (YYYY-MM-DD)
-    if (dateStr.length() >= 10) {
-        return dateStr.substr(0, 10);
-    }
-    return dateStr;
-}
-
-std::string StudentListWidget::getStatusBadgeClass(const std::string& status) {
-    if (status == "active") return "badge badge-success";
-    if (status == "pending") return "badge badge-warning";
-    if (status == "completed") return "badge badge-info";
-    if (status == "revoked") return "badge badge-danger";
-    return "badge badge-secondary";
-}
-
 } // namespace Admin
 } // namespace StudentIntake
@@ -5,7 +5,8 @@
 #include <Wt/WLineEdit.h>
 #include <Wt/WComboBox.h>
 #include <Wt/WPushButton.h>
-#include <Wt/WTable.h>
+#include <Wt/WTableView.h>
+#include <Wt/WTimer.h>
 #include <Wt/WText.h>
 #include <Wt/WSignal.h>
 #include <Wt/WDialog.h>
@@ -14,6 +15,8 @@
 #include <map>
 #include "../../models/Student.h"
 #include "../../api/FormSubmissionService.h"
+#include "../../api/StudentDirectory.h"
+#include "StudentTableModel.h"
 
 namespace StudentIntake {
 namespace Admin {
@@ -37,18 +40,18 @@ private:
     void loadStudents();
     void loadCurriculum();
     void applyFilters();
+    void scheduleSearch();
     void updateStats();
-    std::string getProgramName(const std::string& curriculumId) const;
+    void updateResultCount();
     void clearFilters();
-    void updateTable(const std::vector<::StudentIntake::Models::Student>& students);
     void onStudentRowClicked(int studentId);
     void showAddStudentDialog();
-    std::string formatDate(const std::string& dateStr);
-    std::string getStatusBadgeClass(const std::string& status);
 
     std::shared_ptr<Api::FormSubmissionService> apiService_;
-    std::vector<::StudentIntake::Models::Student> allStudents_;
+    std::shared_ptr<Api::StudentDirectory> directory_;
+    std::shared_ptr<StudentTableModel> model_;
     std::map<std::string, std::string> curriculumMap_;  // curriculum_id -> program_name
+    std::vector<std::string> programFilterIds_;         // curriculum_id per programFilter_ item
 
     // UI Elements - Stats
     Wt::WContainerWidget* statsContainer_;
@@ -66,9 +69,12 @@ private:
     Wt::WComboBox* statusFilter_;
     Wt::WPushButton* clearButton_;
     Wt::WContainerWidget* tableContainer_;
-    Wt::WTable* studentTable_;
+    Wt::WTableView* studentTable_;
     Wt::WText* resultCount_;
 
+    // Debounces search keystrokes into one backend query
+    std::unique_ptr<Wt::WTimer> searchTimer_;
+
     // Signal
     Wt::Signal<int> studentSelected_;
 };
@@ -0,0 +1,165 @@
+#include "StudentTableModel.h"
+
+namespace StudentIntake {
+namespace Admin {
+
+StudentTableModel::StudentTableModel(std::shared_ptr<Api::StudentDirectory> directory)
+    : WAbstractTableModel()
+    , directory_(directory) {
+}
+
+int StudentTableModel::rowCount(const Wt::WModelIndex& parent) const {
+    if (parent.isValid() || !directory_) {
+        return 0;
+    }
+    return directory_->getTotalCount();
+}
+
+int StudentTableModel::columnCount(const Wt::WModelIndex& parent) const {
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+Wt::cpp17::any StudentTableModel::data(const Wt::WModelIndex& index, Wt::ItemDataRole role) const {
+    if (!index.isValid() || !directory_) {
+        return Wt::cpp17::any();
+    }
+    if (role != Wt::ItemDataRole::Display && role != Wt::ItemDataRole::StyleClass) {
+        return Wt::cpp17::any();
+    }
+
+    ::StudentIntake::Models::Student student;
+    if (!directory_->getStudent(index.row(), student)) {
+        return Wt::cpp17::any();
+    }
+    if (index.column() == 0) {
+        // The view asks row by row, so one prefetch per row is enough
+        directory_->prefetchAround(index.row());
+    }
+
+    std::string status = student.getStatus();
+    if (role == Wt::ItemDataRole::StyleClass) {
+        if (index.column() == StatusColumn) {
+            if (status == "active") return std::string("badge badge-success");
+            if (status == "pending") return std::string("badge badge-warning");
+            if (status == "completed") return std::string("badge badge-info");
+            if (status == "revoked") return std::string("badge badge-danger");
+            return std::string("badge badge-secondary");
+        }
+        if (index.column() == ActionsColumn) {
+            return std::string("admin-table-link");
+        }
+        return Wt::cpp17::any();
+    }
+
+    switch (index.column()) {
+        case IdColumn:
+            return student.getId();
+        case NameColumn:
+            return student.getFullName();
+        case EmailColumn:
+            return student.getEmail();
+        case ProgramColumn:
+            return getProgramName(student.getCurriculumId());
+        case StatusColumn:
+            if (status.empty()) {
+                return std::string("Active");
+            }
+            status[0] = std::toupper(status[0]);
+            return status;
+        case EnrolledColumn: {
+            std::string created = student.getCreatedAt();
+            if (created.empty()) return std::string("-");
+            return created.length() >= 10 ? created.substr(0, 10) : created;
+        }
+        case ActionsColumn:
+            return std::string("View");
+        default:
+            return Wt::cpp17::any();
+    }
+}
+
+Wt::cpp17::any StudentTableModel::headerData(int section, Wt::Orientation orientation,
+                                             Wt::ItemDataRole role) const {
+    if (orientation != Wt::Orientation::Horizontal || role != Wt::ItemDataRole::Display) {
+        return Wt::cpp17::any();
+    }
+
+    switch (section) {
+        case IdColumn: return std::string("ID");
+        case NameColumn: return std::string("Name");
+        case EmailColumn: return std::string("Email");
+        case ProgramColumn: return std::string("Program");
+        case StatusColumn: return std::string("Status");
+        case EnrolledColumn: return std::string("Enrolled");
+        case ActionsColumn: return std::string("Actions");
+        default: return Wt::cpp17::any();
+    }
+}
+
+void StudentTableModel::sort(int column, Wt::SortOrder order) {
+    std::string field = sortFieldForColumn(column);
+    if (!directory_ || field.empty()) {
+        return;
+    }
+
+    auto query = directory_->getQuery();
+    query.sortField = field;
+    query.sortAscending = order == Wt::SortOrder::Ascending;
+
+    layoutAboutToBeChanged().emit();
+    directory_->setQuery(query);
+    layoutChanged().emit();
+}
+
+void StudentTableModel::setFilter(const std::string& search, const std::string& curriculumId,
+                                  const std::string& status) {
+    if (!directory_) {
+        return;
+    }
+
+    auto query = directory_->getQuery();
+    query.search = search;
+    query.curriculumId = curriculumId;
+    query.status = status;
+    directory_->setQuery(query);
+    reset();
+}
+
+void StudentTableModel::setProgramNames(const std::map<std::string, std::string>& programNames) {
+    programNames_ = programNames;
+}
+
+int StudentTableModel::getStudentId(int row) const {
+    ::StudentIntake::Models::Student student;
+    if (!directory_ || !directory_->getStudent(row, student)) {
+        return 0;
+    }
+    try {
+        return std::stoi(student.getId());
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+std::string StudentTableModel::getProgramName(const std::string& curriculumId) const {
+    auto it = programNames_.find(curriculumId);
+    if (it != programNames_.end()) {
+        return it->second;
+    }
+    return "Unknown Program";
+}
+
+std::string StudentTableModel::sortFieldForColumn(int column) {
+    switch (column) {
+        case IdColumn: return "id";
+        case NameColumn: return "name";
+        case EmailColumn: return "email";
+        case ProgramColumn: return "curriculum_id";
+        case StatusColumn: return "status";
+        case EnrolledColumn: return "created_at";
+        default: return "";
+    }
+}
+
+} // namespace Admin
+} // namespace StudentIntake
@@ -0,0 +1,65 @@
+#ifndef STUDENT_TABLE_MODEL_H
+#define STUDENT_TABLE_MODEL_H
+
+#include <Wt/WAbstractTableModel.h>
+#include <map>
+#include <memory>
+#include <string>
+#include "../../api/StudentDirectory.h"
+
+namespace StudentIntake {
+namespace Admin {
+
+/**
+ * @brief Lazy table model over the paged student directory
+ *
+ * WTableView only asks for the rows in its viewport, so data() pulls the
+ * containing page from the directory on demand and queues its neighbours.
+ * Sorting and filtering are pushed to the backend through the directory
+ * query; the model just resets itself when either changes.
+ */
+class StudentTableModel : public Wt::WAbstractTableModel {
+public:
+    enum Column {
+        IdColumn = 0,
+        NameColumn,
+        EmailColumn,
+        ProgramColumn,
+        StatusColumn,
+        EnrolledColumn,
+        ActionsColumn,
+        ColumnCount
+    };
+
+    explicit StudentTableModel(std::shared_ptr<Api::StudentDirectory> directory);
+
+    int rowCount(const Wt::WModelIndex& parent = Wt::WModelIndex()) const override;
+    int columnCount(const Wt::WModelIndex& parent = Wt::WModelIndex()) const override;
+    Wt::cpp17::any data(const Wt::WModelIndex& index,
+                        Wt::ItemDataRole role = Wt::ItemDataRole::Display) const override;
+    Wt::cpp17::any headerData(int section, Wt::Orientation orientation = Wt::Orientation::Horizontal,
+                              Wt::ItemDataRole role = Wt::ItemDataRole::Display) const override;
+    void sort(int column, Wt::SortOrder order = Wt::SortOrder::Ascending) override;
+
+    // Apply a filter (sort is kept) and reload from the first page
+    void setFilter(const std::string& search, const std::string& curriculumId,
+                   const std::string& status);
+
+    // Program column labels; shown from the next filter or sort change
+    void setProgramNames(const std::map<std::string, std::string>& programNames);
+
+    // Student id at a view row, or 0 if the row is not loaded
+    int getStudentId(int row) const;
+
+private:
+    std::string getProgramName(const std::string& curriculumId) const;
+    static std::string sortFieldForColumn(int column);
+
+    std::shared_ptr<Api::StudentDirectory> directory_;
+    std::map<std::string, std::string> programNames_;  // curriculum_id -> program_name
+};
+
+} // namespace Admin
+} // namespace StudentIntake
+
+#endif // STUDENT_TABLE_MODEL_H
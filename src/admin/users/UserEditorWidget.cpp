@@ -3,6 +3,7 @@
 #include <Wt/WHBoxLayout.h>
 #include <Wt/WLabel.h>
 #include "utils/Logger.h"
+#include "api/AdminStatisticsService.h"
 #include <nlohmann/json.hpp>
 
 namespace StudentIntake {
@@ -654,6 +655,7 @@ bool UserEditorWidget::createStudent(int userId) {
 
     auto response = apiClient_->post("/Student", payload);
     if (response.success) {
+        Api::AdminStatisticsService::getInstance().applyStudentResponse(response);
         LOG_INFO("UserEditorWidget", "Created Student for user " << userId);
         return true;
     } else {
@@ -730,6 +732,7 @@ bool UserEditorWidget::deleteStudent(int userId) {
                         std::to_string(item["id"].get<int>());
                     auto delResponse = apiClient_->del("/Student/" + recordId);
                     if (delResponse.success) {
+                        Api::AdminStatisticsService::getInstance().removeStudent(recordId);
                         LOG_INFO("UserEditorWidget", "Deleted Student " << recordId << " for user " << userId);
                     }
                 }
@@ -3,6 +3,7 @@
 #include <Wt/WHBoxLayout.h>
 #include <Wt/WTableRow.h>
 #include <algorithm>
+#include <unordered_map>
 #include "utils/Logger.h"
 
 namespace StudentIntake {
@@ -12,6 +13,7 @@ UserListWidget::UserListWidget()
     : apiClient_(nullptr)
     , authService_(nullptr)
     , isCurrentUserAdmin_(false)
+    , searchIndex_(Api::SearchIndexRegistry::getInstance().getIndex("users"))
     , titleText_(nullptr)
     , subtitleText_(nullptr)
     , statsContainer_(nullptr)
@@ -271,6 +273,7 @@ void UserListWidget::loadUsers() {
     }
 
     allUsers_.clear();
+    std::vector<std::pair<std::string, std::vector<std::string>>> searchRecords;
 
     // Try to load from AppUser table first
     auto response = apiClient_->get("/AppUser");
@@ -280,6 +283,10 @@ void UserListWidget::loadUsers() {
         for (const auto& item : json["data"]) {
             auto user = StudentIntake::Models::User::fromJson(item);
 
+            // Index every user, not just the ones this viewer may see;
+            // the index is shared with other admin sessions
+            searchRecords.push_back({std::to_string(user.getId()), {user.getFullName(), user.getEmail()}});
+
             // Get roles for this user
             if (authService_) {
                 auto roles = authService_->getUserRoles(user.getId());
@@ -299,6 +306,9 @@ void UserListWidget::loadUsers() {
 
             allUsers_.push_back(user);
         }
+
+        size_t changed = searchIndex_->sync(searchRecords);
+        LOG_DEBUG("UserListWidget", "Search index updated (" << changed << " changes)");
     }
 
     updateStats();
@@ -327,23 +337,23 @@ void UserListWidget::applyFilters() {
     std::vector<StudentIntake::Models::User> filtered;
 
     std::string searchTerm = searchInput_->text().toUTF8();
-    std::transform(searchTerm.begin(), searchTerm.end(), searchTerm.begin(), ::tolower);
+
+    // Ranked ids from the shared index; rank orders the filtered list
+    std::unordered_map<int, size_t> searchRank;
+    bool searching = searchTerm.find_first_not_of(" \t") != std::string::npos;
+    if (searching) {
+        for (const auto& match : searchIndex_->search(searchTerm)) {
+            searchRank.emplace(std::stoi(match.id), searchRank.size());
+        }
+    }
 
     int roleIndex = roleFilter_->currentIndex();
     int statusIndex = statusFilter_->currentIndex();
 
     for (const auto& user : allUsers_) {
         // Search filter
-        if (!searchTerm.empty()) {
-            std::string name = user.getFullName();
-            std::string email = user.getEmail();
-            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
-            std::transform(email.begin(), email.end(), email.begin(), ::tolower);
-
-            if (name.find(searchTerm) == std::string::npos &&
-                email.find(searchTerm) == std::string::npos) {
-                continue;
-            }
+        if (searching && searchRank.count(user.getId()) == 0) {
+            continue;
         }
 
         // Role filter (from dropdown or placard click)
@@ -388,6 +398,13 @@ void UserListWidget::applyFilters() {
         filtered.push_back(user);
     }
 
+    if (searching) {
+        std::stable_sort(filtered.begin(), filtered.end(),
+            [&searchRank](const StudentIntake::Models::User& a, const StudentIntake::Models::User& b) {
+                return searchRank[a.getId()] < searchRank[b.getId()];
+            });
+    }
+
     updateTable(filtered);
     resultCount_->setText("Showing " + std::to_string(filtered.size()) + " user(s)");
 }
@@ -12,6 +12,7 @@
 #include <memory>
 #include "models/User.h"
 #include "api/ApiClient.h"
+#include "api/TextSearchIndex.h"
 #include "auth/AuthService.h"
 
 namespace StudentIntake {
@@ -53,6 +54,7 @@ private:
     std::vector<StudentIntake::Models::User> allUsers_;
     std::vector<StudentIntake::Models::UserRole> currentUserRoles_;
     bool isCurrentUserAdmin_;
+    std::shared_ptr<Api::TextSearchIndex> searchIndex_;  // name/email, shared by admin sessions
 
     // UI Elements - Header
     Wt::WText* titleText_;
@@ -0,0 +1,312 @@
+#include "ActivityFeed.h"
+#include "ActivityLogService.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+constexpr int kDefaultPollIntervalMs = 15000;
+constexpr size_t kDefaultHistorySize = 500;
+constexpr int kPageSize = 100;
+constexpr int kMaxPagesPerPoll = 10;
+
+} // namespace
+
+ActivityFeed& ActivityFeed::getInstance() {
+    static ActivityFeed instance;
+    return instance;
+}
+
+ActivityFeed::ActivityFeed()
+    : pollIntervalMs_(kDefaultPollIntervalMs)
+    , historySize_(kDefaultHistorySize)
+    , sequence_(0)
+    , lastId_(0)
+    , baselineLoaded_(false)
+    , queries_(0)
+    , nextSubscription_(1)
+    , running_(false)
+    , stopRequested_(false)
+    , notified_(false) {
+}
+
+ActivityFeed::~ActivityFeed() {
+    stop();
+}
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void ActivityFeed::setApiClient(std::shared_ptr<ApiClient> client) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_ = client;
+}
+
+void ActivityFeed::setPollInterval(int milliseconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pollIntervalMs_ = milliseconds > 0 ? milliseconds : 1;
+}
+
+void ActivityFeed::setHistorySize(size_t activities) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    historySize_ = activities > 0 ? activities : 1;
+    while (history_.size() > historySize_) {
+        history_.pop_front();
+    }
+}
+
+// =============================================================================
+// Background Tail
+// =============================================================================
+
+void ActivityFeed::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    tail_ = std::thread([this]() { tailLoop(); });
+    LOG_DEBUG("ActivityFeed", "Live tail started (poll every " << pollIntervalMs_ << "ms while watched)");
+}
+
+void ActivityFeed::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    wakeTail_.notify_all();
+
+    if (tail_.joinable()) {
+        tail_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    stopRequested_ = false;
+}
+
+bool ActivityFeed::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+void ActivityFeed::tailLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopRequested_) {
+        // Nobody watching: no queries at all until someone subscribes
+        if (listeners_.empty()) {
+            wakeTail_.wait(lock, [this]() { return stopRequested_ || !listeners_.empty(); });
+            continue;
+        }
+
+        wakeTail_.wait_for(lock, std::chrono::milliseconds(pollIntervalMs_), [this]() {
+            return stopRequested_ || notified_ || listeners_.empty();
+        });
+        if (stopRequested_ || listeners_.empty()) {
+            continue;
+        }
+        notified_ = false;
+
+        lock.unlock();
+        poll();
+        lock.lock();
+    }
+}
+
+// =============================================================================
+// Subscriptions
+// =============================================================================
+
+int ActivityFeed::subscribe(Listener listener) {
+    std::shared_ptr<ApiClient> client;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client = apiClient_;
+    }
+
+    // The first subscriber starts the tail at the newest stored activity, so
+    // it only reports what arrives from now on (the caller loads the history)
+    {
+        std::lock_guard<std::mutex> pollLock(pollMutex_);
+        bool loaded;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            loaded = baselineLoaded_;
+        }
+        if (!loaded && client) {
+            ApiResponse response = client->get("/ActivityLog?sort=-id&page[limit]=1");
+            int newest = 0;
+            if (response.isSuccess()) {
+                try {
+                    nlohmann::json json = response.getJson();
+                    if (json.contains("data") && json["data"].is_array() && !json["data"].empty()) {
+                        const auto& id = json["data"][0]["id"];
+                        newest = id.is_string() ? std::stoi(id.get<std::string>()) : id.get<int>();
+                    }
+                } catch (const std::exception& e) {
+                    LOG_WARN("ActivityFeed", "Cannot read newest activity id: " << e.what());
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            queries_++;
+            if (response.isSuccess()) {
+                lastId_ = newest;
+                baselineLoaded_ = true;
+            }
+        }
+    }
+
+    int subscription;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        subscription = nextSubscription_++;
+        listeners_[subscription] = std::move(listener);
+    }
+    wakeTail_.notify_all();
+    return subscription;
+}
+
+void ActivityFeed::unsubscribe(int subscription) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    listeners_.erase(subscription);
+    if (listeners_.empty()) {
+        // Unwatched activities are not tracked; the next subscriber starts afresh
+        baselineLoaded_ = false;
+    }
+}
+
+size_t ActivityFeed::getSubscriberCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return listeners_.size();
+}
+
+void ActivityFeed::notify() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (listeners_.empty()) {
+            return;
+        }
+        notified_ = true;
+    }
+    wakeTail_.notify_all();
+}
+
+// =============================================================================
+// Polling
+// =============================================================================
+
+int ActivityFeed::poll() {
+    std::lock_guard<std::mutex> pollLock(pollMutex_);
+
+    std::shared_ptr<ApiClient> client;
+    int lastId;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!apiClient_ || !baselineLoaded_) {
+            return 0;
+        }
+        client = apiClient_;
+        lastId = lastId_;
+    }
+
+    ActivityLogService service(client);
+    std::vector<Models::ActivityLog> received;
+    int queries = 0;
+    for (int page = 0; page < kMaxPagesPerPoll; ++page) {
+        bool ok = false;
+        auto rows = service.getActivitiesAfter(lastId, kPageSize, &ok);
+        queries++;
+        if (!ok) {
+            break;
+        }
+        for (auto& row : rows) {
+            lastId = std::max(lastId, row.getId());
+            received.push_back(std::move(row));
+        }
+        if (static_cast<int>(rows.size()) < kPageSize) {
+            break;
+        }
+    }
+
+    std::vector<Listener> listeners;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queries_ += queries;
+        if (!baselineLoaded_) {
+            // Everyone unsubscribed while this poll ran
+            return 0;
+        }
+        lastId_ = lastId;
+        for (auto& activity : received) {
+            history_.emplace_back(++sequence_, std::move(activity));
+        }
+        while (history_.size() > historySize_) {
+            history_.pop_front();
+        }
+        if (!received.empty()) {
+            for (const auto& entry : listeners_) {
+                listeners.push_back(entry.second);
+            }
+        }
+    }
+
+    for (const auto& listener : listeners) {
+        listener();
+    }
+    if (!received.empty()) {
+        LOG_DEBUG("ActivityFeed", "Pushed " << received.size() << " new activities to "
+                  << listeners.size() << " subscribers");
+    }
+    return static_cast<int>(received.size());
+}
+
+std::vector<Models::ActivityLog> ActivityFeed::getSince(uint64_t& sequence) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Models::ActivityLog> activities;
+    for (const auto& entry : history_) {
+        if (entry.first > sequence) {
+            activities.push_back(entry.second);
+        }
+    }
+    sequence = std::max(sequence, sequence_);
+    return activities;
+}
+
+uint64_t ActivityFeed::getLatestSequence() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sequence_;
+}
+
+int ActivityFeed::getQueryCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queries_;
+}
+
+void ActivityFeed::reset() {
+    std::lock_guard<std::mutex> pollLock(pollMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_.reset();
+    pollIntervalMs_ = kDefaultPollIntervalMs;
+    historySize_ = kDefaultHistorySize;
+    history_.clear();
+    sequence_ = 0;
+    lastId_ = 0;
+    baselineLoaded_ = false;
+    queries_ = 0;
+    listeners_.clear();
+    notified_ = false;
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,112 @@
+#ifndef ACTIVITY_FEED_H
+#define ACTIVITY_FEED_H
+
+#include <string>
+#include <memory>
+#include <deque>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+#include <cstdint>
+#include "ApiClient.h"
+#include "models/ActivityLog.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Process-wide live tail of the activity log for open admin views
+ *
+ * One background thread reads activities stored after the newest id it has
+ * seen and keeps the most recent ones, each numbered with a feed sequence.
+ * Subscribers are told that new activities arrived and read them with
+ * getSince(); a subscriber is a listener that typically posts a server
+ * push to its session. With no subscribers the thread sleeps without
+ * querying. notify() (called when this server writes activities) wakes it
+ * at once; activities written elsewhere are picked up at the poll interval.
+ *
+ * Listeners are called on the feed thread without the feed lock held.
+ * Thread-safe singleton shared by all admin sessions.
+ */
+class ActivityFeed {
+public:
+    using Listener = std::function<void()>;
+
+    // Singleton access
+    static ActivityFeed& getInstance();
+
+    // Prevent copying
+    ActivityFeed(const ActivityFeed&) = delete;
+    ActivityFeed& operator=(const ActivityFeed&) = delete;
+
+    // Configuration
+    void setApiClient(std::shared_ptr<ApiClient> client);
+    void setPollInterval(int milliseconds);
+    void setHistorySize(size_t activities);
+
+    // Background tail lifecycle
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    /**
+     * @brief Register a listener for new activities
+     * @return Subscription id for unsubscribe()
+     */
+    int subscribe(Listener listener);
+    void unsubscribe(int subscription);
+    size_t getSubscriberCount() const;
+
+    // Activities were written; read them soon if anyone is listening
+    void notify();
+
+    // Read new activities now and tell subscribers; returns the number read
+    int poll();
+
+    /**
+     * @brief Activities received after sequence, oldest first
+     * @param sequence Last sequence the caller has seen; advanced to the newest returned
+     */
+    std::vector<Models::ActivityLog> getSince(uint64_t& sequence) const;
+    uint64_t getLatestSequence() const;
+
+    int getQueryCount() const;
+
+    // Drop history, subscribers and configuration (used by tests)
+    void reset();
+
+private:
+    ActivityFeed();
+    ~ActivityFeed();
+
+    void tailLoop();
+
+    std::shared_ptr<ApiClient> apiClient_;
+    int pollIntervalMs_;
+    size_t historySize_;
+
+    std::deque<std::pair<uint64_t, Models::ActivityLog>> history_;
+    uint64_t sequence_;
+    int lastId_;                    // newest activity id seen; 0 until the first poll
+    bool baselineLoaded_;
+    int queries_;
+
+    std::map<int, Listener> listeners_;
+    int nextSubscription_;
+
+    mutable std::mutex mutex_;
+    std::mutex pollMutex_;
+    std::condition_variable wakeTail_;
+    std::thread tail_;
+    bool running_;
+    bool stopRequested_;
+    bool notified_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // ACTIVITY_FEED_H
@@ -0,0 +1,468 @@
+#include "ActivityLogQueue.h"
+#include "ActivityFeed.h"
+#include "EventSpool.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+constexpr size_t kDefaultCapacity = 10000;
+constexpr size_t kDefaultBatchSize = 50;
+constexpr int kDefaultFlushIntervalMs = 1000;
+constexpr int kDefaultBlockTimeoutMs = 250;
+
+// A 4xx the backend will give again on retry; 408 and 429 are worth retrying
+bool isRefused(int statusCode) {
+    return statusCode >= 400 && statusCode < 500 && statusCode != 408 && statusCode != 429;
+}
+
+} // namespace
+
+ActivityLogQueue& ActivityLogQueue::getInstance() {
+    static ActivityLogQueue instance;
+    return instance;
+}
+
+ActivityLogQueue::ActivityLogQueue()
+    : capacity_(kDefaultCapacity)
+    , batchSize_(kDefaultBatchSize)
+    , flushIntervalMs_(kDefaultFlushIntervalMs)
+    , policy_(ActivityOverflowPolicy::Spill)
+    , blockTimeoutMs_(kDefaultBlockTimeoutMs)
+    , spillPending_(false)
+    , spillReadOffset_(0)
+    , batchEndpoint_(true)
+    , lastFlushFailed_(false)
+    , running_(false)
+    , stopRequested_(false) {
+}
+
+ActivityLogQueue::~ActivityLogQueue() {
+    stop();
+}
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void ActivityLogQueue::setApiClient(std::shared_ptr<ApiClient> client) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_ = client;
+}
+
+void ActivityLogQueue::setCapacity(size_t events) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = events > 0 ? events : 1;
+}
+
+void ActivityLogQueue::setBatchSize(size_t events) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batchSize_ = events > 0 ? events : 1;
+}
+
+void ActivityLogQueue::setFlushInterval(int milliseconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushIntervalMs_ = milliseconds > 0 ? milliseconds : 1;
+}
+
+void ActivityLogQueue::setOverflowPolicy(ActivityOverflowPolicy policy) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    policy_ = policy;
+}
+
+void ActivityLogQueue::setBlockTimeout(int milliseconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    blockTimeoutMs_ = milliseconds > 0 ? milliseconds : 0;
+}
+
+void ActivityLogQueue::setSpillPath(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    spillPath_ = path;
+    spillReadOffset_ = 0;
+
+    // Events left by a previous run are replayed by the next flush
+    std::ifstream file(spillPath_);
+    spillPending_ = !spillPath_.empty() && file.peek() != std::ifstream::traits_type::eof();
+    if (spillPending_) {
+        LOG_INFO("ActivityLogQueue", "Replaying activity events spilled to " << spillPath_);
+    }
+}
+
+ActivityOverflowPolicy ActivityLogQueue::policyFromString(const std::string& policy) {
+    if (policy == "block") return ActivityOverflowPolicy::Block;
+    if (policy == "drop-oldest") return ActivityOverflowPolicy::DropOldest;
+    return ActivityOverflowPolicy::Spill;
+}
+
+// =============================================================================
+// Background Flusher
+// =============================================================================
+
+void ActivityLogQueue::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    flusher_ = std::thread([this]() { flusherLoop(); });
+    LOG_DEBUG("ActivityLogQueue", "Flusher started (interval " << flushIntervalMs_
+              << "ms, batch " << batchSize_ << ", capacity " << capacity_ << ")");
+}
+
+void ActivityLogQueue::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    wakeFlusher_.notify_all();
+    notFull_.notify_all();
+
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+        stopRequested_ = false;
+    }
+
+    // Final flush; what the backend did not take is kept in the spill file when there is one
+    flush();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+        return;
+    }
+
+    // The durable spool replays them once the backend is back, even across restarts
+    auto& spool = EventSpool::getInstance();
+    size_t spooled = 0;
+    while (!queue_.empty() && spool.isOpen()) {
+        nlohmann::json payload;
+        payload["data"] = queue_.front().resource;
+        if (!spool.append("/ActivityLog", payload)) {
+            break;
+        }
+        queue_.pop_front();
+        spooled++;
+    }
+    if (spooled > 0) {
+        LOG_WARN("ActivityLogQueue", "Moved " << spooled << " unflushed activity events to the event spool");
+    }
+    if (queue_.empty()) {
+        return;
+    }
+
+    std::vector<Event> unflushed(queue_.begin(), queue_.end());
+    if (spillLocked(unflushed)) {
+        LOG_WARN("ActivityLogQueue", "Spilled " << unflushed.size()
+                 << " unflushed activity events to " << spillPath_);
+        queue_.clear();
+    } else {
+        LOG_ERROR("ActivityLogQueue", "Shutdown with " << queue_.size() << " unflushed activity events");
+    }
+}
+
+bool ActivityLogQueue::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+void ActivityLogQueue::flusherLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopRequested_) {
+        // After a failed flush, wait out the interval instead of retrying at once
+        wakeFlusher_.wait_for(lock, std::chrono::milliseconds(flushIntervalMs_), [this]() {
+            return stopRequested_ ||
+                   (!lastFlushFailed_ && queue_.size() >= std::min(batchSize_, capacity_));
+        });
+        if (stopRequested_) {
+            break;
+        }
+
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+// =============================================================================
+// Producers
+// =============================================================================
+
+bool ActivityLogQueue::enqueue(const nlohmann::json& resource) {
+    Event event{resource, Clock::now()};
+    bool wake = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (queue_.size() >= capacity_) {
+            switch (policy_) {
+            case ActivityOverflowPolicy::Block: {
+                wakeFlusher_.notify_one();
+                notFull_.wait_for(lock, std::chrono::milliseconds(blockTimeoutMs_), [this]() {
+                    return queue_.size() < capacity_ || stopRequested_;
+                });
+                if (queue_.size() >= capacity_) {
+                    if (stats_.dropped++ % 1000 == 0) {
+                        LOG_WARN("ActivityLogQueue", "Queue full for " << blockTimeoutMs_
+                                 << "ms; dropped " << stats_.dropped << " activity events so far");
+                    }
+                    return false;
+                }
+                break;
+            }
+            case ActivityOverflowPolicy::DropOldest:
+                queue_.pop_front();
+                if (stats_.dropped++ % 1000 == 0) {
+                    LOG_WARN("ActivityLogQueue", "Queue full; dropped " << stats_.dropped
+                             << " oldest activity events so far");
+                }
+                break;
+            case ActivityOverflowPolicy::Spill:
+                if (spillLocked({event})) {
+                    stats_.enqueued++;
+                    return true;
+                }
+                stats_.dropped++;
+                return false;
+            }
+        }
+
+        queue_.push_back(std::move(event));
+        stats_.enqueued++;
+        stats_.peakDepth = std::max(stats_.peakDepth, queue_.size());
+        wake = running_ && queue_.size() >= batchSize_;
+    }
+
+    if (wake) {
+        wakeFlusher_.notify_one();
+    }
+    return true;
+}
+
+// =============================================================================
+// Flushing
+// =============================================================================
+
+size_t ActivityLogQueue::postBatch(const std::shared_ptr<ApiClient>& client,
+                                   const std::vector<Event>& batch, uint64_t& rejected) {
+    bool useBatchEndpoint;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        useBatchEndpoint = batchEndpoint_;
+    }
+
+    if (useBatchEndpoint && batch.size() > 1) {
+        nlohmann::json payload;
+        payload["data"] = nlohmann::json::array();
+        for (const auto& event : batch) {
+            payload["data"].push_back(event.resource);
+        }
+
+        ApiResponse response = client->post("/ActivityLog/batch", payload);
+        if (response.isSuccess()) {
+            return batch.size();
+        }
+        if (!isRefused(response.statusCode)) {
+            return 0;
+        }
+        if (response.statusCode == 404 || response.statusCode == 405) {
+            LOG_INFO("ActivityLogQueue", "Backend has no /ActivityLog/batch; posting events one at a time");
+            std::lock_guard<std::mutex> lock(mutex_);
+            batchEndpoint_ = false;
+        }
+        // Otherwise one event was refused; posting them singly finds it
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        nlohmann::json payload;
+        payload["data"] = batch[i].resource;
+        ApiResponse response = client->post("/ActivityLog", payload);
+        // Already stored by an attempt whose answer was lost
+        if (response.isSuccess() || EventSpool::isAlreadyStored(*client, "/ActivityLog", payload, response)) {
+            continue;
+        }
+        if (!isRefused(response.statusCode)) {
+            return i;
+        }
+
+        // Retrying it would hold up every event behind it
+        LOG_ERROR("ActivityLogQueue", "Backend refused activity event (" << response.statusCode
+                  << "): " << response.errorMessage);
+        rejected++;
+    }
+    return batch.size();
+}
+
+int ActivityLogQueue::flush() {
+    // Serialize flushes so the flusher thread and shutdown never interleave
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+
+    int posted = 0;
+    bool failed = false;
+    while (!failed) {
+        std::vector<Event> batch;
+        std::shared_ptr<ApiClient> client;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!apiClient_) {
+                break;
+            }
+            replaySpillLocked(std::min(batchSize_, capacity_ > queue_.size() ? capacity_ - queue_.size() : 0));
+            if (queue_.empty()) {
+                break;
+            }
+
+            client = apiClient_;
+            size_t count = std::min(batchSize_, queue_.size());
+            batch.assign(std::make_move_iterator(queue_.begin()),
+                         std::make_move_iterator(queue_.begin() + static_cast<std::ptrdiff_t>(count)));
+            queue_.erase(queue_.begin(), queue_.begin() + static_cast<std::ptrdiff_t>(count));
+        }
+        notFull_.notify_all();
+
+        auto started = Clock::now();
+        uint64_t rejected = 0;
+        size_t handled = postBatch(client, batch, rejected);
+        double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - started).count();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stats_.lastFlushMs = elapsedMs;
+            stats_.maxFlushMs = std::max(stats_.maxFlushMs, elapsedMs);
+            stats_.totalFlushMs += elapsedMs;
+            for (size_t i = 0; i < handled; ++i) {
+                double waitedMs = std::chrono::duration<double, std::milli>(started - batch[i].queuedAt).count();
+                stats_.maxQueueDelayMs = std::max(stats_.maxQueueDelayMs, waitedMs);
+            }
+            stats_.flushed += handled - rejected;
+            stats_.rejected += rejected;
+
+            if (handled < batch.size()) {
+                // Back at the front, so the next flush retries them first
+                stats_.failedBatches++;
+                queue_.insert(queue_.begin(),
+                              std::make_move_iterator(batch.begin() + static_cast<std::ptrdiff_t>(handled)),
+                              std::make_move_iterator(batch.end()));
+                failed = true;
+            } else {
+                stats_.batches++;
+            }
+            lastFlushFailed_ = failed;
+        }
+        posted += static_cast<int>(handled - rejected);
+    }
+
+    if (failed) {
+        LOG_WARN("ActivityLogQueue", "Activity log flush failed; retrying in " << flushIntervalMs_ << "ms");
+    }
+    if (posted > 0) {
+        LOG_DEBUG("ActivityLogQueue", "Flushed " << posted << " activity events");
+        ActivityFeed::getInstance().notify();
+    }
+    return posted;
+}
+
+// =============================================================================
+// Spill File
+// =============================================================================
+
+bool ActivityLogQueue::spillLocked(const std::vector<Event>& events) {
+    if (spillPath_.empty()) {
+        return false;
+    }
+
+    std::ofstream file(spillPath_, std::ios::app);
+    for (const auto& event : events) {
+        file << event.resource.dump() << '\n';
+    }
+    file.flush();
+    if (!file.good()) {
+        LOG_ERROR("ActivityLogQueue", "Cannot write activity spill file " << spillPath_);
+        return false;
+    }
+
+    stats_.spilled += events.size();
+    spillPending_ = true;
+    return true;
+}
+
+void ActivityLogQueue::replaySpillLocked(size_t maxEvents) {
+    if (!spillPending_ || spillPath_.empty() || maxEvents == 0) {
+        return;
+    }
+
+    std::ifstream file(spillPath_);
+    file.seekg(spillReadOffset_);
+
+    std::vector<Event> events;
+    std::string line;
+    while (events.size() < maxEvents && std::getline(file, line)) {
+        spillReadOffset_ += static_cast<std::streamoff>(line.size()) + 1;
+        if (line.empty()) {
+            continue;
+        }
+        nlohmann::json resource = nlohmann::json::parse(line, nullptr, false);
+        if (resource.is_discarded()) {
+            LOG_WARN("ActivityLogQueue", "Skipping unreadable line in " << spillPath_);
+            continue;
+        }
+        events.push_back(Event{std::move(resource), Clock::now()});
+    }
+
+    // Read to the end: start a fresh file for the next overflow
+    if (!file || file.peek() == std::ifstream::traits_type::eof()) {
+        file.close();
+        std::remove(spillPath_.c_str());
+        spillReadOffset_ = 0;
+        spillPending_ = false;
+    }
+
+    // Spilled events are older than anything queued since the queue drained
+    stats_.replayed += events.size();
+    queue_.insert(queue_.begin(), std::make_move_iterator(events.begin()),
+                  std::make_move_iterator(events.end()));
+    stats_.peakDepth = std::max(stats_.peakDepth, queue_.size());
+}
+
+ActivityQueueStats ActivityLogQueue::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ActivityQueueStats stats = stats_;
+    stats.depth = queue_.size();
+    return stats;
+}
+
+void ActivityLogQueue::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.clear();
+    if (!spillPath_.empty()) {
+        std::remove(spillPath_.c_str());
+    }
+    apiClient_.reset();
+    capacity_ = kDefaultCapacity;
+    batchSize_ = kDefaultBatchSize;
+    flushIntervalMs_ = kDefaultFlushIntervalMs;
+    policy_ = ActivityOverflowPolicy::Spill;
+    blockTimeoutMs_ = kDefaultBlockTimeoutMs;
+    spillPath_.clear();
+    spillPending_ = false;
+    spillReadOffset_ = 0;
+    batchEndpoint_ = true;
+    lastFlushFailed_ = false;
+    stats_ = ActivityQueueStats();
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,148 @@
+#ifndef ACTIVITY_LOG_QUEUE_H
+#define ACTIVITY_LOG_QUEUE_H
+
+#include <string>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include "ApiClient.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief What enqueue() does when the queue is at capacity
+ */
+enum class ActivityOverflowPolicy {
+    Block,          // Wait for the flusher to make room, up to the block timeout
+    DropOldest,     // Discard the oldest queued event
+    Spill           // Append the event to the spill file; replayed once the queue drains
+};
+
+struct ActivityQueueStats {
+    uint64_t enqueued = 0;
+    uint64_t flushed = 0;           // events accepted by the backend
+    uint64_t batches = 0;           // successful flush requests
+    uint64_t failedBatches = 0;     // requests that failed and were kept for retry
+    uint64_t rejected = 0;          // events the backend refused; not retried
+    uint64_t dropped = 0;           // drop-oldest discards and block timeouts
+    uint64_t spilled = 0;
+    uint64_t replayed = 0;          // spilled events read back into the queue
+    size_t depth = 0;
+    size_t peakDepth = 0;
+    double lastFlushMs = 0;         // duration of the last flush request
+    double maxFlushMs = 0;
+    double totalFlushMs = 0;
+    double maxQueueDelayMs = 0;     // longest an event waited before it was flushed
+};
+
+/**
+ * @brief Write-behind queue that posts activity log events in batches
+ *
+ * Sessions enqueue ActivityLog resource objects ({"type", "attributes"})
+ * and return immediately; one flusher thread posts them to
+ * /ActivityLog/batch when batchSize events are waiting or the flush
+ * interval passes, whichever is first. Backends without the batch endpoint
+ * (404/405) get one POST per event from the flusher instead. A failed
+ * request keeps its events at the front of the queue for the next flush.
+ *
+ * The queue holds at most capacity events; the overflow policy decides
+ * what happens beyond that. Spilled events are JSON lines in the spill
+ * file, and start() replays a file left by a previous run. stop() hands
+ * events it could not post to the EventSpool when it is open, otherwise
+ * to the spill file. Delivery is at least once; the backend drops repeats
+ * by client_event_id. Thread-safe singleton shared by all sessions.
+ */
+class ActivityLogQueue {
+public:
+    // Singleton access
+    static ActivityLogQueue& getInstance();
+
+    // Prevent copying
+    ActivityLogQueue(const ActivityLogQueue&) = delete;
+    ActivityLogQueue& operator=(const ActivityLogQueue&) = delete;
+
+    // Configuration
+    void setApiClient(std::shared_ptr<ApiClient> client);
+    void setCapacity(size_t events);
+    void setBatchSize(size_t events);
+    void setFlushInterval(int milliseconds);
+    void setOverflowPolicy(ActivityOverflowPolicy policy);
+    void setBlockTimeout(int milliseconds);
+    void setSpillPath(const std::string& path);
+
+    // "block", "drop-oldest" or "spill"; anything else is Spill
+    static ActivityOverflowPolicy policyFromString(const std::string& policy);
+
+    // Background flusher lifecycle
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    /**
+     * @brief Queue one event for the next batch
+     * @return false if the event was dropped by the overflow policy
+     */
+    bool enqueue(const nlohmann::json& resource);
+
+    // Post everything queued and spilled synchronously; returns the number of events posted
+    int flush();
+
+    ActivityQueueStats getStats() const;
+
+    // Drop queued events, the spill file, statistics and configuration (used by tests)
+    void reset();
+
+private:
+    ActivityLogQueue();
+    ~ActivityLogQueue();
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Event {
+        nlohmann::json resource;
+        Clock::time_point queuedAt;
+    };
+
+    void flusherLoop();
+    size_t postBatch(const std::shared_ptr<ApiClient>& client, const std::vector<Event>& batch,
+                     uint64_t& rejected);
+
+    // Callers hold mutex_
+    bool spillLocked(const std::vector<Event>& events);
+    void replaySpillLocked(size_t maxEvents);
+
+    std::shared_ptr<ApiClient> apiClient_;
+    size_t capacity_;
+    size_t batchSize_;
+    int flushIntervalMs_;
+    ActivityOverflowPolicy policy_;
+    int blockTimeoutMs_;
+    std::string spillPath_;
+
+    std::deque<Event> queue_;
+    bool spillPending_;             // the spill file holds events not yet replayed
+    std::streamoff spillReadOffset_;
+    bool batchEndpoint_;            // cleared when the backend answers 404/405
+    bool lastFlushFailed_;
+    ActivityQueueStats stats_;
+
+    mutable std::mutex mutex_;
+    std::mutex flushMutex_;
+    std::condition_variable wakeFlusher_;
+    std::condition_variable notFull_;
+    std::thread flusher_;
+    bool running_;
+    bool stopRequested_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // ACTIVITY_LOG_QUEUE_H
@@ -1,4 +1,8 @@
 #include "ActivityLogService.h"
+#include "ApiUtils.h"
+#include "ActivityLogQueue.h"
+#include "ActivityFeed.h"
+#include "EventSpool.h"
 #include "utils/Logger.h"
 #include <sstream>
 #include <iomanip>
@@ -65,6 +69,37 @@ std::string ActivityFilter::toQueryString() const {
     return qs.str();
 }
 
+nlohmann::json ActivityFilter::toFilterArray() const {
+    nlohmann::json conditions = nlohmann::json::array();
+    auto addEq = [&](const std::string& name, const nlohmann::json& value) {
+        conditions.push_back({{"name", name}, {"op", "eq"}, {"val", value}});
+    };
+
+    if (!actorType.empty()) addEq("actor_type", actorType);
+    if (!actionCategory.empty()) addEq("action_category", actionCategory);
+    if (!actionType.empty()) addEq("action_type", actionType);
+    if (!entityType.empty()) addEq("entity_type", entityType);
+    if (!entityId.empty()) addEq("entity_id", entityId);
+    if (actorId > 0) addEq("actor_id", actorId);
+
+    return conditions;
+}
+
+bool ActivityFilter::matches(const Models::ActivityLog& activity) const {
+    if (!actorType.empty() && Models::ActivityLog::actorTypeToString(activity.getActorType()) != actorType) {
+        return false;
+    }
+    if (!actionCategory.empty()
+        && Models::ActivityLog::categoryToString(activity.getActionCategory()) != actionCategory) {
+        return false;
+    }
+    if (!actionType.empty() && activity.getActionType() != actionType) return false;
+    if (!entityType.empty() && activity.getEntityType() != entityType) return false;
+    if (!entityId.empty() && activity.getEntityId() != entityId) return false;
+    if (actorId > 0 && activity.getActorId() != actorId) return false;
+    return true;
+}
+
 // =============================================================================
 // ActivityLogService implementation
 // =============================================================================
@@ -190,6 +225,109 @@ int ActivityLogService::getActivityCount(const ActivityFilter& filter) {
     return 0;
 }
 
+// =============================================================================
+// Keyset Pagination
+// =============================================================================
+
+std::string ActivityLogService::keysetEndpoint(const ActivityFilter& filter, const ActivityCursor& before,
+                                               int limit) {
+    nlohmann::json conditions = filter.toFilterArray();
+    if (before.isValid()) {
+        conditions.push_back({{"name", "created_at"}, {"op", "le"}, {"val", before.createdAt}});
+        limit += before.ties;
+    }
+
+    std::string endpoint = "/ActivityLog?sort=-created_at,-id&page[limit]=" + std::to_string(limit);
+    if (!conditions.empty()) {
+        endpoint += "&filter=" + urlEncode(conditions.dump());
+    }
+    return endpoint;
+}
+
+ActivityPage ActivityLogService::getActivityPage(const ActivityFilter& filter, const ActivityCursor& before) {
+    ActivityPage page;
+    if (!apiClient_) {
+        LOG_ERROR("ActivityLogService", "API client not set");
+        return page;
+    }
+
+    int pageSize = filter.limit > 0 ? filter.limit : 10;
+    int requested = pageSize + (before.isValid() ? before.ties : 0);
+    std::string endpoint = keysetEndpoint(filter, before, pageSize);
+    LOG_DEBUG("ActivityLogService", "GET " << endpoint);
+
+    ApiResponse response = apiClient_->get(endpoint);
+    if (!response.isSuccess()) {
+        LOG_ERROR("ActivityLogService", "Failed to get activities: " << response.errorMessage);
+        return page;
+    }
+
+    std::vector<Models::ActivityLog> rows;
+    try {
+        rows = parseActivitiesFromJson(response.getJson());
+    } catch (const std::exception& e) {
+        LOG_ERROR("ActivityLogService", "Error parsing activities: " << e.what());
+        return page;
+    }
+    page.success = true;
+
+    for (auto& row : rows) {
+        // Already returned: at the cursor's timestamp and not below its id
+        if (before.isValid() && row.getCreatedAt() == before.createdAt && row.getId() >= before.id) {
+            continue;
+        }
+        if (static_cast<int>(page.activities.size()) < pageSize) {
+            page.activities.push_back(std::move(row));
+        }
+    }
+    page.hasMore = static_cast<int>(rows.size()) >= requested;
+
+    if (!page.activities.empty()) {
+        const auto& last = page.activities.back();
+        page.next.createdAt = last.getCreatedAt();
+        page.next.id = last.getId();
+        page.next.ties = before.isValid() && before.createdAt == last.getCreatedAt() ? before.ties : 0;
+        for (const auto& activity : page.activities) {
+            page.next.ties += activity.getCreatedAt() == last.getCreatedAt();
+        }
+    } else {
+        page.next = before;
+        page.hasMore = false;
+    }
+    return page;
+}
+
+std::vector<Models::ActivityLog> ActivityLogService::getActivitiesAfter(int afterId, int limit, bool* success) {
+    if (success) {
+        *success = false;
+    }
+    if (!apiClient_) {
+        return {};
+    }
+
+    nlohmann::json conditions = nlohmann::json::array({
+        {{"name", "id"}, {"op", "gt"}, {"val", afterId}}
+    });
+    std::string endpoint = "/ActivityLog?sort=id&page[limit]=" + std::to_string(limit > 0 ? limit : 1)
+                           + "&filter=" + urlEncode(conditions.dump());
+
+    ApiResponse response = apiClient_->get(endpoint);
+    if (!response.isSuccess()) {
+        LOG_WARN("ActivityLogService", "Failed to get new activities: " << response.errorMessage);
+        return {};
+    }
+    try {
+        auto activities = parseActivitiesFromJson(response.getJson());
+        if (success) {
+            *success = true;
+        }
+        return activities;
+    } catch (const std::exception& e) {
+        LOG_ERROR("ActivityLogService", "Error parsing new activities: " << e.what());
+        return {};
+    }
+}
+
 // =============================================================================
 // Async Query Methods
 // =============================================================================
@@ -287,6 +425,11 @@ ActivityLogResult ActivityLogService::logActivity(const Models::ActivityLog& act
         }
 
         LOG_DEBUG("ActivityLogService", "Activity logged with ID: " << result.activityId);
+        ActivityFeed::getInstance().notify();
+    } else if (EventSpool::isRetryable(response) && EventSpool::getInstance().append("/ActivityLog", payload)) {
+        result.success = true;
+        result.message = "Activity spooled until the server is available";
+        LOG_WARN("ActivityLogService", "Spooled activity: " << response.errorMessage);
     } else {
         result.errorMessage = response.errorMessage;
         LOG_ERROR("ActivityLogService", "Failed to log activity: " << result.errorMessage);
@@ -297,6 +440,14 @@ ActivityLogResult ActivityLogService::logActivity(const Models::ActivityLog& act
 
 void ActivityLogService::logActivityAsync(const Models::ActivityLog& activity,
                                            ActivityCallback callback) {
+    if (ActivityLogQueue::getInstance().isRunning()) {
+        ActivityLogResult result = record(activity);
+        if (callback) {
+            callback(result);
+        }
+        return;
+    }
+
     if (!apiClient_) {
         if (callback) {
             ActivityLogResult result;
@@ -309,7 +460,7 @@ void ActivityLogService::logActivityAsync(const Models::ActivityLog& activity,
 
     nlohmann::json payload = preparePayload(activity);
 
-    apiClient_->postAsync("/ActivityLog", payload, [callback](const ApiResponse& response) {
+    apiClient_->postAsync("/ActivityLog", payload, [callback, payload](const ApiResponse& response) {
         ActivityLogResult result;
         result.success = response.isSuccess();
 
@@ -328,6 +479,10 @@ void ActivityLogService::logActivityAsync(const Models::ActivityLog& activity,
             } catch (...) {
                 // Ignore parsing errors for async logging
             }
+            ActivityFeed::getInstance().notify();
+        } else if (EventSpool::isRetryable(response) && EventSpool::getInstance().append("/ActivityLog", payload)) {
+            result.success = true;
+            result.message = "Activity spooled until the server is available";
         } else {
             result.errorMessage = response.errorMessage;
         }
@@ -338,6 +493,24 @@ void ActivityLogService::logActivityAsync(const Models::ActivityLog& activity,
     });
 }
 
+ActivityLogResult ActivityLogService::record(const Models::ActivityLog& activity) {
+    auto& queue = ActivityLogQueue::getInstance();
+    if (!queue.isRunning()) {
+        return logActivity(activity);
+    }
+
+    // Stamped now, so the created_at of a batched event is when it happened
+    ActivityLogResult result;
+    result.activityId = 0;
+    result.success = queue.enqueue(preparePayload(activity)["data"]);
+    if (result.success) {
+        result.message = "Activity queued";
+    } else {
+        result.errorMessage = "Activity log queue is full";
+    }
+    return result;
+}
+
 // =============================================================================
 // Convenience Methods
 // =============================================================================
@@ -351,7 +524,7 @@ ActivityLogResult ActivityLogService::logLogin(
     Models::ActivityLog activity = Models::ActivityLog::createLoginActivity(
         type, userId, userName, email, success, ipAddress, failureReason);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logLogout(
@@ -362,7 +535,7 @@ ActivityLogResult ActivityLogService::logLogout(
     Models::ActivityLog activity = Models::ActivityLog::createLogoutActivity(
         type, userId, userName, email);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logFormSubmission(
@@ -372,7 +545,7 @@ ActivityLogResult ActivityLogService::logFormSubmission(
     Models::ActivityLog activity = Models::ActivityLog::createFormSubmittedActivity(
         studentId, studentName, studentEmail, formId, formName);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logFormReview(
@@ -385,7 +558,7 @@ ActivityLogResult ActivityLogService::logFormReview(
         adminId, adminName, adminEmail, studentId, studentName,
         std::to_string(formSubmissionId), formName, approved, reason);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logStudentRegistration(
@@ -395,7 +568,7 @@ ActivityLogResult ActivityLogService::logStudentRegistration(
     Models::ActivityLog activity = Models::ActivityLog::createStudentRegisteredActivity(
         studentId, studentName, studentEmail, ipAddress);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logProfileUpdate(
@@ -417,7 +590,7 @@ ActivityLogResult ActivityLogService::logProfileUpdate(
     }
     activity.setDescription(desc);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logAccessChange(
@@ -427,7 +600,7 @@ ActivityLogResult ActivityLogService::logAccessChange(
     Models::ActivityLog activity = Models::ActivityLog::createAccessChangeActivity(
         adminId, adminName, adminEmail, studentId, studentName, revoked);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logUserCreated(
@@ -438,7 +611,7 @@ ActivityLogResult ActivityLogService::logUserCreated(
     Models::ActivityLog activity = Models::ActivityLog::createUserCreatedActivity(
         adminId, adminName, adminEmail, newUserId, newUserName, newUserEmail, role);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logCurriculumSelected(
@@ -448,7 +621,7 @@ ActivityLogResult ActivityLogService::logCurriculumSelected(
     Models::ActivityLog activity = Models::ActivityLog::createCurriculumSelectedActivity(
         studentId, studentName, studentEmail, curriculumId, curriculumName);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logCurriculumChange(
@@ -471,7 +644,7 @@ ActivityLogResult ActivityLogService::logCurriculumChange(
     std::string action = isNew ? "created" : "updated";
     activity.setDescription(adminName + " " + action + " program: " + curriculumName);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logSettingsUpdate(
@@ -496,7 +669,7 @@ ActivityLogResult ActivityLogService::logSettingsUpdate(
     }
     activity.setDescription(desc);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 ActivityLogResult ActivityLogService::logAdminAction(
@@ -518,7 +691,7 @@ ActivityLogResult ActivityLogService::logAdminAction(
     activity.setEntityName(entityName);
     activity.setSeverity(Models::ActivitySeverity::Info);
 
-    return logActivity(activity);
+    return record(activity);
 }
 
 // =============================================================================
@@ -681,6 +854,9 @@ nlohmann::json ActivityLogService::preparePayload(const Models::ActivityLog& act
         attrs["created_at"] = activity.getCreatedAt();
     }
 
+    // Unique per event, so a retried or replayed post is not stored twice
+    attrs["client_event_id"] = EventSpool::newEventId();
+
     return payload;
 }
 
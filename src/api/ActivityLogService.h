@@ -5,6 +5,7 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <nlohmann/json.hpp>
 #include "ApiClient.h"
 #include "models/ActivityLog.h"
 
@@ -30,6 +31,42 @@ struct ActivityFilter {
      * @brief Build query string for API request
      */
     std::string toQueryString() const;
+
+    /**
+     * @brief The non-paging criteria as a JSON:API filter array ({"name", "op", "val"})
+     */
+    nlohmann::json toFilterArray() const;
+
+    /**
+     * @brief True if the activity meets the non-paging criteria
+     */
+    bool matches(const Models::ActivityLog& activity) const;
+};
+
+/**
+ * @brief Position after the last activity of a page, newest first
+ *
+ * Pages are ordered by (created_at, id) descending. ties counts the rows
+ * already returned at exactly createdAt; the next request over-fetches by
+ * that many and drops them, so rows sharing a timestamp are neither
+ * skipped nor repeated.
+ */
+struct ActivityCursor {
+    std::string createdAt;
+    int id = 0;
+    int ties = 0;
+
+    bool isValid() const { return id > 0; }
+};
+
+/**
+ * @brief One keyset page of activities
+ */
+struct ActivityPage {
+    std::vector<Models::ActivityLog> activities;
+    ActivityCursor next;         // pass to getActivityPage for the following page
+    bool hasMore = false;
+    bool success = false;
 };
 
 /**
@@ -113,12 +150,38 @@ public:
         const std::string& entityType, const std::string& entityId, int limit = 20);
 
     /**
-     * @brief Get total count of activities (for pagination)
+     * @brief Get total count of activities
+     *
+     * Costs a count over the whole filtered log; page with getActivityPage.
      * @param filter Optional filter criteria
      * @return Total count
      */
     int getActivityCount(const ActivityFilter& filter = ActivityFilter());
 
+    /**
+     * @brief Get one page of activities, newest first, by keyset
+     *
+     * Each page starts where the cursor left off instead of at an offset,
+     * so deep pages cost the same as the first. filter.limit is the page
+     * size; filter.offset and sorting are ignored.
+     * @param before Cursor from the previous page; default for the first page
+     */
+    ActivityPage getActivityPage(const ActivityFilter& filter,
+                                 const ActivityCursor& before = ActivityCursor());
+
+    /**
+     * @brief Get activities stored after afterId, oldest first
+     *
+     * Ids grow with insertion, so this returns what arrived since afterId
+     * even when its created_at is older (e.g. replayed from the spool).
+     */
+    std::vector<Models::ActivityLog> getActivitiesAfter(int afterId, int limit, bool* success = nullptr);
+
+    /**
+     * @brief Endpoint for a keyset page request (exposed for tests)
+     */
+    static std::string keysetEndpoint(const ActivityFilter& filter, const ActivityCursor& before, int limit);
+
     // =========================================================================
     // Async Query Methods
     // =========================================================================
@@ -139,6 +202,9 @@ public:
 
     /**
      * @brief Log a new activity
+     *
+     * If the backend is unreachable the post is stored in the EventSpool
+     * and replayed later; the result is then successful with no activity ID.
      * @param activity The activity to log
      * @return Result with success status and new activity ID
      */
@@ -146,6 +212,9 @@ public:
 
     /**
      * @brief Log an activity asynchronously (fire-and-forget)
+     *
+     * Goes through ActivityLogQueue when it is running; the callback then
+     * reports whether the event was queued, with no activity ID.
      * @param activity The activity to log
      * @param callback Optional callback for result
      */
@@ -154,6 +223,10 @@ public:
 
     // =========================================================================
     // Convenience Methods for Common Activities
+    //
+    // These are batched through ActivityLogQueue when it is running and
+    // return once the event is queued (activityId 0); otherwise they post
+    // synchronously like logActivity().
     // =========================================================================
 
     /**
@@ -250,6 +323,11 @@ public:
 private:
     std::shared_ptr<ApiClient> apiClient_;
 
+    /**
+     * @brief Queue the activity when the write-behind queue runs, else post it now
+     */
+    ActivityLogResult record(const Models::ActivityLog& activity);
+
     /**
      * @brief Parse activity from JSON:API response
      */
@@ -0,0 +1,468 @@
+#include "AdminStatisticsService.h"
+#include "ApiUtils.h"
+#include "DeltaReader.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <ctime>
+#include <vector>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+const char* kStudentFields = "status,intake_status,curriculum_id,is_login_revoked,created_at,updated_at";
+
+std::string stringAttribute(const nlohmann::json& attrs, const char* name) {
+    if (!attrs.contains(name) || attrs[name].is_null()) {
+        return "";
+    }
+    return attrs[name].is_string() ? attrs[name].get<std::string>() : idString(attrs[name]);
+}
+
+void adjust(std::map<std::string, int>& counters, const std::string& key, int delta) {
+    int& value = counters[key];
+    value += delta;
+    if (value <= 0) {
+        counters.erase(key);
+    }
+}
+
+int lookup(const std::map<std::string, int>& counters, const std::string& key) {
+    auto it = counters.find(key);
+    return it != counters.end() ? it->second : 0;
+}
+
+} // namespace
+
+// =============================================================================
+// StatisticsSnapshot
+// =============================================================================
+
+int StatisticsSnapshot::statusCount(const std::string& status) const {
+    return lookup(byStatus, status);
+}
+
+int StatisticsSnapshot::curriculumCount(const std::string& curriculumId) const {
+    return lookup(byCurriculum, curriculumId);
+}
+
+int StatisticsSnapshot::registrationsOn(const std::string& date) const {
+    return lookup(byDay, date);
+}
+
+long long StatisticsSnapshot::ageSeconds() const {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now() - computedAt).count();
+}
+
+// =============================================================================
+// AdminStatisticsService
+// =============================================================================
+
+AdminStatisticsService& AdminStatisticsService::getInstance() {
+    static AdminStatisticsService instance;
+    return instance;
+}
+
+AdminStatisticsService::AdminStatisticsService()
+    : refreshIntervalSeconds_(30)
+    , rebuildIntervalSeconds_(3600)
+    , pageSize_(500)
+    , completedIntakes_(0)
+    , activePrograms_(0)
+    , loaded_(false)
+    , snapshot_(std::make_shared<StatisticsSnapshot>())
+    , running_(false)
+    , stopRequested_(false)
+    , refreshRequested_(false) {
+}
+
+AdminStatisticsService::~AdminStatisticsService() {
+    stop();
+}
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void AdminStatisticsService::setApiClient(std::shared_ptr<ApiClient> client) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_ = client;
+}
+
+bool AdminStatisticsService::hasApiClient() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return apiClient_ != nullptr;
+}
+
+void AdminStatisticsService::setRefreshInterval(int seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    refreshIntervalSeconds_ = seconds > 0 ? seconds : 1;
+}
+
+void AdminStatisticsService::setRebuildInterval(int seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rebuildIntervalSeconds_ = seconds > 0 ? seconds : 1;
+}
+
+void AdminStatisticsService::setPageSize(int rows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pageSize_ = rows > 0 ? rows : 1;
+}
+
+// =============================================================================
+// Background Refresh
+// =============================================================================
+
+void AdminStatisticsService::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    refresher_ = std::thread([this]() { refresherLoop(); });
+    LOG_DEBUG("AdminStatistics", "Refresher started (interval " << refreshIntervalSeconds_
+              << "s, rebuild " << rebuildIntervalSeconds_ << "s)");
+}
+
+void AdminStatisticsService::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    wakeRefresher_.notify_all();
+
+    if (refresher_.joinable()) {
+        refresher_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+}
+
+bool AdminStatisticsService::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+void AdminStatisticsService::refresherLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopRequested_) {
+        refreshRequested_ = false;
+        lock.unlock();
+        refresh();
+        lock.lock();
+
+        wakeRefresher_.wait_for(lock, std::chrono::seconds(refreshIntervalSeconds_), [this]() {
+            return stopRequested_ || refreshRequested_;
+        });
+    }
+}
+
+void AdminStatisticsService::requestRefresh() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        refreshRequested_ = true;
+    }
+    wakeRefresher_.notify_all();
+}
+
+StatisticsSnapshotPtr AdminStatisticsService::getSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return snapshot_;
+}
+
+// =============================================================================
+// Loading
+// =============================================================================
+
+bool AdminStatisticsService::refresh() {
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+
+    bool rebuildDue;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rebuildDue = !loaded_ ||
+            std::chrono::steady_clock::now() - lastRebuild_ >= std::chrono::seconds(rebuildIntervalSeconds_);
+    }
+    return rebuildDue ? loadAll() : loadChanges();
+}
+
+bool AdminStatisticsService::rebuild() {
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+    return loadAll();
+}
+
+bool AdminStatisticsService::loadAll() {
+    std::shared_ptr<ApiClient> client;
+    int pageSize;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client = apiClient_;
+        pageSize = pageSize_;
+    }
+    if (!client) {
+        return false;
+    }
+
+    // Read everything first so a failed page leaves the old counters alone
+    std::vector<std::pair<std::string, StudentFacts>> rows;
+    std::string newest;
+    DeltaReader reader(client, "Student", kStudentFields, pageSize);
+    bool complete = reader.readAll([&rows](const nlohmann::json& row) {
+        std::string id, updatedAt;
+        StudentFacts facts;
+        if (parseFacts(row, id, facts, updatedAt)) {
+            rows.emplace_back(std::move(id), std::move(facts));
+        }
+    }, newest);
+    if (!complete) {
+        return false;
+    }
+    int programs = fetchActivePrograms(client);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    students_.clear();
+    byStatus_.clear();
+    byCurriculum_.clear();
+    byDay_.clear();
+    completedIntakes_ = 0;
+    for (const auto& row : rows) {
+        applyLocked(row.first, row.second);
+    }
+    if (programs >= 0) {
+        activePrograms_ = programs;
+    }
+    watermark_ = newest;
+    loaded_ = true;
+    lastRebuild_ = std::chrono::steady_clock::now();
+    publishLocked();
+
+    LOG_DEBUG("AdminStatistics", "Rebuilt statistics from " << students_.size() << " students");
+    return true;
+}
+
+bool AdminStatisticsService::loadChanges() {
+    std::shared_ptr<ApiClient> client;
+    std::string since;
+    int pageSize;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client = apiClient_;
+        since = watermark_;
+        pageSize = pageSize_;
+    }
+    if (!client) {
+        return false;
+    }
+    if (since.empty()) {
+        // Nothing had updated_at at the last rebuild; only a rebuild can tell what changed
+        return loadAll();
+    }
+
+    size_t applied = 0;
+    DeltaReader reader(client, "Student", kStudentFields, pageSize);
+    bool complete = reader.readChanged(since, [this, &applied](const nlohmann::json& row) {
+        std::string id, updatedAt;
+        StudentFacts facts;
+        if (parseFacts(row, id, facts, updatedAt)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            applyLocked(id, facts);
+            applied++;
+        }
+    });
+    int programs = complete ? fetchActivePrograms(client) : -1;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    watermark_ = std::max(watermark_, since);
+    if (!complete) {
+        return false;
+    }
+    if (programs >= 0) {
+        activePrograms_ = programs;
+    }
+    publishLocked();
+
+    if (applied > 0) {
+        LOG_DEBUG("AdminStatistics", "Applied " << applied << " changed students");
+    }
+    return true;
+}
+
+int AdminStatisticsService::fetchActivePrograms(const std::shared_ptr<ApiClient>& client) const {
+    try {
+        auto response = client->get("/Curriculum?filter[is_active]=true&fields[Curriculum]=id");
+        if (!response.success) {
+            return -1;
+        }
+        auto json = nlohmann::json::parse(response.body);
+        if (json.contains("meta") && json["meta"].contains("count") && json["meta"]["count"].is_number()) {
+            return json["meta"]["count"].get<int>();
+        }
+        if (json.contains("data") && json["data"].is_array()) {
+            return static_cast<int>(json["data"].size());
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR("AdminStatistics", "Exception counting programs: " << e.what());
+    }
+    return -1;
+}
+
+bool AdminStatisticsService::parseFacts(const nlohmann::json& student, std::string& id,
+                                        StudentFacts& facts, std::string& updatedAt) {
+    if (!student.is_object() || !student.contains("id") || student["id"].is_null()) {
+        return false;
+    }
+    id = idString(student["id"]);
+    const auto& attrs = attributesOf(student);
+
+    facts.status = stringAttribute(attrs, "status");
+    std::transform(facts.status.begin(), facts.status.end(), facts.status.begin(), ::tolower);
+    if (facts.status.empty()) {
+        facts.status = "active";
+    }
+    if (attrs.contains("is_login_revoked") && attrs["is_login_revoked"].is_boolean() &&
+        attrs["is_login_revoked"].get<bool>()) {
+        facts.status = "revoked";
+    }
+
+    facts.curriculumId = stringAttribute(attrs, "curriculum_id");
+    facts.createdDay = stringAttribute(attrs, "created_at").substr(0, 10);
+
+    std::string intakeStatus = stringAttribute(attrs, "intake_status");
+    facts.intakeCompleted = intakeStatus == "completed" || intakeStatus == "approved";
+
+    updatedAt = stringAttribute(attrs, "updated_at");
+    return true;
+}
+
+// =============================================================================
+// Counters
+// =============================================================================
+
+void AdminStatisticsService::applyStudent(const nlohmann::json& student) {
+    std::string id, updatedAt;
+    StudentFacts facts;
+    if (!parseFacts(student, id, facts, updatedAt)) {
+        return;
+    }
+
+    // The watermark only follows polled rows; the next poll re-reads this one harmlessly
+    std::lock_guard<std::mutex> lock(mutex_);
+    applyLocked(id, facts);
+    publishLocked();
+}
+
+void AdminStatisticsService::removeStudent(const std::string& studentId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    removeLocked(studentId);
+    publishLocked();
+}
+
+void AdminStatisticsService::applyStudentResponse(const ApiResponse& response) {
+    if (!response.success || response.body.empty()) {
+        return;
+    }
+    try {
+        auto json = nlohmann::json::parse(response.body);
+        if (json.contains("data") && json["data"].is_object()) {
+            applyStudent(json["data"]);
+        }
+    } catch (const std::exception& e) {
+        LOG_WARN("AdminStatistics", "Could not apply written student: " << e.what());
+    }
+}
+
+void AdminStatisticsService::applyLocked(const std::string& id, const StudentFacts& facts) {
+    auto it = students_.find(id);
+    if (it != students_.end()) {
+        count(it->second, -1);
+        it->second = facts;
+    } else {
+        students_.emplace(id, facts);
+    }
+    count(facts, 1);
+}
+
+void AdminStatisticsService::removeLocked(const std::string& id) {
+    auto it = students_.find(id);
+    if (it == students_.end()) {
+        return;
+    }
+    count(it->second, -1);
+    students_.erase(it);
+}
+
+void AdminStatisticsService::count(const StudentFacts& facts, int delta) {
+    adjust(byStatus_, facts.status, delta);
+    adjust(byCurriculum_, facts.curriculumId, delta);
+    if (!facts.createdDay.empty()) {
+        adjust(byDay_, facts.createdDay, delta);
+    }
+    if (facts.intakeCompleted) {
+        completedIntakes_ += delta;
+    }
+}
+
+void AdminStatisticsService::publishLocked() {
+    auto snapshot = std::make_shared<StatisticsSnapshot>();
+    snapshot->valid = loaded_;
+    snapshot->computedAt = std::chrono::system_clock::now();
+    snapshot->day = localDate(snapshot->computedAt);
+    snapshot->totalStudents = static_cast<int>(students_.size());
+    snapshot->todaysStudents = lookup(byDay_, snapshot->day);
+    snapshot->completedIntakes = completedIntakes_;
+    snapshot->activePrograms = activePrograms_;
+    snapshot->byStatus = byStatus_;
+    snapshot->byCurriculum = byCurriculum_;
+    snapshot->byDay = byDay_;
+    snapshot_ = std::move(snapshot);
+}
+
+size_t AdminStatisticsService::getStudentCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return students_.size();
+}
+
+std::string AdminStatisticsService::getWatermark() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return watermark_;
+}
+
+void AdminStatisticsService::reset() {
+    stop();
+
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_.reset();
+    refreshIntervalSeconds_ = 30;
+    rebuildIntervalSeconds_ = 3600;
+    pageSize_ = 500;
+    students_.clear();
+    byStatus_.clear();
+    byCurriculum_.clear();
+    byDay_.clear();
+    completedIntakes_ = 0;
+    activePrograms_ = 0;
+    watermark_.clear();
+    loaded_ = false;
+    refreshRequested_ = false;
+    snapshot_ = std::make_shared<StatisticsSnapshot>();
+}
+
+std::string AdminStatisticsService::localDate(std::chrono::system_clock::time_point time) {
+    auto t = std::chrono::system_clock::to_time_t(time);
+    std::tm tm = *std::localtime(&t);
+    char date[11];
+    std::strftime(date, sizeof(date), "%Y-%m-%d", &tm);
+    return date;
+}
+
+} // namespace Api
+} // namespace StudentIntake
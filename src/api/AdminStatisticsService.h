@@ -0,0 +1,176 @@
+#ifndef ADMIN_STATISTICS_SERVICE_H
+#define ADMIN_STATISTICS_SERVICE_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <nlohmann/json.hpp>
+#include "ApiClient.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Immutable set of admin dashboard counters
+ *
+ * Published as a whole by AdminStatisticsService; readers hold a shared
+ * pointer and never see a half-applied refresh.
+ */
+struct StatisticsSnapshot {
+    bool valid = false;                             // false until the first load succeeds
+    std::chrono::system_clock::time_point computedAt;
+    std::string day;                                // local YYYY-MM-DD the snapshot was built on
+
+    int totalStudents = 0;
+    int todaysStudents = 0;
+    int completedIntakes = 0;                       // intake_status completed or approved
+    int activePrograms = 0;
+
+    std::map<std::string, int> byStatus;            // lowercase status; "revoked" for revoked logins
+    std::map<std::string, int> byCurriculum;        // curriculum id ("" when unassigned)
+    std::map<std::string, int> byDay;               // created_at date -> registrations
+
+    int statusCount(const std::string& status) const;
+    int curriculumCount(const std::string& curriculumId) const;
+    int registrationsOn(const std::string& date) const;
+
+    // Whole seconds since the snapshot was computed
+    long long ageSeconds() const;
+};
+
+using StatisticsSnapshotPtr = std::shared_ptr<const StatisticsSnapshot>;
+
+/**
+ * @brief Process-wide precomputed student statistics for the admin portal
+ *
+ * Keeps a small fact row per student (status, curriculum, created date,
+ * intake status) and counters per status, curriculum and day that are
+ * adjusted as rows change. A background thread polls /Student for rows
+ * whose updated_at is at or after the last one seen and applies only those
+ * deltas; a full paged rebuild runs on first load and periodically after
+ * that to pick up deletions. Both requests ask for the counted columns only.
+ *
+ * Pages that create, update or delete a student apply the row they wrote
+ * right away, so the counters do not wait for the next poll.
+ *
+ * Dashboards read getSnapshot(), which is a pointer copy; the snapshot's
+ * computedAt tells them how stale the numbers are. They never load on the
+ * request thread: until the first rebuild lands the snapshot is invalid and
+ * requestRefresh() only wakes the refresher. Thread-safe singleton shared by
+ * all admin sessions.
+ */
+class AdminStatisticsService {
+public:
+    // Singleton access
+    static AdminStatisticsService& getInstance();
+
+    // Prevent copying
+    AdminStatisticsService(const AdminStatisticsService&) = delete;
+    AdminStatisticsService& operator=(const AdminStatisticsService&) = delete;
+
+    // Configuration (before start; one client for the whole process)
+    void setApiClient(std::shared_ptr<ApiClient> client);
+    bool hasApiClient() const;
+    void setRefreshInterval(int seconds);
+    void setRebuildInterval(int seconds);
+    void setPageSize(int rows);
+
+    // Background refresh lifecycle
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    // Latest published counters; never null
+    StatisticsSnapshotPtr getSnapshot() const;
+
+    /**
+     * @brief Fetch deltas (or rebuild if due) and publish a new snapshot
+     * @return false if the backend could not be read; the old snapshot stays
+     */
+    bool refresh();
+    bool rebuild();
+
+    // Wake the background refresher now instead of at its next interval
+    void requestRefresh();
+
+    /**
+     * @brief Apply a student row the caller just wrote, without waiting for a poll
+     *
+     * Accepts a JSON:API resource or a plain attribute object with an id.
+     */
+    void applyStudent(const nlohmann::json& student);
+    void removeStudent(const std::string& studentId);
+
+    // applyStudent() on the resource returned by a successful Student POST or PATCH
+    void applyStudentResponse(const ApiResponse& response);
+
+    size_t getStudentCount() const;
+    std::string getWatermark() const;
+
+    // Drop all counters and configuration (used by tests)
+    void reset();
+
+    // Local calendar date (YYYY-MM-DD) used for the per-day counters
+    static std::string localDate(std::chrono::system_clock::time_point time);
+
+private:
+    AdminStatisticsService();
+    ~AdminStatisticsService();
+
+    struct StudentFacts {
+        std::string status;
+        std::string curriculumId;
+        std::string createdDay;
+        bool intakeCompleted = false;
+    };
+
+    static bool parseFacts(const nlohmann::json& student, std::string& id,
+                           StudentFacts& facts, std::string& updatedAt);
+
+    // Callers hold refreshMutex_
+    bool loadAll();
+    bool loadChanges();
+
+    int fetchActivePrograms(const std::shared_ptr<ApiClient>& client) const;
+    void refresherLoop();
+
+    // Callers hold mutex_
+    void applyLocked(const std::string& id, const StudentFacts& facts);
+    void removeLocked(const std::string& id);
+    void count(const StudentFacts& facts, int delta);
+    void publishLocked();
+
+    std::shared_ptr<ApiClient> apiClient_;
+    int refreshIntervalSeconds_;
+    int rebuildIntervalSeconds_;
+    int pageSize_;
+
+    std::unordered_map<std::string, StudentFacts> students_;
+    std::map<std::string, int> byStatus_;
+    std::map<std::string, int> byCurriculum_;
+    std::map<std::string, int> byDay_;
+    int completedIntakes_;
+    int activePrograms_;
+    std::string watermark_;                         // newest updated_at applied
+    bool loaded_;
+    std::chrono::steady_clock::time_point lastRebuild_;
+
+    StatisticsSnapshotPtr snapshot_;
+    bool running_;
+    bool stopRequested_;
+    bool refreshRequested_;
+    std::thread refresher_;
+    std::condition_variable wakeRefresher_;
+    std::mutex refreshMutex_;                       // one refresh or rebuild at a time
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // ADMIN_STATISTICS_SERVICE_H
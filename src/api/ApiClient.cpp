@@ -1,6 +1,7 @@
 #include "ApiClient.h"
 #include "utils/Logger.h"
 #include <curl/curl.h>
+#include <chrono>
 #include <thread>
 #include <sstream>
 #include <fstream>
@@ -8,6 +9,20 @@
 namespace StudentIntake {
 namespace Api {
 
+namespace {
+
+constexpr size_t kLoggedBodyBytes = 1024;
+
+// Bodies can be megabytes (PDF payloads, whole tables); debug output keeps the start
+std::string bodyPreview(const std::string& body) {
+    if (body.size() <= kLoggedBodyBytes) {
+        return body;
+    }
+    return body.substr(0, kLoggedBodyBytes) + "... (" + std::to_string(body.size()) + " bytes)";
+}
+
+} // namespace
+
 nlohmann::json ApiResponse::getJson() const {
     try {
         if (!body.empty()) {
@@ -91,9 +106,9 @@ ApiResponse ApiClient::performRequest(const std::string& method,
     // Log request details
     LOG_DEBUG("ApiClient", method << " " << fullUrl);
     if (!body.empty()) {
-        LOG_DEBUG("ApiClient", "Request body: " << body);
+        LOG_DEBUG("ApiClient", "Request body: " << bodyPreview(body));
     }
-    if (Logger::shouldLog(LogLevel::DEBUG)) {
+    if (Logger::compiledIn(LogLevel::DEBUG) && Logger::shouldLog(LogLevel::DEBUG, "ApiClient")) {
         for (const auto& pair : defaultHeaders_) {
             LOG_DEBUG("ApiClient", "  Header: " << pair.first << ": " << pair.second);
         }
@@ -151,7 +166,9 @@ ApiResponse ApiClient::performRequest(const std::string& method,
 
     // Perform request
     LOG_DEBUG("ApiClient", "Sending request...");
+    auto started = std::chrono::steady_clock::now();
     CURLcode res = curl_easy_perform(curl);
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
 
     if (res == CURLE_OK) {
         long httpCode;
@@ -160,14 +177,18 @@ ApiResponse ApiClient::performRequest(const std::string& method,
         response.body = responseBody;
         response.success = (httpCode >= 200 && httpCode < 300);
 
-        LOG_DEBUG("ApiClient", "Response status: " << httpCode);
-        LOG_DEBUG("ApiClient", "Response body: " << responseBody);
+        LOG_FIELDS(DEBUG, "ApiClient", "Response",
+                   {"method", method}, {"endpoint", endpoint}, {"status", httpCode},
+                   {"bytes", responseBody.size()}, {"ms", elapsedMs});
+        LOG_DEBUG("ApiClient", "Response body: " << bodyPreview(responseBody));
         if (!response.success) {
-            LOG_WARN("ApiClient", "Request failed with status " << httpCode);
+            // A failing backend fails every request; keep the log readable
+            LOG_RATE_LIMITED(WARN, "ApiClient", 10, "Request failed with status " << httpCode
+                             << " (" << method << " " << endpoint << ")");
         }
     } else {
         response.errorMessage = curl_easy_strerror(res);
-        LOG_ERROR("ApiClient", "CURL error: " << response.errorMessage);
+        LOG_RATE_LIMITED(ERROR, "ApiClient", 10, "CURL error: " << response.errorMessage);
     }
 
     // Cleanup
@@ -0,0 +1,69 @@
+#include "ApiUtils.h"
+#include <cctype>
+#include <sstream>
+#include <iomanip>
+
+namespace StudentIntake {
+namespace Api {
+
+std::string urlEncode(const std::string& value) {
+    std::ostringstream escaped;
+    escaped.fill('0');
+    escaped << std::hex;
+
+    for (char c : value) {
+        if (isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.' || c == '~') {
+            escaped << c;
+        } else {
+            escaped << std::uppercase;
+            escaped << '%' << std::setw(2) << int(static_cast<unsigned char>(c));
+            escaped << std::nouppercase;
+        }
+    }
+
+    return escaped.str();
+}
+
+std::string idString(const nlohmann::json& value) {
+    if (value.is_string()) {
+        return value.get<std::string>();
+    }
+    if (value.is_number()) {
+        return std::to_string(value.get<long long>());
+    }
+    return "";
+}
+
+int intValue(const nlohmann::json& value) {
+    if (value.is_number()) {
+        return value.get<int>();
+    }
+    if (value.is_string()) {
+        try {
+            return std::stoi(value.get<std::string>());
+        } catch (...) {
+        }
+    }
+    return 0;
+}
+
+int intValue(const nlohmann::json& obj, const char* key) {
+    if (!obj.is_object() || !obj.contains(key)) {
+        return 0;
+    }
+    return intValue(obj[key]);
+}
+
+std::string stringValue(const nlohmann::json& obj, const char* key, const std::string& fallback) {
+    if (obj.is_object() && obj.contains(key) && obj[key].is_string()) {
+        return obj[key].get<std::string>();
+    }
+    return fallback;
+}
+
+const nlohmann::json& attributesOf(const nlohmann::json& row) {
+    return row.contains("attributes") ? row["attributes"] : row;
+}
+
+} // namespace Api
+} // namespace StudentIntake
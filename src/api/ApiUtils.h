@@ -0,0 +1,34 @@
+#ifndef API_UTILS_H
+#define API_UTILS_H
+
+#include <string>
+#include <nlohmann/json.hpp>
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Helpers shared by the services that build JSON:API requests and
+ * read JSON:API rows
+ */
+
+// Percent-encode a query-string value (RFC 3986 unreserved characters pass through)
+std::string urlEncode(const std::string& value);
+
+// JSON:API ids and foreign keys arrive as strings or numbers
+std::string idString(const nlohmann::json& value);
+
+// Number or numeric string as int; 0 for anything else
+int intValue(const nlohmann::json& value);
+int intValue(const nlohmann::json& obj, const char* key);
+
+// String member, or fallback when it is missing, null or not a string
+std::string stringValue(const nlohmann::json& obj, const char* key, const std::string& fallback = "");
+
+// Attributes of a JSON:API resource; plain objects are their own attributes
+const nlohmann::json& attributesOf(const nlohmann::json& row);
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // API_UTILS_H
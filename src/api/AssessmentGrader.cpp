@@ -0,0 +1,231 @@
+#include "AssessmentGrader.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cctype>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+std::string toLower(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+int parseQuestionId(const std::string& id) {
+    try {
+        return std::stoi(id);
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+const size_t kMaxOptions = 64;
+
+} // namespace
+
+// =============================================================================
+// CompiledQuestion
+// =============================================================================
+
+bool CompiledQuestion::encode(const std::string& answer, uint64_t& mask) const {
+    std::string lowered = toLower(answer);
+    for (size_t bit = 0; bit < vocabulary.size(); ++bit) {
+        if (vocabulary[bit] == lowered) {
+            mask |= (uint64_t{1} << bit);
+            return true;
+        }
+    }
+    return false;
+}
+
+// =============================================================================
+// AnswerKey
+// =============================================================================
+
+AnswerKey::AnswerKey()
+    : assessmentId_(0)
+    , moduleId_(0)
+    , passingScore_(0)
+    , totalPoints_(0.0) {
+}
+
+AnswerKey AnswerKey::compile(const Models::Assessment& assessment,
+                             const std::vector<Models::AssessmentQuestion>& questions) {
+    AnswerKey key;
+    key.assessmentId_ = parseQuestionId(assessment.getId());
+    key.moduleId_ = assessment.getModuleId();
+    key.passingScore_ = assessment.getPassingScore();
+    key.questions_.reserve(questions.size());
+
+    for (const auto& question : questions) {
+        int questionId = parseQuestionId(question.getId());
+        if (!question.isActive() || questionId <= 0) {
+            continue;
+        }
+
+        CompiledQuestion compiled;
+        compiled.questionId = questionId;
+        compiled.type = question.getQuestionType();
+        compiled.points = std::max(0, question.getPoints());
+
+        if (compiled.type == Models::QuestionType::ShortAnswer) {
+            compiled.expectedText = question.getCorrectAnswer();
+        } else {
+            auto addTerm = [&compiled](const std::string& term) {
+                std::string lowered = toLower(term);
+                if (!lowered.empty() &&
+                    std::find(compiled.vocabulary.begin(), compiled.vocabulary.end(), lowered)
+                        == compiled.vocabulary.end()) {
+                    compiled.vocabulary.push_back(lowered);
+                }
+            };
+
+            for (const auto& option : question.getAnswerOptions()) {
+                addTerm(option.id);
+            }
+            if (compiled.type == Models::QuestionType::TrueFalse && compiled.vocabulary.empty()) {
+                addTerm("true");
+                addTerm("false");
+            }
+
+            std::vector<std::string> correct = question.getCorrectAnswers();
+            if (compiled.type != Models::QuestionType::MultipleSelect || correct.empty()) {
+                correct = {question.getCorrectAnswer()};
+            }
+            for (const auto& term : correct) {
+                addTerm(term);
+            }
+
+            if (compiled.vocabulary.size() > kMaxOptions) {
+                LOG_WARN("AssessmentGrader", "Question " << questionId << " has "
+                         << compiled.vocabulary.size() << " options; only the first "
+                         << kMaxOptions << " can be graded");
+                compiled.vocabulary.resize(kMaxOptions);
+            }
+
+            for (const auto& term : correct) {
+                if (!compiled.encode(term, compiled.correctMask)) {
+                    // An unencodable correct answer can never be matched
+                    compiled.correctMask = 0;
+                    break;
+                }
+            }
+        }
+
+        key.totalPoints_ += compiled.points;
+        key.questions_.push_back(std::move(compiled));
+    }
+
+    std::sort(key.questions_.begin(), key.questions_.end(),
+              [](const CompiledQuestion& a, const CompiledQuestion& b) {
+                  return a.questionId < b.questionId;
+              });
+
+    return key;
+}
+
+size_t AnswerKey::indexOf(int questionId) const {
+    auto it = std::lower_bound(questions_.begin(), questions_.end(), questionId,
+                               [](const CompiledQuestion& q, int id) { return q.questionId < id; });
+    if (it == questions_.end() || it->questionId != questionId) {
+        return questions_.size();
+    }
+    return static_cast<size_t>(it - questions_.begin());
+}
+
+const CompiledQuestion* AnswerKey::find(int questionId) const {
+    size_t index = indexOf(questionId);
+    return index < questions_.size() ? &questions_[index] : nullptr;
+}
+
+// =============================================================================
+// AssessmentGrader
+// =============================================================================
+
+GradeResult AssessmentGrader::grade(const AnswerKey& key,
+                                    const std::vector<Models::StudentAssessmentAnswer>& answers) {
+    GradeResult result;
+    result.totalQuestions = static_cast<int>(key.getQuestionCount());
+    result.pointsPossible = key.getTotalPoints();
+    result.gradedAnswers.reserve(answers.size());
+
+    const auto& questions = key.getQuestions();
+    std::vector<bool> graded(questions.size(), false);
+
+    for (const auto& answer : answers) {
+        size_t index = key.indexOf(answer.getQuestionId());
+        if (index >= questions.size() || graded[index]) {
+            continue;
+        }
+        graded[index] = true;
+        const auto& question = questions[index];
+
+        bool correct = false;
+        if (question.type == Models::QuestionType::ShortAnswer) {
+            correct = !question.expectedText.empty() &&
+                      answer.getAnswerGiven() == question.expectedText;
+        } else if (question.correctMask != 0) {
+            std::vector<std::string> given = answer.getAnswersGiven();
+            if (given.empty() && !answer.getAnswerGiven().empty()) {
+                given.push_back(answer.getAnswerGiven());
+            }
+
+            uint64_t mask = 0;
+            bool encoded = !given.empty();
+            for (const auto& text : given) {
+                encoded = question.encode(text, mask) && encoded;
+            }
+            correct = encoded && mask == question.correctMask;
+        }
+
+        Models::StudentAssessmentAnswer gradedAnswer = answer;
+        gradedAnswer.setCorrect(correct);
+        gradedAnswer.setPointsEarned(correct ? question.points : 0.0);
+        result.gradedAnswers.push_back(gradedAnswer);
+
+        if (correct) {
+            result.correctAnswers++;
+            result.pointsEarned += question.points;
+        }
+    }
+
+    result.score = result.pointsPossible > 0.0
+        ? (result.pointsEarned / result.pointsPossible) * 100.0
+        : 0.0;
+    result.passed = result.totalQuestions > 0 && result.score >= key.getPassingScore();
+
+    return result;
+}
+
+std::map<std::string, GradeResult> AssessmentGrader::gradeCohort(
+        const AnswerKey& key,
+        const std::map<std::string, std::vector<Models::StudentAssessmentAnswer>>& attemptAnswers) {
+    std::map<std::string, GradeResult> results;
+    for (const auto& pair : attemptAnswers) {
+        results.emplace(pair.first, grade(key, pair.second));
+    }
+    return results;
+}
+
+void AssessmentGrader::addModuleScores(Models::AssessmentReport& report,
+                                       const std::vector<ModuleGradeInput>& modules) {
+    for (const auto& module : modules) {
+        Models::ModuleScoreEntry entry;
+        entry.moduleId = module.moduleId;
+        entry.moduleNumber = module.moduleNumber;
+        entry.moduleTitle = module.moduleTitle;
+        entry.timeSpentSeconds = module.timeSpentSeconds;
+        entry.completed = module.completed;
+        entry.score = 0.0;
+        for (double score : module.attemptScores) {
+            entry.score = std::max(entry.score, score);
+        }
+        report.addModuleScore(entry);
+    }
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,123 @@
+#ifndef ASSESSMENT_GRADER_H
+#define ASSESSMENT_GRADER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include "models/Assessment.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief One question of a compiled answer key
+ *
+ * Choice questions are reduced to a bitmask over the question's option
+ * vocabulary, so multiple choice, true/false and multiple select all grade
+ * with a single mask comparison. Short answers keep the expected text.
+ */
+struct CompiledQuestion {
+    int questionId = 0;
+    Models::QuestionType type = Models::QuestionType::MultipleChoice;
+    double points = 0.0;
+    uint64_t correctMask = 0;
+    std::vector<std::string> vocabulary;   // lower-cased option ids, bit i == vocabulary[i]
+    std::string expectedText;              // ShortAnswer only
+
+    // Encode answer text into option bits; false if any text is not an option
+    bool encode(const std::string& answer, uint64_t& mask) const;
+};
+
+/**
+ * @brief Immutable, compact answer key for one assessment
+ *
+ * Compiled once from the assessment's questions and shared read-only by any
+ * number of grading calls. Questions are kept sorted by id so an answer
+ * lookup is a binary search over a contiguous array.
+ */
+class AnswerKey {
+public:
+    AnswerKey();
+
+    static AnswerKey compile(const Models::Assessment& assessment,
+                             const std::vector<Models::AssessmentQuestion>& questions);
+
+    int getAssessmentId() const { return assessmentId_; }
+    int getModuleId() const { return moduleId_; }
+    int getPassingScore() const { return passingScore_; }
+    size_t getQuestionCount() const { return questions_.size(); }
+    double getTotalPoints() const { return totalPoints_; }
+    bool isEmpty() const { return questions_.empty(); }
+
+    const CompiledQuestion* find(int questionId) const;
+    size_t indexOf(int questionId) const;
+    const std::vector<CompiledQuestion>& getQuestions() const { return questions_; }
+
+private:
+    int assessmentId_;
+    int moduleId_;
+    int passingScore_;
+    double totalPoints_;
+    std::vector<CompiledQuestion> questions_;
+};
+
+/**
+ * @brief Outcome of grading one attempt against an answer key
+ */
+struct GradeResult {
+    int totalQuestions = 0;
+    int correctAnswers = 0;
+    double pointsEarned = 0.0;
+    double pointsPossible = 0.0;
+    double score = 0.0;
+    bool passed = false;
+    std::vector<Models::StudentAssessmentAnswer> gradedAnswers;
+};
+
+/**
+ * @brief Per-module input for the report breakdown
+ */
+struct ModuleGradeInput {
+    int moduleId = 0;
+    int moduleNumber = 0;
+    std::string moduleTitle;
+    int timeSpentSeconds = 0;
+    bool completed = false;
+    std::vector<double> attemptScores;
+};
+
+/**
+ * @brief Deterministic local grading of assessment attempts
+ *
+ * Scores an attempt in one pass over its answers. Unanswered questions count
+ * as incorrect and duplicate answers for the same question are graded once.
+ * The score is the percentage of points earned, so weighted questions are
+ * honoured; with the default of one point per question it equals the share
+ * of correct answers. Choice matching is case-insensitive, short answers
+ * match exactly. Stateless and thread-safe.
+ */
+class AssessmentGrader {
+public:
+    static GradeResult grade(const AnswerKey& key,
+                             const std::vector<Models::StudentAssessmentAnswer>& answers);
+
+    /**
+     * @brief Re-grade many attempts against one (possibly corrected) key
+     * @return attempt id -> result
+     */
+    static std::map<std::string, GradeResult> gradeCohort(
+        const AnswerKey& key,
+        const std::map<std::string, std::vector<Models::StudentAssessmentAnswer>>& attemptAnswers);
+
+    /**
+     * @brief Build one ModuleScoreEntry per module (best attempt) and add it to the report
+     */
+    static void addModuleScores(Models::AssessmentReport& report,
+                                const std::vector<ModuleGradeInput>& modules);
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // ASSESSMENT_GRADER_H
@@ -1,6 +1,11 @@
 #include "ClassroomService.h"
+#include "TimeTrackingAggregator.h"
+#include "ReportJobQueue.h"
+#include "utils/Logger.h"
 #include <stdexcept>
 #include <chrono>
+#include <algorithm>
+#include <cmath>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
@@ -18,11 +23,13 @@ static std::string getCurrentTimestamp() {
 }
 
 ClassroomService::ClassroomService()
-    : apiClient_(std::make_shared<ApiClient>()) {
+    : apiClient_(std::make_shared<ApiClient>())
+    , serverVerification_(false) {
 }
 
 ClassroomService::ClassroomService(std::shared_ptr<ApiClient> apiClient)
-    : apiClient_(apiClient) {
+    : apiClient_(apiClient)
+    , serverVerification_(false) {
 }
 
 ClassroomService::~ClassroomService() = default;
@@ -56,6 +63,26 @@ ClassroomResult ClassroomService::parseResponse(const ApiResponse& response) {
     return result;
 }
 
+void ClassroomService::holdDraftSaves(const std::string& attemptId) {
+    std::unique_lock<std::mutex> lock(draftMutex_);
+    finalizingAttempts_.insert(attemptId);
+
+    // Every draft ends within the client timeout, so this wait does too
+    auto limit = std::chrono::seconds(apiClient_->getTimeout() + 1);
+    bool settled = draftsSettled_.wait_for(lock, limit, [this, &attemptId] {
+        return draftsInFlight_.count(attemptId) == 0;
+    });
+    if (!settled) {
+        LOG_WARN("ClassroomService", "Draft save for attempt " << attemptId
+                 << " still pending at submission");
+    }
+}
+
+void ClassroomService::releaseDraftSaves(const std::string& attemptId) {
+    std::lock_guard<std::mutex> lock(draftMutex_);
+    finalizingAttempts_.erase(attemptId);
+}
+
 nlohmann::json ClassroomService::buildJsonApiPayload(const std::string& type,
                                                        const nlohmann::json& attributes) {
     nlohmann::json payload;
@@ -337,6 +364,13 @@ ClassroomResult ClassroomService::saveModuleProgress(const Models::StudentModule
     }
 }
 
+ClassroomResult ClassroomService::updateModuleProgress(const std::string& progressId,
+                                                       const nlohmann::json& attributes) {
+    auto payload = buildJsonApiPayload("StudentModuleProgress", progressId, attributes);
+    auto response = apiClient_->patch("/StudentModuleProgress/" + progressId, payload);
+    return parseResponse(response);
+}
+
 ClassroomResult ClassroomService::startModule(int studentId, int moduleId, int enrollmentId) {
     nlohmann::json attrs;
     attrs["student_id"] = studentId;
@@ -389,6 +423,40 @@ Models::StudentContentProgress ClassroomService::getContentProgress(int studentI
     return Models::StudentContentProgress();
 }
 
+bool ClassroomService::getCompletedContentProgress(const std::vector<std::string>& moduleProgressIds,
+                                                   std::vector<Models::StudentContentProgress>& progress) {
+    // Ids per request, to keep the URL short; rows per page
+    constexpr size_t kIdsPerRequest = 100;
+    constexpr int kPageLimit = 1000;
+
+    progress.clear();
+    for (size_t first = 0; first < moduleProgressIds.size(); first += kIdsPerRequest) {
+        std::string ids;
+        for (size_t i = first; i < std::min(first + kIdsPerRequest, moduleProgressIds.size()); ++i) {
+            ids += (ids.empty() ? "" : ",") + moduleProgressIds[i];
+        }
+
+        for (int offset = 0;; offset += kPageLimit) {
+            auto response = apiClient_->get("/StudentContentProgress?filter[module_progress_id][in]=" + ids
+                                            + "&filter[completed]=true"
+                                            + "&page[offset]=" + std::to_string(offset)
+                                            + "&page[limit]=" + std::to_string(kPageLimit));
+            auto json = response.getJson();
+            if (!response.success || !json.contains("data")) {
+                return false;
+            }
+            for (const auto& item : json["data"]) {
+                progress.push_back(Models::StudentContentProgress::fromJson(item));
+            }
+            if (json["data"].size() < static_cast<size_t>(kPageLimit)) {
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
 ClassroomResult ClassroomService::saveContentProgress(const Models::StudentContentProgress& progress) {
     auto attrs = progress.toJson();
 
@@ -431,15 +499,32 @@ ClassroomResult ClassroomService::completeContent(int studentId, int contentId,
 // Time Logging API Endpoints
 // =============================================================================
 
-ClassroomResult ClassroomService::startTimeSession(const Models::StudentTimeLog& log) {
-    auto attrs = log.toJson();
-    auto payload = buildJsonApiPayload("StudentTimeLog", attrs);
-    auto response = apiClient_->post("/StudentTimeLog", payload);
+TimeTrackingAggregator& ClassroomService::timeTracker() {
+    auto& tracker = TimeTrackingAggregator::getInstance();
+    if (!tracker.hasApiClient()) {
+        tracker.setApiClient(apiClient_);
+    }
+    tracker.start();
+    return tracker;
+}
 
-    return parseResponse(response);
+ClassroomResult ClassroomService::startTimeSession(const Models::StudentTimeLog& log) {
+    // Sessions stay local until they end; only the compacted row is written
+    ClassroomResult result;
+    result.success = true;
+    result.id = timeTracker().beginSession(log);
+    return result;
 }
 
 ClassroomResult ClassroomService::endTimeSession(const std::string& logId, int durationSeconds) {
+    if (timeTracker().endSession(logId, durationSeconds)) {
+        ClassroomResult result;
+        result.success = true;
+        result.id = logId;
+        return result;
+    }
+
+    // Session started against the backend directly
     nlohmann::json attrs;
     attrs["session_end"] = getCurrentTimestamp();
     attrs["duration_seconds"] = durationSeconds;
@@ -468,11 +553,12 @@ ClassroomResult ClassroomService::logTime(int studentId, int enrollmentId, int c
     log.setValidated(true);
     log.setValidationMethod("automatic");
 
-    auto attrs = log.toJson();
-    auto payload = buildJsonApiPayload("StudentTimeLog", attrs);
-    auto response = apiClient_->post("/StudentTimeLog", payload);
+    // Buffered; flushed as a compacted row by the time tracker
+    timeTracker().record(log);
 
-    return parseResponse(response);
+    ClassroomResult result;
+    result.success = true;
+    return result;
 }
 
 std::vector<Models::StudentTimeLog> ClassroomService::getTimeLogs(const std::string& enrollmentId) {
@@ -491,37 +577,62 @@ std::vector<Models::StudentTimeLog> ClassroomService::getTimeLogs(const std::str
 }
 
 int ClassroomService::getTotalTimeSpent(int studentId, int courseId) {
+    auto& tracker = timeTracker();
+    if (tracker.hasCourseTotal(studentId, courseId)) {
+        return tracker.getCourseTotal(studentId, courseId);
+    }
+
+    // Hold the student's buffered rows back so none is posted while persisted rows are read
+    TimeTrackingAggregator::SeedScope seeding(tracker, studentId);
     std::string endpoint = "/StudentTimeLog?filter[student_id]=" + std::to_string(studentId)
                          + "&filter[course_id]=" + std::to_string(courseId);
     auto response = apiClient_->get(endpoint);
     auto json = response.getJson();
 
+    if (!response.success) {
+        return tracker.getCourseTotal(studentId, courseId);
+    }
+
     int totalSeconds = 0;
-    if (response.success && json.contains("data")) {
+    if (json.contains("data")) {
         for (const auto& item : json["data"]) {
             auto log = Models::StudentTimeLog::fromJson(item);
             totalSeconds += log.getDurationSeconds();
         }
     }
 
-    return totalSeconds;
+    // Seed once; later heartbeats keep the total current in memory
+    tracker.seedCourseTotal(studentId, courseId, totalSeconds);
+    return tracker.getCourseTotal(studentId, courseId);
 }
 
 int ClassroomService::getModuleTimeSpent(int studentId, int moduleId) {
+    auto& tracker = timeTracker();
+    if (tracker.hasModuleTotal(studentId, moduleId)) {
+        return tracker.getModuleTotal(studentId, moduleId);
+    }
+
+    // Hold the student's buffered rows back so none is posted while persisted rows are read
+    TimeTrackingAggregator::SeedScope seeding(tracker, studentId);
     std::string endpoint = "/StudentTimeLog?filter[student_id]=" + std::to_string(studentId)
                          + "&filter[module_id]=" + std::to_string(moduleId);
     auto response = apiClient_->get(endpoint);
     auto json = response.getJson();
 
+    if (!response.success) {
+        return tracker.getModuleTotal(studentId, moduleId);
+    }
+
     int totalSeconds = 0;
-    if (response.success && json.contains("data")) {
+    if (json.contains("data")) {
         for (const auto& item : json["data"]) {
             auto log = Models::StudentTimeLog::fromJson(item);
             totalSeconds += log.getDurationSeconds();
         }
     }
 
-    return totalSeconds;
+    tracker.seedModuleTotal(studentId, moduleId, totalSeconds);
+    return tracker.getModuleTotal(studentId, moduleId);
 }
 
 // =============================================================================
@@ -679,37 +790,179 @@ ClassroomResult ClassroomService::submitAssessment(const std::string& attemptId)
         return result;
     }
 
-    // Get answers and calculate score
+    // Get answers and grade them against the compiled key
     auto answers = getAttemptAnswers(attemptId);
+    auto grade = gradeAttempt(attempt.getAssessmentId(), answers);
 
-    // Get assessment to check passing score
-    auto assessment = getAssessment(std::to_string(attempt.getAssessmentId()));
+    nlohmann::json attrs = buildGradeAttributes(grade);
+    attrs["submitted_at"] = getCurrentTimestamp();
+
+    auto payload = buildJsonApiPayload("StudentAssessmentAttempt", attemptId, attrs);
+    auto response = apiClient_->patch("/StudentAssessmentAttempt/" + attemptId, payload);
+
+    return parseResponse(response);
+}
+
+nlohmann::json ClassroomService::buildAttemptAnswersPayload(
+        const std::string& attemptId,
+        const std::vector<Models::StudentAssessmentAnswer>& answers,
+        bool finalize, int timeSpentSeconds,
+        const GradeResult* grade) {
+    std::string answeredAt = getCurrentTimestamp();
+
+    std::map<int, const Models::StudentAssessmentAnswer*> gradedById;
+    if (grade) {
+        for (const auto& graded : grade->gradedAnswers) {
+            gradedById[graded.getQuestionId()] = &graded;
+        }
+    }
 
-    int totalQuestions = static_cast<int>(answers.size());
-    int correctAnswers = 0;
-    for (const auto& ans : answers) {
-        if (ans.isCorrect()) {
-            correctAnswers++;
+    nlohmann::json answerList = nlohmann::json::array();
+    for (const auto& answer : answers) {
+        nlohmann::json item;
+        item["question_id"] = answer.getQuestionId();
+        item["answer_given"] = answer.getAnswerGiven();
+        item["answers_given"] = answer.getAnswersGiven();
+        item["answered_at"] = answer.getAnsweredAt().empty() ? answeredAt : answer.getAnsweredAt();
+
+        // Correctness is only ever sent from the local grader, never from the widget
+        auto graded = gradedById.find(answer.getQuestionId());
+        if (graded != gradedById.end()) {
+            item["is_correct"] = graded->second->isCorrect();
+            item["points_earned"] = graded->second->getPointsEarned();
         }
+        answerList.push_back(item);
     }
 
-    double score = totalQuestions > 0 ? (static_cast<double>(correctAnswers) / totalQuestions) * 100.0 : 0.0;
-    bool passed = score >= assessment.getPassingScore();
+    nlohmann::json attrs;
+    if (finalize && grade) {
+        attrs = buildGradeAttributes(*grade);
+    }
+    attrs["answers"] = answerList;
+    attrs["finalize"] = finalize;
+    if (finalize) {
+        attrs["submitted_at"] = answeredAt;
+        attrs["time_spent_seconds"] = timeSpentSeconds;
+        attrs["verify"] = serverVerification_;
+    }
 
+    return buildJsonApiPayload("StudentAssessmentAttempt", attemptId, attrs);
+}
+
+nlohmann::json ClassroomService::buildGradeAttributes(const GradeResult& grade) {
     nlohmann::json attrs;
     attrs["status"] = "graded";
-    attrs["submitted_at"] = getCurrentTimestamp();
-    attrs["total_questions"] = totalQuestions;
-    attrs["correct_answers"] = correctAnswers;
-    attrs["score"] = score;
-    attrs["passed"] = passed;
+    attrs["total_questions"] = grade.totalQuestions;
+    attrs["correct_answers"] = grade.correctAnswers;
+    attrs["score"] = grade.score;
+    attrs["passed"] = grade.passed;
+    return attrs;
+}
 
-    auto payload = buildJsonApiPayload("StudentAssessmentAttempt", attemptId, attrs);
-    auto response = apiClient_->patch("/StudentAssessmentAttempt/" + attemptId, payload);
+ClassroomResult ClassroomService::saveAttemptAnswers(
+        const std::string& attemptId,
+        const std::vector<Models::StudentAssessmentAnswer>& answers) {
+    auto payload = buildAttemptAnswersPayload(attemptId, answers, false, 0);
+    auto response = apiClient_->post("/StudentAssessmentAttempt/" + attemptId + "/answers", payload);
 
     return parseResponse(response);
 }
 
+AttemptSubmission ClassroomService::submitAttempt(
+        const Models::StudentAssessmentAttempt& attempt,
+        const std::vector<Models::StudentAssessmentAnswer>& answers,
+        int timeSpentSeconds) {
+    const std::string attemptId = attempt.getId();
+    auto key = getAnswerKey(attempt.getAssessmentId());
+    bool gradedLocally = !key->isEmpty();
+    GradeResult grade;
+    if (gradedLocally) {
+        grade = AssessmentGrader::grade(*key, answers);
+    }
+
+    holdDraftSaves(attemptId);
+    auto payload = buildAttemptAnswersPayload(attemptId, answers, true, timeSpentSeconds,
+                                              gradedLocally ? &grade : nullptr);
+    auto response = apiClient_->post("/StudentAssessmentAttempt/" + attemptId + "/answers", payload);
+
+    // Backends without the bulk endpoint still get a correct, if slower, submission
+    if (response.statusCode == 404 || response.statusCode == 405) {
+        auto fallback = submitAttemptPerAnswer(attemptId, answers);
+        if (!fallback.result.success) {
+            releaseDraftSaves(attemptId);
+        }
+        return fallback;
+    }
+
+    AttemptSubmission submission;
+    submission.result = parseResponse(response);
+    if (!submission.result.success) {
+        // Not submitted: the student keeps answering, so drafts resume
+        releaseDraftSaves(attemptId);
+        return submission;
+    }
+
+    const auto& json = submission.result.responseData;
+    bool serverGraded = false;
+    submission.attempt = attempt;
+    if (json.contains("data") && json["data"].is_object()) {
+        submission.attempt = Models::StudentAssessmentAttempt::fromJson(json["data"]);
+        serverGraded = submission.attempt.isSubmitted();
+        if (submission.attempt.getId().empty()) {
+            submission.attempt.setId(attemptId);
+        }
+    }
+    if (json.contains("included")) {
+        for (const auto& item : json["included"]) {
+            if (item.value("type", "") == "StudentAssessmentAnswer") {
+                submission.answers.push_back(Models::StudentAssessmentAnswer::fromJson(item));
+            }
+        }
+    }
+
+    if (!gradedLocally) {
+        return submission;
+    }
+
+    if (serverVerification_ && serverGraded) {
+        if (std::fabs(submission.attempt.getScore() - grade.score) > 0.01 ||
+            submission.attempt.hasPassed() != grade.passed) {
+            LOG_WARN("ClassroomService", "Grade mismatch for attempt " << attemptId
+                     << ": local " << grade.score << "%, server "
+                     << submission.attempt.getScore() << "%");
+        }
+        return submission;
+    }
+
+    submission.attempt.setStatus(Models::AttemptStatus::Graded);
+    submission.attempt.setTotalQuestions(grade.totalQuestions);
+    submission.attempt.setCorrectAnswers(grade.correctAnswers);
+    submission.attempt.setScore(grade.score);
+    submission.attempt.setPassed(grade.passed);
+    submission.answers = grade.gradedAnswers;
+    return submission;
+}
+
+AttemptSubmission ClassroomService::submitAttemptPerAnswer(
+        const std::string& attemptId,
+        const std::vector<Models::StudentAssessmentAnswer>& answers) {
+    int attemptNumericId = std::stoi(attemptId);
+    for (const auto& answer : answers) {
+        submitAnswer(attemptNumericId, answer.getQuestionId(),
+                     answer.getAnswerGiven(), answer.getAnswersGiven());
+    }
+
+    AttemptSubmission submission;
+    submission.result = submitAssessment(attemptId);
+    submission.attempt = getAttemptDetails(attemptId);
+
+    // submitAssessment graded with the cached key, so this re-grade is local
+    auto stored = getAttemptAnswers(attemptId);
+    auto grade = gradeAttempt(submission.attempt.getAssessmentId(), stored);
+    submission.answers = grade.totalQuestions > 0 ? grade.gradedAnswers : stored;
+    return submission;
+}
+
 Models::StudentAssessmentAttempt ClassroomService::getAttemptDetails(const std::string& attemptId) {
     auto response = apiClient_->get("/StudentAssessmentAttempt/" + attemptId);
     auto json = response.getJson();
@@ -736,6 +989,45 @@ std::vector<Models::StudentAssessmentAnswer> ClassroomService::getAttemptAnswers
     return answers;
 }
 
+bool ClassroomService::getAttemptAnswers(
+    const std::vector<std::string>& attemptIds,
+    std::map<std::string, std::vector<Models::StudentAssessmentAnswer>>& answers) {
+    // Ids per request, to keep the URL short; answers per page
+    constexpr size_t kIdsPerRequest = 100;
+    constexpr int kPageLimit = 1000;
+
+    answers.clear();
+    for (const auto& attemptId : attemptIds) {
+        answers[attemptId];
+    }
+
+    for (size_t first = 0; first < attemptIds.size(); first += kIdsPerRequest) {
+        std::string ids;
+        for (size_t i = first; i < std::min(first + kIdsPerRequest, attemptIds.size()); ++i) {
+            ids += (ids.empty() ? "" : ",") + attemptIds[i];
+        }
+
+        for (int offset = 0;; offset += kPageLimit) {
+            auto response = apiClient_->get("/StudentAssessmentAnswer?filter[attempt_id][in]=" + ids
+                                            + "&page[offset]=" + std::to_string(offset)
+                                            + "&page[limit]=" + std::to_string(kPageLimit));
+            auto json = response.getJson();
+            if (!response.success || !json.contains("data")) {
+                return false;
+            }
+            for (const auto& item : json["data"]) {
+                auto answer = Models::StudentAssessmentAnswer::fromJson(item);
+                answers[std::to_string(answer.getAttemptId())].push_back(answer);
+            }
+            if (json["data"].size() < static_cast<size_t>(kPageLimit)) {
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
 bool ClassroomService::canAttemptAssessment(int studentId, int assessmentId) {
     return getRemainingAttempts(studentId, assessmentId) > 0;
 }
@@ -750,25 +1042,263 @@ int ClassroomService::getRemainingAttempts(int studentId, int assessmentId) {
     return std::max(0, maxAttempts - usedAttempts);
 }
 
+// =============================================================================
+// Local Grading
+// =============================================================================
+
+std::string ClassroomService::getQuestionSetVersion(const Models::Assessment& assessment) {
+    // Sparse read: only updated_at per row, enough to see edits, additions and removals
+    auto response = apiClient_->get("/AssessmentQuestion?filter[assessment_id]=" + assessment.getId()
+                                    + "&fields[AssessmentQuestion]=updated_at");
+    auto json = response.getJson();
+    if (!response.success || !json.contains("data") || !json["data"].is_array()) {
+        return "";
+    }
+
+    std::string newest;
+    for (const auto& item : json["data"]) {
+        if (item.contains("attributes") && item["attributes"].contains("updated_at")
+            && item["attributes"]["updated_at"].is_string()) {
+            newest = std::max(newest, item["attributes"]["updated_at"].get<std::string>());
+        }
+    }
+    return QuestionBankCache::versionOf(assessment.getUpdatedAt(), newest, json["data"].size());
+}
+
+QuestionSet ClassroomService::sharedQuestions(const Models::Assessment& assessment,
+                                              const std::string& version) {
+    auto& cache = QuestionBankCache::getInstance();
+    if (!version.empty()) {
+        if (auto questions = cache.findQuestions(assessment.getId(), version)) {
+            return questions;
+        }
+    }
+
+    auto questions = getAssessmentQuestions(assessment.getId());
+
+    // Do not cache a failed fetch; the next call retries
+    if (questions.empty()) {
+        return std::make_shared<const std::vector<Models::AssessmentQuestion>>();
+    }
+    return cache.store(assessment, std::move(questions));
+}
+
+QuestionSet ClassroomService::getSharedQuestions(const Models::Assessment& assessment) {
+    return sharedQuestions(assessment, getQuestionSetVersion(assessment));
+}
+
+std::shared_ptr<const AnswerKey> ClassroomService::getAnswerKey(int assessmentId) {
+    auto assessment = getAssessment(std::to_string(assessmentId));
+    if (assessment.getId().empty()) {
+        return std::make_shared<const AnswerKey>();
+    }
+
+    auto& cache = QuestionBankCache::getInstance();
+    std::string version = getQuestionSetVersion(assessment);
+    if (!version.empty()) {
+        if (auto key = cache.findAnswerKey(assessmentId, version)) {
+            return key;
+        }
+    }
+
+    auto questions = sharedQuestions(assessment, version);
+    if (auto key = cache.findAnswerKey(assessmentId, QuestionBankCache::versionOf(assessment, *questions))) {
+        return key;
+    }
+    return std::make_shared<const AnswerKey>();
+}
+
+void ClassroomService::invalidateAssessmentCache(int assessmentId) {
+    QuestionBankCache::getInstance().invalidate(std::to_string(assessmentId));
+}
+
+GradeResult ClassroomService::gradeAttempt(int assessmentId,
+                                           const std::vector<Models::StudentAssessmentAnswer>& answers) {
+    return AssessmentGrader::grade(*getAnswerKey(assessmentId), answers);
+}
+
+ClassroomResult ClassroomService::regradeAssessment(int assessmentId) {
+    ClassroomResult result;
+    result.success = false;
+
+    invalidateAssessmentCache(assessmentId);
+    auto key = getAnswerKey(assessmentId);
+    if (key->isEmpty()) {
+        result.message = "Answer key could not be loaded";
+        return result;
+    }
+
+    std::vector<Models::StudentAssessmentAttempt> attempts;
+    auto response = apiClient_->get("/StudentAssessmentAttempt?filter[assessment_id]="
+                                    + std::to_string(assessmentId));
+    auto json = response.getJson();
+    if (response.success && json.contains("data")) {
+        for (const auto& item : json["data"]) {
+            auto attempt = Models::StudentAssessmentAttempt::fromJson(item);
+            if (attempt.isSubmitted()) {
+                attempts.push_back(attempt);
+            }
+        }
+    }
+
+    std::vector<std::string> attemptIds;
+    for (const auto& attempt : attempts) {
+        attemptIds.push_back(attempt.getId());
+    }
+    // Grading a missing answer set as all wrong would overwrite real scores
+    std::map<std::string, std::vector<Models::StudentAssessmentAnswer>> cohort;
+    if (!getAttemptAnswers(attemptIds, cohort)) {
+        result.message = "Attempt answers could not be loaded";
+        return result;
+    }
+    auto grades = AssessmentGrader::gradeCohort(*key, cohort);
+
+    // Only attempts whose outcome moved are written back
+    int changed = 0;
+    for (const auto& attempt : attempts) {
+        const auto& grade = grades[attempt.getId()];
+        if (std::fabs(attempt.getScore() - grade.score) < 0.005 &&
+            attempt.hasPassed() == grade.passed &&
+            attempt.getCorrectAnswers() == grade.correctAnswers) {
+            continue;
+        }
+
+        auto payload = buildJsonApiPayload("StudentAssessmentAttempt", attempt.getId(),
+                                           buildGradeAttributes(grade));
+        auto patchResponse = apiClient_->patch("/StudentAssessmentAttempt/" + attempt.getId(), payload);
+        if (patchResponse.success) {
+            changed++;
+        } else {
+            result.errors.push_back("Attempt " + attempt.getId() + ": " + patchResponse.errorMessage);
+        }
+    }
+
+    result.success = result.errors.empty();
+    result.message = "Re-graded " + std::to_string(attempts.size()) + " attempts, "
+                   + std::to_string(changed) + " changed";
+    LOG_INFO("ClassroomService", "Assessment " << assessmentId << ": " << result.message);
+    return result;
+}
+
 // =============================================================================
 // Assessment Report API Endpoints
 // =============================================================================
 
 ClassroomResult ClassroomService::generateReport(int studentId, int enrollmentId, int courseId) {
-    // This would typically be a server-side operation that compiles all the data
-    // For now, we create a report record that the backend can populate
+    std::string courseKey = std::to_string(courseId);
+    auto course = getCourse(courseKey);
+    auto modules = getCourseModules(courseKey);
+    auto assessments = getCourseAssessments(courseId);
+    auto progressList = getModuleProgressList(std::to_string(enrollmentId));
+
+    // Every graded attempt for the enrollment in one request
+    std::map<int, std::vector<double>> scoresByAssessment;
+    std::map<int, bool> passedByAssessment;
+    auto response = apiClient_->get("/StudentAssessmentAttempt?filter[enrollment_id]="
+                                    + std::to_string(enrollmentId));
+    auto json = response.getJson();
+    if (response.success && json.contains("data")) {
+        for (const auto& item : json["data"]) {
+            auto attempt = Models::StudentAssessmentAttempt::fromJson(item);
+            if (attempt.isSubmitted()) {
+                scoresByAssessment[attempt.getAssessmentId()].push_back(attempt.getScore());
+                passedByAssessment[attempt.getAssessmentId()] |= attempt.hasPassed();
+            }
+        }
+    }
 
-    nlohmann::json attrs;
-    attrs["student_id"] = studentId;
-    attrs["enrollment_id"] = enrollmentId;
-    attrs["course_id"] = courseId;
-    attrs["report_type"] = "completion";
-    attrs["generated_at"] = getCurrentTimestamp();
+    std::map<int, const Models::StudentModuleProgress*> progressByModule;
+    for (const auto& progress : progressList) {
+        progressByModule[progress.getModuleId()] = &progress;
+    }
+
+    Models::AssessmentReport report;
+    report.setStudentId(studentId);
+    report.setEnrollmentId(enrollmentId);
+    report.setCourseId(courseId);
+    report.setReportType("completion");
+    report.setCourseName(course.getName());
+    report.setTotalModules(static_cast<int>(modules.size()));
+
+    std::vector<ModuleGradeInput> moduleInputs;
+    int modulesCompleted = 0;
+    for (const auto& module : modules) {
+        ModuleGradeInput input;
+        input.moduleId = std::stoi(module.getId());
+        input.moduleNumber = module.getModuleNumber();
+        input.moduleTitle = module.getTitle();
+
+        auto progress = progressByModule.find(input.moduleId);
+        if (progress != progressByModule.end()) {
+            input.completed = progress->second->isCompleted();
+            input.timeSpentSeconds = progress->second->getTimeSpent();
+        }
+        if (input.completed) {
+            modulesCompleted++;
+        }
+
+        for (const auto& assessment : assessments) {
+            if (assessment.getModuleId() == input.moduleId &&
+                assessment.getAssessmentType() != Models::AssessmentType::FinalExam) {
+                const auto& scores = scoresByAssessment[std::stoi(assessment.getId())];
+                input.attemptScores.insert(input.attemptScores.end(), scores.begin(), scores.end());
+            }
+        }
+        moduleInputs.push_back(input);
+    }
+    AssessmentGrader::addModuleScores(report, moduleInputs);
+    report.setModulesCompleted(modulesCompleted);
+
+    double quizTotal = 0.0;
+    int quizCount = 0;
+    for (size_t i = 0; i < moduleInputs.size(); ++i) {
+        if (!moduleInputs[i].attemptScores.empty()) {
+            quizTotal += report.getModuleScores()[i].score;
+            quizCount++;
+        }
+    }
+    double averageQuizScore = quizCount > 0 ? quizTotal / quizCount : 0.0;
+    report.setAverageQuizScore(averageQuizScore);
+
+    bool hasFinalExam = false;
+    bool finalPassed = false;
+    double finalExamScore = 0.0;
+    for (const auto& assessment : assessments) {
+        if (assessment.getAssessmentType() != Models::AssessmentType::FinalExam) {
+            continue;
+        }
+        int assessmentId = std::stoi(assessment.getId());
+        hasFinalExam = true;
+        finalPassed = finalPassed || passedByAssessment[assessmentId];
+        for (double score : scoresByAssessment[assessmentId]) {
+            finalExamScore = std::max(finalExamScore, score);
+        }
+    }
+    report.setFinalExamScore(finalExamScore);
+    report.setOverallScore(hasFinalExam ? finalExamScore : averageQuizScore);
+
+    bool allModulesCompleted = modulesCompleted == static_cast<int>(modules.size());
+    report.setPassed(allModulesCompleted && (!hasFinalExam || finalPassed));
+    report.setTotalTimeHours(getTotalTimeSpent(studentId, courseId) / 3600.0);
+
+    std::string now = getCurrentTimestamp();
+    report.setGeneratedAt(now);
+    if (report.hasPassed()) {
+        report.setCompletionDate(now.substr(0, 10));
+    }
+
+    // Unset snapshot fields are left to the backend (report_number is unique)
+    nlohmann::json attrs = report.toJson();
+    for (const char* field : {"report_number", "student_name", "student_email", "completion_date"}) {
+        if (attrs.contains(field) && attrs[field] == "") {
+            attrs.erase(field);
+        }
+    }
 
     auto payload = buildJsonApiPayload("AssessmentReport", attrs);
-    auto response = apiClient_->post("/AssessmentReport", payload);
+    auto postResponse = apiClient_->post("/AssessmentReport", payload);
 
-    return parseResponse(response);
+    return parseResponse(postResponse);
 }
 
 Models::AssessmentReport ClassroomService::getReport(const std::string& reportId) {
@@ -876,30 +1406,65 @@ void ClassroomService::submitAssessmentAsync(const std::string& attemptId, Class
         });
 }
 
+void ClassroomService::saveAttemptAnswersAsync(const std::string& attemptId,
+                                               const std::vector<Models::StudentAssessmentAnswer>& answers,
+                                               ClassroomCallback callback) {
+    {
+        std::lock_guard<std::mutex> lock(draftMutex_);
+        if (finalizingAttempts_.count(attemptId)) {
+            ClassroomResult dropped;
+            dropped.success = false;
+            dropped.message = "Attempt is being submitted";
+            callback(dropped);
+            return;
+        }
+        ++draftsInFlight_[attemptId];
+    }
+
+    auto payload = buildAttemptAnswersPayload(attemptId, answers, false, 0);
+
+    apiClient_->postAsync("/StudentAssessmentAttempt/" + attemptId + "/answers", payload,
+        [this, attemptId, callback](const ApiResponse& response) {
+            {
+                std::lock_guard<std::mutex> lock(draftMutex_);
+                if (--draftsInFlight_[attemptId] == 0) {
+                    draftsInFlight_.erase(attemptId);
+                }
+            }
+            draftsSettled_.notify_all();
+            callback(parseResponse(response));
+        });
+}
+
 void ClassroomService::logTimeAsync(int studentId, int enrollmentId, int courseId,
                                      int moduleId, int contentId,
                                      Models::ActivityType activity, int durationSeconds,
                                      ClassroomCallback callback) {
-    Models::StudentTimeLog log;
-    log.setStudentId(studentId);
-    log.setEnrollmentId(enrollmentId);
-    log.setCourseId(courseId);
-    log.setModuleId(moduleId);
-    log.setContentId(contentId);
-    log.setActivityType(activity);
-    log.setSessionStart(getCurrentTimestamp());
-    log.setSessionEnd(getCurrentTimestamp());
-    log.setDurationSeconds(durationSeconds);
-    log.setValidated(true);
-    log.setValidationMethod("automatic");
+    // Buffering never blocks, so the callback can run immediately
+    auto result = logTime(studentId, enrollmentId, courseId, moduleId, contentId,
+                          activity, durationSeconds);
+    if (callback) {
+        callback(result);
+    }
+}
 
-    auto attrs = log.toJson();
-    auto payload = buildJsonApiPayload("StudentTimeLog", attrs);
+ReportJobQueue& ClassroomService::reportJobs() {
+    auto& queue = ReportJobQueue::getInstance();
+    if (!queue.hasApiClient()) {
+        queue.setApiClient(apiClient_);
+    }
+    queue.start();
+    return queue;
+}
 
-    apiClient_->postAsync("/StudentTimeLog", payload,
-        [this, callback](const ApiResponse& response) {
-            callback(parseResponse(response));
-        });
+std::string ClassroomService::queueReport(int studentId, int enrollmentId, int courseId,
+                                          ReportJobCallback callback) {
+    return reportJobs().submitReport(studentId, enrollmentId, courseId, callback);
+}
+
+std::string ClassroomService::queueCertificate(const std::string& reportId,
+                                               ReportJobCallback callback) {
+    return reportJobs().submitCertificate(reportId, callback);
 }
 
 } // namespace Api
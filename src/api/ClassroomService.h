@@ -5,7 +5,14 @@
 #include <memory>
 #include <functional>
 #include <vector>
+#include <map>
+#include <set>
+#include <mutex>
+#include <condition_variable>
 #include "ApiClient.h"
+#include "AssessmentGrader.h"
+#include "QuestionBankCache.h"
+#include "ReportJobQueue.h"
 #include "models/Course.h"
 #include "models/StudentProgress.h"
 #include "models/Assessment.h"
@@ -13,6 +20,8 @@
 namespace StudentIntake {
 namespace Api {
 
+class TimeTrackingAggregator;
+
 /**
  * @brief Result of a classroom API operation
  */
@@ -29,6 +38,18 @@ struct ClassroomResult {
  */
 using ClassroomCallback = std::function<void(const ClassroomResult&)>;
 
+/**
+ * @brief Graded outcome of a bulk attempt submission
+ *
+ * The attempt and its graded answers come back in the same response that
+ * finalized the attempt, so no follow-up reads are needed for the results view.
+ */
+struct AttemptSubmission {
+    ClassroomResult result;
+    Models::StudentAssessmentAttempt attempt;
+    std::vector<Models::StudentAssessmentAnswer> answers;
+};
+
 /**
  * @brief Service for classroom-related API operations
  *
@@ -165,6 +186,11 @@ public:
      */
     ClassroomResult saveModuleProgress(const Models::StudentModuleProgress& progress);
 
+    /**
+     * @brief PATCH only the given attributes of an existing module progress row
+     */
+    ClassroomResult updateModuleProgress(const std::string& progressId, const nlohmann::json& attributes);
+
     /**
      * @brief Mark a module as started
      */
@@ -180,6 +206,13 @@ public:
      */
     Models::StudentContentProgress getContentProgress(int studentId, int contentId);
 
+    /**
+     * @brief Get completed content rows under many module progress rows
+     * Uses filter[module_progress_id][in]; returns false if any request failed.
+     */
+    bool getCompletedContentProgress(const std::vector<std::string>& moduleProgressIds,
+                                     std::vector<Models::StudentContentProgress>& progress);
+
     /**
      * @brief Update content progress
      */
@@ -196,6 +229,9 @@ public:
 
     /**
      * @brief Start a new time logging session
+     *
+     * The session is held by the shared TimeTrackingAggregator; the returned
+     * id is local and the row is written when the session ends.
      */
     ClassroomResult startTimeSession(const Models::StudentTimeLog& log);
 
@@ -206,6 +242,8 @@ public:
 
     /**
      * @brief Log time for a specific activity (convenience method)
+     *
+     * Buffered and coalesced in memory; flushed to /StudentTimeLog in batches.
      */
     ClassroomResult logTime(int studentId, int enrollmentId, int courseId,
                             int moduleId, int contentId,
@@ -218,6 +256,8 @@ public:
 
     /**
      * @brief Get total time spent by student in a course
+     *
+     * Seeded from persisted logs once, then answered from the running total.
      */
     int getTotalTimeSpent(int studentId, int courseId);
 
@@ -286,6 +326,28 @@ public:
      */
     ClassroomResult submitAssessment(const std::string& attemptId);
 
+    /**
+     * @brief Upsert a batch of answers for an in-progress attempt in one request
+     *
+     * Used for incremental autosave; answers already stored for the same
+     * question are replaced rather than duplicated.
+     */
+    ClassroomResult saveAttemptAnswers(const std::string& attemptId,
+                                        const std::vector<Models::StudentAssessmentAnswer>& answers);
+
+    /**
+     * @brief Send all answers and finalize the attempt in a single request
+     *
+     * The attempt is graded locally against the compiled answer key and the
+     * backend stores the answers and results in one request. With server
+     * verification enabled, the backend's own grade wins and disagreements
+     * are logged. Falls back to per-answer submission when the bulk endpoint
+     * is not available.
+     */
+    AttemptSubmission submitAttempt(const Models::StudentAssessmentAttempt& attempt,
+                                     const std::vector<Models::StudentAssessmentAnswer>& answers,
+                                     int timeSpentSeconds);
+
     /**
      * @brief Get attempt details including answers
      */
@@ -296,6 +358,14 @@ public:
      */
     std::vector<Models::StudentAssessmentAnswer> getAttemptAnswers(const std::string& attemptId);
 
+    /**
+     * @brief Get answers for many attempts with filter[attempt_id][in], keyed by attempt id
+     * Every requested attempt has an entry, empty if it has no answers.
+     * Returns false if any request failed.
+     */
+    bool getAttemptAnswers(const std::vector<std::string>& attemptIds,
+                           std::map<std::string, std::vector<Models::StudentAssessmentAnswer>>& answers);
+
     /**
      * @brief Check if student can attempt assessment (has attempts remaining)
      */
@@ -306,6 +376,55 @@ public:
      */
     int getRemainingAttempts(int studentId, int assessmentId);
 
+    // =========================================================================
+    // Local Grading
+    // =========================================================================
+
+    /**
+     * @brief Get the shared, immutable question set for an assessment
+     *
+     * Served from the process-wide QuestionBankCache when the cached version
+     * matches getQuestionSetVersion(); otherwise fetched once and stored.
+     */
+    QuestionSet getSharedQuestions(const Models::Assessment& assessment);
+
+    /**
+     * @brief Current version of an assessment's question set
+     *
+     * Reads only updated_at of each question row. Returns empty on failure.
+     */
+    std::string getQuestionSetVersion(const Models::Assessment& assessment);
+
+    /**
+     * @brief Get the compiled answer key, fetching the questions on first use
+     */
+    std::shared_ptr<const AnswerKey> getAnswerKey(int assessmentId);
+
+    /**
+     * @brief Drop cached questions and key, e.g. after a question or key correction
+     */
+    void invalidateAssessmentCache(int assessmentId);
+
+    /**
+     * @brief Grade answers locally without touching the backend
+     */
+    GradeResult gradeAttempt(int assessmentId,
+                             const std::vector<Models::StudentAssessmentAnswer>& answers);
+
+    /**
+     * @brief Re-grade every submitted attempt after a key correction
+     *
+     * Recompiles the key, grades all attempts in memory and patches only the
+     * attempts whose score or pass state changed.
+     */
+    ClassroomResult regradeAssessment(int assessmentId);
+
+    /**
+     * @brief Have the backend re-grade submissions and log disagreements
+     */
+    void setServerVerification(bool enabled) { serverVerification_ = enabled; }
+    bool isServerVerificationEnabled() const { return serverVerification_; }
+
     // =========================================================================
     // Assessment Report API Endpoints
     // =========================================================================
@@ -343,19 +462,57 @@ public:
     void submitAnswerAsync(int attemptId, int questionId,
                            const std::string& answer, ClassroomCallback callback);
     void submitAssessmentAsync(const std::string& attemptId, ClassroomCallback callback);
+    void saveAttemptAnswersAsync(const std::string& attemptId,
+                                 const std::vector<Models::StudentAssessmentAnswer>& answers,
+                                 ClassroomCallback callback);
     void logTimeAsync(int studentId, int enrollmentId, int courseId,
                       int moduleId, int contentId,
                       Models::ActivityType activity, int durationSeconds,
                       ClassroomCallback callback);
 
+    /**
+     * @brief Queue report generation on the background job pool
+     * @return Job id (stable per enrollment), or empty if the queue is full
+     */
+    std::string queueReport(int studentId, int enrollmentId, int courseId,
+                            ReportJobCallback callback = nullptr);
+
+    /**
+     * @brief Queue certificate issuance on the background job pool
+     * @return Job id (stable per report), or empty if the queue is full
+     */
+    std::string queueCertificate(const std::string& reportId,
+                                 ReportJobCallback callback = nullptr);
+
 private:
     std::shared_ptr<ApiClient> apiClient_;
+    bool serverVerification_;
+
+    // Draft saves still in flight per attempt. Finalizing waits for them, and
+    // drafts for an attempt being finalized are dropped, so a late draft can
+    // never overwrite the submitted answers.
+    std::mutex draftMutex_;
+    std::condition_variable draftsSettled_;
+    std::map<std::string, int> draftsInFlight_;
+    std::set<std::string> finalizingAttempts_;
 
     // Helper methods
+    void holdDraftSaves(const std::string& attemptId);
+    void releaseDraftSaves(const std::string& attemptId);
+    TimeTrackingAggregator& timeTracker();
+    ReportJobQueue& reportJobs();
     ClassroomResult parseResponse(const ApiResponse& response);
     nlohmann::json buildJsonApiPayload(const std::string& type, const nlohmann::json& attributes);
     nlohmann::json buildJsonApiPayload(const std::string& type, const std::string& id,
                                         const nlohmann::json& attributes);
+    nlohmann::json buildAttemptAnswersPayload(const std::string& attemptId,
+                                               const std::vector<Models::StudentAssessmentAnswer>& answers,
+                                               bool finalize, int timeSpentSeconds,
+                                               const GradeResult* grade = nullptr);
+    QuestionSet sharedQuestions(const Models::Assessment& assessment, const std::string& version);
+    AttemptSubmission submitAttemptPerAnswer(const std::string& attemptId,
+                                             const std::vector<Models::StudentAssessmentAnswer>& answers);
+    nlohmann::json buildGradeAttributes(const GradeResult& grade);
 };
 
 } // namespace Api
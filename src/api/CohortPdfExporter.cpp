@@ -0,0 +1,281 @@
+#include "CohortPdfExporter.h"
+#include "StudentDossier.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace StudentIntake {
+namespace Api {
+
+CohortPdfExporter::CohortPdfExporter(std::shared_ptr<ApiClient> apiClient,
+                                     size_t workers, size_t maxPendingPackets)
+    : apiClient_(apiClient)
+    , workerCount_(workers > 0 ? workers : 1)
+    , maxPending_(maxPendingPackets > 0 ? maxPendingPackets : 1)
+    , nextClaim_(0)
+    , nextWrite_(0)
+    , peakPending_(0)
+    , cancelled_(false) {
+}
+
+CohortPdfExporter::~CohortPdfExporter() {
+    cancel();
+}
+
+void CohortPdfExporter::setInstitution(const std::string& name, const std::string& tagline) {
+    institutionName_ = name;
+    institutionTagline_ = tagline;
+}
+
+void CohortPdfExporter::setProgressCallback(ProgressCallback callback) {
+    progressCallback_ = callback;
+}
+
+void CohortPdfExporter::setRenderer(PacketRenderer renderer) {
+    renderer_ = renderer;
+}
+
+// =============================================================================
+// Cohort Selection
+// =============================================================================
+
+std::vector<int> CohortPdfExporter::selectStudents(const std::vector<SubmissionView>& submissions,
+                                                   const CohortFilter& filter) {
+    std::vector<int> studentIds;
+    std::set<int> seen;
+    for (const auto& submission : submissions) {
+        if (submission.studentId <= 0) {
+            continue;
+        }
+        if (filter.curriculumId > 0 && submission.curriculumId != filter.curriculumId) {
+            continue;
+        }
+        // ISO dates compare correctly as strings
+        std::string day = submission.submittedAt.substr(0, 10);
+        if (!filter.submittedFrom.empty() && (day.empty() || day < filter.submittedFrom)) {
+            continue;
+        }
+        if (!filter.submittedTo.empty() && (day.empty() || day > filter.submittedTo)) {
+            continue;
+        }
+        if (seen.insert(submission.studentId).second) {
+            studentIds.push_back(submission.studentId);
+        }
+    }
+    return studentIds;
+}
+
+std::string CohortPdfExporter::packetFileName(int studentId, const std::string& studentName) {
+    std::ostringstream name;
+    name << std::setw(4) << std::setfill('0') << studentId;
+
+    std::string safe;
+    for (char c : studentName) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            safe += c;
+        } else if (!safe.empty() && safe.back() != '_') {
+            safe += '_';
+        }
+    }
+    while (!safe.empty() && safe.back() == '_') {
+        safe.pop_back();
+    }
+    if (!safe.empty()) {
+        name << '_' << safe;
+    }
+    name << ".pdf";
+    return name.str();
+}
+
+// =============================================================================
+// Export
+// =============================================================================
+
+bool CohortPdfExporter::run(const std::vector<int>& studentIds, Sink sink) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.clear();
+        nextClaim_ = 0;
+        nextWrite_ = 0;
+        peakPending_ = 0;
+        progress_ = CohortExportProgress();
+        progress_.total = studentIds.size();
+    }
+    reportProgress();
+
+    LOG_INFO("CohortPdfExporter", "Exporting " << studentIds.size() << " intake packets with "
+             << std::min(workerCount_, studentIds.size()) << " workers");
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < std::min(workerCount_, studentIds.size()); ++i) {
+        workers.emplace_back([this, &studentIds]() { workerLoop(studentIds); });
+    }
+
+    ZipStreamWriter zip([this, &sink](const char* data, size_t size) {
+        return !cancelled_ && sink(data, size);
+    });
+    std::ostringstream errors;
+
+    for (size_t i = 0; i < studentIds.size(); ++i) {
+        StudentPacket packet;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            packetReady_.wait(lock, [this, i]() { return cancelled_ || ready_.count(i) > 0; });
+            if (cancelled_) {
+                break;
+            }
+            packet = std::move(ready_[i]);
+            ready_.erase(i);
+        }
+
+        bool written = false;
+        if (packet.pdf.empty()) {
+            errors << packet.studentId << "\t" << packet.error << "\n";
+        } else if (zip.addFile(packet.fileName, packet.pdf)) {
+            written = true;
+        } else {
+            LOG_ERROR("CohortPdfExporter", "Archive write failed at " << packet.fileName);
+            cancel();
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            nextWrite_ = i + 1;
+            progress_.completed++;
+            progress_.failed += written ? 0 : 1;
+            progress_.bytesWritten = zip.getBytesWritten();
+        }
+        slotFree_.notify_all();
+        reportProgress();
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    bool ok = !cancelled_;
+    if (ok && !errors.str().empty()) {
+        ok = zip.addFile("export_errors.txt", "student_id\terror\n" + errors.str());
+    }
+    ok = ok && zip.finish();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.clear();
+        progress_.bytesWritten = zip.getBytesWritten();
+        progress_.finished = true;
+        progress_.cancelled = !ok;
+    }
+    reportProgress();
+
+    LOG_INFO("CohortPdfExporter", "Export " << (ok ? "finished" : "stopped") << ": "
+             << zip.getEntryCount() << " files, " << zip.getBytesWritten() << " bytes");
+    return ok;
+}
+
+void CohortPdfExporter::cancel() {
+    {
+        // Set under the lock so no waiter misses it
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+    }
+    packetReady_.notify_all();
+    slotFree_.notify_all();
+}
+
+CohortExportProgress CohortPdfExporter::getProgress() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return progress_;
+}
+
+size_t CohortPdfExporter::getPeakPendingPackets() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return peakPending_;
+}
+
+void CohortPdfExporter::reportProgress() {
+    if (progressCallback_) {
+        progressCallback_(getProgress());
+    }
+}
+
+void CohortPdfExporter::workerLoop(const std::vector<int>& studentIds) {
+    // One generator per thread: libharu documents never cross threads
+    PdfGenerator generator;
+
+    while (true) {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            slotFree_.wait(lock, [this, &studentIds]() {
+                return cancelled_ || nextClaim_ >= studentIds.size() || nextClaim_ - nextWrite_ < maxPending_;
+            });
+            if (cancelled_ || nextClaim_ >= studentIds.size()) {
+                return;
+            }
+            index = nextClaim_++;
+            peakPending_ = std::max(peakPending_, nextClaim_ - nextWrite_);
+        }
+
+        StudentPacket packet;
+        try {
+            packet = renderer_ ? renderer_(studentIds[index]) : renderPacket(generator, studentIds[index]);
+        } catch (const std::exception& e) {
+            packet.error = e.what();
+        }
+        packet.studentId = studentIds[index];
+        if (packet.pdf.empty() && packet.error.empty()) {
+            packet.error = "Rendering failed";
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ready_[index] = std::move(packet);
+        }
+        packetReady_.notify_all();
+    }
+}
+
+StudentPacket CohortPdfExporter::renderPacket(PdfGenerator& generator, int studentId) {
+    StudentPacket packet;
+    packet.studentId = studentId;
+
+    StudentDossier dossier = StudentDossierLoader(apiClient_).load(studentId);
+    if (!dossier.hasStudent()) {
+        packet.error = "Student record could not be loaded";
+        return packet;
+    }
+    if (dossier.submissions.empty()) {
+        packet.error = "No form submissions";
+        return packet;
+    }
+
+    std::string studentName = dossier.studentName();
+    std::vector<PdfFormData> forms;
+    for (const auto& submission : dossier.submissions) {
+        PdfFormData form;
+        form.formTitle = StudentDossierLoader::formTitle(submission.formType);
+        form.studentName = studentName;
+        form.studentEmail = dossier.studentEmail();
+        form.submissionDate = submission.submittedAt;
+        form.institutionName = institutionName_;
+        form.institutionTagline = institutionTagline_;
+        form.fields = dossier.formFields(submission.formType);
+        forms.push_back(std::move(form));
+    }
+
+    packet.fileName = packetFileName(studentId, studentName);
+    packet.pdf = generator.renderMultiFormPdf(forms, studentName);
+    if (packet.pdf.empty()) {
+        packet.error = generator.getLastError();
+    }
+    return packet;
+}
+
+} // namespace Api
+} // namespace StudentIntake
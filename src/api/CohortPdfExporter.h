@@ -0,0 +1,133 @@
+#ifndef COHORT_PDF_EXPORTER_H
+#define COHORT_PDF_EXPORTER_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include "ApiClient.h"
+#include "PdfGenerator.h"
+#include "SubmissionIndex.h"
+#include "ZipStreamWriter.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Which students a cohort export covers; empty fields do not filter
+ */
+struct CohortFilter {
+    int curriculumId = 0;
+    std::string submittedFrom;      // YYYY-MM-DD, inclusive
+    std::string submittedTo;        // YYYY-MM-DD, inclusive
+};
+
+struct CohortExportProgress {
+    size_t total = 0;
+    size_t completed = 0;           // packets written to the archive or given up on
+    size_t failed = 0;
+    uint64_t bytesWritten = 0;
+    bool finished = false;
+    bool cancelled = false;
+};
+
+/**
+ * @brief One student's rendered intake packet, or why it could not be rendered
+ */
+struct StudentPacket {
+    int studentId = 0;
+    std::string fileName;
+    std::string pdf;
+    std::string error;
+};
+
+/**
+ * @brief Renders intake packets for a cohort in parallel into a streamed ZIP
+ *
+ * Each worker thread loads a student's dossier and renders the same
+ * multi-form packet as "Print All Forms", with its own PdfGenerator so
+ * every libharu document stays on one thread. Packets are written to the
+ * archive in the order given, as soon as the next one is ready.
+ *
+ * Memory is bounded by the pending window: a worker only claims a student
+ * while fewer than maxPendingPackets packets are rendering or waiting to be
+ * written, so a slow sink stalls the workers instead of piling up PDFs.
+ * Students that fail are listed in export_errors.txt at the end of the
+ * archive. A single export per instance; run() blocks until it is done.
+ */
+class CohortPdfExporter {
+public:
+    using Sink = ZipStreamWriter::Sink;
+    using ProgressCallback = std::function<void(const CohortExportProgress&)>;
+    using PacketRenderer = std::function<StudentPacket(int studentId)>;
+
+    static constexpr size_t kDefaultWorkers = 4;
+    static constexpr size_t kDefaultMaxPendingPackets = 8;
+
+    explicit CohortPdfExporter(std::shared_ptr<ApiClient> apiClient,
+                               size_t workers = kDefaultWorkers,
+                               size_t maxPendingPackets = kDefaultMaxPendingPackets);
+    ~CohortPdfExporter();
+
+    // Prevent copying
+    CohortPdfExporter(const CohortPdfExporter&) = delete;
+    CohortPdfExporter& operator=(const CohortPdfExporter&) = delete;
+
+    // Configuration (before run)
+    void setInstitution(const std::string& name, const std::string& tagline);
+    void setProgressCallback(ProgressCallback callback);   // called on the run() thread
+    void setRenderer(PacketRenderer renderer);             // replaces dossier rendering (used by tests)
+
+    /**
+     * @brief Render every packet and stream the archive into sink
+     * @return false if the sink failed or the export was cancelled
+     */
+    bool run(const std::vector<int>& studentIds, Sink sink);
+
+    // Stop claiming students; run() returns once in-flight packets finish
+    void cancel();
+
+    CohortExportProgress getProgress() const;
+    size_t getPeakPendingPackets() const;
+
+    // Distinct students with a matching submission, in first-seen order
+    static std::vector<int> selectStudents(const std::vector<SubmissionView>& submissions,
+                                           const CohortFilter& filter);
+
+    // "0042_Ada_Lovelace.pdf"
+    static std::string packetFileName(int studentId, const std::string& studentName);
+
+private:
+    void workerLoop(const std::vector<int>& studentIds);
+    StudentPacket renderPacket(PdfGenerator& generator, int studentId);
+    void reportProgress();
+
+    std::shared_ptr<ApiClient> apiClient_;
+    size_t workerCount_;
+    size_t maxPending_;
+    std::string institutionName_;
+    std::string institutionTagline_;
+    ProgressCallback progressCallback_;
+    PacketRenderer renderer_;
+
+    // Work state, guarded by mutex_
+    std::map<size_t, StudentPacket> ready_;     // rendered, waiting for their turn
+    size_t nextClaim_;
+    size_t nextWrite_;
+    size_t peakPending_;
+    CohortExportProgress progress_;
+    std::atomic<bool> cancelled_;
+    std::condition_variable packetReady_;
+    std::condition_variable slotFree_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // COHORT_PDF_EXPORTER_H
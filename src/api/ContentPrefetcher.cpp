@@ -0,0 +1,326 @@
+#include "ContentPrefetcher.h"
+#include "PrefetchPool.h"
+#include "utils/Logger.h"
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+size_t contentBytes(const Models::ModuleContent& content) {
+    return sizeof(Models::ModuleContent) + content.getId().size() + content.getTitle().size()
+         + content.getDescription().size() + content.getContentUrl().size()
+         + content.getContentText().size();
+}
+
+} // namespace
+
+ContentPrefetcher::ContentPrefetcher(std::shared_ptr<ClassroomService> service, size_t maxBytes)
+    : state_(std::make_shared<State>())
+    , maxBytes_(maxBytes) {
+    state_->service = service;
+    state_->maxBytes = maxBytes;
+}
+
+ContentPrefetcher::~ContentPrefetcher() {
+    // Jobs in flight keep the state alive and stop at their next step
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->generation++;
+}
+
+uint64_t ContentPrefetcher::currentGeneration() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->generation;
+}
+
+// =============================================================================
+// Cache-through Reads
+// =============================================================================
+
+Models::ModuleContent ContentPrefetcher::getContent(int contentId) {
+    Value cached;
+    if (state_->lookup(contentKey(contentId), cached, true)) {
+        return std::get<Models::ModuleContent>(cached);
+    }
+
+    uint64_t generation = currentGeneration();
+    auto content = state_->service->getContent(std::to_string(contentId));
+    if (!content.getId().empty()) {
+        state_->store(contentKey(contentId), content, generation);
+    }
+    return content;
+}
+
+std::vector<Models::ModuleContent> ContentPrefetcher::getModuleContents(int moduleId) {
+    return state_->loadModuleContents(moduleId, true, currentGeneration());
+}
+
+Models::Assessment ContentPrefetcher::getModuleAssessment(int moduleId) {
+    Value cached;
+    if (state_->lookup(assessmentKey(moduleId), cached, true)) {
+        return std::get<Models::Assessment>(cached);
+    }
+
+    uint64_t generation = currentGeneration();
+    auto assessment = state_->service->getModuleAssessment(moduleId);
+    if (!assessment.getId().empty()) {
+        state_->store(assessmentKey(moduleId), assessment, generation);
+    }
+    return assessment;
+}
+
+std::vector<Models::ModuleContent> ContentPrefetcher::State::loadModuleContents(
+        int moduleId, bool countStats, uint64_t fetchGeneration) {
+    Value cached;
+    if (lookup(moduleKey(moduleId), cached, countStats)) {
+        return std::get<std::vector<Models::ModuleContent>>(cached);
+    }
+
+    auto contents = service->getModuleContents(std::to_string(moduleId));
+    if (!contents.empty()) {
+        store(moduleKey(moduleId), contents, fetchGeneration);
+    }
+    return contents;
+}
+
+void ContentPrefetcher::State::warmContent(int contentId, uint64_t jobGeneration) {
+    if (!isCurrent(jobGeneration) || contains(contentKey(contentId))) {
+        return;
+    }
+    auto content = service->getContent(std::to_string(contentId));
+    if (!content.getId().empty()) {
+        store(contentKey(contentId), content, jobGeneration);
+    }
+}
+
+void ContentPrefetcher::State::warmModuleAssessment(int moduleId, uint64_t jobGeneration) {
+    if (!isCurrent(jobGeneration) || contains(assessmentKey(moduleId))) {
+        return;
+    }
+    auto assessment = service->getModuleAssessment(moduleId);
+    if (!assessment.getId().empty()) {
+        store(assessmentKey(moduleId), assessment, jobGeneration);
+    }
+}
+
+// =============================================================================
+// Background Prefetch
+// =============================================================================
+
+void ContentPrefetcher::prefetchAfter(const std::vector<Models::CourseModule>& modules,
+                                      int moduleId, int contentId) {
+    int nextModuleId = 0;
+    for (size_t i = 0; i + 1 < modules.size(); ++i) {
+        if (modules[i].getId() == std::to_string(moduleId)) {
+            nextModuleId = std::stoi(modules[i + 1].getId());
+            break;
+        }
+    }
+
+    Job job{moduleId, contentId, nextModuleId, 0};
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        // A job queued before the last clear() is cancelled and does not count
+        auto queued = state_->queued.find({moduleId, contentId});
+        if (queued != state_->queued.end() && queued->second == state_->generation) {
+            return;
+        }
+        job.generation = state_->generation;
+        state_->queued[{moduleId, contentId}] = job.generation;
+        state_->pending++;
+    }
+
+    std::shared_ptr<State> state = state_;
+    bool accepted = PrefetchPool::getInstance().submit([state, job]() {
+        try {
+            runJob(*state, job);
+        } catch (const std::exception& e) {
+            LOG_WARN("Prefetch", "Prefetch after content " << job.contentId << " failed: " << e.what());
+        }
+        state->finishJob(job);
+    });
+
+    if (!accepted) {
+        state_->finishJob(job);
+    }
+}
+
+void ContentPrefetcher::State::finishJob(const Job& job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto queuedJob = queued.find({job.moduleId, job.contentId});
+    if (queuedJob != queued.end() && queuedJob->second == job.generation) {
+        queued.erase(queuedJob);
+    }
+    if (--pending == 0) {
+        idle.notify_all();
+    }
+}
+
+void ContentPrefetcher::waitIdle() {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->idle.wait(lock, [this]() { return state_->pending == 0; });
+}
+
+void ContentPrefetcher::runJob(State& state, const Job& job) {
+    // Next item in the current module; the list itself is usually already cached
+    auto contents = state.loadModuleContents(job.moduleId, false, job.generation);
+    int nextContentId = 0;
+    for (size_t i = 0; i + 1 < contents.size(); ++i) {
+        if (contents[i].getId() == std::to_string(job.contentId)) {
+            nextContentId = std::stoi(contents[i + 1].getId());
+            break;
+        }
+    }
+
+    if (job.nextModuleId > 0 && state.isCurrent(job.generation)) {
+        auto nextContents = state.loadModuleContents(job.nextModuleId, false, job.generation);
+        if (nextContentId == 0 && !nextContents.empty()) {
+            nextContentId = std::stoi(nextContents.front().getId());
+        }
+    }
+
+    if (nextContentId > 0) {
+        state.warmContent(nextContentId, job.generation);
+    }
+    if (job.nextModuleId > 0) {
+        state.warmModuleAssessment(job.nextModuleId, job.generation);
+    }
+}
+
+// =============================================================================
+// Cache Primitives
+// =============================================================================
+
+std::string ContentPrefetcher::contentKey(int contentId) {
+    return "content:" + std::to_string(contentId);
+}
+
+std::string ContentPrefetcher::moduleKey(int moduleId) {
+    return "module:" + std::to_string(moduleId);
+}
+
+std::string ContentPrefetcher::assessmentKey(int moduleId) {
+    return "assessment:" + std::to_string(moduleId);
+}
+
+size_t ContentPrefetcher::estimateBytes(const Value& value) {
+    if (auto content = std::get_if<Models::ModuleContent>(&value)) {
+        return contentBytes(*content);
+    }
+    if (auto contents = std::get_if<std::vector<Models::ModuleContent>>(&value)) {
+        size_t bytes = sizeof(*contents);
+        for (const auto& content : *contents) {
+            bytes += contentBytes(content);
+        }
+        return bytes;
+    }
+    const auto& assessment = std::get<Models::Assessment>(value);
+    return sizeof(Models::Assessment) + assessment.getId().size() + assessment.getCode().size()
+         + assessment.getTitle().size() + assessment.getDescription().size()
+         + assessment.getInstructions().size();
+}
+
+bool ContentPrefetcher::State::lookup(const std::string& key, Value& value, bool countStats) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        if (countStats) {
+            misses++;
+        }
+        return false;
+    }
+
+    if (countStats) {
+        hits++;
+    }
+    lru.splice(lru.begin(), lru, it->second.lruPosition);
+    value = it->second.value;
+    return true;
+}
+
+bool ContentPrefetcher::State::contains(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.count(key) > 0;
+}
+
+bool ContentPrefetcher::State::isCurrent(uint64_t jobGeneration) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return generation == jobGeneration;
+}
+
+void ContentPrefetcher::State::store(const std::string& key, Value value, uint64_t fetchGeneration) {
+    size_t bytes = estimateBytes(value);
+    if (bytes > maxBytes) {
+        LOG_DEBUG("Prefetch", "Not caching " << key << " (" << bytes << " bytes exceeds budget)");
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // Fetched before a clear or invalidation; the value may already be stale
+    if (generation != fetchGeneration) {
+        return;
+    }
+    eraseLocked(key);
+
+    // Evict least recently used entries until the new one fits
+    while (bytesUsed + bytes > maxBytes && !lru.empty()) {
+        eraseLocked(lru.back());
+    }
+
+    lru.push_front(key);
+    entries[key] = Entry{std::move(value), bytes, lru.begin()};
+    bytesUsed += bytes;
+}
+
+void ContentPrefetcher::State::eraseLocked(const std::string& key) {
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        bytesUsed -= it->second.bytes;
+        lru.erase(it->second.lruPosition);
+        entries.erase(it);
+    }
+}
+
+void ContentPrefetcher::invalidateModule(int moduleId) {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->generation++;
+    state_->eraseLocked(moduleKey(moduleId));
+    state_->eraseLocked(assessmentKey(moduleId));
+}
+
+void ContentPrefetcher::clear() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->generation++;
+    state_->entries.clear();
+    state_->lru.clear();
+    state_->bytesUsed = 0;
+    state_->hits = 0;
+    state_->misses = 0;
+}
+
+// =============================================================================
+// Statistics
+// =============================================================================
+
+size_t ContentPrefetcher::getEntryCount() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->entries.size();
+}
+
+size_t ContentPrefetcher::getMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->bytesUsed;
+}
+
+uint64_t ContentPrefetcher::getHitCount() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->hits;
+}
+
+uint64_t ContentPrefetcher::getMissCount() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->misses;
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,146 @@
+#ifndef CONTENT_PREFETCHER_H
+#define CONTENT_PREFETCHER_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <list>
+#include <vector>
+#include <variant>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include "ClassroomService.h"
+#include "models/Course.h"
+#include "models/Assessment.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Per-session read-ahead cache for classroom navigation
+ *
+ * Holds content items, module content lists and module assessment metadata
+ * in a small LRU bounded by an approximate byte budget. Reads are
+ * cache-through: a hit renders from memory, a miss falls back to the
+ * synchronous ClassroomService call and keeps the result.
+ *
+ * prefetchAfter() hands a job to the shared PrefetchPool that loads what the
+ * student is most likely to open next (the following content item, the next
+ * module's content list and its assessment) while the current item is being
+ * read. Jobs hold the cache state, not the prefetcher, and carry the cache
+ * generation they were queued under: clear(), invalidateModule() and the
+ * destructor move the generation on, so a job still in flight stops at its
+ * next step and its results are dropped. Nothing ever waits for a job.
+ * Thread-safe, but intended to be owned by a single classroom session.
+ */
+class ContentPrefetcher {
+public:
+    static constexpr size_t kDefaultMaxBytes = 512 * 1024;
+
+    explicit ContentPrefetcher(std::shared_ptr<ClassroomService> service,
+                               size_t maxBytes = kDefaultMaxBytes);
+    ~ContentPrefetcher();
+
+    // Prevent copying
+    ContentPrefetcher(const ContentPrefetcher&) = delete;
+    ContentPrefetcher& operator=(const ContentPrefetcher&) = delete;
+
+    // Cache-through reads
+    Models::ModuleContent getContent(int contentId);
+    std::vector<Models::ModuleContent> getModuleContents(int moduleId);
+    Models::Assessment getModuleAssessment(int moduleId);
+
+    /**
+     * @brief Warm the cache for whatever follows contentId in moduleId
+     *
+     * Returns immediately; the next content item (the first item of the
+     * next module when contentId is the last one), the next module's content
+     * list and the next module's assessment are loaded in the background.
+     * Does nothing while the PrefetchPool is not running.
+     */
+    void prefetchAfter(const std::vector<Models::CourseModule>& modules,
+                       int moduleId, int contentId);
+
+    // Block until this prefetcher has no queued or running job (used by tests)
+    void waitIdle();
+
+    // Cache maintenance; cancels jobs in flight
+    void invalidateModule(int moduleId);
+    void clear();
+
+    // Statistics
+    size_t getEntryCount() const;
+    size_t getMemoryUsage() const;
+    size_t getMaxBytes() const { return maxBytes_; }
+    uint64_t getHitCount() const;
+    uint64_t getMissCount() const;
+
+private:
+    using Value = std::variant<Models::ModuleContent,
+                               std::vector<Models::ModuleContent>,
+                               Models::Assessment>;
+
+    struct Entry {
+        Value value;
+        size_t bytes;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    struct Job {
+        int moduleId;
+        int contentId;
+        int nextModuleId;
+        uint64_t generation;
+    };
+
+    // Everything a background job touches; shared so jobs outlive the prefetcher
+    struct State {
+        std::shared_ptr<ClassroomService> service;
+        size_t maxBytes = 0;
+
+        std::map<std::string, Entry> entries;
+        std::list<std::string> lru;          // most recently used first
+        size_t bytesUsed = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        uint64_t generation = 0;             // bumped to cancel jobs in flight
+        std::map<std::pair<int, int>, uint64_t> queued;  // (module, content) -> generation
+        size_t pending = 0;                  // jobs queued or running, cancelled or not
+        std::condition_variable idle;
+        mutable std::mutex mutex;
+
+        // Cache primitives; callers must not hold mutex
+        bool lookup(const std::string& key, Value& value, bool countStats);
+        bool contains(const std::string& key) const;
+        bool isCurrent(uint64_t jobGeneration) const;
+        void finishJob(const Job& job);
+        // Drops the value when the generation moved on since the fetch began
+        void store(const std::string& key, Value value, uint64_t fetchGeneration);
+        void eraseLocked(const std::string& key);
+
+        // Fetch-and-store helpers shared by reads and jobs
+        std::vector<Models::ModuleContent> loadModuleContents(int moduleId, bool countStats,
+                                                              uint64_t fetchGeneration);
+        void warmContent(int contentId, uint64_t jobGeneration);
+        void warmModuleAssessment(int moduleId, uint64_t jobGeneration);
+    };
+
+    static std::string contentKey(int contentId);
+    static std::string moduleKey(int moduleId);
+    static std::string assessmentKey(int moduleId);
+    static size_t estimateBytes(const Value& value);
+
+    static void runJob(State& state, const Job& job);
+
+    uint64_t currentGeneration() const;
+
+    std::shared_ptr<State> state_;
+    size_t maxBytes_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // CONTENT_PREFETCHER_H
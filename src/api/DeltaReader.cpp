@@ -0,0 +1,143 @@
+#include "DeltaReader.h"
+#include "ApiUtils.h"
+#include "utils/Logger.h"
+#include <algorithm>
+
+namespace StudentIntake {
+namespace Api {
+
+DeltaReader::DeltaReader(std::shared_ptr<ApiClient> apiClient, const std::string& resource,
+                         const std::string& fields, int pageSize)
+    : apiClient_(apiClient)
+    , resource_(resource)
+    , fields_(fields)
+    , pageSize_(pageSize > 0 ? pageSize : 1)
+    , requests_(0) {
+}
+
+std::string DeltaReader::buildEndpoint(const std::string& resource, const std::string& fields,
+                                       int offset, int limit, const std::string& since) {
+    std::string endpoint = "/" + resource + "?";
+    if (!fields.empty()) {
+        endpoint += "fields[" + resource + "]=" + fields + "&";
+    }
+    endpoint += since.empty() ? "sort=id" : "sort=updated_at,id";
+    endpoint += "&page[offset]=" + std::to_string(offset) + "&page[limit]=" + std::to_string(limit);
+    if (!since.empty()) {
+        nlohmann::json filter = nlohmann::json::array({
+            {{"name", "updated_at"}, {"op", "ge"}, {"val", since}}
+        });
+        endpoint += "&filter=" + urlEncode(filter.dump());
+    }
+    return endpoint;
+}
+
+std::string DeltaReader::buildEndpointAfter(const std::string& resource, const std::string& fields,
+                                            int afterId, int limit) {
+    std::string endpoint = "/" + resource + "?";
+    if (!fields.empty()) {
+        endpoint += "fields[" + resource + "]=" + fields + "&";
+    }
+    endpoint += "sort=id&page[limit]=" + std::to_string(limit);
+    if (afterId > 0) {
+        nlohmann::json filter = nlohmann::json::array({
+            {{"name", "id"}, {"op", "gt"}, {"val", afterId}}
+        });
+        endpoint += "&filter=" + urlEncode(filter.dump());
+    }
+    return endpoint;
+}
+
+std::string DeltaReader::updatedAt(const nlohmann::json& row) {
+    const auto& attrs = attributesOf(row);
+    if (attrs.contains("updated_at") && attrs["updated_at"].is_string()) {
+        return attrs["updated_at"].get<std::string>();
+    }
+    return "";
+}
+
+bool DeltaReader::readPage(const std::string& endpoint, nlohmann::json& rows) {
+    if (!apiClient_) {
+        return false;
+    }
+    requests_++;
+
+    try {
+        auto response = apiClient_->get(endpoint);
+        if (!response.success) {
+            LOG_ERROR("DeltaReader", "Failed to load " << resource_ << ": " << response.errorMessage);
+            return false;
+        }
+        auto json = nlohmann::json::parse(response.body);
+        if (json.is_array()) {
+            rows = json;
+        } else if (json.contains("data") && json["data"].is_array()) {
+            rows = json["data"];
+        } else {
+            rows = nlohmann::json::array();
+        }
+        return true;
+    } catch (const std::exception& e) {
+        LOG_ERROR("DeltaReader", "Exception loading " << resource_ << ": " << e.what());
+        return false;
+    }
+}
+
+bool DeltaReader::readAll(const RowHandler& onRow, std::string& newest) {
+    int lastId = 0;
+    while (true) {
+        nlohmann::json page;
+        if (!readPage(buildEndpointAfter(resource_, fields_, lastId, pageSize_), page)) {
+            return false;
+        }
+
+        int pageStart = lastId;
+        for (const auto& row : page) {
+            onRow(row);
+            newest = std::max(newest, updatedAt(row));
+            lastId = std::max(lastId, row.contains("id") ? intValue(row["id"]) : 0);
+        }
+        if (static_cast<int>(page.size()) < pageSize_) {
+            return true;
+        }
+        if (lastId == pageStart) {
+            // Ids that are not numbers give no key to continue from
+            LOG_ERROR("DeltaReader", "Cannot page " << resource_ << " past id " << lastId);
+            return false;
+        }
+    }
+}
+
+bool DeltaReader::readChanged(std::string& since, const RowHandler& onRow) {
+    if (since.empty()) {
+        return readAll(onRow, since);
+    }
+
+    int skip = 0;
+    while (true) {
+        nlohmann::json page;
+        if (!readPage(buildEndpoint(resource_, fields_, skip, pageSize_, since), page)) {
+            return false;
+        }
+
+        // Count the rows read at the newest timestamp; the next page skips them
+        for (const auto& row : page) {
+            onRow(row);
+            std::string rowUpdatedAt = updatedAt(row);
+            if (rowUpdatedAt > since) {
+                since = rowUpdatedAt;
+                skip = 0;
+            }
+            if (rowUpdatedAt == since) {
+                skip++;
+            }
+        }
+
+        if (static_cast<int>(page.size()) < pageSize_) {
+            return true;
+        }
+    }
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,70 @@
+#ifndef DELTA_READER_H
+#define DELTA_READER_H
+
+#include <string>
+#include <memory>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include "ApiClient.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Paged reader for one JSON:API collection, whole or changed rows only
+ *
+ * readAll() pages through the collection by id keyset: each request asks
+ * for ids above the last one read, so rows added or deleted meanwhile do
+ * not shift the rest of the collection across pages. readChanged() asks for rows
+ * whose updated_at is at or after a watermark, sorted by (updated_at, id),
+ * and pages by keyset: each request restarts at the newest timestamp seen
+ * and skips the rows already read at exactly that timestamp, so rows that
+ * change while it reads are never skipped. Rows at the watermark itself are
+ * read again on the next call, so callers must apply rows idempotently.
+ *
+ * Both ask only for the given sparse fieldset (which must include
+ * updated_at). Not thread-safe; use one reader per refresh.
+ */
+class DeltaReader {
+public:
+    using RowHandler = std::function<void(const nlohmann::json& row)>;
+
+    DeltaReader(std::shared_ptr<ApiClient> apiClient, const std::string& resource,
+                const std::string& fields, int pageSize);
+
+    /**
+     * @brief Read every row
+     * @param newest Set to the largest updated_at read
+     * @return false if any page failed; rows already handled stay handled
+     */
+    bool readAll(const RowHandler& onRow, std::string& newest);
+
+    /**
+     * @brief Read rows changed at or after since
+     * @param since Watermark; advanced past every row handled, even on failure
+     */
+    bool readChanged(std::string& since, const RowHandler& onRow);
+
+    int getRequestCount() const { return requests_; }
+
+    static std::string buildEndpoint(const std::string& resource, const std::string& fields,
+                                     int offset, int limit, const std::string& since);
+    // Rows with id above afterId (0 = from the start), sorted by id
+    static std::string buildEndpointAfter(const std::string& resource, const std::string& fields,
+                                          int afterId, int limit);
+    static std::string updatedAt(const nlohmann::json& row);
+
+private:
+    bool readPage(const std::string& endpoint, nlohmann::json& rows);
+
+    std::shared_ptr<ApiClient> apiClient_;
+    std::string resource_;
+    std::string fields_;
+    int pageSize_;
+    int requests_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // DELTA_READER_H
@@ -0,0 +1,425 @@
+#include "EnrollmentProgress.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
+namespace StudentIntake {
+namespace Api {
+
+// Helper to get current timestamp in ISO format
+static std::string getCurrentTimestamp() {
+    auto now = std::chrono::system_clock::now();
+    auto time = std::chrono::system_clock::to_time_t(now);
+    std::ostringstream oss;
+    oss << std::put_time(std::gmtime(&time), "%Y-%m-%dT%H:%M:%SZ");
+    return oss.str();
+}
+
+EnrollmentProgress::EnrollmentProgress(std::shared_ptr<ClassroomService> service,
+                                       int studentId, const std::string& enrollmentId)
+    : service_(service)
+    , studentId_(studentId)
+    , enrollmentId_(enrollmentId)
+    , loaded_(false)
+    , reconciledId_(0)
+    , nextReconciledId_(1)
+    , busy_(false)
+    , needsReload_(false)
+    , stopping_(false) {
+}
+
+EnrollmentProgress::~EnrollmentProgress() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        reconciled_ = nullptr;
+    }
+    writeReady_.notify_all();
+
+    // The worker drains queued writes before it exits
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+// =============================================================================
+// Loading
+// =============================================================================
+
+bool EnrollmentProgress::load() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (loaded_) {
+            return true;
+        }
+    }
+
+    auto rows = fetchRows();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!loaded_) {
+        rows_ = std::move(rows);
+        loaded_ = true;
+        LOG_DEBUG("EnrollmentProgress", "Loaded " << rows_.size() << " module rows for enrollment "
+                  << enrollmentId_);
+    }
+    return true;
+}
+
+std::map<int, Models::StudentModuleProgress> EnrollmentProgress::fetchRows() {
+    std::map<int, Models::StudentModuleProgress> rows;
+    std::map<std::string, int> moduleByRowId;
+    std::vector<std::string> rowIds;
+    for (const auto& progress : service_->getModuleProgressList(enrollmentId_)) {
+        rows[progress.getModuleId()] = progress;
+        if (!progress.getId().empty()) {
+            moduleByRowId[progress.getId()] = progress.getModuleId();
+            rowIds.push_back(progress.getId());
+        }
+    }
+
+    // Completed items live in StudentContentProgress; completed_content_ids
+    // on the module row is only filled in by this client
+    std::vector<Models::StudentContentProgress> completed;
+    if (!service_->getCompletedContentProgress(rowIds, completed)) {
+        LOG_WARN("EnrollmentProgress", "Could not load content progress for enrollment " << enrollmentId_);
+    }
+    for (const auto& content : completed) {
+        auto module = moduleByRowId.find(std::to_string(content.getModuleProgressId()));
+        if (module != moduleByRowId.end()) {
+            rows[module->second].addCompletedContentId(content.getContentId());
+        }
+    }
+    return rows;
+}
+
+bool EnrollmentProgress::isLoaded() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return loaded_;
+}
+
+// =============================================================================
+// In-memory Lookups
+// =============================================================================
+
+std::vector<Models::StudentModuleProgress> EnrollmentProgress::getModuleProgressList() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Models::StudentModuleProgress> progressList;
+    progressList.reserve(rows_.size());
+    for (const auto& pair : rows_) {
+        progressList.push_back(pair.second);
+    }
+    return progressList;
+}
+
+Models::StudentModuleProgress EnrollmentProgress::getModuleProgress(int moduleId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = rows_.find(moduleId);
+    return it != rows_.end() ? it->second : Models::StudentModuleProgress();
+}
+
+bool EnrollmentProgress::isContentCompleted(int moduleId, int contentId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = rows_.find(moduleId);
+    return it != rows_.end() && it->second.isContentCompleted(contentId);
+}
+
+bool EnrollmentProgress::isModuleCompleted(int moduleId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = rows_.find(moduleId);
+    return it != rows_.end() && it->second.isCompleted();
+}
+
+bool EnrollmentProgress::isModuleUnlocked(const Models::CourseModule& module) const {
+    int moduleId = std::stoi(module.getId());
+    int prerequisiteId = module.getPrerequisiteModuleId();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = rows_.find(moduleId);
+    if (it != rows_.end() && !it->second.isLocked()) {
+        return true;
+    }
+
+    // A locked or missing row opens as soon as its prerequisite is done
+    if (prerequisiteId > 0) {
+        auto prerequisite = rows_.find(prerequisiteId);
+        return prerequisite != rows_.end() && prerequisite->second.isCompleted();
+    }
+    return it == rows_.end();
+}
+
+bool EnrollmentProgress::areRequiredContentsCompleted(int moduleId,
+        const std::vector<Models::ModuleContent>& contents) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = rows_.find(moduleId);
+    for (const auto& content : contents) {
+        if (!content.isRequired()) {
+            continue;
+        }
+        if (it == rows_.end() || !it->second.isContentCompleted(std::stoi(content.getId()))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int EnrollmentProgress::getCompletedModuleCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int completed = 0;
+    for (const auto& pair : rows_) {
+        if (pair.second.isCompleted()) {
+            completed++;
+        }
+    }
+    return completed;
+}
+
+// =============================================================================
+// Optimistic Updates
+// =============================================================================
+
+Models::StudentModuleProgress& EnrollmentProgress::rowFor(int moduleId) {
+    auto it = rows_.find(moduleId);
+    if (it == rows_.end()) {
+        Models::StudentModuleProgress progress;
+        progress.setStudentId(studentId_);
+        progress.setModuleId(moduleId);
+        progress.setEnrollmentId(std::stoi(enrollmentId_));
+        progress.setStartedAt(getCurrentTimestamp());
+        it = rows_.emplace(moduleId, progress).first;
+    }
+    return it->second;
+}
+
+void EnrollmentProgress::completeContent(int moduleId, int contentId, size_t moduleContentCount) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& row = rowFor(moduleId);
+        row.addCompletedContentId(contentId);
+        row.setLastAccessedAt(getCurrentTimestamp());
+        if (!row.isCompleted()) {
+            row.setStatus(Models::ProgressStatus::InProgress);
+            if (moduleContentCount > 0) {
+                double percentage = 100.0 * row.getCompletedContentIds().size() / moduleContentCount;
+                row.setProgressPercentage(std::min(percentage, 100.0));
+            }
+        }
+    }
+    enqueue({moduleId, contentId});
+}
+
+void EnrollmentProgress::completeModule(int moduleId) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& row = rowFor(moduleId);
+        row.setStatus(Models::ProgressStatus::Completed);
+        row.setProgressPercentage(100);
+        row.setCompletedAt(getCurrentTimestamp());
+    }
+    enqueue({moduleId, 0});
+}
+
+int EnrollmentProgress::setReconciledCallback(ReconciledCallback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reconciled_ = std::move(callback);
+    reconciledId_ = nextReconciledId_++;
+    return reconciledId_;
+}
+
+void EnrollmentProgress::clearReconciledCallback(int id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (id == reconciledId_) {
+        reconciled_ = nullptr;
+        reconciledId_ = 0;
+    }
+}
+
+// =============================================================================
+// Background Reconciliation
+// =============================================================================
+
+void EnrollmentProgress::reconcile() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        needsReload_ = true;
+        ensureWorker();
+    }
+    writeReady_.notify_one();
+}
+
+void EnrollmentProgress::enqueue(const PendingWrite& write) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        writes_.push_back(write);
+        ensureWorker();
+    }
+    writeReady_.notify_one();
+}
+
+void EnrollmentProgress::ensureWorker() {
+    // Caller holds mutex_
+    if (!worker_.joinable() && !stopping_) {
+        worker_ = std::thread([this]() { workerLoop(); });
+    }
+}
+
+void EnrollmentProgress::whenDrained(DrainedCallback callback) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!writes_.empty() || busy_) {
+            drainedCallbacks_.push_back(std::move(callback));
+            return;
+        }
+    }
+    callback();
+}
+
+void EnrollmentProgress::runDrainedCallbacks(std::unique_lock<std::mutex>& lock) {
+    // Caller holds lock
+    if (drainedCallbacks_.empty()) {
+        return;
+    }
+    auto callbacks = std::move(drainedCallbacks_);
+    drainedCallbacks_.clear();
+
+    lock.unlock();
+    for (const auto& callback : callbacks) {
+        try {
+            callback();
+        } catch (const std::exception& e) {
+            LOG_ERROR("EnrollmentProgress", "Drained callback failed: " << e.what());
+        }
+    }
+    lock.lock();
+}
+
+void EnrollmentProgress::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    drained_.wait(lock, [this]() { return writes_.empty() && !needsReload_ && !busy_; });
+}
+
+size_t EnrollmentProgress::getPendingWriteCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return writes_.size() + (busy_ ? 1 : 0);
+}
+
+void EnrollmentProgress::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        writeReady_.wait(lock, [this]() { return stopping_ || needsReload_ || !writes_.empty(); });
+        if (writes_.empty() && (stopping_ || !needsReload_)) {
+            break;   // stopping with nothing left to write
+        }
+        busy_ = true;
+
+        if (!writes_.empty()) {
+            PendingWrite write = writes_.front();
+            writes_.pop_front();
+
+            lock.unlock();
+            bool ok = false;
+            try {
+                ok = applyWrite(write);
+            } catch (const std::exception& e) {
+                LOG_ERROR("EnrollmentProgress", "Progress write failed: " << e.what());
+            }
+            if (!ok) {
+                LOG_WARN("EnrollmentProgress", "Could not save progress for module " << write.moduleId
+                         << (write.contentId > 0 ? ", content " + std::to_string(write.contentId) : "")
+                         << "; reloading from backend");
+            }
+            lock.lock();
+            needsReload_ = needsReload_ || !ok;
+        }
+
+        // Reload only once nothing local is left to write
+        if (writes_.empty() && needsReload_ && !stopping_) {
+            needsReload_ = false;
+            lock.unlock();
+            reload();
+            lock.lock();
+        }
+
+        busy_ = false;
+        if (writes_.empty()) {
+            runDrainedCallbacks(lock);
+            drained_.notify_all();
+        }
+    }
+    runDrainedCallbacks(lock);
+    drained_.notify_all();
+}
+
+std::string EnrollmentProgress::ensureModuleRow(int moduleId) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = rows_.find(moduleId);
+        if (it != rows_.end() && !it->second.getId().empty()) {
+            return it->second.getId();
+        }
+    }
+
+    // First write for this module: find or create its backend row
+    std::string rowId = service_->getModuleProgress(studentId_, moduleId).getId();
+    if (rowId.empty()) {
+        rowId = service_->startModule(studentId_, moduleId, std::stoi(enrollmentId_)).id;
+    }
+    if (!rowId.empty()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rowFor(moduleId).setId(rowId);
+    }
+    return rowId;
+}
+
+bool EnrollmentProgress::applyWrite(const PendingWrite& write) {
+    std::string rowId = ensureModuleRow(write.moduleId);
+    if (rowId.empty()) {
+        return false;
+    }
+
+    if (write.contentId > 0 &&
+        !service_->completeContent(studentId_, write.contentId, std::stoi(rowId)).success) {
+        return false;
+    }
+
+    // Send only what this write changed, not the whole row
+    nlohmann::json attrs;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto& row = rows_[write.moduleId];
+        attrs["status"] = row.getStatusString();
+        attrs["progress_percentage"] = row.getProgressPercentage();
+        if (write.contentId > 0) {
+            attrs["completed_content_ids"] = row.getCompletedContentIds();
+            attrs["last_accessed_at"] = row.getLastAccessedAt();
+        } else {
+            attrs["completed_at"] = row.getCompletedAt();
+        }
+    }
+    return service_->updateModuleProgress(rowId, attrs).success;
+}
+
+void EnrollmentProgress::reload() {
+    auto rows = fetchRows();
+
+    ReconciledCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (rows.empty() || !writes_.empty()) {
+            // Backend unreachable, or newer local changes are queued: keep the local model
+            return;
+        }
+        rows_ = std::move(rows);
+        callback = reconciled_;
+    }
+
+    if (callback) {
+        callback();
+    }
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,134 @@
+#ifndef ENROLLMENT_PROGRESS_H
+#define ENROLLMENT_PROGRESS_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <deque>
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include "ClassroomService.h"
+#include "models/Course.h"
+#include "models/StudentProgress.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief In-memory progress model for one student's course enrollment
+ *
+ * Loads the enrollment's module progress rows once, together with their
+ * completed StudentContentProgress rows, and answers completion and unlock
+ * questions from memory. completeContent() and completeModule()
+ * update the model immediately and queue the backend writes for a
+ * background worker, so the UI never waits on them. If a write fails, or
+ * reconcile() is called, the model reloads from the backend once the queue
+ * drains and the reconciled callback fires so views can redraw.
+ *
+ * Held by the StudentSession for the lifetime of the login; the destructor
+ * finishes queued writes before returning.
+ */
+class EnrollmentProgress {
+public:
+    using ReconciledCallback = std::function<void()>;
+    using DrainedCallback = std::function<void()>;
+
+    EnrollmentProgress(std::shared_ptr<ClassroomService> service,
+                       int studentId, const std::string& enrollmentId);
+    ~EnrollmentProgress();
+
+    // Prevent copying
+    EnrollmentProgress(const EnrollmentProgress&) = delete;
+    EnrollmentProgress& operator=(const EnrollmentProgress&) = delete;
+
+    int getStudentId() const { return studentId_; }
+    std::string getEnrollmentId() const { return enrollmentId_; }
+
+    // Fetch the progress rows; only the first call hits the backend
+    bool load();
+    bool isLoaded() const;
+
+    // In-memory lookups
+    std::vector<Models::StudentModuleProgress> getModuleProgressList() const;
+    Models::StudentModuleProgress getModuleProgress(int moduleId) const;
+    bool isContentCompleted(int moduleId, int contentId) const;
+    bool isModuleCompleted(int moduleId) const;
+    bool isModuleUnlocked(const Models::CourseModule& module) const;
+    bool areRequiredContentsCompleted(int moduleId,
+                                      const std::vector<Models::ModuleContent>& contents) const;
+    int getCompletedModuleCount() const;
+
+    // Optimistic updates; backend writes happen in the background
+    void completeContent(int moduleId, int contentId, size_t moduleContentCount);
+    void completeModule(int moduleId);
+
+    // Queue a background reload, e.g. after the backend changed progress itself
+    void reconcile();
+
+    /**
+     * @brief Invoked on the worker thread after a reload replaced the model
+     * @return Id for clearReconciledCallback(); a later call replaces the callback
+     */
+    int setReconciledCallback(ReconciledCallback callback);
+
+    // Clear the callback, unless another one has replaced it since
+    void clearReconciledCallback(int id);
+
+    /**
+     * @brief Run a callback once the writes queued so far have landed
+     *
+     * Runs at once on the calling thread when nothing is queued, otherwise
+     * on the worker thread. Never blocks; use it instead of flush() on a
+     * request thread.
+     */
+    void whenDrained(DrainedCallback callback);
+
+    // Block until queued writes are done (used by tests)
+    void flush();
+    size_t getPendingWriteCount() const;
+
+private:
+    struct PendingWrite {
+        int moduleId;
+        int contentId;   // 0 for a module completion
+    };
+
+    Models::StudentModuleProgress& rowFor(int moduleId);
+    std::map<int, Models::StudentModuleProgress> fetchRows();
+    std::string ensureModuleRow(int moduleId);
+    bool applyWrite(const PendingWrite& write);
+    void reload();
+
+    void enqueue(const PendingWrite& write);
+    void ensureWorker();
+    void workerLoop();
+    void runDrainedCallbacks(std::unique_lock<std::mutex>& lock);
+
+    std::shared_ptr<ClassroomService> service_;
+    int studentId_;
+    std::string enrollmentId_;
+
+    bool loaded_;
+    std::map<int, Models::StudentModuleProgress> rows_;   // by module id
+    ReconciledCallback reconciled_;
+    int reconciledId_;
+    int nextReconciledId_;
+
+    std::deque<PendingWrite> writes_;
+    std::vector<DrainedCallback> drainedCallbacks_;
+    bool busy_;
+    bool needsReload_;
+    bool stopping_;
+    std::thread worker_;
+    std::condition_variable writeReady_;
+    std::condition_variable drained_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // ENROLLMENT_PROGRESS_H
@@ -0,0 +1,690 @@
+#include "EventSpool.h"
+#include "ActivityFeed.h"
+#include "ApiUtils.h"
+#include "ZipStreamWriter.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+constexpr size_t kDefaultSegmentSize = 4 * 1024 * 1024;
+constexpr uint64_t kDefaultMaxBytes = 64ull * 1024 * 1024;
+constexpr int kDefaultReplayRate = 50;
+constexpr int kDefaultReplayIntervalMs = 5000;
+constexpr size_t kReplayChunk = 32;
+
+// Segment header: 8-byte magic, then the segment's sequence number
+constexpr char kSegmentMagic[8] = {'S', 'I', 'S', 'P', 'O', 'O', 'L', '1'};
+constexpr size_t kSegmentHeaderSize = 16;
+
+// Record header: magic, body length, CRC-32 of the body, reserved; body padded to 8 bytes
+constexpr uint32_t kRecordMagic = 0x4c4f5053;  // "SPOL"
+constexpr size_t kRecordHeaderSize = 16;
+
+size_t recordSize(size_t bodySize) {
+    return (kRecordHeaderSize + bodySize + 7) & ~static_cast<size_t>(7);
+}
+
+uint32_t readU32(const char* data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+void writeU32(char* data, uint32_t value) {
+    std::memcpy(data, &value, sizeof(value));
+}
+
+// Push the written range to the page cache's backing file without waiting for it
+void syncRange(char* base, size_t offset, size_t length) {
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t start = offset - offset % pageSize;
+    msync(base + start, offset + length - start, MS_ASYNC);
+}
+
+} // namespace
+
+EventSpool& EventSpool::getInstance() {
+    static EventSpool instance;
+    return instance;
+}
+
+EventSpool::EventSpool()
+    : segmentSize_(kDefaultSegmentSize)
+    , maxBytes_(kDefaultMaxBytes)
+    , replayRate_(kDefaultReplayRate)
+    , replayIntervalMs_(kDefaultReplayIntervalMs)
+    , readOffset_(kSegmentHeaderSize)
+    , lastReplayFailed_(false)
+    , running_(false)
+    , stopRequested_(false) {
+}
+
+EventSpool::~EventSpool() {
+    stop();
+    close();
+}
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void EventSpool::setApiClient(std::shared_ptr<ApiClient> client) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_ = client;
+}
+
+void EventSpool::setSegmentSize(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    segmentSize_ = std::max(bytes, static_cast<size_t>(4096));
+}
+
+void EventSpool::setMaxBytes(uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxBytes_ = bytes;
+}
+
+void EventSpool::setReplayRate(int eventsPerSecond) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    replayRate_ = eventsPerSecond > 0 ? eventsPerSecond : 1;
+}
+
+void EventSpool::setReplayInterval(int milliseconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    replayIntervalMs_ = milliseconds > 0 ? milliseconds : 1;
+}
+
+std::string EventSpool::newEventId() {
+    thread_local std::mt19937_64 generator(std::random_device{}());
+    uint64_t high = generator();
+    uint64_t low = generator();
+
+    // Version 4, RFC 4122 variant
+    high = (high & 0xffffffffffff0fffull) | 0x0000000000004000ull;
+    low = (low & 0x3fffffffffffffffull) | 0x8000000000000000ull;
+
+    std::ostringstream id;
+    id << std::hex << std::setfill('0')
+       << std::setw(8) << (high >> 32) << '-'
+       << std::setw(4) << ((high >> 16) & 0xffff) << '-'
+       << std::setw(4) << (high & 0xffff) << '-'
+       << std::setw(4) << (low >> 48) << '-'
+       << std::setw(12) << (low & 0xffffffffffffull);
+    return id.str();
+}
+
+bool EventSpool::isRetryable(const ApiResponse& response) {
+    if (response.isSuccess()) {
+        return false;
+    }
+    return response.statusCode == 0 || response.statusCode >= 500
+           || response.statusCode == 408 || response.statusCode == 429;
+}
+
+bool EventSpool::isAlreadyStored(ApiClient& client, const std::string& endpoint,
+                                 const nlohmann::json& payload, const ApiResponse& response) {
+    const nlohmann::json& data = payload.contains("data") ? payload["data"] : payload;
+    std::string id = data.is_object() ? stringValue(attributesOf(data), "client_event_id") : "";
+    if (id.empty() || response.statusCode == 0) {
+        return response.statusCode == 409;
+    }
+
+    std::string query = endpoint + "?filter[client_event_id]=" + urlEncode(id) + "&page[limit]=1";
+    std::string type = stringValue(data, "type");
+    if (!type.empty()) {
+        query += "&fields[" + type + "]=client_event_id";
+    }
+    ApiResponse lookup = client.get(query);
+    nlohmann::json rows = lookup.isSuccess() ? lookup.getJson().value("data", nlohmann::json()) : nlohmann::json();
+    if (!rows.is_array()) {
+        LOG_WARN("EventSpool", "Cannot look up client_event_id " << id << " on " << endpoint);
+        return response.statusCode == 409;
+    }
+    return !rows.empty();
+}
+
+// =============================================================================
+// Segments
+// =============================================================================
+
+std::string EventSpool::segmentPath(uint64_t sequence) const {
+    std::ostringstream path;
+    path << directory_ << "/" << std::setw(12) << std::setfill('0') << sequence << ".seg";
+    return path.str();
+}
+
+bool EventSpool::mapSegmentLocked(Segment& segment, bool create) {
+    std::string path = segmentPath(segment.sequence);
+    segment.fd = ::open(path.c_str(), O_RDWR | (create ? O_CREAT | O_EXCL : 0), 0600);
+    if (segment.fd < 0) {
+        LOG_ERROR("EventSpool", "Cannot open spool segment " << path);
+        return false;
+    }
+
+    if (create && ::ftruncate(segment.fd, static_cast<off_t>(segmentSize_)) != 0) {
+        LOG_ERROR("EventSpool", "Cannot size spool segment " << path);
+        ::close(segment.fd);
+        std::remove(path.c_str());
+        segment.fd = -1;
+        return false;
+    }
+
+    struct stat info;
+    if (::fstat(segment.fd, &info) != 0 || static_cast<size_t>(info.st_size) < kSegmentHeaderSize) {
+        LOG_WARN("EventSpool", "Spool segment " << path << " is truncated");
+        ::close(segment.fd);
+        segment.fd = -1;
+        return false;
+    }
+    segment.size = static_cast<size_t>(info.st_size);
+
+    void* data = ::mmap(nullptr, segment.size, PROT_READ | PROT_WRITE, MAP_SHARED, segment.fd, 0);
+    if (data == MAP_FAILED) {
+        LOG_ERROR("EventSpool", "Cannot map spool segment " << path);
+        ::close(segment.fd);
+        segment.fd = -1;
+        return false;
+    }
+    segment.data = static_cast<char*>(data);
+
+    if (create) {
+        std::memcpy(segment.data, kSegmentMagic, sizeof(kSegmentMagic));
+        std::memcpy(segment.data + sizeof(kSegmentMagic), &segment.sequence, sizeof(segment.sequence));
+        syncRange(segment.data, 0, kSegmentHeaderSize);
+        segment.writeOffset = kSegmentHeaderSize;
+    } else if (std::memcmp(segment.data, kSegmentMagic, sizeof(kSegmentMagic)) != 0) {
+        LOG_WARN("EventSpool", "Spool segment " << path << " has no spool header");
+        unmapSegmentLocked(segment);
+        return false;
+    }
+    return true;
+}
+
+void EventSpool::unmapSegmentLocked(Segment& segment) {
+    if (segment.data) {
+        ::munmap(segment.data, segment.size);
+        segment.data = nullptr;
+    }
+    if (segment.fd >= 0) {
+        ::close(segment.fd);
+        segment.fd = -1;
+    }
+}
+
+bool EventSpool::rotateLocked() {
+    uint64_t diskBytes = stats_.diskBytes;
+    if (diskBytes + segmentSize_ > maxBytes_) {
+        return false;
+    }
+
+    Segment segment;
+    segment.sequence = segments_.empty() ? 1 : segments_.back().sequence + 1;
+    if (!mapSegmentLocked(segment, true)) {
+        return false;
+    }
+    segments_.push_back(segment);
+    stats_.diskBytes += segment.size;
+    return true;
+}
+
+bool EventSpool::readRecordLocked(const Segment& segment, size_t offset,
+                                  std::string& body, size_t& next) const {
+    if (offset + kRecordHeaderSize > segment.size) {
+        return false;
+    }
+    const char* header = segment.data + offset;
+    if (readU32(header) != kRecordMagic) {
+        return false;
+    }
+    uint32_t length = readU32(header + 4);
+    if (length > segment.size - offset - kRecordHeaderSize) {
+        return false;
+    }
+    const char* data = header + kRecordHeaderSize;
+    if (ZipStreamWriter::crc32(data, length) != readU32(header + 8)) {
+        return false;
+    }
+
+    body.assign(data, length);
+    next = offset + recordSize(length);
+    return true;
+}
+
+size_t EventSpool::scanSegmentLocked(Segment& segment) {
+    size_t records = 0;
+    size_t offset = kSegmentHeaderSize;
+    std::string body;
+    size_t next = 0;
+    while (readRecordLocked(segment, offset, body, next)) {
+        if (segment.sequence != segments_.front().sequence || offset >= readOffset_) {
+            records++;
+        }
+        offset = next;
+    }
+    segment.writeOffset = offset;
+
+    // Anything after the last valid record is a write torn by a crash; clear it so it is not mistaken for data
+    if (offset + sizeof(uint32_t) <= segment.size && readU32(segment.data + offset) != 0) {
+        stats_.corrupt++;
+        LOG_WARN("EventSpool", "Discarding torn record at offset " << offset
+                 << " of " << segmentPath(segment.sequence));
+        std::memset(segment.data + offset, 0, segment.size - offset);
+        syncRange(segment.data, offset, segment.size - offset);
+    }
+    return records;
+}
+
+void EventSpool::dropSegmentLocked() {
+    Segment& front = segments_.front();
+    std::string path = segmentPath(front.sequence);
+    stats_.diskBytes -= front.size;
+    unmapSegmentLocked(front);
+    segments_.pop_front();
+    readOffset_ = kSegmentHeaderSize;
+    saveCursorLocked();
+    std::remove(path.c_str());
+}
+
+void EventSpool::saveCursorLocked() {
+    if (segments_.empty()) {
+        return;
+    }
+
+    // Written aside and renamed, so a crash leaves the old cursor or the new one
+    std::string path = directory_ + "/cursor";
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::trunc);
+        file << segments_.front().sequence << " " << readOffset_ << "\n";
+        if (!file.good()) {
+            LOG_WARN("EventSpool", "Cannot write spool cursor " << path);
+            return;
+        }
+    }
+    std::rename(tempPath.c_str(), path.c_str());
+}
+
+// =============================================================================
+// Open / Close
+// =============================================================================
+
+bool EventSpool::open(const std::string& directory) {
+    std::lock_guard<std::mutex> replayLock(replayMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    closeLocked();
+
+    directory_ = directory;
+    // Private to the server user: audit events carry names, emails and addresses
+    ::mkdir(directory_.c_str(), 0700);
+
+    DIR* dir = opendir(directory_.c_str());
+    if (!dir) {
+        LOG_ERROR("EventSpool", "Spool directory " << directory_ << " is not usable; audit events will not be spooled");
+        directory_.clear();
+        return false;
+    }
+    std::vector<uint64_t> sequences;
+    while (dirent* item = readdir(dir)) {
+        std::string name = item->d_name;
+        if (name.size() == 16 && name.compare(12, std::string::npos, ".seg") == 0
+            && name.find_first_not_of("0123456789") == 12) {
+            sequences.push_back(std::stoull(name.substr(0, 12)));
+        }
+    }
+    closedir(dir);
+    std::sort(sequences.begin(), sequences.end());
+
+    uint64_t cursorSequence = 0;
+    size_t cursorOffset = kSegmentHeaderSize;
+    std::ifstream cursor(directory_ + "/cursor");
+    cursor >> cursorSequence >> cursorOffset;
+
+    for (uint64_t sequence : sequences) {
+        Segment segment;
+        segment.sequence = sequence;
+        // Replayed before the last shutdown, but not yet removed
+        if (sequence < cursorSequence || !mapSegmentLocked(segment, false)) {
+            std::remove(segmentPath(sequence).c_str());
+            continue;
+        }
+        segments_.push_back(segment);
+        stats_.diskBytes += segment.size;
+    }
+
+    readOffset_ = !segments_.empty() && segments_.front().sequence == cursorSequence
+                  ? std::max(cursorOffset, kSegmentHeaderSize) : kSegmentHeaderSize;
+    for (auto& segment : segments_) {
+        stats_.pending += scanSegmentLocked(segment);
+    }
+    if (!segments_.empty()) {
+        readOffset_ = std::min(readOffset_, segments_.front().writeOffset);
+    }
+
+    if (segments_.empty()) {
+        // Numbered after anything the cursor has seen, so the next open does not take it for replayed
+        Segment segment;
+        segment.sequence = std::max(cursorSequence, sequences.empty() ? 0 : sequences.back()) + 1;
+        if (!mapSegmentLocked(segment, true)) {
+            directory_.clear();
+            return false;
+        }
+        segments_.push_back(segment);
+        stats_.diskBytes += segment.size;
+        saveCursorLocked();
+    }
+    stats_.segments = segments_.size();
+
+    if (stats_.pending > 0) {
+        LOG_INFO("EventSpool", "Recovered " << stats_.pending << " spooled audit events from " << directory_);
+    }
+    return true;
+}
+
+void EventSpool::close() {
+    std::lock_guard<std::mutex> replayLock(replayMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    closeLocked();
+}
+
+void EventSpool::closeLocked() {
+    for (auto& segment : segments_) {
+        if (segment.data) {
+            msync(segment.data, segment.size, MS_SYNC);
+        }
+        unmapSegmentLocked(segment);
+    }
+    segments_.clear();
+    readOffset_ = kSegmentHeaderSize;
+    stats_.pending = 0;
+    stats_.segments = 0;
+    stats_.diskBytes = 0;
+}
+
+bool EventSpool::isOpen() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !segments_.empty();
+}
+
+// =============================================================================
+// Append
+// =============================================================================
+
+bool EventSpool::append(const std::string& endpoint, const nlohmann::json& payload) {
+    nlohmann::json record;
+    record["endpoint"] = endpoint;
+    record["payload"] = payload;
+    std::string body = record.dump();
+    size_t size = recordSize(body.size());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (segments_.empty()) {
+        return false;
+    }
+    if (size > segmentSize_ - kSegmentHeaderSize) {
+        LOG_ERROR("EventSpool", "Audit event of " << body.size() << " bytes does not fit a spool segment");
+        stats_.full++;
+        return false;
+    }
+
+    if (segments_.back().writeOffset + size > segments_.back().size) {
+        if (!rotateLocked()) {
+            if (stats_.full++ % 1000 == 0) {
+                LOG_ERROR("EventSpool", "Spool " << directory_ << " is full; " << stats_.full
+                          << " audit events lost so far");
+            }
+            return false;
+        }
+        stats_.segments = segments_.size();
+    }
+
+    // Body first, magic last: a record is only visible once it is complete
+    Segment& segment = segments_.back();
+    char* header = segment.data + segment.writeOffset;
+    std::memcpy(header + kRecordHeaderSize, body.data(), body.size());
+    writeU32(header + 4, static_cast<uint32_t>(body.size()));
+    writeU32(header + 8, ZipStreamWriter::crc32(body.data(), body.size()));
+    writeU32(header + 12, 0);
+    writeU32(header, kRecordMagic);
+    syncRange(segment.data, segment.writeOffset, size);
+
+    segment.writeOffset += size;
+    stats_.appended++;
+    stats_.pending++;
+    return true;
+}
+
+// =============================================================================
+// Replay
+// =============================================================================
+
+int EventSpool::replay(size_t maxEvents) {
+    std::lock_guard<std::mutex> replayLock(replayMutex_);
+
+    size_t delivered = 0;
+    bool failed = false;
+    while (delivered < maxEvents && !failed) {
+        std::vector<Record> records;
+        std::shared_ptr<ApiClient> client;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!apiClient_) {
+                break;
+            }
+            client = apiClient_;
+
+            size_t wanted = std::min(kReplayChunk, maxEvents - delivered);
+            size_t segmentIndex = 0;
+            size_t offset = readOffset_;
+            while (records.size() < wanted && segmentIndex < segments_.size()) {
+                const Segment& segment = segments_[segmentIndex];
+                std::string body;
+                size_t next = 0;
+                if (!readRecordLocked(segment, offset, body, next)) {
+                    // End of this segment; the writer's segment is the last
+                    segmentIndex++;
+                    offset = kSegmentHeaderSize;
+                    continue;
+                }
+                offset = next;
+
+                nlohmann::json record = nlohmann::json::parse(body, nullptr, false);
+                Record entry{"", nlohmann::json(), segment.sequence, next};
+                if (!record.is_discarded()) {
+                    entry.endpoint = record.value("endpoint", "");
+                    entry.payload = record.value("payload", nlohmann::json());
+                }
+                records.push_back(std::move(entry));
+            }
+        }
+        if (records.empty()) {
+            break;
+        }
+
+        size_t handled = 0;
+        uint64_t rejected = 0;
+        uint64_t duplicates = 0;
+        for (const auto& record : records) {
+            if (record.endpoint.empty()) {
+                rejected++;
+                handled++;
+                continue;
+            }
+            ApiResponse response = client->post(record.endpoint, record.payload);
+            if (!response.isSuccess() && isAlreadyStored(*client, record.endpoint, record.payload, response)) {
+                // Stored by an earlier attempt whose acknowledgement was lost
+                duplicates++;
+            } else if (isRetryable(response)) {
+                failed = true;
+                break;
+            } else if (!response.isSuccess()) {
+                LOG_ERROR("EventSpool", "Backend refused spooled event for " << record.endpoint
+                          << " (" << response.statusCode << "): " << response.errorMessage);
+                rejected++;
+            }
+            handled++;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (handled > 0) {
+            const Record& last = records[handled - 1];
+            while (!segments_.empty() && segments_.front().sequence < last.sequence) {
+                dropSegmentLocked();
+            }
+            if (segments_.empty()) {
+                break;
+            }
+            readOffset_ = last.endOffset;
+            stats_.pending -= std::min(stats_.pending, handled);
+        }
+        stats_.delivered += handled - rejected;
+        stats_.duplicates += duplicates;
+        stats_.rejected += rejected;
+        delivered += handled - rejected;
+
+        // Segments read to the end are deleted; when the last one drains,
+        // the next outage starts in a fresh segment
+        while (segments_.size() > 1 && readOffset_ >= segments_.front().writeOffset) {
+            dropSegmentLocked();
+        }
+        const Segment& front = segments_.front();
+        if (readOffset_ >= front.writeOffset && front.writeOffset > kSegmentHeaderSize && rotateLocked()) {
+            dropSegmentLocked();
+        } else {
+            saveCursorLocked();
+        }
+        stats_.segments = segments_.size();
+        if (failed) {
+            stats_.failedReplays++;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lastReplayFailed_ = failed;
+    }
+    if (failed) {
+        LOG_WARN("EventSpool", "Backend still unavailable; " << getStats().pending << " audit events stay spooled");
+    } else if (delivered > 0) {
+        LOG_INFO("EventSpool", "Replayed " << delivered << " spooled audit events");
+    }
+    if (delivered > 0) {
+        ActivityFeed::getInstance().notify();
+    }
+    return static_cast<int>(delivered);
+}
+
+// =============================================================================
+// Background Replayer
+// =============================================================================
+
+void EventSpool::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    replayer_ = std::thread([this]() { replayerLoop(); });
+    LOG_DEBUG("EventSpool", "Replayer started (" << replayRate_ << " events/s, retry every "
+              << replayIntervalMs_ << "ms)");
+}
+
+void EventSpool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    wakeReplayer_.notify_all();
+
+    if (replayer_.joinable()) {
+        replayer_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    stopRequested_ = false;
+}
+
+bool EventSpool::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+void EventSpool::replayerLoop() {
+    using Clock = std::chrono::steady_clock;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopRequested_) {
+        wakeReplayer_.wait_for(lock, std::chrono::milliseconds(replayIntervalMs_),
+                               [this]() { return stopRequested_; });
+
+        // Drain at replayRate_ events per second until empty, failed or stopped
+        while (!stopRequested_ && stats_.pending > 0) {
+            auto windowEnd = Clock::now() + std::chrono::seconds(1);
+            size_t rate = static_cast<size_t>(replayRate_);
+
+            lock.unlock();
+            replay(rate);
+            lock.lock();
+
+            if (lastReplayFailed_) {
+                break;
+            }
+            wakeReplayer_.wait_until(lock, windowEnd, [this]() { return stopRequested_; });
+        }
+    }
+}
+
+EventSpoolStats EventSpool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void EventSpool::reset() {
+    std::lock_guard<std::mutex> replayLock(replayMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<uint64_t> sequences;
+    for (const auto& segment : segments_) {
+        sequences.push_back(segment.sequence);
+    }
+    closeLocked();
+    if (!directory_.empty()) {
+        for (uint64_t sequence : sequences) {
+            std::remove(segmentPath(sequence).c_str());
+        }
+        std::remove((directory_ + "/cursor").c_str());
+        ::rmdir(directory_.c_str());
+    }
+
+    apiClient_.reset();
+    segmentSize_ = kDefaultSegmentSize;
+    maxBytes_ = kDefaultMaxBytes;
+    replayRate_ = kDefaultReplayRate;
+    replayIntervalMs_ = kDefaultReplayIntervalMs;
+    directory_.clear();
+    lastReplayFailed_ = false;
+    stats_ = EventSpoolStats();
+}
+
+} // namespace Api
+} // namespace StudentIntake
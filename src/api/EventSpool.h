@@ -0,0 +1,169 @@
+#ifndef EVENT_SPOOL_H
+#define EVENT_SPOOL_H
+
+#include <string>
+#include <memory>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <cstdint>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "ApiClient.h"
+
+namespace StudentIntake {
+namespace Api {
+
+struct EventSpoolStats {
+    uint64_t appended = 0;
+    uint64_t delivered = 0;         // accepted by the backend on replay
+    uint64_t duplicates = 0;        // already stored by the backend; counted as delivered
+    uint64_t rejected = 0;          // refused by the backend; not retried
+    uint64_t full = 0;              // not spooled because the size limit was reached
+    uint64_t corrupt = 0;           // records skipped on recovery because their CRC did not match
+    uint64_t failedReplays = 0;     // replay passes stopped by a backend failure
+    size_t pending = 0;             // records waiting for replay
+    size_t segments = 0;
+    uint64_t diskBytes = 0;
+};
+
+/**
+ * @brief Crash-safe local spool for audit events the backend could not take
+ *
+ * When ApiLogicServer is unreachable, ActivityLog and LoginAudit posts are
+ * appended here instead of being lost. The spool is a directory of
+ * fixed-size segment files written through a shared memory mapping; each
+ * record carries its length and a CRC-32, so a record torn by a crash is
+ * detected and discarded when the spool is reopened. Segments rotate when
+ * full and are deleted once every record in them has been replayed.
+ *
+ * A background replayer posts spooled records, oldest first and at most
+ * replayRate per second, once the backend answers again. The replay
+ * position is kept in a cursor file. Every event carries a client-generated
+ * client_event_id that the backend stores under a unique constraint, so a
+ * record replayed twice (after a crash between post and cursor update) is
+ * refused rather than stored again. Whatever status the refusal comes back
+ * with, the id is looked up before the record is counted as a duplicate,
+ * rejected or left for the next pass.
+ *
+ * Thread-safe singleton shared by all sessions.
+ */
+class EventSpool {
+public:
+    // Singleton access
+    static EventSpool& getInstance();
+
+    // Prevent copying
+    EventSpool(const EventSpool&) = delete;
+    EventSpool& operator=(const EventSpool&) = delete;
+
+    // Configuration
+    void setApiClient(std::shared_ptr<ApiClient> client);
+    void setSegmentSize(size_t bytes);          // applies to segments created afterwards
+    void setMaxBytes(uint64_t bytes);
+    void setReplayRate(int eventsPerSecond);
+    void setReplayInterval(int milliseconds);   // wait after a failed replay
+
+    /**
+     * @brief Open (creating if needed) the spool directory and recover its records
+     * @return false if the directory cannot be used; append() then refuses events
+     */
+    bool open(const std::string& directory);
+    void close();
+    bool isOpen() const;
+
+    // Background replayer lifecycle
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    /**
+     * @brief Durably store one post for later delivery
+     * @param endpoint API endpoint to replay the post to, e.g. "/LoginAudit"
+     * @param payload JSON:API request body
+     * @return false if the spool is closed, full or cannot be written
+     */
+    bool append(const std::string& endpoint, const nlohmann::json& payload);
+
+    // Post up to maxEvents spooled records synchronously; returns the number delivered
+    int replay(size_t maxEvents = SIZE_MAX);
+
+    EventSpoolStats getStats() const;
+
+    // Close, delete the spool files, statistics and configuration (used by tests)
+    void reset();
+
+    // Random UUID used as client_event_id
+    static std::string newEventId();
+
+    // True for failures worth spooling: no response, 5xx, 408 or 429
+    static bool isRetryable(const ApiResponse& response);
+
+    /**
+     * @brief Whether a failed post was refused because its event is already stored
+     *
+     * A unique violation on client_event_id may come back as 409, 400 or 500
+     * depending on the backend, so the status alone cannot tell. The post's
+     * client_event_id is looked up on its endpoint; when the payload has no
+     * id or the lookup fails, only a 409 counts as stored.
+     */
+    static bool isAlreadyStored(ApiClient& client, const std::string& endpoint,
+                                const nlohmann::json& payload, const ApiResponse& response);
+
+private:
+    EventSpool();
+    ~EventSpool();
+
+    struct Segment {
+        uint64_t sequence = 0;
+        int fd = -1;
+        char* data = nullptr;
+        size_t size = 0;
+        size_t writeOffset = 0;     // end of the last valid record
+    };
+
+    struct Record {
+        std::string endpoint;
+        nlohmann::json payload;
+        uint64_t sequence;
+        size_t endOffset;
+    };
+
+    void replayerLoop();
+
+    // Callers hold mutex_
+    bool mapSegmentLocked(Segment& segment, bool create);
+    void unmapSegmentLocked(Segment& segment);
+    bool rotateLocked();
+    size_t scanSegmentLocked(Segment& segment);
+    bool readRecordLocked(const Segment& segment, size_t offset, std::string& body, size_t& next) const;
+    void dropSegmentLocked();
+    void saveCursorLocked();
+    void closeLocked();
+    std::string segmentPath(uint64_t sequence) const;
+
+    std::shared_ptr<ApiClient> apiClient_;
+    size_t segmentSize_;
+    uint64_t maxBytes_;
+    int replayRate_;
+    int replayIntervalMs_;
+
+    std::string directory_;
+    std::deque<Segment> segments_;  // oldest first; the back one is written to
+    size_t readOffset_;             // replay position in segments_.front()
+    bool lastReplayFailed_;
+    EventSpoolStats stats_;
+
+    mutable std::mutex mutex_;
+    std::mutex replayMutex_;
+    std::condition_variable wakeReplayer_;
+    std::thread replayer_;
+    bool running_;
+    bool stopRequested_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // EVENT_SPOOL_H
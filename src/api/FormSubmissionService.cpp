@@ -1,4 +1,8 @@
 #include "FormSubmissionService.h"
+#include "AdminStatisticsService.h"
+#include "ApiUtils.h"
+#include "PdfCache.h"
+#include <cstdlib>
 #include <thread>
 #include <chrono>
 #include <ctime>
@@ -9,25 +13,6 @@
 namespace StudentIntake {
 namespace Api {
 
-// Helper function to URL-encode a string
-static std::string urlEncode(const std::string& value) {
-    std::ostringstream escaped;
-    escaped.fill('0');
-    escaped << std::hex;
-
-    for (char c : value) {
-        if (isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.' || c == '~') {
-            escaped << c;
-        } else {
-            escaped << std::uppercase;
-            escaped << '%' << std::setw(2) << int(static_cast<unsigned char>(c));
-            escaped << std::nouppercase;
-        }
-    }
-
-    return escaped.str();
-}
-
 FormSubmissionService::FormSubmissionService()
     : apiClient_(std::make_shared<ApiClient>()) {
 }
@@ -190,6 +175,7 @@ SubmissionResult FormSubmissionService::registerStudent(const Models::Student& s
 
     // ApiLogicServer uses capitalized resource names
     ApiResponse response = apiClient_->post("/Student", payload);
+    AdminStatisticsService::getInstance().applyStudentResponse(response);
 
     LOG_DEBUG("FormSubmissionService", "API response received - status: " << response.statusCode
               << ", success: " << response.success);
@@ -323,6 +309,7 @@ SubmissionResult FormSubmissionService::updateStudentProfile(const Models::Stude
         {"attributes", attributes}
     };
     ApiResponse response = apiClient_->patch("/Student/" + student.getId(), payload);
+    AdminStatisticsService::getInstance().applyStudentResponse(response);
     LOG_INFO("FormSubmissionService", "updateStudentProfile - response status: " << response.statusCode);
     if (!response.isSuccess()) {
         LOG_ERROR("FormSubmissionService", "updateStudentProfile - error: " << response.errorMessage);
@@ -846,6 +833,7 @@ SubmissionResult FormSubmissionService::submitPersonalInfo(const std::string& st
     payload["data"]["id"] = studentId;
     LOG_DEBUG("FormSubmissionService", "submitPersonalInfo payload: " << payload.dump());
     ApiResponse response = apiClient_->patch("/Student/" + studentId, payload);
+    AdminStatisticsService::getInstance().applyStudentResponse(response);
     return parseSubmissionResponse(response);
 }
 
@@ -1448,6 +1436,7 @@ SubmissionResult FormSubmissionService::submitForm(const std::string& studentId,
         if (formId == "personal_info") {
             payload["data"]["id"] = studentId;
             response = apiClient_->patch("/Student/" + studentId, payload);
+            AdminStatisticsService::getInstance().applyStudentResponse(response);
         } else {
             response = apiClient_->post(endpoint, payload);
         }
@@ -1466,6 +1455,9 @@ SubmissionResult FormSubmissionService::submitForm(const std::string& studentId,
             // Don't fail the overall submission - domain data was saved successfully
             // Just log the warning
         }
+
+        // Previews rendered before this edit no longer match the student's data
+        PdfCache::getInstance().invalidateStudent(std::atoi(studentId.c_str()));
     }
 
     return domainResult;
@@ -1588,6 +1580,7 @@ SubmissionResult FormSubmissionService::finalizeIntake(const std::string& studen
     };
 
     ApiResponse response = apiClient_->patch("/Student/" + studentId, payload);
+    AdminStatisticsService::getInstance().applyStudentResponse(response);
     return parseSubmissionResponse(response);
 }
 
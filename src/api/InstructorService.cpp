@@ -1,10 +1,10 @@
 #include "InstructorService.h"
+#include "SkillProgressMatrix.h"
 #include <stdexcept>
 #include <chrono>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
-#include <set>
 
 namespace StudentIntake {
 namespace Api {
@@ -950,6 +950,8 @@ std::vector<Models::SkillItem> InstructorService::getAllSkillItems() {
         for (const auto& item : json["data"]) {
             items.push_back(Models::SkillItem::fromJson(item));
         }
+        // Refresh the shared matrix columns whenever the catalog is fetched
+        SkillProgressMatrix::getInstance().setSkillItems(items);
     }
 
     return items;
@@ -966,6 +968,8 @@ std::vector<Models::StudentSkillProgress> InstructorService::getSkillProgress(in
         for (const auto& item : json["data"]) {
             progressList.push_back(Models::StudentSkillProgress::fromJson(item));
         }
+        // Every fetch re-hydrates the enrollment's matrix row
+        SkillProgressMatrix::getInstance().loadEnrollment(studentId, enrollmentId, progressList);
     }
 
     return progressList;
@@ -1038,7 +1042,11 @@ InstructorResult InstructorService::createValidation(const Models::SkillValidati
     auto payload = buildJsonApiPayload("SkillValidation", attrs);
     auto response = apiClient_->post("/SkillValidation", payload);
 
-    return parseResponse(response);
+    auto result = parseResponse(response);
+    if (result.success) {
+        SkillProgressMatrix::getInstance().applyValidation(validation);
+    }
+    return result;
 }
 
 InstructorResult InstructorService::updateValidation(const Models::SkillValidation& validation) {
@@ -1046,61 +1054,43 @@ InstructorResult InstructorService::updateValidation(const Models::SkillValidati
     auto payload = buildJsonApiPayload("SkillValidation", validation.getId(), attrs);
     auto response = apiClient_->patch("/SkillValidation/" + validation.getId(), payload);
 
-    return parseResponse(response);
+    auto result = parseResponse(response);
+    if (result.success) {
+        // An edit can revoke a pass or re-count one; reload the row on next query
+        SkillProgressMatrix::getInstance().invalidateEnrollment(validation.getEnrollmentId());
+    }
+    return result;
 }
 
 InstructorResult InstructorService::deleteValidation(const std::string& validationId) {
     auto response = apiClient_->del("/SkillValidation/" + validationId);
-    return parseResponse(response);
-}
 
-bool InstructorService::hasPassedAllSkills(int studentId, int enrollmentId) {
-    auto allSkills = getAllSkillItems();
-    auto progress = getSkillProgress(studentId, enrollmentId);
-
-    int validatedCount = 0;
-    for (const auto& p : progress) {
-        if (p.isValidated()) {
-            validatedCount++;
-        }
+    auto result = parseResponse(response);
+    if (result.success) {
+        // The id alone doesn't say which enrollment lost the record; rows reload on next query
+        SkillProgressMatrix::getInstance().invalidateAllEnrollments();
     }
+    return result;
+}
 
-    // Check if all required skills are validated
-    int requiredCount = 0;
-    for (const auto& skill : allSkills) {
-        if (skill.requiresDemonstration()) {
-            requiredCount++;
-        }
+void InstructorService::ensureSkillMatrixRow(int studentId, int enrollmentId) {
+    auto& matrix = SkillProgressMatrix::getInstance();
+    if (!matrix.hasSkillCatalog()) {
+        getAllSkillItems();
+    }
+    if (!matrix.hasEnrollment(enrollmentId)) {
+        getSkillProgress(studentId, enrollmentId);
     }
+}
 
-    return validatedCount >= requiredCount;
+bool InstructorService::hasPassedAllSkills(int studentId, int enrollmentId) {
+    ensureSkillMatrixRow(studentId, enrollmentId);
+    return SkillProgressMatrix::getInstance().hasPassedAllRequired(enrollmentId);
 }
 
 std::vector<Models::SkillItem> InstructorService::getSkillsNeedingValidation(int studentId, int enrollmentId) {
-    std::vector<Models::SkillItem> needsValidation;
-
-    auto allSkills = getAllSkillItems();
-    auto progress = getSkillProgress(studentId, enrollmentId);
-
-    // Create a set of validated skill IDs
-    std::set<int> validatedSkillIds;
-    for (const auto& p : progress) {
-        if (p.isValidated()) {
-            validatedSkillIds.insert(p.getSkillItemId());
-        }
-    }
-
-    // Find skills not yet validated
-    for (const auto& skill : allSkills) {
-        if (skill.requiresDemonstration()) {
-            int skillId = std::stoi(skill.getId());
-            if (validatedSkillIds.find(skillId) == validatedSkillIds.end()) {
-                needsValidation.push_back(skill);
-            }
-        }
-    }
-
-    return needsValidation;
+    ensureSkillMatrixRow(studentId, enrollmentId);
+    return SkillProgressMatrix::getInstance().getRequiredSkillsNotPassed(enrollmentId);
 }
 
 // =============================================================================
@@ -1140,13 +1130,16 @@ nlohmann::json InstructorService::getCdlTestResults(int studentId) {
 }
 
 bool InstructorService::isStudentReadyForCdlTest(int studentId, int enrollmentId) {
+    // Practice hours are logged outside this service, so read progress fresh;
+    // the fetch also re-hydrates the enrollment's matrix row
+    auto skillProgress = getSkillProgress(studentId, enrollmentId);
+
     // Check if student has passed all required skills
     if (!hasPassedAllSkills(studentId, enrollmentId)) {
         return false;
     }
 
     // Check if student has completed required hours
-    auto skillProgress = getSkillProgress(studentId, enrollmentId);
     double totalHours = 0.0;
     for (const auto& p : skillProgress) {
         totalHours += p.getPracticeHours();
@@ -509,6 +509,7 @@ private:
                                         const nlohmann::json& attributes);
     StudentProgressSummary parseStudentProgressSummary(const nlohmann::json& json);
     CalendarEvent parseCalendarEvent(const nlohmann::json& json);
+    void ensureSkillMatrixRow(int studentId, int enrollmentId);
 };
 
 } // namespace Api
@@ -0,0 +1,530 @@
+#include "PdfCache.h"
+#include "utils/Logger.h"
+#include <cerrno>
+#include <cstdio>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+/**
+ * @brief Two independent 64-bit FNV-1a hashes over length-prefixed fields
+ *
+ * Length prefixes keep ("ab", "c") and ("a", "bc") apart.
+ */
+class KeyHasher {
+public:
+    void add(const std::string& value) {
+        addBytes(std::to_string(value.size()) + ":");
+        addBytes(value);
+    }
+
+    void add(int value) {
+        add(std::to_string(value));
+    }
+
+    std::string hex() const {
+        std::ostringstream out;
+        out << std::hex << std::setfill('0') << std::setw(16) << first_ << std::setw(16) << second_;
+        return out.str();
+    }
+
+private:
+    void addBytes(const std::string& bytes) {
+        for (unsigned char c : bytes) {
+            first_ = (first_ ^ c) * 0x100000001b3ULL;
+            second_ = (second_ ^ c) * 0x100000001b3ULL;
+        }
+    }
+
+    uint64_t first_ = 0xcbf29ce484222325ULL;
+    uint64_t second_ = 0x84222325cbf29ce4ULL;
+};
+
+} // namespace
+
+PdfCache& PdfCache::getInstance() {
+    static PdfCache instance;
+    return instance;
+}
+
+PdfCache::PdfCache()
+    : memoryLimit_(kDefaultMemoryLimit)
+    , diskLimit_(kDefaultDiskLimit)
+    , nextSpillTicket_(1)
+    , memoryBytes_(0)
+    , diskBytes_(0) {
+}
+
+void PdfCache::setMemoryLimit(size_t bytes) {
+    FileWork work;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        memoryLimit_ = bytes;
+        evictLocked(work);
+    }
+    runFileWork(std::move(work));
+}
+
+void PdfCache::setDiskLimit(size_t bytes) {
+    FileWork work;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        diskLimit_ = bytes;
+        evictLocked(work);
+    }
+    runFileWork(std::move(work));
+}
+
+void PdfCache::setSpillDirectory(const std::string& path) {
+    bool usable = !path.empty() && preparePrivateDirectory(path);
+    if (usable) {
+        // Left by a previous run; their students are not tracked, so they cannot be invalidated
+        removeSpillFiles(path);
+    }
+
+    FileWork work;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& key : std::list<std::string>(diskLru_)) {
+            dropLocked(key, work);
+        }
+        spillDirectory_ = usable ? path : std::string();
+    }
+    runFileWork(std::move(work));
+}
+
+// =============================================================================
+// Keys
+// =============================================================================
+
+std::string PdfCache::makeKey(const std::vector<PdfFormData>& forms, bool packet,
+                              const std::string& packetStudentName,
+                              const std::string& settingsVersion) {
+    KeyHasher hasher;
+    hasher.add(kRenderVersion);
+    hasher.add(settingsVersion);
+    hasher.add(packet ? "packet" : "form");
+    hasher.add(packet ? packetStudentName : "");
+    hasher.add(static_cast<int>(forms.size()));
+    for (const auto& form : forms) {
+        hasher.add(form.formTitle);
+        hasher.add(form.studentName);
+        hasher.add(form.studentEmail);
+        hasher.add(form.submissionDate);
+        hasher.add(form.institutionName);
+        hasher.add(form.institutionTagline);
+        hasher.add(static_cast<int>(form.fields.size()));
+        for (const auto& field : form.fields) {
+            hasher.add(field.label);
+            hasher.add(field.value);
+            hasher.add(field.type);
+        }
+    }
+    return hasher.hex();
+}
+
+std::string PdfCache::settingsVersion(const std::map<std::string, std::string>& settings) {
+    KeyHasher hasher;
+    for (const auto& setting : settings) {
+        hasher.add(setting.first);
+        hasher.add(setting.second);
+    }
+    return hasher.hex();
+}
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+bool PdfCache::get(const std::string& key, std::string& pdf) {
+    std::string path;
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            stats_.misses++;
+            return false;
+        }
+
+        Entry& entry = it->second;
+        if (entry.pdf) {
+            // In memory, or still being written out
+            if (entry.place == Place::Memory) {
+                memoryLru_.splice(memoryLru_.begin(), memoryLru_, entry.position);
+            }
+            pdf = *entry.pdf;
+            stats_.hits++;
+            return true;
+        }
+        path = entry.spillFile;
+        size = entry.size;
+    }
+
+    // Spilled: read it back without the lock, then promote it to memory
+    std::ifstream file(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    FileWork work;
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end() && it->second.pdf) {
+            // Promoted by another session while this one was reading
+            pdf = *it->second.pdf;
+            stats_.hits++;
+            found = true;
+        } else if (it == entries_.end() || it->second.spillFile != path) {
+            // Dropped, or replaced by a newer document, while reading
+            stats_.misses++;
+        } else if (bytes.size() != size) {
+            LOG_WARN("PdfCache", "Spilled document " << key << " is missing or truncated");
+            dropLocked(key, work);
+            stats_.misses++;
+        } else {
+            Entry& entry = it->second;
+            diskLru_.erase(entry.position);
+            diskBytes_ -= entry.size;
+            work.removals.push_back(entry.spillFile);
+            entry.spillFile.clear();
+
+            entry.pdf = std::make_shared<const std::string>(std::move(bytes));
+            entry.place = Place::Memory;
+            memoryLru_.push_front(key);
+            entry.position = memoryLru_.begin();
+            memoryBytes_ += entry.size;
+            pdf = *entry.pdf;
+            stats_.diskHits++;
+            found = true;
+
+            evictLocked(work);
+        }
+    }
+    runFileWork(std::move(work));
+    return found;
+}
+
+void PdfCache::put(const std::string& key, const std::string& pdf, int studentId, int submissionId) {
+    if (pdf.empty()) {
+        return;
+    }
+
+    FileWork work;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dropLocked(key, work);
+        if (pdf.size() <= memoryLimit_) {
+            // A larger one would evict everything else and then itself
+            Entry entry;
+            entry.pdf = std::make_shared<const std::string>(pdf);
+            entry.size = pdf.size();
+            entry.studentId = studentId;
+            entry.submissionId = submissionId;
+            memoryLru_.push_front(key);
+            entry.position = memoryLru_.begin();
+            entries_.emplace(key, std::move(entry));
+            memoryBytes_ += pdf.size();
+
+            if (studentId > 0) {
+                byStudent_[studentId].insert(key);
+            }
+            if (submissionId > 0) {
+                bySubmission_[submissionId].insert(key);
+            }
+
+            evictLocked(work);
+        }
+    }
+    runFileWork(std::move(work));
+}
+
+// =============================================================================
+// Invalidation
+// =============================================================================
+
+void PdfCache::invalidateStudent(int studentId) {
+    FileWork work;
+    size_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = byStudent_.find(studentId);
+        if (it == byStudent_.end()) {
+            return;
+        }
+
+        std::set<std::string> keys = it->second;
+        for (const auto& key : keys) {
+            dropLocked(key, work);
+        }
+        dropped = keys.size();
+        stats_.invalidations += dropped;
+    }
+    runFileWork(std::move(work));
+    LOG_DEBUG("PdfCache", "Dropped " << dropped << " documents for student " << studentId);
+}
+
+void PdfCache::invalidateSubmission(int submissionId) {
+    FileWork work;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = bySubmission_.find(submissionId);
+        if (it == bySubmission_.end()) {
+            return;
+        }
+
+        std::set<std::string> keys = it->second;
+        for (const auto& key : keys) {
+            dropLocked(key, work);
+        }
+        stats_.invalidations += keys.size();
+    }
+    runFileWork(std::move(work));
+}
+
+PdfCacheStats PdfCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PdfCacheStats stats = stats_;
+    stats.memoryEntries = memoryLru_.size();
+    stats.memoryBytes = memoryBytes_;
+    stats.diskEntries = diskLru_.size();
+    stats.diskBytes = diskBytes_;
+    return stats;
+}
+
+void PdfCache::reset() {
+    FileWork work;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& key : diskLru_) {
+            work.removals.push_back(entries_[key].spillFile);
+        }
+        entries_.clear();
+        memoryLru_.clear();
+        diskLru_.clear();
+        byStudent_.clear();
+        bySubmission_.clear();
+        memoryBytes_ = 0;
+        diskBytes_ = 0;
+        stats_ = PdfCacheStats();
+        memoryLimit_ = kDefaultMemoryLimit;
+        diskLimit_ = kDefaultDiskLimit;
+        spillDirectory_.clear();
+    }
+    runFileWork(std::move(work));
+}
+
+// =============================================================================
+// Eviction and Spill
+// =============================================================================
+
+void PdfCache::evictLocked(FileWork& work) {
+    while (memoryBytes_ > memoryLimit_ && !memoryLru_.empty()) {
+        // A copy: both paths below erase the list node the key lives in
+        std::string key = memoryLru_.back();
+        Entry& entry = entries_[key];
+        if (spillDirectory_.empty() || entry.size > diskLimit_) {
+            dropLocked(key, work);
+        } else {
+            startSpillLocked(key, entry, work);
+        }
+    }
+
+    while (diskBytes_ > diskLimit_ && !diskLru_.empty()) {
+        std::string key = diskLru_.back();
+        dropLocked(key, work);
+    }
+}
+
+void PdfCache::startSpillLocked(const std::string& key, Entry& entry, FileWork& work) {
+    // Leaves the memory budget now; still served from memory until written
+    memoryLru_.erase(entry.position);
+    memoryBytes_ -= entry.size;
+    entry.place = Place::Spilling;
+    entry.spillTicket = nextSpillTicket_++;
+
+    SpillJob job;
+    job.key = key;
+    job.ticket = entry.spillTicket;
+    job.path = spillDirectory_ + "/" + key + "." + std::to_string(job.ticket) + ".pdf";
+    job.pdf = entry.pdf;
+    work.spills.push_back(std::move(job));
+}
+
+void PdfCache::finishSpillLocked(const SpillJob& job, bool written, FileWork& work) {
+    auto it = entries_.find(job.key);
+    bool current = it != entries_.end() && it->second.place == Place::Spilling
+                   && it->second.spillTicket == job.ticket && !spillDirectory_.empty()
+                   && job.path.compare(0, spillDirectory_.size() + 1, spillDirectory_ + "/") == 0;
+    if (!current) {
+        // Dropped, replaced or moved to another directory while being written
+        if (written) {
+            work.removals.push_back(job.path);
+        }
+        return;
+    }
+
+    if (!written) {
+        dropLocked(job.key, work);
+        return;
+    }
+
+    Entry& entry = it->second;
+    entry.pdf.reset();
+    entry.place = Place::Disk;
+    entry.spillFile = job.path;
+    diskLru_.push_front(job.key);
+    entry.position = diskLru_.begin();
+    diskBytes_ += entry.size;
+    evictLocked(work);
+}
+
+void PdfCache::dropLocked(const std::string& key, FileWork& work) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return;
+    }
+
+    // A spill in flight finds its entry gone and removes its own file
+    Entry& entry = it->second;
+    if (entry.place == Place::Memory) {
+        memoryLru_.erase(entry.position);
+        memoryBytes_ -= entry.size;
+    } else if (entry.place == Place::Disk) {
+        diskLru_.erase(entry.position);
+        diskBytes_ -= entry.size;
+        work.removals.push_back(entry.spillFile);
+    }
+
+    if (entry.studentId > 0) {
+        auto owner = byStudent_.find(entry.studentId);
+        if (owner != byStudent_.end()) {
+            owner->second.erase(key);
+            if (owner->second.empty()) {
+                byStudent_.erase(owner);
+            }
+        }
+    }
+    if (entry.submissionId > 0) {
+        auto owner = bySubmission_.find(entry.submissionId);
+        if (owner != bySubmission_.end()) {
+            owner->second.erase(key);
+            if (owner->second.empty()) {
+                bySubmission_.erase(owner);
+            }
+        }
+    }
+    entries_.erase(it);
+}
+
+// =============================================================================
+// Files
+// =============================================================================
+
+void PdfCache::runFileWork(FileWork work) {
+    // Finishing a spill can evict further documents, so repeat until nothing is left
+    while (!work.spills.empty() || !work.removals.empty()) {
+        for (const auto& path : work.removals) {
+            std::remove(path.c_str());
+        }
+
+        std::vector<std::pair<SpillJob, bool>> results;
+        for (auto& job : work.spills) {
+            bool written = writeSpillFile(job);
+            job.pdf.reset();
+            results.emplace_back(std::move(job), written);
+        }
+
+        work = FileWork();
+        if (results.empty()) {
+            break;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& result : results) {
+            finishSpillLocked(result.first, result.second, work);
+        }
+    }
+}
+
+bool PdfCache::writeSpillFile(const SpillJob& job) {
+    // Written under a temporary name so a crash never leaves a partial document
+    std::string temporary = job.path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(job.pdf->data(), static_cast<std::streamsize>(job.pdf->size()));
+        if (!file.good()) {
+            LOG_WARN("PdfCache", "Cannot spill to " << job.path);
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temporary.c_str(), job.path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool PdfCache::preparePrivateDirectory(const std::string& path) {
+    // Spilled documents are student records: only a directory of our own will do
+    if (::mkdir(path.c_str(), 0700) != 0 && errno != EEXIST) {
+        LOG_WARN("PdfCache", "Cannot create spill directory " << path << "; spilling disabled");
+        return false;
+    }
+
+    struct stat info;
+    if (::lstat(path.c_str(), &info) != 0) {
+        LOG_WARN("PdfCache", "Cannot inspect spill directory " << path << "; spilling disabled");
+        return false;
+    }
+    if (S_ISLNK(info.st_mode) || !S_ISDIR(info.st_mode)) {
+        LOG_WARN("PdfCache", "Spill directory " << path << " is not a plain directory; spilling disabled");
+        return false;
+    }
+    if (info.st_uid != ::geteuid()) {
+        LOG_WARN("PdfCache", "Spill directory " << path << " belongs to another user; spilling disabled");
+        return false;
+    }
+    if ((info.st_mode & 0777) != 0700) {
+        LOG_WARN("PdfCache", "Spill directory " << path << " is not mode 0700; spilling disabled");
+        return false;
+    }
+    return true;
+}
+
+void PdfCache::removeSpillFiles(const std::string& directory) {
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+        return;
+    }
+
+    int removed = 0;
+    while (dirent* item = readdir(dir)) {
+        std::string name = item->d_name;
+        // Only files this cache writes: 32 hex digits, "." and a ticket, then ".pdf" or ".pdf.tmp"
+        bool ours = name.size() >= 36 && name.find_first_not_of("0123456789abcdef") == 32
+                    && name[32] == '.'
+                    && (name.compare(name.size() - 4, 4, ".pdf") == 0
+                        || (name.size() >= 40 && name.compare(name.size() - 8, 8, ".pdf.tmp") == 0));
+        if (ours && std::remove((directory + "/" + name).c_str()) == 0) {
+            removed++;
+        }
+    }
+    closedir(dir);
+
+    if (removed > 0) {
+        LOG_INFO("PdfCache", "Removed " << removed << " documents left in " << directory);
+    }
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,156 @@
+#ifndef PDF_CACHE_H
+#define PDF_CACHE_H
+
+#include <string>
+#include <map>
+#include <set>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include "PdfGenerator.h"
+
+namespace StudentIntake {
+namespace Api {
+
+struct PdfCacheStats {
+    size_t memoryEntries = 0;
+    size_t memoryBytes = 0;
+    size_t diskEntries = 0;
+    size_t diskBytes = 0;
+    uint64_t hits = 0;              // served from memory
+    uint64_t diskHits = 0;          // read back from the spill directory
+    uint64_t misses = 0;
+    uint64_t invalidations = 0;     // entries dropped by invalidateStudent/Submission
+};
+
+/**
+ * @brief Process-wide cache of rendered PDFs, keyed by what was rendered
+ *
+ * The key is a hash of every PdfFormData input, the layout (single form or
+ * student packet), the institution settings version and the renderer
+ * version, so a cached document can only be returned for identical input.
+ * Entries live in an in-memory LRU bounded by bytes; entries pushed out of
+ * memory are spilled to a directory, itself bounded, and promoted back on
+ * the next hit.
+ *
+ * Each entry is tagged with the student and submission it was rendered
+ * for. Editing, approving or rejecting a submission drops that student's
+ * entries, which keeps the spill directory from holding stale records.
+ *
+ * The spill directory must be a real directory owned by the server user
+ * with mode 0700; anything else (a symlink, another owner, wider
+ * permissions) disables spilling. Spill files are written, read and removed
+ * without holding the cache lock, so a slow disk never stalls sessions that
+ * are served from memory. Each spill gets a file name of its own, which
+ * keeps a late removal from deleting a newer copy of the same document.
+ * Thread-safe singleton shared by all admin sessions.
+ */
+class PdfCache {
+public:
+    // Bump when PdfGenerator output changes, so spilled documents are not reused
+    static constexpr int kRenderVersion = 2;
+
+    static constexpr size_t kDefaultMemoryLimit = 64 * 1024 * 1024;
+    static constexpr size_t kDefaultDiskLimit = 512 * 1024 * 1024;
+
+    // Singleton access
+    static PdfCache& getInstance();
+
+    // Prevent copying
+    PdfCache(const PdfCache&) = delete;
+    PdfCache& operator=(const PdfCache&) = delete;
+
+    // Configuration; setting the spill directory removes documents left in
+    // it, and an empty or unsafe directory turns spilling off
+    void setMemoryLimit(size_t bytes);
+    void setDiskLimit(size_t bytes);
+    void setSpillDirectory(const std::string& path);
+
+    /**
+     * @brief Key for a render
+     * @param packet true for renderMultiFormPdf, false for renderFormPdf of forms[0]
+     */
+    static std::string makeKey(const std::vector<PdfFormData>& forms, bool packet,
+                               const std::string& packetStudentName,
+                               const std::string& settingsVersion);
+
+    // Version string for a set of institution settings
+    static std::string settingsVersion(const std::map<std::string, std::string>& settings);
+
+    bool get(const std::string& key, std::string& pdf);
+    void put(const std::string& key, const std::string& pdf, int studentId = 0, int submissionId = 0);
+
+    // Drop every document rendered for a student or a submission
+    void invalidateStudent(int studentId);
+    void invalidateSubmission(int submissionId);
+
+    PdfCacheStats getStats() const;
+
+    // Drop all entries, spilled files and configuration (used by tests)
+    void reset();
+
+private:
+    PdfCache();
+    ~PdfCache() = default;
+
+    enum class Place { Memory, Spilling, Disk };
+
+    struct Entry {
+        std::shared_ptr<const std::string> pdf;     // null once spilled to disk
+        size_t size = 0;
+        int studentId = 0;
+        int submissionId = 0;
+        Place place = Place::Memory;
+        uint64_t spillTicket = 0;                   // the spill in flight or on disk
+        std::string spillFile;                      // set while on disk
+        std::list<std::string>::iterator position;  // in memoryLru_ or diskLru_
+    };
+
+    struct SpillJob {
+        std::string key;
+        uint64_t ticket;
+        std::string path;
+        std::shared_ptr<const std::string> pdf;
+    };
+
+    // File work collected under mutex_ and done after it is released
+    struct FileWork {
+        std::vector<SpillJob> spills;
+        std::vector<std::string> removals;
+    };
+
+    // Callers hold mutex_
+    void evictLocked(FileWork& work);
+    void startSpillLocked(const std::string& key, Entry& entry, FileWork& work);
+    void finishSpillLocked(const SpillJob& job, bool written, FileWork& work);
+    void dropLocked(const std::string& key, FileWork& work);
+
+    // Callers do not hold mutex_
+    void runFileWork(FileWork work);
+    static bool writeSpillFile(const SpillJob& job);
+    static bool preparePrivateDirectory(const std::string& path);
+    static void removeSpillFiles(const std::string& directory);
+
+    size_t memoryLimit_;
+    size_t diskLimit_;
+    std::string spillDirectory_;
+    uint64_t nextSpillTicket_;
+
+    std::unordered_map<std::string, Entry> entries_;
+    std::list<std::string> memoryLru_;          // most recently used first
+    std::list<std::string> diskLru_;
+    size_t memoryBytes_;
+    size_t diskBytes_;
+    std::unordered_map<int, std::set<std::string>> byStudent_;
+    std::unordered_map<int, std::set<std::string>> bySubmission_;
+    PdfCacheStats stats_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // PDF_CACHE_H
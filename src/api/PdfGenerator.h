@@ -34,10 +34,17 @@ public:
     PdfGenerator();
     ~PdfGenerator();
 
+    // Render a PDF from form data into memory; returns the document bytes, empty on failure
+    std::string renderFormPdf(const PdfFormData& formData);
+
+    // Render a PDF with multiple forms (for "Print All Forms") into memory
+    std::string renderMultiFormPdf(const std::vector<PdfFormData>& forms,
+                                   const std::string& studentName);
+
     // Generate a PDF from form data and return the file path
     std::string generateFormPdf(const PdfFormData& formData, const std::string& outputDir = "/tmp");
 
-    // Generate a PDF with multiple forms (for "Print All Forms")
+    // Generate a PDF with multiple forms and return the file path
     std::string generateMultiFormPdf(const std::vector<PdfFormData>& forms,
                                       const std::string& studentName,
                                       const std::string& outputDir = "/tmp");
@@ -52,9 +59,9 @@ private:
     std::string lastError_;
 
     // Helper methods
-    std::string formatPhoneNumber(const std::string& phone);
-    std::string formatDate(const std::string& date);
     std::string generateUniqueFilename(const std::string& prefix);
+    std::string writePdfFile(const std::string& bytes, const std::string& outputDir,
+                             const std::string& prefix);
 };
 
 } // namespace Api
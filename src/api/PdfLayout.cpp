@@ -0,0 +1,546 @@
+#include "PdfLayout.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <sstream>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+// AFM advance widths for codes 32-126
+const int kHelveticaWidths[95] = {
+    278, 278, 355, 556, 556, 889, 667, 222, 333, 333, 389, 584, 278, 333, 278, 278,
+    556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+    278, 278, 584, 584, 584, 556, 1015,
+    667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833,
+    722, 778, 667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611,
+    278, 278, 278, 469, 556, 222,
+    556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833,
+    556, 556, 556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500,
+    334, 260, 334, 584
+};
+
+const int kHelveticaBoldWidths[95] = {
+    278, 333, 474, 556, 556, 889, 722, 278, 333, 333, 389, 584, 278, 333, 278, 278,
+    556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+    333, 333, 584, 584, 584, 611, 975,
+    722, 722, 722, 722, 667, 611, 778, 722, 278, 556, 722, 611, 833,
+    722, 778, 667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611,
+    333, 278, 333, 584, 556, 278,
+    556, 611, 556, 611, 556, 333, 611, 611, 278, 278, 556, 278, 889,
+    611, 611, 611, 611, 389, 556, 333, 611, 556, 778, 556, 556, 500,
+    389, 280, 389, 584
+};
+
+// Used for bytes outside ASCII, which the standard fonts cannot show reliably anyway
+constexpr int kFallbackWidth = 556;
+
+using WidthTable = std::array<int, 256>;
+
+WidthTable buildTable(const int (&ascii)[95]) {
+    WidthTable table;
+    for (int c = 0; c < 256; ++c) {
+        if (c < 32) {
+            table[c] = 0;
+        } else if (c <= 126) {
+            table[c] = ascii[c - 32];
+        } else {
+            table[c] = kFallbackWidth;
+        }
+    }
+    return table;
+}
+
+const WidthTable& widthTable(PdfFont font) {
+    static const WidthTable regular = buildTable(kHelveticaWidths);
+    static const WidthTable bold = buildTable(kHelveticaBoldWidths);
+    return font == PdfFont::Bold ? bold : regular;
+}
+
+int rawWidth(const WidthTable& table, const std::string& text) {
+    int width = 0;
+    for (unsigned char c : text) {
+        width += table[c];
+    }
+    return width;
+}
+
+// =============================================================================
+// Page Building
+// =============================================================================
+
+const PdfColor kNavy{0.12f, 0.23f, 0.37f};          // #1e3a5f
+const PdfColor kGray{0.4f, 0.45f, 0.53f};           // #64748b
+const PdfColor kSlate{0.2f, 0.25f, 0.33f};          // #334155
+const PdfColor kLabel{0.28f, 0.33f, 0.41f};
+const PdfColor kValue{0.12f, 0.16f, 0.23f};
+const PdfColor kSection{0.12f, 0.25f, 0.5f};
+const PdfColor kRule{0.89f, 0.91f, 0.94f};
+
+constexpr float kContentWidth = PdfLayout::kPageWidth - 2 * PdfLayout::kMargin;
+constexpr float kColumnSplit = 0.4f;
+
+class PageBuilder {
+public:
+    explicit PageBuilder(std::vector<PdfLayoutPage>& pages) : y(0), pages_(pages) {}
+
+    void newPage() {
+        pages_.emplace_back();
+        y = PdfLayout::kPageHeight - PdfLayout::kMargin;
+    }
+
+    void text(float x, float baseline, PdfFont font, float size, const PdfColor& color,
+              const std::string& text) {
+        if (text.empty()) {
+            return;
+        }
+        PdfDrawCommand command;
+        command.type = PdfDrawCommand::Type::Text;
+        command.x = x;
+        command.y = baseline;
+        command.font = font;
+        command.fontSize = size;
+        command.color = color;
+        command.text = text;
+        pages_.back().commands.push_back(std::move(command));
+    }
+
+    void centeredText(float baseline, PdfFont font, float size, const PdfColor& color,
+                      const std::string& value) {
+        float width = PdfFontMetrics::textWidth(value, font, size);
+        text((PdfLayout::kPageWidth - width) / 2, baseline, font, size, color, value);
+    }
+
+    void fillRect(float x, float bottom, float width, float height, const PdfColor& color) {
+        PdfDrawCommand command;
+        command.type = PdfDrawCommand::Type::FillRect;
+        command.x = x;
+        command.y = bottom;
+        command.width = width;
+        command.height = height;
+        command.color = color;
+        pages_.back().commands.push_back(command);
+    }
+
+    // Full-width horizontal rule
+    void rule(float at, float lineWidth, const PdfColor& color) {
+        PdfDrawCommand command;
+        command.type = PdfDrawCommand::Type::Line;
+        command.x = PdfLayout::kMargin;
+        command.y = at;
+        command.width = kContentWidth;
+        command.lineWidth = lineWidth;
+        command.color = color;
+        pages_.back().commands.push_back(command);
+    }
+
+    float y;    // Top of the next block
+
+private:
+    std::vector<PdfLayoutPage>& pages_;
+};
+
+/**
+ * @brief Geometry of the field table, which differs between a form and a packet
+ *
+ * A row with n lines reaches rowDepth + (n - 1) * lineHeight below its top
+ * and must stay above bottom; the cursor then moves rowGap further down.
+ */
+struct TableStyle {
+    float labelX;
+    float labelWidth;
+    float valueX;
+    float valueWidth;
+    float fontSize;
+    float lineHeight;
+    float baselineOffset;       // First baseline below the row top
+    float rowDepth;             // Lowest point of a one-line row below its top
+    float rowGap;               // Cursor movement after the row's depth
+    bool rowRules;
+    float bottom;
+
+    float depth(size_t lines) const {
+        return rowDepth + static_cast<float>(lines - 1) * lineHeight;
+    }
+
+    // Lines of a row that fit between y and the bottom
+    size_t linesThatFit(float y) const {
+        float available = y - bottom;
+        if (available < rowDepth) {
+            return 0;
+        }
+        return 1 + static_cast<size_t>((available - rowDepth) / lineHeight);
+    }
+};
+
+std::string displayValue(const PdfFormField& field) {
+    if (field.type == "phone") {
+        return PdfLayout::formatPhoneNumber(field.value);
+    }
+    if (field.type == "date") {
+        return PdfLayout::formatDate(field.value);
+    }
+    return field.value;
+}
+
+/**
+ * @brief Places one label/value row, splitting it across pages when needed
+ *
+ * A row that fits on a fresh page is moved there whole; a longer one fills
+ * the rest of the current page and continues on the next.
+ */
+void layoutRow(PageBuilder& builder, const TableStyle& style, const PdfFormField& field) {
+    auto labelLines = PdfFontMetrics::wrapText(field.label, PdfFont::Regular, style.fontSize,
+                                               style.labelWidth);
+    auto valueLines = PdfFontMetrics::wrapText(displayValue(field), PdfFont::Regular, style.fontSize,
+                                               style.valueWidth);
+    size_t lineCount = std::max(labelLines.size(), valueLines.size());
+    size_t pageCapacity = style.linesThatFit(PdfLayout::kPageHeight - PdfLayout::kMargin);
+
+    size_t first = 0;
+    while (first < lineCount) {
+        size_t count = lineCount - first;
+        size_t fit = style.linesThatFit(builder.y);
+        if (count > fit) {
+            bool movesWhole = first == 0 && count <= pageCapacity;
+            if (movesWhole || fit == 0) {
+                builder.newPage();
+                continue;
+            }
+            count = fit;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            float baseline = builder.y - style.baselineOffset - static_cast<float>(i) * style.lineHeight;
+            size_t line = first + i;
+            if (line < labelLines.size()) {
+                builder.text(style.labelX, baseline, PdfFont::Regular, style.fontSize, kLabel,
+                             labelLines[line]);
+            }
+            if (line < valueLines.size()) {
+                builder.text(style.valueX, baseline, PdfFont::Regular, style.fontSize, kValue,
+                             valueLines[line]);
+            }
+        }
+
+        float depth = style.depth(count);
+        if (style.rowRules) {
+            builder.rule(builder.y - depth, 0.5f, kRule);
+        }
+        builder.y -= depth + style.rowGap;
+        first += count;
+    }
+}
+
+} // namespace
+
+// =============================================================================
+// Font Metrics
+// =============================================================================
+
+int PdfFontMetrics::glyphWidth(PdfFont font, unsigned char c) {
+    return widthTable(font)[c];
+}
+
+float PdfFontMetrics::textWidth(const std::string& text, PdfFont font, float size) {
+    return static_cast<float>(rawWidth(widthTable(font), text)) * size / 1000.0f;
+}
+
+std::vector<std::string> PdfFontMetrics::wrapText(const std::string& text, PdfFont font, float size,
+                                                  float maxWidth) {
+    const WidthTable& table = widthTable(font);
+    const int limit = size > 0 ? static_cast<int>(maxWidth * 1000.0f / size) : 0;
+    const int spaceWidth = table[' '];
+
+    std::vector<std::string> lines;
+    size_t paragraphStart = 0;
+    while (paragraphStart <= text.size()) {
+        size_t paragraphEnd = text.find('\n', paragraphStart);
+        if (paragraphEnd == std::string::npos) {
+            paragraphEnd = text.size();
+        }
+
+        std::string line;
+        int lineWidth = 0;
+        size_t pos = paragraphStart;
+        while (pos < paragraphEnd) {
+            if (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r') {
+                ++pos;
+                continue;
+            }
+            size_t wordEnd = std::min(text.find_first_of(" \t\r\n", pos), paragraphEnd);
+            std::string word = text.substr(pos, wordEnd - pos);
+            pos = wordEnd;
+
+            int wordWidth = rawWidth(table, word);
+            if (!line.empty() && lineWidth + spaceWidth + wordWidth <= limit) {
+                line += ' ';
+                line += word;
+                lineWidth += spaceWidth + wordWidth;
+                continue;
+            }
+            if (!line.empty()) {
+                lines.push_back(std::move(line));
+                line.clear();
+            }
+
+            // A word wider than the line is split, never inside a UTF-8 sequence
+            while (wordWidth > limit && !word.empty()) {
+                size_t cut = 0;
+                int cutWidth = 0;
+                int width = 0;
+                for (size_t i = 0; i <= word.size(); ++i) {
+                    bool boundary = i == word.size()
+                                    || (static_cast<unsigned char>(word[i]) & 0xC0) != 0x80;
+                    if (boundary && i > 0) {
+                        if (width > limit && cut > 0) {
+                            break;
+                        }
+                        cut = i;
+                        cutWidth = width;
+                        if (width > limit) {
+                            break;      // One character wider than the line
+                        }
+                    }
+                    if (i < word.size()) {
+                        width += table[static_cast<unsigned char>(word[i])];
+                    }
+                }
+                lines.push_back(word.substr(0, cut));
+                word.erase(0, cut);
+                wordWidth -= cutWidth;
+            }
+            line = word;
+            lineWidth = wordWidth;
+        }
+        lines.push_back(std::move(line));
+        paragraphStart = paragraphEnd + 1;
+    }
+
+    // Trailing newlines would only add blank lines
+    while (lines.size() > 1 && lines.back().empty()) {
+        lines.pop_back();
+    }
+    return lines;
+}
+
+// =============================================================================
+// Formatting
+// =============================================================================
+
+std::string PdfLayout::formatPhoneNumber(const std::string& phone) {
+    // Extract digits only
+    std::string digits;
+    for (char c : phone) {
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            digits += c;
+        }
+    }
+
+    // Format as (XXX) XXX-XXXX if 10 digits
+    if (digits.length() == 10) {
+        return "(" + digits.substr(0, 3) + ") " + digits.substr(3, 3) + "-" + digits.substr(6, 4);
+    }
+    return phone;
+}
+
+std::string PdfLayout::formatDate(const std::string& date) {
+    if (date.empty()) return "";
+
+    // Try to parse ISO format and convert to readable format
+    if (date.length() >= 10 && date[4] == '-' && date[7] == '-') {
+        std::string year = date.substr(0, 4);
+        std::string month = date.substr(5, 2);
+        std::string day = date.substr(8, 2);
+
+        // Convert month to name
+        const char* months[] = {"", "January", "February", "March", "April", "May", "June",
+                                "July", "August", "September", "October", "November", "December"};
+        int monthNum = std::stoi(month);
+        if (monthNum >= 1 && monthNum <= 12) {
+            return std::string(months[monthNum]) + " " + std::to_string(std::stoi(day)) + ", " + year;
+        }
+    }
+    return date;
+}
+
+// =============================================================================
+// Single Form
+// =============================================================================
+
+std::vector<PdfLayoutPage> PdfLayout::layoutForm(const PdfFormData& formData,
+                                                 const std::string& generatedAt) {
+    std::vector<PdfLayoutPage> pages;
+    PageBuilder page(pages);
+    page.newPage();
+
+    const float col1Width = kContentWidth * kColumnSplit;
+    const float col2Width = kContentWidth - col1Width;
+
+    // Header - Institution Name, tagline and form title
+    std::string instName = formData.institutionName.empty() ?
+        "Student Intake System" : formData.institutionName;
+    page.centeredText(page.y, PdfFont::Bold, 18, kNavy, instName);
+    page.y -= 18;
+
+    std::string tagline = formData.institutionTagline.empty() ?
+        "Official Student Records" : formData.institutionTagline;
+    page.centeredText(page.y, PdfFont::Regular, 10, kGray, tagline);
+    page.y -= 25;
+
+    page.centeredText(page.y, PdfFont::Bold, 14, kSlate, formData.formTitle);
+    page.y -= 15;
+
+    page.rule(page.y, 2, kNavy);
+    page.y -= 25;
+
+    // Submission date bar
+    if (!formData.submissionDate.empty()) {
+        page.fillRect(kMargin, page.y - 20, kContentWidth, 25, PdfColor{0.97f, 0.98f, 0.99f});
+        page.text(kMargin + 10, page.y - 12, PdfFont::Bold, 10, kLabel, "Submitted:");
+        page.text(kMargin + 75, page.y - 12, PdfFont::Regular, 10, kValue,
+                  formatDate(formData.submissionDate));
+        page.y -= 35;
+    }
+
+    // Table header
+    page.fillRect(kMargin, page.y - 20, kContentWidth, 22, PdfColor{0.95f, 0.96f, 0.97f});
+    page.text(kMargin + 8, page.y - 13, PdfFont::Bold, 10, kLabel, "Field");
+    page.text(kMargin + col1Width + 8, page.y - 13, PdfFont::Bold, 10, kLabel, "Value");
+    page.rule(page.y - 20, 1.5f, PdfColor{0.8f, 0.84f, 0.88f});
+    page.y -= 25;
+
+    // Rows end 60pt above the margin, leaving room for the footer
+    TableStyle style;
+    style.labelX = kMargin + 8;
+    style.labelWidth = col1Width - 16;
+    style.valueX = kMargin + col1Width + 8;
+    style.valueWidth = col2Width - 16;
+    style.fontSize = 10;
+    style.lineHeight = 12;
+    style.baselineOffset = 13;
+    style.rowDepth = 20;
+    style.rowGap = 2;
+    style.rowRules = true;
+    style.bottom = kMargin + 60;
+
+    const float sectionSpace = 10;      // Extra space before a section header
+    const float sectionHeight = 28;
+
+    for (const auto& field : formData.fields) {
+        // Skip empty fields
+        if (field.label.empty() && field.value.empty()) continue;
+
+        if (field.type == "header") {
+            // Keep the header with the first line of the row that follows it
+            if (page.y - sectionSpace - sectionHeight - style.rowDepth < style.bottom) {
+                page.newPage();
+            }
+            page.y -= sectionSpace;
+            page.fillRect(kMargin, page.y - 18, kContentWidth, 22, PdfColor{0.93f, 0.96f, 1.0f});
+            page.fillRect(kMargin, page.y - 18, 3, 22, PdfColor{0.23f, 0.51f, 0.97f});   // #3b82f6
+            page.text(kMargin + 10, page.y - 12, PdfFont::Bold, 10, kSection, field.label);
+            page.y -= sectionHeight;
+            continue;
+        }
+
+        layoutRow(page, style, field);
+    }
+
+    // Footer on the last page
+    float footerY = kMargin + 40;
+    page.rule(footerY, 0.5f, kRule);
+    page.centeredText(footerY - 15, PdfFont::Regular, 8, kGray, generatedAt);
+    page.centeredText(footerY - 27, PdfFont::Bold, 7, PdfColor{0.86f, 0.15f, 0.15f},
+                      "CONFIDENTIAL - OFFICIAL STUDENT RECORD");
+
+    return pages;
+}
+
+// =============================================================================
+// Packet
+// =============================================================================
+
+std::vector<PdfLayoutPage> PdfLayout::layoutPacket(const std::vector<PdfFormData>& forms) {
+    std::vector<PdfLayoutPage> pages;
+    PageBuilder page(pages);
+
+    const float col1Width = kContentWidth * kColumnSplit;
+
+    // Rows are one baseline; the last baseline stays 60pt above the margin
+    TableStyle style;
+    style.labelX = kMargin;
+    style.labelWidth = col1Width - 8;
+    style.valueX = kMargin + col1Width;
+    style.valueWidth = kContentWidth - col1Width;
+    style.fontSize = 9;
+    style.lineHeight = 11;
+    style.baselineOffset = 0;
+    style.rowDepth = 0;
+    style.rowGap = 16;
+    style.rowRules = false;
+    style.bottom = kMargin + 60;
+
+    const float sectionSpace = 8;
+    const float sectionHeight = 15;
+
+    for (const auto& formData : forms) {
+        page.newPage();
+
+        std::string instName = formData.institutionName.empty() ?
+            "Student Intake System" : formData.institutionName;
+        page.centeredText(page.y, PdfFont::Bold, 16, kNavy, instName);
+        page.y -= 20;
+
+        page.centeredText(page.y, PdfFont::Bold, 12, kSlate, formData.formTitle);
+        page.y -= 15;
+
+        page.rule(page.y, 1.5f, kNavy);
+        page.y -= 20;
+
+        if (!formData.submissionDate.empty()) {
+            page.text(kMargin, page.y, PdfFont::Regular, 9, kGray,
+                      "Submitted: " + formatDate(formData.submissionDate));
+            page.y -= 20;
+        }
+
+        for (const auto& field : formData.fields) {
+            if (field.label.empty() && field.value.empty()) continue;
+
+            if (field.type == "header") {
+                if (page.y - sectionSpace - sectionHeight < style.bottom) {
+                    page.newPage();
+                }
+                page.y -= sectionSpace;
+                page.text(kMargin, page.y, PdfFont::Bold, 10, kSection, field.label);
+                page.y -= sectionHeight;
+                continue;
+            }
+
+            layoutRow(page, style, field);
+        }
+    }
+
+    // Numbered once the page count is known
+    for (size_t i = 0; i < pages.size(); ++i) {
+        std::ostringstream pageNum;
+        pageNum << "Page " << (i + 1) << " of " << pages.size();
+        std::string label = pageNum.str();
+        PdfDrawCommand command;
+        command.type = PdfDrawCommand::Type::Text;
+        command.x = (kPageWidth - PdfFontMetrics::textWidth(label, PdfFont::Regular, 8)) / 2;
+        command.y = kMargin;
+        command.font = PdfFont::Regular;
+        command.fontSize = 8;
+        command.color = kGray;
+        command.text = label;
+        pages[i].commands.push_back(std::move(command));
+    }
+
+    return pages;
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,103 @@
+#ifndef PDF_LAYOUT_H
+#define PDF_LAYOUT_H
+
+#include <string>
+#include <vector>
+#include "PdfGenerator.h"
+
+namespace StudentIntake {
+namespace Api {
+
+// The two standard fonts the generator draws with
+enum class PdfFont {
+    Regular,    // Helvetica
+    Bold        // Helvetica-Bold
+};
+
+struct PdfColor {
+    float r = 0;
+    float g = 0;
+    float b = 0;
+
+    bool operator==(const PdfColor& other) const {
+        return r == other.r && g == other.g && b == other.b;
+    }
+    bool operator!=(const PdfColor& other) const { return !(*this == other); }
+};
+
+// One drawing operation on a page, in PDF points from the bottom-left corner
+struct PdfDrawCommand {
+    enum class Type { Text, FillRect, Line };
+
+    Type type = Type::Text;
+    float x = 0;
+    float y = 0;                // Text baseline, rectangle bottom or line start
+    float width = 0;            // FillRect size; a Line ends at (x + width, y + height)
+    float height = 0;
+    PdfColor color;             // Fill for Text and FillRect, stroke for Line
+    PdfFont font = PdfFont::Regular;
+    float fontSize = 0;
+    float lineWidth = 0;
+    std::string text;
+};
+
+struct PdfLayoutPage {
+    std::vector<PdfDrawCommand> commands;
+};
+
+/**
+ * @brief Text measurement from the standard Helvetica glyph-width tables
+ *
+ * Widths come from the Adobe font metrics of Helvetica and Helvetica-Bold
+ * (StandardEncoding, which libharu uses for them), so measuring needs no
+ * PDF document and matches HPDF_Page_TextWidth for ASCII text. Bytes outside
+ * ASCII are measured at an average glyph width.
+ */
+class PdfFontMetrics {
+public:
+    // Advance width of one byte in 1/1000 of the font size
+    static int glyphWidth(PdfFont font, unsigned char c);
+
+    static float textWidth(const std::string& text, PdfFont font, float size);
+
+    /**
+     * @brief Break text into lines no wider than maxWidth
+     *
+     * Breaks at spaces and at newlines in the text; a word wider than the
+     * line is split between characters. Always returns at least one line.
+     */
+    static std::vector<std::string> wrapText(const std::string& text, PdfFont font, float size,
+                                             float maxWidth);
+};
+
+/**
+ * @brief Lays out forms as pages of drawing commands
+ *
+ * Measuring, wrapping and pagination happen here, without libharu, so the
+ * result can be tested directly; PdfGenerator only draws the commands.
+ * Long values wrap within their column and continue on the next page when
+ * they do not fit, and section headers are kept with the row after them.
+ */
+class PdfLayout {
+public:
+    // US Letter, portrait, in points
+    static constexpr float kPageWidth = 612;
+    static constexpr float kPageHeight = 792;
+    static constexpr float kMargin = 50;
+
+    // One form as printed from the preview; the footer on the last page shows generatedAt
+    static std::vector<PdfLayoutPage> layoutForm(const PdfFormData& formData,
+                                                 const std::string& generatedAt);
+
+    // Several forms as one packet, each starting on a new page, numbered "Page n of N"
+    static std::vector<PdfLayoutPage> layoutPacket(const std::vector<PdfFormData>& forms);
+
+    // Display formatting for phone and date fields
+    static std::string formatPhoneNumber(const std::string& phone);
+    static std::string formatDate(const std::string& date);
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // PDF_LAYOUT_H
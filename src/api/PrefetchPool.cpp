@@ -0,0 +1,117 @@
+#include "PrefetchPool.h"
+#include "utils/Logger.h"
+
+namespace StudentIntake {
+namespace Api {
+
+PrefetchPool& PrefetchPool::getInstance() {
+    static PrefetchPool instance;
+    return instance;
+}
+
+PrefetchPool::PrefetchPool()
+    : workerCount_(2)
+    , running_(false)
+    , stopRequested_(false) {
+}
+
+PrefetchPool::~PrefetchPool() {
+    stop();
+}
+
+void PrefetchPool::setWorkerCount(size_t workers) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    workerCount_ = workers > 0 ? workers : 1;
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+void PrefetchPool::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    for (size_t i = 0; i < workerCount_; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+    LOG_DEBUG("Prefetch", "Started " << workerCount_ << " prefetch workers");
+}
+
+void PrefetchPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+        tasks_.clear();
+    }
+    taskReady_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    workers_.clear();
+    running_ = false;
+}
+
+bool PrefetchPool::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+// =============================================================================
+// Tasks
+// =============================================================================
+
+bool PrefetchPool::submit(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_ || stopRequested_) {
+            return false;
+        }
+        tasks_.push_back(std::move(task));
+    }
+    taskReady_.notify_one();
+    return true;
+}
+
+size_t PrefetchPool::getQueuedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.size();
+}
+
+void PrefetchPool::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        taskReady_.wait(lock, [this]() { return stopRequested_ || !tasks_.empty(); });
+        if (stopRequested_) {
+            break;
+        }
+
+        Task task = std::move(tasks_.front());
+        tasks_.pop_front();
+
+        lock.unlock();
+        try {
+            task();
+        } catch (const std::exception& e) {
+            LOG_WARN("Prefetch", "Prefetch task failed: " << e.what());
+        }
+        // Release captured state before taking the lock again
+        task = nullptr;
+        lock.lock();
+    }
+}
+
+} // namespace Api
+} // namespace StudentIntake
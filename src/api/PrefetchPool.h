@@ -0,0 +1,64 @@
+#ifndef PREFETCH_POOL_H
+#define PREFETCH_POOL_H
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Process-wide worker pool for best-effort read-ahead
+ *
+ * Per-session caches such as ContentPrefetcher hand their background loads
+ * to this pool instead of each owning a thread. Tasks carry their own
+ * cancellation (they hold shared state and check a token), so the owner of
+ * a task never waits for it. submit() returns false while the pool is not
+ * running; callers treat that as "no read-ahead". stop() drops queued tasks
+ * and joins the workers after running tasks return. Thread-safe singleton.
+ */
+class PrefetchPool {
+public:
+    using Task = std::function<void()>;
+
+    // Singleton access
+    static PrefetchPool& getInstance();
+
+    // Prevent copying
+    PrefetchPool(const PrefetchPool&) = delete;
+    PrefetchPool& operator=(const PrefetchPool&) = delete;
+
+    // Configuration (before start)
+    void setWorkerCount(size_t workers);
+
+    // Worker lifecycle
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    bool submit(Task task);
+    size_t getQueuedCount() const;
+
+private:
+    PrefetchPool();
+    ~PrefetchPool();
+
+    void workerLoop();
+
+    size_t workerCount_;
+    std::deque<Task> tasks_;
+    bool running_;
+    bool stopRequested_;
+    std::vector<std::thread> workers_;
+    std::condition_variable taskReady_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // PREFETCH_POOL_H
@@ -0,0 +1,181 @@
+#include "QuestionBankCache.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+// Fisher-Yates with an explicit draw so the layout is identical on every
+// standard library (std::shuffle's algorithm is unspecified)
+template <typename T>
+void deterministicShuffle(std::vector<T>& values, std::mt19937_64& rng) {
+    for (size_t i = values.size(); i > 1; --i) {
+        size_t j = static_cast<size_t>(rng() % i);
+        std::swap(values[i - 1], values[j]);
+    }
+}
+
+} // namespace
+
+// =============================================================================
+// AttemptPermutation
+// =============================================================================
+
+uint64_t AttemptPermutation::seedFor(const std::string& attemptId, const std::string& assessmentId) {
+    // FNV-1a over "attempt:assessment"
+    uint64_t hash = 1469598103934665603ULL;
+    for (char c : attemptId + ":" + assessmentId) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+AttemptPermutation AttemptPermutation::create(const std::vector<Models::AssessmentQuestion>& questions,
+                                              uint64_t seed, bool shuffleQuestions, bool shuffleAnswers) {
+    AttemptPermutation permutation;
+    std::mt19937_64 rng(seed);
+
+    permutation.questionOrder.resize(questions.size());
+    std::iota(permutation.questionOrder.begin(), permutation.questionOrder.end(), uint16_t{0});
+    if (shuffleQuestions) {
+        deterministicShuffle(permutation.questionOrder, rng);
+    }
+
+    if (shuffleAnswers) {
+        permutation.optionOrder.resize(questions.size());
+        for (size_t i = 0; i < questions.size(); ++i) {
+            size_t optionCount = questions[i].getAnswerOptions().size();
+            if (optionCount < 2 || optionCount > 255) {
+                continue;
+            }
+            auto& order = permutation.optionOrder[i];
+            order.resize(optionCount);
+            std::iota(order.begin(), order.end(), uint8_t{0});
+            deterministicShuffle(order, rng);
+        }
+    }
+
+    return permutation;
+}
+
+std::vector<Models::AnswerOption> AttemptPermutation::orderedOptions(
+        const Models::AssessmentQuestion& question, size_t sharedIndex) const {
+    auto options = question.getAnswerOptions();
+    if (sharedIndex >= optionOrder.size() || optionOrder[sharedIndex].size() != options.size()) {
+        return options;
+    }
+
+    std::vector<Models::AnswerOption> ordered;
+    ordered.reserve(options.size());
+    for (uint8_t index : optionOrder[sharedIndex]) {
+        ordered.push_back(options[index]);
+    }
+    return ordered;
+}
+
+// =============================================================================
+// QuestionBankCache
+// =============================================================================
+
+QuestionBankCache& QuestionBankCache::getInstance() {
+    static QuestionBankCache instance;
+    return instance;
+}
+
+QuestionBankCache::QuestionBankCache()
+    : hits_(0)
+    , misses_(0) {
+}
+
+std::string QuestionBankCache::versionOf(const std::string& assessmentUpdatedAt,
+                                         const std::string& newestQuestionUpdatedAt, size_t questionCount) {
+    return assessmentUpdatedAt + "|" + newestQuestionUpdatedAt + "|" + std::to_string(questionCount);
+}
+
+std::string QuestionBankCache::versionOf(const Models::Assessment& assessment,
+                                         const std::vector<Models::AssessmentQuestion>& questions) {
+    // ISO-8601 timestamps order lexicographically
+    std::string newest;
+    for (const auto& question : questions) {
+        newest = std::max(newest, question.getUpdatedAt());
+    }
+    return versionOf(assessment.getUpdatedAt(), newest, questions.size());
+}
+
+QuestionSet QuestionBankCache::findQuestions(const std::string& assessmentId,
+                                             const std::string& version) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(assessmentId);
+    if (it == entries_.end() || it->second.version != version) {
+        misses_++;
+        return nullptr;
+    }
+    hits_++;
+    return it->second.questions;
+}
+
+std::shared_ptr<const AnswerKey> QuestionBankCache::findAnswerKey(int assessmentId,
+                                                                  const std::string& version) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(std::to_string(assessmentId));
+    if (it == entries_.end() || it->second.version != version) {
+        misses_++;
+        return nullptr;
+    }
+    hits_++;
+    return it->second.answerKey;
+}
+
+QuestionSet QuestionBankCache::store(const Models::Assessment& assessment,
+                                     std::vector<Models::AssessmentQuestion> questions) {
+    // Compile outside the lock; concurrent stores of the same version are harmless
+    std::string version = versionOf(assessment, questions);
+    auto answerKey = std::make_shared<const AnswerKey>(AnswerKey::compile(assessment, questions));
+    auto shared = std::make_shared<const std::vector<Models::AssessmentQuestion>>(std::move(questions));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entry = entries_[assessment.getId()];
+    if (!entry.version.empty() && entry.version != version) {
+        LOG_DEBUG("QuestionBank", "Assessment " << assessment.getId() << " changed from version "
+                  << entry.version << " to " << version);
+    }
+    entry.version = version;
+    entry.questions = shared;
+    entry.answerKey = answerKey;
+    return shared;
+}
+
+void QuestionBankCache::invalidate(const std::string& assessmentId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(assessmentId);
+}
+
+void QuestionBankCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    hits_ = 0;
+    misses_ = 0;
+}
+
+size_t QuestionBankCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+uint64_t QuestionBankCache::getHitCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+uint64_t QuestionBankCache::getMissCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,100 @@
+#ifndef QUESTION_BANK_CACHE_H
+#define QUESTION_BANK_CACHE_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include "AssessmentGrader.h"
+#include "models/Assessment.h"
+
+namespace StudentIntake {
+namespace Api {
+
+using QuestionSet = std::shared_ptr<const std::vector<Models::AssessmentQuestion>>;
+
+/**
+ * @brief Per-attempt view over a shared question set
+ *
+ * Stores only index permutations: the order questions are shown in and,
+ * for each shared question, the order of its options. Derived
+ * deterministically from a seed (the attempt id), so a resumed attempt
+ * sees exactly the same layout.
+ */
+struct AttemptPermutation {
+    std::vector<uint16_t> questionOrder;              // display index -> shared index
+    std::vector<std::vector<uint8_t>> optionOrder;    // shared index -> option order; empty if unshuffled
+
+    static AttemptPermutation create(const std::vector<Models::AssessmentQuestion>& questions,
+                                     uint64_t seed, bool shuffleQuestions, bool shuffleAnswers);
+    static uint64_t seedFor(const std::string& attemptId, const std::string& assessmentId);
+
+    size_t size() const { return questionOrder.size(); }
+    size_t sharedIndex(size_t displayIndex) const { return questionOrder[displayIndex]; }
+
+    // Options of a shared question in this attempt's display order
+    std::vector<Models::AnswerOption> orderedOptions(const Models::AssessmentQuestion& question,
+                                                     size_t sharedIndex) const;
+};
+
+/**
+ * @brief Process-wide cache of immutable assessment question sets
+ *
+ * Keyed by assessment id and version. The version combines the assessment's
+ * updated_at with the newest question's updated_at and the question count,
+ * so editing, adding or removing a question (and so its answer key) changes
+ * it. All sessions taking the same assessment share one parsed question
+ * vector and one compiled answer key; storing a new version replaces the
+ * old one.
+ * Thread-safe singleton shared by all classroom sessions.
+ */
+class QuestionBankCache {
+public:
+    // Singleton access
+    static QuestionBankCache& getInstance();
+
+    // Prevent copying
+    QuestionBankCache(const QuestionBankCache&) = delete;
+    QuestionBankCache& operator=(const QuestionBankCache&) = delete;
+
+    // Version of a question set, from its rows or from a sparse read of them
+    static std::string versionOf(const std::string& assessmentUpdatedAt,
+                                 const std::string& newestQuestionUpdatedAt, size_t questionCount);
+    static std::string versionOf(const Models::Assessment& assessment,
+                                 const std::vector<Models::AssessmentQuestion>& questions);
+
+    // Lookups return null on a miss or a version mismatch
+    QuestionSet findQuestions(const std::string& assessmentId, const std::string& version) const;
+    std::shared_ptr<const AnswerKey> findAnswerKey(int assessmentId, const std::string& version) const;
+
+    QuestionSet store(const Models::Assessment& assessment,
+                      std::vector<Models::AssessmentQuestion> questions);
+    void invalidate(const std::string& assessmentId);
+    void clear();
+
+    size_t size() const;
+    uint64_t getHitCount() const;
+    uint64_t getMissCount() const;
+
+private:
+    QuestionBankCache();
+    ~QuestionBankCache() = default;
+
+    struct Entry {
+        std::string version;
+        QuestionSet questions;
+        std::shared_ptr<const AnswerKey> answerKey;
+    };
+
+    std::map<std::string, Entry> entries_;
+    mutable uint64_t hits_;
+    mutable uint64_t misses_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // QUESTION_BANK_CACHE_H
@@ -0,0 +1,583 @@
+#include "ReportJobQueue.h"
+#include "ClassroomService.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+constexpr std::chrono::milliseconds kMaxRetryDelay(5 * 60 * 1000);
+
+// Journal lines allowed beyond one per job before it is compacted
+constexpr size_t kJournalSlack = 64;
+
+} // namespace
+
+// =============================================================================
+// ReportJob
+// =============================================================================
+
+std::string ReportJob::kindToString(ReportJobKind kind) {
+    return kind == ReportJobKind::Certificate ? "certificate" : "report";
+}
+
+std::string ReportJob::statusToString(ReportJobStatus status) {
+    switch (status) {
+        case ReportJobStatus::Queued: return "queued";
+        case ReportJobStatus::Running: return "running";
+        case ReportJobStatus::Completed: return "completed";
+        case ReportJobStatus::Failed: return "failed";
+    }
+    return "queued";
+}
+
+nlohmann::json ReportJob::toJson() const {
+    return {
+        {"id", id},
+        {"kind", kindToString(kind)},
+        {"status", statusToString(status)},
+        {"student_id", studentId},
+        {"enrollment_id", enrollmentId},
+        {"course_id", courseId},
+        {"report_id", reportId},
+        {"attempts", attempts},
+        {"error", error}
+    };
+}
+
+ReportJob ReportJob::fromJson(const nlohmann::json& json) {
+    ReportJob job;
+    job.id = json.value("id", "");
+    job.kind = json.value("kind", "") == "certificate" ? ReportJobKind::Certificate : ReportJobKind::Report;
+
+    std::string status = json.value("status", "queued");
+    if (status == "running") job.status = ReportJobStatus::Running;
+    else if (status == "completed") job.status = ReportJobStatus::Completed;
+    else if (status == "failed") job.status = ReportJobStatus::Failed;
+    else job.status = ReportJobStatus::Queued;
+
+    job.studentId = json.value("student_id", 0);
+    job.enrollmentId = json.value("enrollment_id", 0);
+    job.courseId = json.value("course_id", 0);
+    job.reportId = json.value("report_id", "");
+    job.attempts = json.value("attempts", 0);
+    job.error = json.value("error", "");
+    return job;
+}
+
+// =============================================================================
+// ReportJobQueue
+// =============================================================================
+
+ReportJobQueue& ReportJobQueue::getInstance() {
+    static ReportJobQueue instance;
+    return instance;
+}
+
+ReportJobQueue::ReportJobQueue()
+    : workerCount_(2)
+    , maxQueued_(256)
+    , maxAttempts_(3)
+    , retryDelayMs_(2000)
+    , maxFinished_(256)
+    , journalLines_(0)
+    , journalWriting_(false)
+    , active_(0)
+    , running_(false)
+    , stopRequested_(false) {
+}
+
+ReportJobQueue::~ReportJobQueue() {
+    stop();
+}
+
+void ReportJobQueue::setApiClient(std::shared_ptr<ApiClient> client) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_ = client;
+}
+
+bool ReportJobQueue::hasApiClient() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return apiClient_ != nullptr;
+}
+
+void ReportJobQueue::setJournalPath(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    journalPath_ = path;
+}
+
+void ReportJobQueue::setWorkerCount(size_t workers) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    workerCount_ = workers > 0 ? workers : 1;
+}
+
+void ReportJobQueue::setMaxQueuedJobs(size_t jobs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxQueued_ = jobs > 0 ? jobs : 1;
+}
+
+void ReportJobQueue::setMaxAttempts(int attempts) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxAttempts_ = attempts > 0 ? attempts : 1;
+}
+
+void ReportJobQueue::setRetryDelay(int milliseconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retryDelayMs_ = milliseconds > 0 ? milliseconds : 1;
+}
+
+void ReportJobQueue::setMaxFinishedJobs(size_t jobs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxFinished_ = jobs;
+    pruneFinished();
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+void ReportJobQueue::start() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            return;
+        }
+
+        replayJournal();
+
+        stopRequested_ = false;
+        running_ = true;
+        for (size_t i = 0; i < workerCount_; ++i) {
+            workers_.emplace_back([this]() { workerLoop(); });
+        }
+        LOG_DEBUG("ReportJobs", "Started " << workerCount_ << " workers, " << queue_.size() << " jobs queued");
+    }
+    flushJournal();
+}
+
+void ReportJobQueue::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    jobReady_.notify_all();
+
+    // Running jobs finish; queued ones stay in the journal for the next start
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    workers_.clear();
+    running_ = false;
+    if (!queue_.empty() || !retries_.empty()) {
+        LOG_INFO("ReportJobs", queue_.size() + retries_.size() << " report jobs left queued for the next start");
+    }
+}
+
+bool ReportJobQueue::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+// =============================================================================
+// Submission
+// =============================================================================
+
+std::string ReportJobQueue::submitReport(int studentId, int enrollmentId, int courseId,
+                                         ReportJobCallback callback) {
+    ReportJob job;
+    job.id = "report-" + std::to_string(enrollmentId);
+    job.kind = ReportJobKind::Report;
+    job.studentId = studentId;
+    job.enrollmentId = enrollmentId;
+    job.courseId = courseId;
+    return submit(job, callback);
+}
+
+std::string ReportJobQueue::submitCertificate(const std::string& reportId, ReportJobCallback callback) {
+    ReportJob job;
+    job.id = "certificate-" + reportId;
+    job.kind = ReportJobKind::Certificate;
+    job.reportId = reportId;
+    return submit(job, callback);
+}
+
+std::string ReportJobQueue::submit(ReportJob job, ReportJobCallback callback) {
+    ReportJob finished;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto existing = jobs_.find(job.id);
+        if (existing != jobs_.end() && existing->second.status != ReportJobStatus::Failed) {
+            // Same work already queued, running or done
+            if (!existing->second.isFinished()) {
+                if (callback) {
+                    callbacks_[job.id].push_back(callback);
+                }
+                return job.id;
+            }
+            finished = existing->second;
+        } else {
+            if (queue_.size() + retries_.size() >= maxQueued_) {
+                LOG_WARN("ReportJobs", "Queue full (" << maxQueued_ << " jobs), rejecting " << job.id);
+                return "";
+            }
+
+            if (existing != jobs_.end()) {
+                // Resubmitting a failed job; it is no longer a finished one
+                finished_.erase(std::remove(finished_.begin(), finished_.end(), job.id), finished_.end());
+            }
+            jobs_[job.id] = job;
+            queue_.push_back(job.id);
+            if (callback) {
+                callbacks_[job.id].push_back(callback);
+            }
+            appendJournal(job);
+        }
+    }
+
+    if (!finished.id.empty()) {
+        if (callback) {
+            callback(finished);
+        }
+        return finished.id;
+    }
+
+    flushJournal();
+    jobReady_.notify_one();
+    return job.id;
+}
+
+bool ReportJobQueue::getJob(const std::string& jobId, ReportJob& job) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = jobs_.find(jobId);
+    if (it == jobs_.end()) {
+        return false;
+    }
+    job = it->second;
+    return true;
+}
+
+size_t ReportJobQueue::getQueuedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size() + retries_.size();
+}
+
+size_t ReportJobQueue::getJobCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return jobs_.size();
+}
+
+void ReportJobQueue::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() {
+        bool journalDone = journalPending_.empty() && !journalWriting_;
+        return journalDone && (!running_ || (queue_.empty() && retries_.empty() && active_ == 0));
+    });
+}
+
+void ReportJobQueue::reset() {
+    stop();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.clear();
+    callbacks_.clear();
+    queue_.clear();
+    retries_.clear();
+    finished_.clear();
+    journalLines_ = 0;
+    journalPending_.clear();
+    apiClient_.reset();
+    journalPath_.clear();
+    workerCount_ = 2;
+    maxQueued_ = 256;
+    maxAttempts_ = 3;
+    retryDelayMs_ = 2000;
+    maxFinished_ = 256;
+}
+
+// =============================================================================
+// Workers
+// =============================================================================
+
+void ReportJobQueue::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        promoteDueRetries();
+        if (stopRequested_) {
+            break;
+        }
+        if (queue_.empty()) {
+            if (retries_.empty()) {
+                jobReady_.wait(lock);
+            } else {
+                jobReady_.wait_until(lock, retries_.begin()->first);
+            }
+            continue;
+        }
+
+        std::string jobId = queue_.front();
+        queue_.pop_front();
+
+        ReportJob job = jobs_[jobId];
+        job.status = ReportJobStatus::Running;
+        job.attempts++;
+        jobs_[jobId] = job;
+        appendJournal(job);
+        active_++;
+
+        lock.unlock();
+        flushJournal();
+        bool ok = false;
+        try {
+            ok = runJob(job);
+        } catch (const std::exception& e) {
+            job.error = e.what();
+        }
+        lock.lock();
+
+        if (ok) {
+            job.status = ReportJobStatus::Completed;
+            job.error.clear();
+        } else if (job.attempts < maxAttempts_) {
+            // Retried by this pool after a backoff, or by the next start if stopping
+            job.status = ReportJobStatus::Queued;
+            scheduleRetry(jobId, job.attempts);
+        } else {
+            job.status = ReportJobStatus::Failed;
+            LOG_ERROR("ReportJobs", "Job " << jobId << " failed after " << job.attempts
+                      << " attempts: " << job.error);
+        }
+        jobs_[jobId] = job;
+        appendJournal(job);
+
+        std::vector<ReportJobCallback> callbacks;
+        if (job.isFinished()) {
+            callbacks = std::move(callbacks_[jobId]);
+            callbacks_.erase(jobId);
+            finished_.push_back(jobId);
+            pruneFinished();
+        }
+
+        lock.unlock();
+        flushJournal();
+        for (const auto& callback : callbacks) {
+            callback(job);
+        }
+        lock.lock();
+
+        active_--;
+        if (queue_.empty() && retries_.empty() && active_ == 0) {
+            idle_.notify_all();
+        }
+    }
+    idle_.notify_all();
+}
+
+std::chrono::milliseconds ReportJobQueue::retryDelayFor(int attempts) const {
+    // retryDelay, 2 x retryDelay, 4 x retryDelay, ... after the 1st, 2nd, 3rd failure
+    std::chrono::milliseconds delay(retryDelayMs_);
+    for (int i = 1; i < attempts && delay < kMaxRetryDelay; ++i) {
+        delay *= 2;
+    }
+    return std::min(delay, kMaxRetryDelay);
+}
+
+void ReportJobQueue::scheduleRetry(const std::string& jobId, int attempts) {
+    auto delay = retryDelayFor(attempts);
+    retries_.emplace(std::chrono::steady_clock::now() + delay, jobId);
+    LOG_DEBUG("ReportJobs", "Retrying " << jobId << " in " << delay.count() << " ms");
+}
+
+void ReportJobQueue::promoteDueRetries() {
+    auto now = std::chrono::steady_clock::now();
+    while (!retries_.empty() && retries_.begin()->first <= now) {
+        queue_.push_back(retries_.begin()->second);
+        retries_.erase(retries_.begin());
+    }
+}
+
+void ReportJobQueue::pruneFinished() {
+    while (finished_.size() > maxFinished_) {
+        auto it = jobs_.find(finished_.front());
+        if (it != jobs_.end() && it->second.isFinished()) {
+            jobs_.erase(it);
+        }
+        finished_.pop_front();
+    }
+}
+
+bool ReportJobQueue::runJob(ReportJob& job) {
+    std::shared_ptr<ApiClient> client;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client = apiClient_;
+    }
+    if (!client) {
+        job.error = "No API client configured";
+        return false;
+    }
+
+    // Each job checks the backend first, so a retry after a crash is a no-op
+    ClassroomService service(client);
+    ClassroomResult result;
+    if (job.kind == ReportJobKind::Report) {
+        auto existing = service.getReportByEnrollment(std::to_string(job.enrollmentId));
+        if (!existing.getId().empty()) {
+            job.reportId = existing.getId();
+            return true;
+        }
+        result = service.generateReport(job.studentId, job.enrollmentId, job.courseId);
+        if (result.success) {
+            job.reportId = result.id;
+        }
+    } else {
+        if (service.getReport(job.reportId).isCertificateIssued()) {
+            return true;
+        }
+        result = service.issueCertificate(job.reportId);
+    }
+
+    if (!result.success) {
+        job.error = result.message.empty() ? "Request failed" : result.message;
+    }
+    return result.success;
+}
+
+// =============================================================================
+// Journal
+// =============================================================================
+
+void ReportJobQueue::appendJournal(const ReportJob& job) {
+    if (journalPath_.empty()) {
+        return;
+    }
+
+    if (journalPending_.empty() || journalPending_.back().rewrite) {
+        journalPending_.push_back({false, {}});
+    }
+    journalPending_.back().lines.push_back(job.toJson().dump());
+
+    // Every state change adds a line; rewrite once most of them are superseded
+    if (++journalLines_ > 2 * jobs_.size() + kJournalSlack) {
+        compactJournal();
+    }
+}
+
+void ReportJobQueue::replayJournal() {
+    if (journalPath_.empty()) {
+        return;
+    }
+
+    std::ifstream file(journalPath_);
+    if (file.is_open()) {
+        std::map<std::string, ReportJob> replayed;
+        std::string line;
+        while (std::getline(file, line)) {
+            // A torn last line from a crash is skipped, not fatal
+            auto json = nlohmann::json::parse(line, nullptr, false);
+            if (!json.is_discarded() && json.is_object()) {
+                auto job = ReportJob::fromJson(json);
+                replayed[job.id] = job;
+            }
+        }
+
+        int resumed = 0;
+        for (auto& pair : replayed) {
+            if (jobs_.count(pair.first) > 0) {
+                continue;
+            }
+            if (!pair.second.isFinished()) {
+                pair.second.status = ReportJobStatus::Queued;
+                queue_.push_back(pair.first);
+                resumed++;
+            } else {
+                finished_.push_back(pair.first);
+            }
+            jobs_[pair.first] = pair.second;
+        }
+        pruneFinished();
+        if (resumed > 0) {
+            LOG_INFO("ReportJobs", "Resuming " << resumed << " report jobs from " << journalPath_);
+        }
+    }
+
+    compactJournal();
+}
+
+void ReportJobQueue::compactJournal() {
+    // One line per kept job with its latest state; earlier queued appends are superseded
+    JournalWrite write{true, {}};
+    for (const auto& pair : jobs_) {
+        write.lines.push_back(pair.second.toJson().dump());
+    }
+    journalPending_.clear();
+    journalPending_.push_back(std::move(write));
+    journalLines_ = jobs_.size();
+}
+
+void ReportJobQueue::flushJournal() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (journalWriting_) {
+        // The thread writing now also takes what this one queued
+        return;
+    }
+
+    journalWriting_ = true;
+    while (!journalPending_.empty()) {
+        auto writes = std::move(journalPending_);
+        journalPending_.clear();
+        std::string path = journalPath_;
+
+        lock.unlock();
+        for (const auto& write : writes) {
+            writeJournal(path, write);
+        }
+        lock.lock();
+    }
+    journalWriting_ = false;
+    idle_.notify_all();
+}
+
+void ReportJobQueue::writeJournal(const std::string& path, const JournalWrite& write) {
+    if (path.empty()) {
+        return;
+    }
+
+    if (!write.rewrite) {
+        std::ofstream file(path, std::ios::app);
+        if (!file.is_open()) {
+            LOG_WARN("ReportJobs", "Cannot write job journal " << path);
+            return;
+        }
+        for (const auto& line : write.lines) {
+            file << line << "\n";
+        }
+        return;
+    }
+
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::trunc);
+        if (!out.is_open()) {
+            LOG_WARN("ReportJobs", "Cannot compact job journal " << path);
+            return;
+        }
+        for (const auto& line : write.lines) {
+            out << line << "\n";
+        }
+    }
+    std::rename(tempPath.c_str(), path.c_str());
+}
+
+} // namespace Api
+} // namespace StudentIntake
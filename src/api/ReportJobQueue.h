@@ -0,0 +1,183 @@
+#ifndef REPORT_JOB_QUEUE_H
+#define REPORT_JOB_QUEUE_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <deque>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <nlohmann/json.hpp>
+#include "ApiClient.h"
+
+namespace StudentIntake {
+namespace Api {
+
+enum class ReportJobKind {
+    Report,         // Compile an AssessmentReport for an enrollment
+    Certificate     // Issue the certificate on an existing report
+};
+
+enum class ReportJobStatus {
+    Queued,
+    Running,
+    Completed,
+    Failed
+};
+
+/**
+ * @brief One report or certificate job and its current state
+ */
+struct ReportJob {
+    std::string id;
+    ReportJobKind kind = ReportJobKind::Report;
+    ReportJobStatus status = ReportJobStatus::Queued;
+    int studentId = 0;
+    int enrollmentId = 0;
+    int courseId = 0;
+    std::string reportId;       // Input for certificates, result for reports
+    int attempts = 0;
+    std::string error;
+
+    bool isFinished() const {
+        return status == ReportJobStatus::Completed || status == ReportJobStatus::Failed;
+    }
+
+    nlohmann::json toJson() const;
+    static ReportJob fromJson(const nlohmann::json& json);
+
+    static std::string kindToString(ReportJobKind kind);
+    static std::string statusToString(ReportJobStatus status);
+};
+
+using ReportJobCallback = std::function<void(const ReportJob&)>;
+
+/**
+ * @brief Bounded background queue for report and certificate generation
+ *
+ * Course completion hands work to a small worker pool instead of compiling
+ * grades on the request thread. Job ids are derived from the work itself
+ * ("report-<enrollment>", "certificate-<report>"), so submitting the same
+ * job twice returns the existing id, and the runner checks the backend
+ * before writing so a retried job never creates a second report.
+ *
+ * A failed job is retried after an exponential backoff (retry delay, then
+ * twice that, and so on, capped at five minutes) until it has used its
+ * attempts. Only the most recent finished jobs are kept, so a resubmitted
+ * job that just finished is still answered from memory.
+ *
+ * Every state change is appended to a local JSON-lines journal. start()
+ * replays it and re-queues jobs that were queued or running when the process
+ * stopped; the journal is compacted to one line per kept job on start and
+ * whenever it has grown well past that. stop() lets running jobs finish and
+ * leaves the rest in the journal. Configure it before the server starts
+ * taking requests. Thread-safe singleton shared by all sessions.
+ */
+class ReportJobQueue {
+public:
+    // Singleton access
+    static ReportJobQueue& getInstance();
+
+    // Prevent copying
+    ReportJobQueue(const ReportJobQueue&) = delete;
+    ReportJobQueue& operator=(const ReportJobQueue&) = delete;
+
+    // Configuration (before start)
+    void setApiClient(std::shared_ptr<ApiClient> client);
+    bool hasApiClient() const;
+    void setJournalPath(const std::string& path);
+    void setWorkerCount(size_t workers);
+    void setMaxQueuedJobs(size_t jobs);
+    void setMaxAttempts(int attempts);
+    void setRetryDelay(int milliseconds);
+    void setMaxFinishedJobs(size_t jobs);
+
+    // Worker pool lifecycle
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    /**
+     * @brief Queue a job; returns its id, or an empty string if the queue is full
+     *
+     * The callback runs on a worker thread when the job finishes. It is kept
+     * in memory only; a job resumed after a restart completes silently.
+     */
+    std::string submitReport(int studentId, int enrollmentId, int courseId,
+                             ReportJobCallback callback = nullptr);
+    std::string submitCertificate(const std::string& reportId,
+                                  ReportJobCallback callback = nullptr);
+
+    bool getJob(const std::string& jobId, ReportJob& job) const;
+    size_t getQueuedCount() const;      // including jobs waiting to be retried
+    size_t getJobCount() const;         // queued, running and kept finished jobs
+
+    // Block until no job is queued or running (used by tests)
+    void waitIdle();
+
+    // Drop all jobs and configuration (used by tests)
+    void reset();
+
+private:
+    ReportJobQueue();
+    ~ReportJobQueue();
+
+    std::string submit(ReportJob job, ReportJobCallback callback);
+    void workerLoop();
+    bool runJob(ReportJob& job);
+
+    // Callers hold mutex_
+    void scheduleRetry(const std::string& jobId, int attempts);
+    void promoteDueRetries();
+    void pruneFinished();
+    std::chrono::milliseconds retryDelayFor(int attempts) const;
+
+    // Journal file work collected under mutex_: lines to append, or the
+    // whole journal (one line per kept job) replacing the file
+    struct JournalWrite {
+        bool rewrite;
+        std::vector<std::string> lines;
+    };
+
+    // Journal helpers; callers hold mutex_ and only queue the file writes
+    void appendJournal(const ReportJob& job);
+    void replayJournal();
+    void compactJournal();
+
+    // Callers do not hold mutex_
+    void flushJournal();
+    static void writeJournal(const std::string& path, const JournalWrite& write);
+
+    std::shared_ptr<ApiClient> apiClient_;
+    std::string journalPath_;
+    size_t workerCount_;
+    size_t maxQueued_;
+    int maxAttempts_;
+    int retryDelayMs_;
+    size_t maxFinished_;
+
+    std::map<std::string, ReportJob> jobs_;
+    std::map<std::string, std::vector<ReportJobCallback>> callbacks_;
+    std::deque<std::string> queue_;
+    std::multimap<std::chrono::steady_clock::time_point, std::string> retries_;  // by due time
+    std::deque<std::string> finished_;    // oldest first
+    size_t journalLines_;
+    std::deque<JournalWrite> journalPending_;   // in order; written by one thread at a time
+    bool journalWriting_;
+    size_t active_;
+    bool running_;
+    bool stopRequested_;
+    std::vector<std::thread> workers_;
+    std::condition_variable jobReady_;
+    std::condition_variable idle_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // REPORT_JOB_QUEUE_H
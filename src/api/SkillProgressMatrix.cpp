@@ -0,0 +1,321 @@
+#include "SkillProgressMatrix.h"
+#include <algorithm>
+#include <bitset>
+#include <stdexcept>
+
+namespace StudentIntake {
+namespace Api {
+
+// Parse a model id string, returning 0 when it is empty or malformed
+static int parseId(const std::string& id) {
+    try {
+        return id.empty() ? 0 : std::stoi(id);
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+// Index of the lowest set bit in a non-zero word
+static size_t lowestBit(uint64_t word) {
+    return static_cast<size_t>(__builtin_ctzll(word));
+}
+
+SkillProgressMatrix& SkillProgressMatrix::getInstance() {
+    static SkillProgressMatrix instance;
+    return instance;
+}
+
+SkillProgressMatrix::SkillProgressMatrix()
+    : catalogLoaded_(false) {
+}
+
+SkillProgressMatrix::~SkillProgressMatrix() {
+}
+
+// =============================================================================
+// Bit Helpers
+// =============================================================================
+
+bool SkillProgressMatrix::testBit(const Bits& bits, size_t column) {
+    size_t word = wordIndex(column);
+    return word < bits.size() && (bits[word] & bitMask(column)) != 0;
+}
+
+void SkillProgressMatrix::setBit(Bits& bits, size_t column) {
+    size_t word = wordIndex(column);
+    if (word >= bits.size()) {
+        bits.resize(word + 1, 0);
+    }
+    bits[word] |= bitMask(column);
+}
+
+int SkillProgressMatrix::columnFor(int skillItemId) const {
+    auto it = columnBySkillId_.find(skillItemId);
+    return it != columnBySkillId_.end() ? it->second : -1;
+}
+
+int SkillProgressMatrix::ensureColumn(int skillItemId) {
+    int column = columnFor(skillItemId);
+    if (column >= 0) {
+        return column;
+    }
+
+    // Columns are append-only so existing rows stay valid
+    column = static_cast<int>(columns_.size());
+    Models::SkillItem placeholder;
+    placeholder.setId(std::to_string(skillItemId));
+    columns_.push_back(placeholder);
+    columnBySkillId_[skillItemId] = column;
+    requiredMask_.resize(wordCount(), 0);
+    return column;
+}
+
+SkillProgressMatrix::Row& SkillProgressMatrix::rowFor(int studentId, int enrollmentId) {
+    Row& row = rows_[enrollmentId];
+    if (studentId != 0) {
+        row.studentId = studentId;
+    }
+    resizeRow(row);
+    return row;
+}
+
+void SkillProgressMatrix::resizeRow(Row& row) const {
+    size_t words = wordCount();
+    if (row.passed.size() < words) {
+        row.passed.resize(words, 0);
+        row.attempted.resize(words, 0);
+        row.criticalError.resize(words, 0);
+    }
+    if (row.successfulCount.size() < columns_.size()) {
+        row.successfulCount.resize(columns_.size(), 0);
+    }
+}
+
+// =============================================================================
+// Skill Catalog
+// =============================================================================
+
+void SkillProgressMatrix::setSkillItems(const std::vector<Models::SkillItem>& items) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::fill(requiredMask_.begin(), requiredMask_.end(), 0);
+
+    for (const auto& item : items) {
+        int skillId = parseId(item.getId());
+        if (skillId == 0) continue;
+
+        int column = ensureColumn(skillId);
+        columns_[column] = item;
+        if (item.requiresDemonstration()) {
+            setBit(requiredMask_, column);
+        }
+    }
+
+    catalogLoaded_ = true;
+}
+
+bool SkillProgressMatrix::hasSkillCatalog() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return catalogLoaded_;
+}
+
+std::vector<Models::SkillItem> SkillProgressMatrix::getSkillItems() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return columns_;
+}
+
+size_t SkillProgressMatrix::getSkillCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return columns_.size();
+}
+
+size_t SkillProgressMatrix::getRequiredSkillCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t count = 0;
+    for (uint64_t word : requiredMask_) {
+        count += std::bitset<64>(word).count();
+    }
+    return count;
+}
+
+// =============================================================================
+// Enrollment Rows
+// =============================================================================
+
+void SkillProgressMatrix::loadEnrollment(int studentId, int enrollmentId,
+                                         const std::vector<Models::StudentSkillProgress>& progress) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Register any skills referenced by progress before sizing the row
+    for (const auto& p : progress) {
+        ensureColumn(p.getSkillItemId());
+    }
+
+    Row& row = rowFor(studentId, enrollmentId);
+    std::fill(row.passed.begin(), row.passed.end(), 0);
+    std::fill(row.attempted.begin(), row.attempted.end(), 0);
+    std::fill(row.criticalError.begin(), row.criticalError.end(), 0);
+    std::fill(row.successfulCount.begin(), row.successfulCount.end(), 0);
+    row.practiceHours = 0.0;
+
+    for (const auto& p : progress) {
+        size_t column = static_cast<size_t>(columnFor(p.getSkillItemId()));
+        row.successfulCount[column] = p.getSuccessfulCount();
+        if (p.isValidated()) {
+            setBit(row.passed, column);
+        }
+        if (p.isValidated() || p.getPracticeCount() > 0 ||
+            p.getSuccessfulCount() > 0 || p.getFailedCount() > 0) {
+            setBit(row.attempted, column);
+        }
+        row.practiceHours += p.getPracticeHours();
+    }
+}
+
+void SkillProgressMatrix::applyValidation(const Models::SkillValidation& validation) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Only rows that were hydrated from the backend are kept current; a
+    // single validation is not enough to build a complete row
+    if (rows_.find(validation.getEnrollmentId()) == rows_.end()) {
+        return;
+    }
+
+    size_t column = static_cast<size_t>(ensureColumn(validation.getSkillItemId()));
+    Row& row = rowFor(validation.getStudentId(), validation.getEnrollmentId());
+
+    setBit(row.attempted, column);
+    if (validation.isPassing()) {
+        int required = std::max(1, columns_[column].getMinimumSuccessfulAttempts());
+        if (++row.successfulCount[column] >= required) {
+            setBit(row.passed, column);
+        }
+    }
+    if (validation.hasCriticalError()) {
+        setBit(row.criticalError, column);
+    }
+}
+
+bool SkillProgressMatrix::hasEnrollment(int enrollmentId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return rows_.find(enrollmentId) != rows_.end();
+}
+
+void SkillProgressMatrix::invalidateEnrollment(int enrollmentId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rows_.erase(enrollmentId);
+}
+
+void SkillProgressMatrix::invalidateAllEnrollments() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rows_.clear();
+}
+
+void SkillProgressMatrix::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rows_.clear();
+    columns_.clear();
+    columnBySkillId_.clear();
+    requiredMask_.clear();
+    catalogLoaded_ = false;
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+bool SkillProgressMatrix::hasPassedAllRequired(int enrollmentId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = rows_.find(enrollmentId);
+    if (it == rows_.end()) {
+        return false;
+    }
+
+    const Bits& passed = it->second.passed;
+    for (size_t w = 0; w < requiredMask_.size(); ++w) {
+        uint64_t passedWord = w < passed.size() ? passed[w] : 0;
+        if (requiredMask_[w] & ~passedWord) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<Models::SkillItem> SkillProgressMatrix::getRequiredSkillsNotPassed(int enrollmentId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<Models::SkillItem> missing;
+    auto it = rows_.find(enrollmentId);
+    if (it == rows_.end()) {
+        return missing;
+    }
+
+    const Bits& passed = it->second.passed;
+    for (size_t w = 0; w < requiredMask_.size(); ++w) {
+        uint64_t passedWord = w < passed.size() ? passed[w] : 0;
+        uint64_t outstanding = requiredMask_[w] & ~passedWord;
+        while (outstanding) {
+            missing.push_back(columns_[w * 64 + lowestBit(outstanding)]);
+            outstanding &= outstanding - 1;
+        }
+    }
+    return missing;
+}
+
+bool SkillProgressMatrix::hasPassedSkill(int enrollmentId, int skillItemId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = rows_.find(enrollmentId);
+    int column = columnFor(skillItemId);
+    return it != rows_.end() && column >= 0 &&
+           testBit(it->second.passed, static_cast<size_t>(column));
+}
+
+bool SkillProgressMatrix::hasAttemptedSkill(int enrollmentId, int skillItemId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = rows_.find(enrollmentId);
+    int column = columnFor(skillItemId);
+    return it != rows_.end() && column >= 0 &&
+           testBit(it->second.attempted, static_cast<size_t>(column));
+}
+
+bool SkillProgressMatrix::hasCriticalError(int enrollmentId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = rows_.find(enrollmentId);
+    if (it == rows_.end()) {
+        return false;
+    }
+    for (uint64_t word : it->second.criticalError) {
+        if (word) return true;
+    }
+    return false;
+}
+
+int SkillProgressMatrix::getPassedCount(int enrollmentId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = rows_.find(enrollmentId);
+    if (it == rows_.end()) {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (uint64_t word : it->second.passed) {
+        count += std::bitset<64>(word).count();
+    }
+    return static_cast<int>(count);
+}
+
+double SkillProgressMatrix::getPracticeHours(int enrollmentId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = rows_.find(enrollmentId);
+    return it != rows_.end() ? it->second.practiceHours : 0.0;
+}
+
+} // namespace Api
+} // namespace StudentIntake
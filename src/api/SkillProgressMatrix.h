@@ -0,0 +1,101 @@
+#ifndef SKILL_PROGRESS_MATRIX_H
+#define SKILL_PROGRESS_MATRIX_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <cstdint>
+#include "models/TrainingSession.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief In-memory students x skills matrix for validation queries
+ *
+ * Each skill item is assigned a stable column, and each enrollment owns one
+ * packed row of 64-bit words per flag (passed, attempted, critical error).
+ * Readiness checks become word-wide bit operations instead of re-fetching
+ * and scanning skill progress.
+ *
+ * Rows are hydrated from StudentSkillProgress records and kept current by
+ * applying SkillValidation records as they are created. A skill counts as
+ * passed once it has the item's minimum number of successful attempts.
+ * Thread-safe singleton shared by all instructor sessions.
+ */
+class SkillProgressMatrix {
+public:
+    // Singleton access
+    static SkillProgressMatrix& getInstance();
+
+    // Prevent copying
+    SkillProgressMatrix(const SkillProgressMatrix&) = delete;
+    SkillProgressMatrix& operator=(const SkillProgressMatrix&) = delete;
+
+    // Skill catalog (columns)
+    void setSkillItems(const std::vector<Models::SkillItem>& items);
+    bool hasSkillCatalog() const;
+    std::vector<Models::SkillItem> getSkillItems() const;
+    size_t getSkillCount() const;
+    size_t getRequiredSkillCount() const;
+
+    // Enrollment rows
+    void loadEnrollment(int studentId, int enrollmentId,
+                        const std::vector<Models::StudentSkillProgress>& progress);
+    void applyValidation(const Models::SkillValidation& validation);
+    bool hasEnrollment(int enrollmentId) const;
+    void invalidateEnrollment(int enrollmentId);
+    void invalidateAllEnrollments();
+    void clear();
+
+    // Queries
+    bool hasPassedAllRequired(int enrollmentId) const;
+    std::vector<Models::SkillItem> getRequiredSkillsNotPassed(int enrollmentId) const;
+    bool hasPassedSkill(int enrollmentId, int skillItemId) const;
+    bool hasAttemptedSkill(int enrollmentId, int skillItemId) const;
+    bool hasCriticalError(int enrollmentId) const;
+    int getPassedCount(int enrollmentId) const;
+    double getPracticeHours(int enrollmentId) const;
+
+private:
+    SkillProgressMatrix();
+    ~SkillProgressMatrix();
+
+    using Bits = std::vector<uint64_t>;
+
+    struct Row {
+        int studentId = 0;
+        double practiceHours = 0.0;
+        Bits passed;
+        Bits attempted;
+        Bits criticalError;
+        std::vector<int> successfulCount;  // per column, toward minimum_successful_attempts
+    };
+
+    static size_t wordIndex(size_t column) { return column / 64; }
+    static uint64_t bitMask(size_t column) { return uint64_t(1) << (column % 64); }
+    static bool testBit(const Bits& bits, size_t column);
+    static void setBit(Bits& bits, size_t column);
+
+    size_t wordCount() const { return (columns_.size() + 63) / 64; }
+    int columnFor(int skillItemId) const;
+    int ensureColumn(int skillItemId);
+    Row& rowFor(int studentId, int enrollmentId);
+    void resizeRow(Row& row) const;
+
+    // skill item id -> column, and column -> skill item
+    std::map<int, int> columnBySkillId_;
+    std::vector<Models::SkillItem> columns_;
+    Bits requiredMask_;
+    bool catalogLoaded_;
+
+    // enrollment id -> packed row
+    std::map<int, Row> rows_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // SKILL_PROGRESS_MATRIX_H
@@ -0,0 +1,488 @@
+#include "StudentDirectory.h"
+#include "ApiUtils.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <limits>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+std::string trim(const std::string& value) {
+    auto first = value.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+        return "";
+    }
+    auto last = value.find_last_not_of(" \t\r\n");
+    return value.substr(first, last - first + 1);
+}
+
+std::string toLower(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+} // namespace
+
+// =============================================================================
+// StudentQuery
+// =============================================================================
+
+std::string StudentQuery::key() const {
+    return nlohmann::json::array({trim(search), curriculumId, toLower(status), sortField, sortAscending}).dump();
+}
+
+// =============================================================================
+// StudentDirectory
+// =============================================================================
+
+StudentDirectory::StudentDirectory(std::shared_ptr<ApiClient> apiClient, int pageSize, size_t maxPages)
+    : apiClient_(apiClient)
+    , pageSize_(pageSize > 0 ? pageSize : kDefaultPageSize)
+    , maxPages_(maxPages > 0 ? maxPages : 1)
+    , fetches_(0)
+    , busy_(false)
+    , stopping_(false) {
+}
+
+StudentDirectory::~StudentDirectory() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        jobs_.clear();
+    }
+    jobReady_.notify_all();
+
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void StudentDirectory::setQuery(const StudentQuery& query) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (query.key() == query_.key()) {
+        return;
+    }
+    query_ = query;
+
+    // Prefetches for the old query would only evict useful pages
+    for (const auto& job : jobs_) {
+        queued_.erase(pageKey(job.first.key(), job.second));
+    }
+    jobs_.clear();
+}
+
+StudentQuery StudentDirectory::getQuery() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return query_;
+}
+
+// =============================================================================
+// Paged Reads
+// =============================================================================
+
+int StudentDirectory::getTotalCount() {
+    StudentQuery query;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = totals_.find(query_.key());
+        if (it != totals_.end()) {
+            return it->second;
+        }
+        if (unknownTotals_.count(query_.key()) > 0) {
+            return pageSize_;
+        }
+        query = query_;
+    }
+
+    if (!loadPage(query, 0)) {
+        return 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = totals_.find(query.key());
+        if (it != totals_.end()) {
+            return it->second;
+        }
+    }
+
+    // No meta.count and a full first page: find the end of the list
+    int total = probeTotal(query, pageSize_);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (total < 0) {
+        // Show the rows known to exist; probing again on every redraw would not help
+        LOG_WARN("StudentDirectory", "Could not count students; showing the first page only");
+        unknownTotals_.insert(query.key());
+        return pageSize_;
+    }
+    totals_[query.key()] = total;
+    return total;
+}
+
+bool StudentDirectory::isTotalKnown() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return totals_.count(query_.key()) > 0;
+}
+
+bool StudentDirectory::getStudent(int row, Models::Student& student) {
+    if (row < 0) {
+        return false;
+    }
+
+    StudentQuery query;
+    int pageIndex = row / pageSize_;
+    size_t offsetInPage = static_cast<size_t>(row % pageSize_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        query = query_;
+        if (Page* page = findPage(pageKey(query.key(), pageIndex))) {
+            if (offsetInPage >= page->students.size()) {
+                return false;
+            }
+            student = page->students[offsetInPage];
+            return true;
+        }
+    }
+
+    if (!loadPage(query, pageIndex)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Page* page = findPage(pageKey(query.key(), pageIndex));
+    if (!page || offsetInPage >= page->students.size()) {
+        return false;
+    }
+    student = page->students[offsetInPage];
+    return true;
+}
+
+int StudentDirectory::countStudents(const StudentQuery& query) {
+    auto result = fetch(query, 0, 1);
+    if (!result.success) {
+        return 0;
+    }
+    if (result.total >= 0 || result.students.empty()) {
+        return result.total >= 0 ? result.total : 0;
+    }
+    int total = probeTotal(query, 1);
+    return total >= 0 ? total : 1;
+}
+
+int StudentDirectory::probeTotal(const StudentQuery& query, int knownRows) {
+    // Rows [0, low) are known to exist. Gallop with one-row requests until a
+    // probe comes back empty, then bisect the gap.
+    int low = knownRows;
+    int high = -1;
+    int probe = knownRows;
+    int step = std::max(knownRows, 1);
+    while (high < 0) {
+        auto result = fetch(query, probe, 1);
+        if (!result.success) {
+            return -1;
+        }
+        if (result.total >= 0) {
+            return result.total;
+        }
+        if (result.students.empty()) {
+            high = probe;
+        } else {
+            low = probe + 1;
+            if (probe > std::numeric_limits<int>::max() - step) {
+                return -1;
+            }
+            probe += step;
+            step *= 2;
+        }
+    }
+
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        auto result = fetch(query, mid, 1);
+        if (!result.success) {
+            return -1;
+        }
+        if (result.total >= 0) {
+            return result.total;
+        }
+        if (result.students.empty()) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low;
+}
+
+bool StudentDirectory::loadPage(const StudentQuery& query, int pageIndex) {
+    auto result = fetch(query, pageIndex * pageSize_, pageSize_);
+    if (!result.success) {
+        return false;
+    }
+
+    std::string queryKey = query.key();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (result.total >= 0) {
+        totals_[queryKey] = result.total;
+    } else if (static_cast<int>(result.students.size()) < pageSize_) {
+        // No meta.count: a short page still tells us where the list ends
+        totals_[queryKey] = pageIndex * pageSize_ + static_cast<int>(result.students.size());
+    }
+    storePage(pageKey(queryKey, pageIndex), std::move(result.students));
+    return true;
+}
+
+StudentDirectory::FetchResult StudentDirectory::fetch(const StudentQuery& query, int offset, int limit) {
+    FetchResult result;
+    if (!apiClient_) {
+        return result;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fetches_++;
+    }
+
+    try {
+        auto response = apiClient_->get(buildEndpoint(query, offset, limit));
+        if (!response.success) {
+            LOG_ERROR("StudentDirectory", "Failed to load students: " << response.errorMessage);
+            return result;
+        }
+
+        auto json = nlohmann::json::parse(response.body);
+        if (json.contains("data") && json["data"].is_array()) {
+            for (const auto& item : json["data"]) {
+                result.students.push_back(parseStudent(item));
+            }
+        }
+        if (json.contains("meta") && json["meta"].is_object()) {
+            const auto& meta = json["meta"];
+            if (meta.contains("count") && meta["count"].is_number()) {
+                result.total = meta["count"].get<int>();
+            } else if (meta.contains("total") && meta["total"].is_number()) {
+                result.total = meta["total"].get<int>();
+            }
+        }
+        result.success = true;
+    } catch (const std::exception& e) {
+        LOG_ERROR("StudentDirectory", "Exception loading students: " << e.what());
+    }
+    return result;
+}
+
+// =============================================================================
+// Background Prefetch
+// =============================================================================
+
+void StudentDirectory::prefetchAround(int row) {
+    int pageIndex = row / pageSize_;
+    bool queuedAny = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+
+        std::string queryKey = query_.key();
+        auto total = totals_.find(queryKey);
+        int lastPage = total != totals_.end() ? (total->second - 1) / pageSize_ : pageIndex + 1;
+
+        for (int neighbour : {pageIndex + 1, pageIndex - 1}) {
+            if (neighbour < 0 || neighbour > lastPage) {
+                continue;
+            }
+            std::string key = pageKey(queryKey, neighbour);
+            if (pages_.count(key) > 0 || !queued_.insert(key).second) {
+                continue;
+            }
+            jobs_.emplace_back(query_, neighbour);
+            queuedAny = true;
+        }
+    }
+
+    if (queuedAny) {
+        ensureWorker();
+        jobReady_.notify_one();
+    }
+}
+
+void StudentDirectory::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return stopping_ || (jobs_.empty() && !busy_); });
+}
+
+void StudentDirectory::ensureWorker() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!worker_.joinable() && !stopping_) {
+        worker_ = std::thread([this]() { workerLoop(); });
+    }
+}
+
+void StudentDirectory::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        jobReady_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+        if (stopping_) {
+            break;
+        }
+
+        auto job = jobs_.front();
+        jobs_.pop_front();
+        busy_ = true;
+
+        lock.unlock();
+        loadPage(job.first, job.second);
+        lock.lock();
+
+        queued_.erase(pageKey(job.first.key(), job.second));
+        busy_ = false;
+        if (jobs_.empty()) {
+            idle_.notify_all();
+        }
+    }
+    idle_.notify_all();
+}
+
+// =============================================================================
+// Page Cache
+// =============================================================================
+
+std::string StudentDirectory::pageKey(const std::string& queryKey, int pageIndex) {
+    return queryKey + "#" + std::to_string(pageIndex);
+}
+
+StudentDirectory::Page* StudentDirectory::findPage(const std::string& key) {
+    auto it = pages_.find(key);
+    if (it == pages_.end()) {
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lruPosition);
+    return &it->second;
+}
+
+void StudentDirectory::storePage(const std::string& key, std::vector<Models::Student> students) {
+    auto existing = pages_.find(key);
+    if (existing != pages_.end()) {
+        lru_.erase(existing->second.lruPosition);
+        pages_.erase(existing);
+    }
+
+    while (pages_.size() >= maxPages_ && !lru_.empty()) {
+        pages_.erase(lru_.back());
+        lru_.pop_back();
+    }
+
+    lru_.push_front(key);
+    pages_[key] = Page{std::move(students), lru_.begin()};
+}
+
+void StudentDirectory::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pages_.clear();
+    lru_.clear();
+    totals_.clear();
+    unknownTotals_.clear();
+}
+
+size_t StudentDirectory::getCachedPageCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pages_.size();
+}
+
+uint64_t StudentDirectory::getFetchCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return fetches_;
+}
+
+// =============================================================================
+// Query Building and Parsing
+// =============================================================================
+
+std::string StudentDirectory::buildEndpoint(const StudentQuery& query, int offset, int limit) {
+    std::string endpoint = "/Student?page[offset]=" + std::to_string(offset)
+                         + "&page[limit]=" + std::to_string(limit);
+
+    std::string prefix = query.sortAscending ? "" : "-";
+    if (query.sortField == "name") {
+        endpoint += "&sort=" + prefix + "last_name," + prefix + "first_name";
+    } else if (!query.sortField.empty()) {
+        endpoint += "&sort=" + prefix + query.sortField;
+    }
+
+    if (!query.curriculumId.empty()) {
+        endpoint += "&filter[curriculum_id]=" + urlEncode(query.curriculumId);
+    }
+
+    // Revoked students keep their status; the revoked flag overrides it.
+    // Status values are stored in mixed case, so match them with ilike.
+    nlohmann::json clauses = nlohmann::json::array();
+    std::string status = toLower(query.status);
+    if (status == "revoked") {
+        endpoint += "&filter[is_login_revoked]=true";
+    } else if (!status.empty()) {
+        endpoint += "&filter[is_login_revoked]=false";
+        nlohmann::json statusMatch = {{"name", "status"}, {"op", "ilike"}, {"val", escapeLike(status)}};
+        if (status == "active") {
+            // parseStudent lists rows without a status as active
+            nlohmann::json noStatus = {{"name", "status"}, {"op", "is_"}, {"val", nullptr}};
+            clauses.push_back({{"or", nlohmann::json::array({noStatus, statusMatch})}});
+        } else {
+            clauses.push_back(statusMatch);
+        }
+    }
+
+    std::string search = trim(query.search);
+    if (!search.empty()) {
+        std::string pattern = "%" + escapeLike(search) + "%";
+        nlohmann::json anyField = nlohmann::json::array();
+        for (const char* field : {"first_name", "last_name", "email"}) {
+            anyField.push_back({{"name", field}, {"op", "ilike"}, {"val", pattern}});
+        }
+        clauses.push_back({{"or", anyField}});
+    }
+
+    if (!clauses.empty()) {
+        endpoint += "&filter=" + urlEncode(clauses.dump());
+    }
+
+    return endpoint;
+}
+
+std::string StudentDirectory::escapeLike(const std::string& value) {
+    // Backslash is PostgreSQL's default LIKE escape character
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        if (c == '%' || c == '_' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+Models::Student StudentDirectory::parseStudent(const nlohmann::json& data) {
+    Models::Student student = Models::Student::fromJson(data);
+
+    // The list shows every student with a status; rows without one are active
+    const nlohmann::json& attrs = attributesOf(data);
+    std::string status = "active";
+    if (attrs.contains("status") && attrs["status"].is_string()) {
+        status = toLower(student.getStatus());
+    }
+    if (attrs.contains("is_login_revoked") && attrs["is_login_revoked"].is_boolean()
+        && attrs["is_login_revoked"].get<bool>()) {
+        status = "revoked";
+    }
+    student.setStatus(status);
+    return student;
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,165 @@
+#ifndef STUDENT_DIRECTORY_H
+#define STUDENT_DIRECTORY_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <list>
+#include <deque>
+#include <set>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include "ApiClient.h"
+#include "models/Student.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Filter and sort applied to the admin student list
+ *
+ * Every field is pushed into the /Student query string; nothing is
+ * filtered or sorted on the client.
+ */
+struct StudentQuery {
+    std::string search;             // Name or email fragment
+    std::string curriculumId;       // Empty = all programs
+    std::string status;             // active/pending/completed/revoked, empty = all
+    std::string sortField = "id";   // Student attribute, or "name" for last/first name
+    bool sortAscending = true;
+
+    // Stable cache key for this filter/sort combination
+    std::string key() const;
+};
+
+/**
+ * @brief Paged, server-side view of the Student table for the admin list
+ *
+ * Rows are fetched one page at a time with page[offset]/page[limit], and
+ * the total comes from the JSON:API meta.count (or one-row probes when the
+ * backend omits it) so the list can size itself without loading every
+ * student. Pages are held in a small LRU keyed by
+ * query and page index, so scrolling back and forth or toggling a filter
+ * off again does not refetch.
+ *
+ * getStudent() loads the containing page synchronously on a miss;
+ * prefetchAround() queues the neighbouring pages on a background worker so
+ * the next scroll step is usually a hit. Thread-safe, but intended to be
+ * owned by a single admin session.
+ */
+class StudentDirectory {
+public:
+    static constexpr int kDefaultPageSize = 50;
+    static constexpr size_t kDefaultMaxPages = 16;
+
+    explicit StudentDirectory(std::shared_ptr<ApiClient> apiClient,
+                              int pageSize = kDefaultPageSize,
+                              size_t maxPages = kDefaultMaxPages);
+    ~StudentDirectory();
+
+    // Prevent copying
+    StudentDirectory(const StudentDirectory&) = delete;
+    StudentDirectory& operator=(const StudentDirectory&) = delete;
+
+    // Current filter and sort; changing it drops queued prefetches
+    void setQuery(const StudentQuery& query);
+    StudentQuery getQuery() const;
+
+    /**
+     * @brief Number of students matching the current query
+     *
+     * Returns the cached total when known, otherwise loads the first page.
+     * When the backend sends no meta.count and the first page is full, the
+     * end of the list is found with one-row probes. If probing fails, the
+     * rows of the first page are counted and the total is left unknown until
+     * invalidate(). Returns 0 when the backend is unreachable.
+     */
+    int getTotalCount();
+
+    // Whether getTotalCount() found the exact total for the current query
+    bool isTotalKnown() const;
+
+    /**
+     * @brief Student at a row of the current query
+     *
+     * Returns false if the row is out of range or its page failed to load.
+     */
+    bool getStudent(int row, Models::Student& student);
+
+    // Warm the pages before and after the one containing row
+    void prefetchAround(int row);
+
+    // Count students matching a query without caching rows (one-row request)
+    int countStudents(const StudentQuery& query);
+
+    // Block until queued prefetches are done (used by tests)
+    void waitIdle();
+
+    // Drop every cached page, e.g. after a student was added
+    void invalidate();
+
+    // Statistics
+    int getPageSize() const { return pageSize_; }
+    size_t getCachedPageCount() const;
+    uint64_t getFetchCount() const;
+
+    // Query building and response parsing (public for tests)
+    static std::string buildEndpoint(const StudentQuery& query, int offset, int limit);
+    static std::string escapeLike(const std::string& value);
+    static Models::Student parseStudent(const nlohmann::json& data);
+
+private:
+    struct Page {
+        std::vector<Models::Student> students;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    struct FetchResult {
+        bool success = false;
+        std::vector<Models::Student> students;
+        int total = -1;
+    };
+
+    static std::string pageKey(const std::string& queryKey, int pageIndex);
+
+    FetchResult fetch(const StudentQuery& query, int offset, int limit);
+    bool loadPage(const StudentQuery& query, int pageIndex);
+    // Row count when meta.count is missing and knownRows rows exist; -1 on failure
+    int probeTotal(const StudentQuery& query, int knownRows);
+
+    // Cache primitives; callers hold mutex_
+    Page* findPage(const std::string& key);
+    void storePage(const std::string& key, std::vector<Models::Student> students);
+
+    void ensureWorker();
+    void workerLoop();
+
+    std::shared_ptr<ApiClient> apiClient_;
+    int pageSize_;
+    size_t maxPages_;
+
+    StudentQuery query_;
+    std::map<std::string, int> totals_;     // query key -> meta.count
+    std::set<std::string> unknownTotals_;   // query keys whose count probe failed
+    std::map<std::string, Page> pages_;
+    std::list<std::string> lru_;            // most recently used first
+    uint64_t fetches_;
+
+    std::deque<std::pair<StudentQuery, int>> jobs_;
+    std::set<std::string> queued_;          // page keys pending in jobs_ or in flight
+    bool busy_;
+    bool stopping_;
+    std::thread worker_;
+    std::condition_variable jobReady_;
+    std::condition_variable idle_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // STUDENT_DIRECTORY_H
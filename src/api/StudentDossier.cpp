@@ -0,0 +1,684 @@
+#include "StudentDossier.h"
+#include "ApiUtils.h"
+#include "utils/Logger.h"
+#include <future>
+#include <map>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+// Rows of a JSON:API document, whether data is a collection or a single resource
+std::vector<nlohmann::json> parseRows(const std::string& body) {
+    std::vector<nlohmann::json> rows;
+    auto json = nlohmann::json::parse(body);
+    const auto& data = json.contains("data") ? json["data"] : json;
+    if (data.is_array()) {
+        rows.assign(data.begin(), data.end());
+    } else if (data.is_object()) {
+        rows.push_back(data);
+    }
+    return rows;
+}
+
+// "2024-03-01" -> "March 1, 2024"; anything else is returned unchanged
+std::string formatDate(const std::string& dateStr) {
+    if (dateStr.empty()) return "-";
+
+    try {
+        if (dateStr.length() >= 10) {
+            static const char* months[] = {"January", "February", "March", "April", "May", "June",
+                "July", "August", "September", "October", "November", "December"};
+
+            int monthIdx = std::stoi(dateStr.substr(5, 2)) - 1;
+            if (monthIdx >= 0 && monthIdx < 12) {
+                return std::string(months[monthIdx]) + " " + std::to_string(std::stoi(dateStr.substr(8, 2)))
+                       + ", " + dateStr.substr(0, 4);
+            }
+        }
+    } catch (...) {
+        // Fall through
+    }
+
+    return dateStr;
+}
+
+} // namespace
+
+// =============================================================================
+// StudentDossier
+// =============================================================================
+
+std::string StudentDossier::studentName() const {
+    if (!hasStudent()) {
+        return "Unknown Student";
+    }
+    return stringValue(student, "first_name") + " " + stringValue(student, "last_name");
+}
+
+std::string StudentDossier::studentEmail() const {
+    return stringValue(student, "email");
+}
+
+const DossierSubmission* StudentDossier::findSubmission(int submissionId) const {
+    for (const auto& submission : submissions) {
+        if (submission.id == submissionId) {
+            return &submission;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<PdfFormField> StudentDossier::formFields(const std::string& formType) const {
+    std::vector<PdfFormField> fields;
+
+    if (formType == "personal_info") {
+        // Personal information lives on the Student row
+        if (hasStudent()) {
+            const nlohmann::json& pAttrs = student;
+
+            fields.push_back({"First Name", pAttrs.value("first_name", ""), "text"});
+            fields.push_back({"Last Name", pAttrs.value("last_name", ""), "text"});
+            fields.push_back({"Email", pAttrs.value("email", ""), "email"});
+            fields.push_back({"Phone", pAttrs.value("phone_number", ""), "phone"});
+            fields.push_back({"Date of Birth", pAttrs.value("date_of_birth", ""), "date"});
+            fields.push_back({"Gender", pAttrs.value("gender", ""), "text"});
+            fields.push_back({"Preferred Pronouns", pAttrs.value("preferred_pronouns", ""), "text"});
+            fields.push_back({"Citizenship Status", pAttrs.value("citizenship_status", ""), "text"});
+        }
+    } else if (formType == "emergency_contact") {
+        const auto& ecItems = emergencyContacts;
+        if (!ecItems.empty()) {
+            int contactNum = 1;
+            for (const auto& ecAttrs : ecItems) {
+                // Helper lambda to safely get string from JSON (handles null values)
+                auto safeGetString = [&ecAttrs](const std::string& key) -> std::string {
+                    if (ecAttrs.contains(key) && !ecAttrs[key].is_null()) {
+                        if (ecAttrs[key].is_string()) {
+                            return ecAttrs[key].get<std::string>();
+                        } else if (ecAttrs[key].is_number()) {
+                            return std::to_string(ecAttrs[key].get<int>());
+                        }
+                    }
+                    return "";
+                };
+
+                // Determine contact label
+                std::string contactLabel;
+                bool isPrimary = ecAttrs.contains("is_primary") && !ecAttrs["is_primary"].is_null() && ecAttrs["is_primary"].get<bool>();
+                int priority = ecAttrs.contains("priority") && !ecAttrs["priority"].is_null() && ecAttrs["priority"].is_number() ? ecAttrs["priority"].get<int>() : 0;
+
+                if (isPrimary || priority == 1) {
+                    contactLabel = "Primary Contact";
+                } else if (priority == 2) {
+                    contactLabel = "Secondary Contact";
+                } else {
+                    contactLabel = "Contact #" + std::to_string(contactNum);
+                }
+
+                if (contactNum > 1) {
+                    fields.push_back({"", "", "text"});
+                }
+                fields.push_back({contactLabel, "", "header"});
+
+                std::string firstName = safeGetString("first_name");
+                std::string lastName = safeGetString("last_name");
+                std::string fullName = firstName;
+                if (!lastName.empty()) {
+                    fullName += (fullName.empty() ? "" : " ") + lastName;
+                }
+                if (!fullName.empty()) {
+                    fields.push_back({"Name", fullName, "text"});
+                }
+
+                std::string relationship = safeGetString("contact_relationship");
+                if (!relationship.empty()) {
+                    fields.push_back({"Relationship", relationship, "text"});
+                }
+
+                std::string phone = safeGetString("phone");
+                if (!phone.empty()) {
+                    fields.push_back({"Phone", phone, "phone"});
+                }
+
+                std::string altPhone = safeGetString("alternate_phone");
+                if (!altPhone.empty()) {
+                    fields.push_back({"Alternate Phone", altPhone, "phone"});
+                }
+
+                std::string email = safeGetString("email");
+                if (!email.empty()) {
+                    fields.push_back({"Email", email, "email"});
+                }
+
+                // Build address
+                std::string street1 = safeGetString("street1");
+                std::string street2 = safeGetString("street2");
+                std::string city = safeGetString("city");
+                std::string state = safeGetString("state");
+                std::string postalCode = safeGetString("postal_code");
+                std::string country = safeGetString("country");
+
+                if (!street1.empty()) {
+                    std::string fullAddress = street1;
+                    if (!street2.empty()) fullAddress += ", " + street2;
+                    fields.push_back({"Street Address", fullAddress, "text"});
+                }
+                if (!city.empty() || !state.empty() || !postalCode.empty()) {
+                    std::string cityStateZip = city;
+                    if (!state.empty()) cityStateZip += (!cityStateZip.empty() ? ", " : "") + state;
+                    if (!postalCode.empty()) cityStateZip += " " + postalCode;
+                    fields.push_back({"City, State, Zip", cityStateZip, "text"});
+                }
+                if (!country.empty() && country != "USA" && country != "US" && country != "United States") {
+                    fields.push_back({"Country", country, "text"});
+                }
+
+                contactNum++;
+            }
+        } else {
+            fields.push_back({"No Emergency Contacts", "No emergency contacts have been added yet.", "text"});
+        }
+    } else if (formType == "academic_history") {
+        if (!academicHistory.empty()) {
+            // Group by institution type
+            std::vector<std::string> institutionTypes = {"High School", "College", "University", "Trade School"};
+            std::map<std::string, std::vector<nlohmann::json>> groupedRecords;
+
+            for (const auto& ahAttrs : academicHistory) {
+                std::string instType = ahAttrs.value("institution_type", "Other");
+                groupedRecords[instType].push_back(ahAttrs);
+            }
+
+            bool firstGroup = true;
+            for (const auto& instType : institutionTypes) {
+                if (groupedRecords.find(instType) != groupedRecords.end()) {
+                    if (!firstGroup) {
+                        fields.push_back({"", "", "text"}); // Separator
+                    }
+                    fields.push_back({instType + " Education", "", "header"});
+                    firstGroup = false;
+
+                    int recordNum = 1;
+                    for (const auto& ahAttrs : groupedRecords[instType]) {
+                        if (recordNum > 1) {
+                            fields.push_back({"", "", "text"});
+                        }
+
+                        fields.push_back({"Institution Name", ahAttrs.value("institution_name", ""), "text"});
+
+                        // Location
+                        std::string city = ahAttrs.value("institution_city", "");
+                        std::string state = ahAttrs.value("institution_state", "");
+                        std::string country = ahAttrs.value("institution_country", "");
+                        std::string location;
+                        if (!city.empty()) location = city;
+                        if (!state.empty()) location += (!location.empty() ? ", " : "") + state;
+                        if (!country.empty() && country != "USA" && country != "US" && country != "United States") {
+                            location += (!location.empty() ? ", " : "") + country;
+                        }
+                        if (!location.empty()) {
+                            fields.push_back({"Location", location, "text"});
+                        }
+
+                        // Degree and major/minor
+                        std::string degree = ahAttrs.value("degree_earned", "");
+                        if (!degree.empty()) {
+                            fields.push_back({"Degree Earned", degree, "text"});
+                        }
+                        std::string major = ahAttrs.value("major", "");
+                        if (!major.empty()) {
+                            fields.push_back({"Major", major, "text"});
+                        }
+                        std::string minor = ahAttrs.value("minor", "");
+                        if (!minor.empty()) {
+                            fields.push_back({"Minor", minor, "text"});
+                        }
+
+                        // GPA
+                        if (ahAttrs.contains("gpa") && !ahAttrs["gpa"].is_null()) {
+                            double gpa = ahAttrs.value("gpa", 0.0);
+                            double gpaScale = ahAttrs.value("gpa_scale", 4.0);
+                            std::ostringstream gpaStr;
+                            gpaStr << std::fixed << std::setprecision(2) << gpa << " / " << gpaScale;
+                            fields.push_back({"GPA", gpaStr.str(), "text"});
+                        }
+
+                        // Dates
+                        std::string startDate = ahAttrs.value("start_date", "");
+                        std::string endDate = ahAttrs.value("end_date", "");
+                        bool currentlyAttending = ahAttrs.value("is_currently_attending", false);
+
+                        if (!startDate.empty() || !endDate.empty()) {
+                            std::string dateRange = formatDate(startDate) + " - ";
+                            if (currentlyAttending) {
+                                dateRange += "Present";
+                            } else if (!endDate.empty()) {
+                                dateRange += formatDate(endDate);
+                            }
+                            fields.push_back({"Attendance Period", dateRange, "text"});
+                        }
+
+                        std::string gradDate = ahAttrs.value("graduation_date", "");
+                        if (!gradDate.empty()) {
+                            fields.push_back({"Graduation Date", gradDate, "date"});
+                        }
+
+                        // Transcript status
+                        bool transcriptReceived = ahAttrs.value("transcript_received", false);
+                        fields.push_back({"Transcript Received", transcriptReceived ? "Yes" : "No", "text"});
+
+                        recordNum++;
+                    }
+                }
+            }
+
+            // Handle any "Other" types not in the standard list
+            for (const auto& pair : groupedRecords) {
+                if (std::find(institutionTypes.begin(), institutionTypes.end(), pair.first) == institutionTypes.end()) {
+                    if (!firstGroup) {
+                        fields.push_back({"", "", "text"});
+                    }
+                    fields.push_back({pair.first + " Education", "", "header"});
+                    firstGroup = false;
+
+                    for (const auto& ahAttrs : pair.second) {
+                        fields.push_back({"Institution Name", ahAttrs.value("institution_name", ""), "text"});
+                        fields.push_back({"Degree Earned", ahAttrs.value("degree_earned", ""), "text"});
+                        fields.push_back({"Graduation Date", ahAttrs.value("graduation_date", ""), "date"});
+                    }
+                }
+            }
+        }
+    } else if (formType == "medical_info") {
+        if (!medicalInfo.empty()) {
+            const nlohmann::json& medAttrs = medicalInfo.front();
+
+            // Basic medical info
+            fields.push_back({"Medical Information", "", "header"});
+            fields.push_back({"Blood Type", medAttrs.value("blood_type", ""), "text"});
+
+            // Allergies
+            bool hasAllergies = medAttrs.value("has_allergies", false);
+            fields.push_back({"Has Allergies", hasAllergies ? "Yes" : "No", "text"});
+            if (hasAllergies) {
+                fields.push_back({"Allergies", medAttrs.value("allergies", ""), "text"});
+            }
+
+            // Medications
+            bool hasMedications = medAttrs.value("has_medications", false);
+            fields.push_back({"Currently on Medications", hasMedications ? "Yes" : "No", "text"});
+            if (hasMedications) {
+                fields.push_back({"Medications", medAttrs.value("medications", ""), "text"});
+            }
+
+            // Chronic conditions
+            bool hasChronicConditions = medAttrs.value("has_chronic_conditions", false);
+            fields.push_back({"Has Chronic Conditions", hasChronicConditions ? "Yes" : "No", "text"});
+            if (hasChronicConditions) {
+                fields.push_back({"Chronic Conditions", medAttrs.value("chronic_conditions", ""), "text"});
+            }
+
+            // Disabilities
+            bool hasDisabilities = medAttrs.value("has_disabilities", false);
+            fields.push_back({"Has Disabilities", hasDisabilities ? "Yes" : "No", "text"});
+            if (hasDisabilities) {
+                fields.push_back({"Disabilities", medAttrs.value("disabilities", ""), "text"});
+            }
+
+            // Accommodations
+            bool requiresAccommodations = medAttrs.value("requires_accommodations", false);
+            fields.push_back({"Requires Accommodations", requiresAccommodations ? "Yes" : "No", "text"});
+            if (requiresAccommodations) {
+                fields.push_back({"Accommodations Needed", medAttrs.value("accommodations_needed", ""), "text"});
+            }
+
+            // Immunizations
+            bool immunizationsUpToDate = medAttrs.value("immunizations_up_to_date", false);
+            fields.push_back({"Immunizations Up To Date", immunizationsUpToDate ? "Yes" : "No", "text"});
+
+            // Insurance information
+            fields.push_back({"", "", "text"});
+            fields.push_back({"Insurance Information", "", "header"});
+            fields.push_back({"Insurance Provider", medAttrs.value("insurance_provider", ""), "text"});
+            fields.push_back({"Policy Number", medAttrs.value("insurance_policy_number", ""), "text"});
+            fields.push_back({"Group Number", medAttrs.value("insurance_group_number", ""), "text"});
+            fields.push_back({"Insurance Phone", medAttrs.value("insurance_phone", ""), "phone"});
+
+            // Physician info
+            fields.push_back({"", "", "text"});
+            fields.push_back({"Primary Care Physician", "", "header"});
+            fields.push_back({"Physician Name", medAttrs.value("primary_physician", ""), "text"});
+            fields.push_back({"Physician Phone", medAttrs.value("physician_phone", ""), "phone"});
+        }
+    } else if (formType == "financial_aid") {
+        if (!financialAid.empty()) {
+            const nlohmann::json& faAttrs = financialAid.front();
+
+            // Helper lambdas for safe JSON access
+            auto safeGetString = [&faAttrs](const std::string& key) -> std::string {
+                if (faAttrs.contains(key) && faAttrs[key].is_string()) {
+                    return faAttrs[key].get<std::string>();
+                }
+                return "";
+            };
+            auto safeGetBool = [&faAttrs](const std::string& key, bool defaultVal = false) -> bool {
+                if (faAttrs.contains(key) && faAttrs[key].is_boolean()) {
+                    return faAttrs[key].get<bool>();
+                }
+                return defaultVal;
+            };
+
+            // General Information
+            fields.push_back({"General Information", "", "header"});
+            fields.push_back({"Applying for Financial Aid", safeGetBool("applying_for_aid", true) ? "Yes" : "No", "text"});
+
+            // FAFSA Information
+            fields.push_back({"", "", "text"});
+            fields.push_back({"FAFSA Information", "", "header"});
+            fields.push_back({"FAFSA Completed", safeGetBool("fafsa_completed") ? "Yes" : "No", "text"});
+            if (faAttrs.contains("efc") && !faAttrs["efc"].is_null()) {
+                std::ostringstream efcStr;
+                efcStr << std::fixed << std::setprecision(2) << faAttrs.value("efc", 0.0);
+                fields.push_back({"Student Aid Index (SAI/EFC)", efcStr.str(), "text"});
+            }
+
+            // Employment Information
+            fields.push_back({"", "", "text"});
+            fields.push_back({"Employment Information", "", "header"});
+            std::string empStatus = safeGetString("employment_status");
+            fields.push_back({"Employment Status", empStatus.empty() ? "Not specified" : empStatus, "text"});
+            std::string employer = safeGetString("employer_name");
+            if (!employer.empty()) {
+                fields.push_back({"Employer Name", employer, "text"});
+            }
+
+            // Household Information
+            fields.push_back({"", "", "text"});
+            fields.push_back({"Household Information", "", "header"});
+            std::string incomeRange = safeGetString("household_income_range");
+            fields.push_back({"Household Income Range", incomeRange.empty() ? "Not specified" : incomeRange, "text"});
+            if (faAttrs.contains("dependents_count") && !faAttrs["dependents_count"].is_null()) {
+                fields.push_back({"Number of Dependents", std::to_string(faAttrs.value("dependents_count", 0)), "text"});
+            }
+            fields.push_back({"Veteran Benefits Eligible", safeGetBool("veteran_benefits") ? "Yes" : "No", "text"});
+
+            // Aid Types Interested In
+            fields.push_back({"", "", "text"});
+            fields.push_back({"Types of Aid Interested In", "", "header"});
+            fields.push_back({"Scholarships and Grants", safeGetBool("scholarship_interest") ? "Yes" : "No", "text"});
+            fields.push_back({"Federal Work-Study", safeGetBool("work_study_interest") ? "Yes" : "No", "text"});
+            fields.push_back({"Student Loans", safeGetBool("loan_interest") ? "Yes" : "No", "text"});
+
+            // Current Scholarships
+            std::string scholarships = safeGetString("scholarship_applications");
+            if (!scholarships.empty()) {
+                fields.push_back({"", "", "text"});
+                fields.push_back({"Current Scholarships", "", "header"});
+                fields.push_back({"Scholarships", scholarships, "text"});
+            }
+
+            // Special Circumstances
+            std::string specialCirc = safeGetString("special_circumstances");
+            if (!specialCirc.empty()) {
+                fields.push_back({"", "", "text"});
+                fields.push_back({"Special Circumstances", "", "header"});
+                fields.push_back({"Details", specialCirc, "text"});
+            }
+        } else {
+            fields.push_back({"No Financial Aid Data", "No financial aid information has been submitted.", "text"});
+        }
+    } else if (formType == "documents") {
+        const auto& docItems = documents;
+        if (!docItems.empty()) {
+            int docNum = 1;
+            for (const auto& docAttrs : docItems) {
+                // Helper lambda to safely get string from JSON (handles null values)
+                auto safeGetString = [&docAttrs](const std::string& key) -> std::string {
+                    if (docAttrs.contains(key) && docAttrs[key].is_string()) {
+                        return docAttrs[key].get<std::string>();
+                    }
+                    return "";
+                };
+
+                if (docNum > 1) {
+                    fields.push_back({"", "", "text"});
+                }
+                fields.push_back({"Document #" + std::to_string(docNum), "", "header"});
+
+                fields.push_back({"Document Type", safeGetString("document_type"), "text"});
+                fields.push_back({"File Name", safeGetString("file_name"), "text"});
+
+                // File size in KB/MB
+                int fileSize = docAttrs.contains("file_size") && docAttrs["file_size"].is_number() ?
+                    docAttrs["file_size"].get<int>() : 0;
+                std::string sizeStr;
+                if (fileSize >= 1048576) {
+                    std::ostringstream ss;
+                    ss << std::fixed << std::setprecision(2) << (fileSize / 1048576.0) << " MB";
+                    sizeStr = ss.str();
+                } else if (fileSize >= 1024) {
+                    std::ostringstream ss;
+                    ss << std::fixed << std::setprecision(1) << (fileSize / 1024.0) << " KB";
+                    sizeStr = ss.str();
+                } else {
+                    sizeStr = std::to_string(fileSize) + " bytes";
+                }
+                fields.push_back({"File Size", sizeStr, "text"});
+
+                fields.push_back({"Status", safeGetString("status"), "text"});
+
+                std::string verifiedAt = safeGetString("verified_at");
+                if (!verifiedAt.empty()) {
+                    fields.push_back({"Verified On", verifiedAt, "date"});
+                    fields.push_back({"Verified By", safeGetString("verified_by"), "text"});
+                }
+
+                std::string notes = safeGetString("notes");
+                if (!notes.empty()) {
+                    fields.push_back({"Notes", notes, "text"});
+                }
+
+                docNum++;
+            }
+        } else {
+            fields.push_back({"No Documents", "No documents uploaded yet", "text"});
+        }
+    } else if (formType == "consent") {
+        const auto& cItems = consents;
+
+        // Build a map of consent_type -> is_accepted and extract signature
+        std::map<std::string, bool> consentMap;
+        std::string signature;
+        std::string signatureDate;
+
+        for (const auto& cAttrs : cItems) {
+            std::string consentType;
+            if (cAttrs.contains("consent_type") && cAttrs["consent_type"].is_string()) {
+                consentType = cAttrs["consent_type"].get<std::string>();
+            }
+
+            bool isAccepted = cAttrs.contains("is_accepted") && !cAttrs["is_accepted"].is_null() ?
+                cAttrs.value("is_accepted", false) : false;
+
+            if (consentType == "student_signature") {
+                // Extract signature data
+                if (cAttrs.contains("electronic_signature") && cAttrs["electronic_signature"].is_string()) {
+                    signature = cAttrs["electronic_signature"].get<std::string>();
+                }
+                if (cAttrs.contains("signature_date") && cAttrs["signature_date"].is_string()) {
+                    signatureDate = cAttrs["signature_date"].get<std::string>();
+                }
+            } else if (!consentType.empty()) {
+                consentMap[consentType] = isAccepted;
+            }
+        }
+
+        // Define consent items with titles and descriptions (matching student form)
+        struct ConsentItemDef {
+            std::string type;
+            std::string title;
+            std::string description;
+        };
+
+        std::vector<ConsentItemDef> consentDefs = {
+            {"terms_of_service", "Terms of Service",
+             "By enrolling, I agree to abide by all university policies, procedures, regulations, and applicable laws."},
+            {"privacy_policy", "Privacy Policy",
+             "My personal information will be collected, stored, and processed in accordance with the university's Privacy Policy."},
+            {"ferpa_acknowledgment", "FERPA Rights",
+             "I understand my rights under the Family Educational Rights and Privacy Act regarding my education records."},
+            {"code_of_conduct", "Student Code of Conduct",
+             "I will uphold academic integrity and ethical behavior standards, including refraining from cheating and plagiarism."},
+            {"communication_consent", "Communication Consent",
+             "I agree to receive email, SMS, and mail from the university regarding enrollment, academics, and campus events."},
+            {"photo_release", "Photo/Media Release (Optional)",
+             "I grant permission for photos and videos taken during university events to be used for promotional purposes."},
+            {"accuracy_certification", "Accuracy Certification",
+             "All information provided in this application is accurate and complete. I understand false information may result in disciplinary action."}
+        };
+
+        // Add consent acknowledgments section
+        fields.push_back({"Consent Acknowledgments", "", "header"});
+
+        for (const auto& def : consentDefs) {
+            bool isChecked = consentMap.count(def.type) && consentMap[def.type];
+            std::string checkbox = isChecked ? "☑" : "☐";
+            std::string title = checkbox + " " + def.title;
+            fields.push_back({title, def.description, "consent_item"});
+        }
+
+        // Add signature section at the bottom
+        if (!signature.empty()) {
+            fields.push_back({"", "", "text"});  // Spacer
+            fields.push_back({"Electronic Signature", "", "header"});
+            fields.push_back({"Signature", signature, "signature"});
+            if (!signatureDate.empty()) {
+                fields.push_back({"Date", signatureDate, "date"});
+            }
+        }
+    }
+
+    return fields;
+}
+
+// =============================================================================
+// StudentDossierLoader
+// =============================================================================
+
+StudentDossierLoader::StudentDossierLoader(std::shared_ptr<ApiClient> apiClient)
+    : apiClient_(apiClient) {
+}
+
+std::string StudentDossierLoader::formTypeCode(int formTypeId) {
+    static const std::map<int, std::string> codes = {
+        {1, "personal_info"},
+        {2, "emergency_contact"},
+        {3, "medical_info"},
+        {4, "academic_history"},
+        {5, "financial_aid"},
+        {6, "documents"},
+        {7, "consent"}
+    };
+    auto it = codes.find(formTypeId);
+    return it != codes.end() ? it->second : "unknown";
+}
+
+std::string StudentDossierLoader::formTitle(const std::string& formType) {
+    static const std::map<std::string, std::string> titles = {
+        {"personal_info", "Personal Information Form"},
+        {"emergency_contact", "Emergency Contact Form"},
+        {"medical_info", "Medical Information Form"},
+        {"academic_history", "Academic History Form"},
+        {"financial_aid", "Financial Aid Form"},
+        {"documents", "Document Upload Form"},
+        {"consent", "Consent Form"}
+    };
+    auto it = titles.find(formType);
+    return it != titles.end() ? it->second : "Form";
+}
+
+StudentDossier StudentDossierLoader::load(int studentId) const {
+    StudentDossier dossier;
+    dossier.studentId = studentId;
+    if (!apiClient_ || studentId <= 0) {
+        return dossier;
+    }
+
+    std::string filter = "?filter[student_id]=" + std::to_string(studentId);
+    std::vector<nlohmann::json> studentRows;
+    std::vector<nlohmann::json> submissionRows;
+
+    struct Section {
+        std::string endpoint;
+        std::vector<nlohmann::json>* rows;
+    };
+    std::vector<Section> sections = {
+        {"/Student/" + std::to_string(studentId), &studentRows},
+        {"/FormSubmission" + filter, &submissionRows},
+        {"/EmergencyContact" + filter, &dossier.emergencyContacts},
+        {"/MedicalInfo" + filter, &dossier.medicalInfo},
+        {"/AcademicHistory" + filter, &dossier.academicHistory},
+        {"/FinancialAid" + filter, &dossier.financialAid},
+        {"/Document" + filter, &dossier.documents},
+        {"/Consent" + filter, &dossier.consents}
+    };
+
+    // Issue every request before waiting on any of them
+    std::vector<std::future<ApiResponse>> responses;
+    for (const auto& section : sections) {
+        responses.push_back(std::async(std::launch::async, [client = apiClient_, endpoint = section.endpoint]() {
+            return client->get(endpoint);
+        }));
+    }
+
+    dossier.complete = true;
+    for (size_t i = 0; i < sections.size(); ++i) {
+        try {
+            ApiResponse response = responses[i].get();
+            if (!response.success) {
+                LOG_WARN("StudentDossier", "Failed to load " << sections[i].endpoint << ": "
+                         << response.errorMessage);
+                dossier.complete = false;
+                continue;
+            }
+            for (const auto& row : parseRows(response.body)) {
+                if (sections[i].rows == &submissionRows) {
+                    sections[i].rows->push_back(row);
+                } else {
+                    sections[i].rows->push_back(attributesOf(row));
+                }
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR("StudentDossier", "Error loading " << sections[i].endpoint << ": " << e.what());
+            dossier.complete = false;
+        }
+    }
+
+    if (!studentRows.empty()) {
+        dossier.student = studentRows.front();
+    }
+
+    for (const auto& row : submissionRows) {
+        const auto& attrs = attributesOf(row);
+        DossierSubmission submission;
+        submission.id = intValue(row, "id");
+        submission.formTypeId = intValue(attrs, "form_type_id");
+        submission.formType = formTypeCode(submission.formTypeId);
+        submission.status = stringValue(attrs, "status");
+        if (submission.status.empty()) {
+            submission.status = "pending";
+        }
+        submission.submittedAt = stringValue(attrs, "submitted_at");
+        dossier.submissions.push_back(submission);
+    }
+
+    LOG_DEBUG("StudentDossier", "Loaded dossier for student " << studentId << ": "
+              << dossier.submissions.size() << " submissions"
+              << (dossier.complete ? "" : " (incomplete)"));
+    return dossier;
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,80 @@
+#ifndef STUDENT_DOSSIER_H
+#define STUDENT_DOSSIER_H
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "ApiClient.h"
+#include "PdfGenerator.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief One form submission in a dossier
+ */
+struct DossierSubmission {
+    int id = 0;
+    int formTypeId = 0;
+    std::string formType;       // form type code, "unknown" if not mapped
+    std::string status;
+    std::string submittedAt;
+};
+
+/**
+ * @brief Everything the admin form preview and PDF need for one student
+ *
+ * Record sections hold the JSON:API attributes of each row. A section whose
+ * request failed is left empty and complete is false.
+ */
+struct StudentDossier {
+    int studentId = 0;
+    bool complete = false;
+
+    nlohmann::json student = nlohmann::json::object();
+    std::vector<DossierSubmission> submissions;
+    std::vector<nlohmann::json> emergencyContacts;
+    std::vector<nlohmann::json> medicalInfo;
+    std::vector<nlohmann::json> academicHistory;
+    std::vector<nlohmann::json> financialAid;
+    std::vector<nlohmann::json> documents;
+    std::vector<nlohmann::json> consents;
+
+    bool hasStudent() const { return !student.empty(); }
+    std::string studentName() const;
+    std::string studentEmail() const;
+    const DossierSubmission* findSubmission(int submissionId) const;
+
+    // Labelled fields of one form, in the order the preview and the PDF show them
+    std::vector<PdfFormField> formFields(const std::string& formType) const;
+};
+
+/**
+ * @brief Loads a StudentDossier with one concurrent request per table
+ *
+ * The Student row, the student's FormSubmission rows and each form data
+ * table are requested at the same time, so a dossier costs the latency of
+ * the slowest single call rather than the sum of eight. Requests are
+ * independent; a failed one leaves its section empty.
+ */
+class StudentDossierLoader {
+public:
+    explicit StudentDossierLoader(std::shared_ptr<ApiClient> apiClient);
+
+    StudentDossier load(int studentId) const;
+
+    // Form type code for a FormType id in the default form set
+    static std::string formTypeCode(int formTypeId);
+
+    // Document heading for a form type code ("Form" if not mapped)
+    static std::string formTitle(const std::string& formType);
+
+private:
+    std::shared_ptr<ApiClient> apiClient_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // STUDENT_DOSSIER_H
@@ -0,0 +1,668 @@
+#include "SubmissionIndex.h"
+#include "ApiUtils.h"
+#include "DeltaReader.h"
+#include "PdfCache.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <tuple>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+const char* kSubmissionFields = "student_id,form_type_id,status,submitted_at,approved_at,approved_by,updated_at";
+const char* kStudentFields = "first_name,last_name,email,curriculum_id,updated_at";
+
+nlohmann::json dataArray(const ApiResponse& response) {
+    auto json = nlohmann::json::parse(response.body);
+    if (json.is_array()) {
+        return json;
+    }
+    if (json.contains("data") && json["data"].is_array()) {
+        return json["data"];
+    }
+    return nlohmann::json::array();
+}
+
+template <typename Key>
+void indexId(std::map<Key, std::set<int>>& index, const Key& key, int id, bool add) {
+    if (add) {
+        index[key].insert(id);
+        return;
+    }
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second.erase(id);
+        if (it->second.empty()) {
+            index.erase(it);
+        }
+    }
+}
+
+} // namespace
+
+SubmissionIndex& SubmissionIndex::getInstance() {
+    static SubmissionIndex instance;
+    return instance;
+}
+
+SubmissionIndex::SubmissionIndex()
+    : refreshIntervalSeconds_(30)
+    , rebuildIntervalSeconds_(3600)
+    , pageSize_(500)
+    , loaded_(false)
+    , running_(false)
+    , stopRequested_(false) {
+}
+
+SubmissionIndex::~SubmissionIndex() {
+    stop();
+}
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void SubmissionIndex::setApiClient(std::shared_ptr<ApiClient> client) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_ = client;
+}
+
+bool SubmissionIndex::hasApiClient() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return apiClient_ != nullptr;
+}
+
+void SubmissionIndex::setRefreshInterval(int seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    refreshIntervalSeconds_ = seconds > 0 ? seconds : 1;
+}
+
+void SubmissionIndex::setRebuildInterval(int seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rebuildIntervalSeconds_ = seconds > 0 ? seconds : 1;
+}
+
+void SubmissionIndex::setPageSize(int rows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pageSize_ = rows > 0 ? rows : 1;
+}
+
+// =============================================================================
+// Background Refresh
+// =============================================================================
+
+void SubmissionIndex::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    refresher_ = std::thread([this]() { refresherLoop(); });
+    LOG_DEBUG("SubmissionIndex", "Refresher started (interval " << refreshIntervalSeconds_
+              << "s, rebuild " << rebuildIntervalSeconds_ << "s)");
+}
+
+void SubmissionIndex::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    wakeRefresher_.notify_all();
+
+    if (refresher_.joinable()) {
+        refresher_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+}
+
+bool SubmissionIndex::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+void SubmissionIndex::refresherLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopRequested_) {
+        lock.unlock();
+        refresh();
+        lock.lock();
+
+        wakeRefresher_.wait_for(lock, std::chrono::seconds(refreshIntervalSeconds_), [this]() {
+            return stopRequested_;
+        });
+    }
+}
+
+// =============================================================================
+// Loading
+// =============================================================================
+
+bool SubmissionIndex::refresh() {
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+
+    bool rebuildDue;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rebuildDue = !loaded_ ||
+            std::chrono::steady_clock::now() - lastRebuild_ >= std::chrono::seconds(rebuildIntervalSeconds_);
+    }
+    return rebuildDue ? loadAll() : loadChanges();
+}
+
+bool SubmissionIndex::rebuild() {
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+    return loadAll();
+}
+
+bool SubmissionIndex::isLoaded() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return loaded_;
+}
+
+bool SubmissionIndex::loadLookups(const std::shared_ptr<ApiClient>& client,
+                                  std::map<int, FormTypeInfo>& formTypes,
+                                  std::map<int, std::string>& programs) const {
+    try {
+        auto formTypeResponse = client->get("/FormType");
+        if (!formTypeResponse.success) {
+            LOG_ERROR("SubmissionIndex", "Failed to load form types: " << formTypeResponse.errorMessage);
+            return false;
+        }
+        for (const auto& item : dataArray(formTypeResponse)) {
+            FormTypeInfo info;
+            info.id = intValue(item, "id");
+            const auto& attrs = attributesOf(item);
+            info.code = stringValue(attrs, "code");
+            info.name = stringValue(attrs, "name", info.code);
+            if (info.id > 0 && !info.code.empty()) {
+                formTypes[info.id] = info;
+            }
+        }
+
+        auto curriculumResponse = client->get("/Curriculum?fields[Curriculum]=name");
+        if (!curriculumResponse.success) {
+            LOG_ERROR("SubmissionIndex", "Failed to load programs: " << curriculumResponse.errorMessage);
+            return false;
+        }
+        for (const auto& item : dataArray(curriculumResponse)) {
+            int id = intValue(item, "id");
+            std::string name = stringValue(attributesOf(item), "name");
+            if (id > 0 && !name.empty()) {
+                programs[id] = name;
+            }
+        }
+        return true;
+    } catch (const std::exception& e) {
+        LOG_ERROR("SubmissionIndex", "Exception loading form types and programs: " << e.what());
+        return false;
+    }
+}
+
+bool SubmissionIndex::loadAll() {
+    std::shared_ptr<ApiClient> client;
+    int pageSize;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client = apiClient_;
+        pageSize = pageSize_;
+    }
+    if (!client) {
+        return false;
+    }
+
+    // Read everything first so a failed request leaves the old index alone
+    std::map<int, FormTypeInfo> formTypes;
+    std::map<int, std::string> programs;
+    if (!loadLookups(client, formTypes, programs)) {
+        return false;
+    }
+
+    std::vector<std::pair<int, StudentInfo>> students;
+    std::string studentNewest;
+    DeltaReader studentReader(client, "Student", kStudentFields, pageSize);
+    bool complete = studentReader.readAll([&students](const nlohmann::json& row) {
+        int id;
+        StudentInfo student;
+        if (parseStudent(row, id, student)) {
+            students.emplace_back(id, std::move(student));
+        }
+    }, studentNewest);
+
+    std::vector<std::pair<int, Submission>> submissions;
+    std::string submissionNewest;
+    DeltaReader submissionReader(client, "FormSubmission", kSubmissionFields, pageSize);
+    complete = complete && submissionReader.readAll([&submissions](const nlohmann::json& row) {
+        int id;
+        Submission submission;
+        if (parseSubmission(row, id, submission)) {
+            submissions.emplace_back(id, std::move(submission));
+        }
+    }, submissionNewest);
+    if (!complete) {
+        return false;
+    }
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> searchRecords;
+    searchRecords.reserve(students.size());
+    for (const auto& student : students) {
+        searchRecords.push_back({std::to_string(student.first), {student.second.name, student.second.email}});
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    clearLocked();
+    formTypes_ = std::move(formTypes);
+    for (const auto& formType : formTypes_) {
+        formTypeIdsByCode_[formType.second.code] = formType.first;
+    }
+    programs_ = std::move(programs);
+    for (auto& student : students) {
+        students_[student.first] = std::move(student.second);
+    }
+    studentSearch_.sync(searchRecords);
+    for (const auto& submission : submissions) {
+        applySubmissionLocked(submission.first, submission.second);
+    }
+    studentWatermark_ = studentNewest;
+    submissionWatermark_ = submissionNewest;
+    loaded_ = true;
+    lastRebuild_ = std::chrono::steady_clock::now();
+
+    LOG_INFO("SubmissionIndex", "Indexed " << submissions_.size() << " submissions for "
+             << students_.size() << " students");
+    return true;
+}
+
+bool SubmissionIndex::loadChanges() {
+    std::shared_ptr<ApiClient> client;
+    std::string studentSince, submissionSince;
+    int pageSize;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client = apiClient_;
+        studentSince = studentWatermark_;
+        submissionSince = submissionWatermark_;
+        pageSize = pageSize_;
+    }
+    if (!client) {
+        return false;
+    }
+    if (studentSince.empty() || submissionSince.empty()) {
+        // No updated_at at the last reload; only a reload can tell what changed
+        return loadAll();
+    }
+
+    size_t changedStudents = 0, changedSubmissions = 0;
+    // Rendered PDFs of anyone whose rows moved, wherever the edit or review was made
+    auto& pdfCache = PdfCache::getInstance();
+
+    DeltaReader studentReader(client, "Student", kStudentFields, pageSize);
+    bool complete = studentReader.readChanged(studentSince,
+        [this, &changedStudents, &pdfCache](const nlohmann::json& row) {
+            int id;
+            StudentInfo student;
+            if (parseStudent(row, id, student)) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    applyStudentLocked(id, student);
+                    changedStudents++;
+                }
+                pdfCache.invalidateStudent(id);
+            }
+        });
+
+    DeltaReader submissionReader(client, "FormSubmission", kSubmissionFields, pageSize);
+    complete = submissionReader.readChanged(submissionSince,
+        [this, &changedSubmissions, &pdfCache](const nlohmann::json& row) {
+            int id;
+            Submission submission;
+            if (parseSubmission(row, id, submission)) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    applySubmissionLocked(id, submission);
+                    changedSubmissions++;
+                }
+                pdfCache.invalidateSubmission(id);
+                pdfCache.invalidateStudent(submission.studentId);
+            }
+        }) && complete;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    studentWatermark_ = std::max(studentWatermark_, studentSince);
+    submissionWatermark_ = std::max(submissionWatermark_, submissionSince);
+
+    if (changedStudents > 0 || changedSubmissions > 0) {
+        LOG_DEBUG("SubmissionIndex", "Applied " << changedSubmissions << " changed submissions and "
+                  << changedStudents << " changed students");
+    }
+    return complete;
+}
+
+bool SubmissionIndex::parseSubmission(const nlohmann::json& row, int& id, Submission& submission) {
+    id = intValue(row, "id");
+    if (id <= 0) {
+        return false;
+    }
+    const auto& attrs = attributesOf(row);
+    submission.studentId = intValue(attrs, "student_id");
+    submission.formTypeId = intValue(attrs, "form_type_id");
+    submission.status = stringValue(attrs, "status", "pending");
+    submission.submittedAt = stringValue(attrs, "submitted_at");
+    submission.reviewedAt = stringValue(attrs, "approved_at");
+    submission.reviewedBy = stringValue(attrs, "approved_by");
+    return true;
+}
+
+bool SubmissionIndex::parseStudent(const nlohmann::json& row, int& id, StudentInfo& student) {
+    id = intValue(row, "id");
+    if (id <= 0) {
+        return false;
+    }
+    const auto& attrs = attributesOf(row);
+    student.name = stringValue(attrs, "first_name") + " " + stringValue(attrs, "last_name");
+    student.email = stringValue(attrs, "email");
+    student.sortKey = TextSearchIndex::fold(student.name);
+    student.curriculumId = intValue(attrs, "curriculum_id");
+    return true;
+}
+
+// =============================================================================
+// Local Writes
+// =============================================================================
+
+void SubmissionIndex::applySubmission(const nlohmann::json& row) {
+    int id;
+    Submission submission;
+    if (!parseSubmission(row, id, submission)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    applySubmissionLocked(id, submission);
+}
+
+void SubmissionIndex::applyStudent(const nlohmann::json& row) {
+    int id;
+    StudentInfo student;
+    if (!parseStudent(row, id, student)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    applyStudentLocked(id, student);
+}
+
+bool SubmissionIndex::updateStatus(int submissionId, const std::string& status,
+                                   const std::string& reviewedAt, const std::string& reviewedBy) {
+    int studentId;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = submissions_.find(submissionId);
+        if (it == submissions_.end()) {
+            return false;
+        }
+
+        // The watermark is left alone; the next delta re-reads this row harmlessly
+        Submission submission = it->second;
+        submission.status = status;
+        submission.reviewedAt = reviewedAt;
+        submission.reviewedBy = reviewedBy;
+        applySubmissionLocked(submissionId, submission);
+        studentId = submission.studentId;
+    }
+
+    // Approved and rejected forms are rendered again on the next preview
+    PdfCache::getInstance().invalidateSubmission(submissionId);
+    PdfCache::getInstance().invalidateStudent(studentId);
+    return true;
+}
+
+void SubmissionIndex::applySubmissionLocked(int id, const Submission& submission) {
+    auto it = submissions_.find(id);
+    if (it != submissions_.end()) {
+        indexSubmission(id, it->second, false);
+        it->second = submission;
+    } else {
+        submissions_.emplace(id, submission);
+    }
+    indexSubmission(id, submission, true);
+}
+
+void SubmissionIndex::applyStudentLocked(int id, const StudentInfo& student) {
+    students_[id] = student;
+    studentSearch_.upsert(std::to_string(id), {student.name, student.email});
+}
+
+void SubmissionIndex::indexSubmission(int id, const Submission& submission, bool add) {
+    indexId(byStatus_, submission.status, id, add);
+    indexId(byFormType_, submission.formTypeId, id, add);
+    indexId(byStudent_, submission.studentId, id, add);
+    if (submission.submittedAt.size() >= 10) {
+        indexId(byDay_, submission.submittedAt.substr(0, 10), id, add);
+    }
+}
+
+void SubmissionIndex::clearLocked() {
+    submissions_.clear();
+    students_.clear();
+    formTypes_.clear();
+    formTypeIdsByCode_.clear();
+    programs_.clear();
+    byStatus_.clear();
+    byFormType_.clear();
+    byDay_.clear();
+    byStudent_.clear();
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+std::vector<SubmissionView> SubmissionIndex::query(const SubmissionFilter& filter) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Each indexed filter contributes its posting set; the smallest drives the scan
+    std::vector<const std::set<int>*> postings;
+    static const std::set<int> kNone;
+
+    if (!filter.status.empty()) {
+        auto it = byStatus_.find(filter.status);
+        postings.push_back(it != byStatus_.end() ? &it->second : &kNone);
+    }
+
+    int formTypeId = -1;
+    if (!filter.formType.empty()) {
+        auto code = formTypeIdsByCode_.find(filter.formType);
+        formTypeId = code != formTypeIdsByCode_.end() ? code->second : 0;
+        auto it = byFormType_.find(formTypeId);
+        postings.push_back(it != byFormType_.end() ? &it->second : &kNone);
+    }
+
+    if (!filter.submittedOn.empty()) {
+        auto it = byDay_.find(filter.submittedOn);
+        postings.push_back(it != byDay_.end() ? &it->second : &kNone);
+    }
+
+    std::set<int> searchHits;
+    bool searching = filter.search.find_first_not_of(" \t") != std::string::npos;
+    if (searching) {
+        for (const auto& match : studentSearch_.search(filter.search)) {
+            auto it = byStudent_.find(std::stoi(match.id));
+            if (it != byStudent_.end()) {
+                searchHits.insert(it->second.begin(), it->second.end());
+            }
+        }
+        postings.push_back(&searchHits);
+    }
+
+    auto matches = [&](int id, const Submission& submission) {
+        for (const auto* posting : postings) {
+            if (posting->count(id) == 0) {
+                return false;
+            }
+        }
+        if (filter.curriculumId > 0) {
+            auto student = students_.find(submission.studentId);
+            if (student == students_.end() || student->second.curriculumId != filter.curriculumId) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<std::pair<int, const Submission*>> found;
+    if (postings.empty()) {
+        found.reserve(submissions_.size());
+        for (const auto& entry : submissions_) {
+            if (matches(entry.first, entry.second)) {
+                found.emplace_back(entry.first, &entry.second);
+            }
+        }
+    } else {
+        const auto* smallest = *std::min_element(postings.begin(), postings.end(),
+            [](const std::set<int>* a, const std::set<int>* b) { return a->size() < b->size(); });
+        for (int id : *smallest) {
+            auto it = submissions_.find(id);
+            if (it != submissions_.end() && matches(id, it->second)) {
+                found.emplace_back(id, &it->second);
+            }
+        }
+    }
+
+    // Student name, then student (keeps each student's forms together), then id
+    static const std::string kNoName;
+    auto sortKey = [this](const Submission& submission) -> const std::string& {
+        auto it = students_.find(submission.studentId);
+        return it != students_.end() ? it->second.sortKey : kNoName;
+    };
+    std::sort(found.begin(), found.end(), [&sortKey](const auto& a, const auto& b) {
+        return std::forward_as_tuple(sortKey(*a.second), a.second->studentId, a.first) <
+               std::forward_as_tuple(sortKey(*b.second), b.second->studentId, b.first);
+    });
+
+    std::vector<SubmissionView> views;
+    views.reserve(found.size());
+    for (const auto& entry : found) {
+        views.push_back(viewLocked(entry.first, *entry.second));
+    }
+    return views;
+}
+
+bool SubmissionIndex::getSubmission(int submissionId, SubmissionView& view) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = submissions_.find(submissionId);
+    if (it == submissions_.end()) {
+        return false;
+    }
+    view = viewLocked(submissionId, it->second);
+    return true;
+}
+
+SubmissionView SubmissionIndex::viewLocked(int id, const Submission& submission) const {
+    SubmissionView view;
+    view.id = id;
+    view.studentId = submission.studentId;
+    view.formTypeId = submission.formTypeId;
+    view.status = submission.status;
+    view.submittedAt = submission.submittedAt;
+    view.reviewedAt = submission.reviewedAt;
+    view.reviewedBy = submission.reviewedBy;
+
+    auto student = students_.find(submission.studentId);
+    if (student != students_.end()) {
+        view.studentName = student->second.name;
+        view.studentEmail = student->second.email;
+        view.curriculumId = student->second.curriculumId;
+        auto program = programs_.find(view.curriculumId);
+        if (program != programs_.end()) {
+            view.programName = program->second;
+        }
+    } else {
+        view.studentName = "Student #" + std::to_string(submission.studentId);
+    }
+
+    auto formType = formTypes_.find(submission.formTypeId);
+    if (formType != formTypes_.end()) {
+        view.formType = formType->second.code;
+        view.formName = formType->second.name;
+    } else {
+        view.formType = "unknown";
+        view.formName = defaultFormName(view.formType);
+    }
+    return view;
+}
+
+std::map<std::string, int> SubmissionIndex::countByStatus() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, int> counts;
+    for (const auto& entry : byStatus_) {
+        counts[entry.first] = static_cast<int>(entry.second.size());
+    }
+    return counts;
+}
+
+int SubmissionIndex::countSubmittedOn(const std::string& date) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = byDay_.find(date);
+    return it != byDay_.end() ? static_cast<int>(it->second.size()) : 0;
+}
+
+size_t SubmissionIndex::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return submissions_.size();
+}
+
+std::vector<FormTypeInfo> SubmissionIndex::getFormTypes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<FormTypeInfo> formTypes;
+    for (const auto& entry : formTypeIdsByCode_) {
+        formTypes.push_back(formTypes_.at(entry.second));
+    }
+    return formTypes;
+}
+
+std::vector<std::pair<int, std::string>> SubmissionIndex::getPrograms() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::vector<std::pair<int, std::string>>(programs_.begin(), programs_.end());
+}
+
+std::string SubmissionIndex::getWatermark() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return submissionWatermark_;
+}
+
+void SubmissionIndex::reset() {
+    stop();
+
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_.reset();
+    refreshIntervalSeconds_ = 30;
+    rebuildIntervalSeconds_ = 3600;
+    pageSize_ = 500;
+    clearLocked();
+    studentSearch_.clear();
+    studentWatermark_.clear();
+    submissionWatermark_.clear();
+    loaded_ = false;
+}
+
+std::string SubmissionIndex::defaultFormName(const std::string& code) {
+    if (code == "personal_info") return "Personal Information";
+    if (code == "emergency_contact") return "Emergency Contacts";
+    if (code == "medical_info") return "Medical Information";
+    if (code == "academic_history") return "Academic History";
+    if (code == "financial_aid") return "Financial Aid";
+    if (code == "documents") return "Document Upload";
+    if (code == "consent") return "Terms and Consent";
+    return code;
+}
+
+} // namespace Api
+} // namespace StudentIntake
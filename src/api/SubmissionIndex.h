@@ -0,0 +1,198 @@
+#ifndef SUBMISSION_INDEX_H
+#define SUBMISSION_INDEX_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <nlohmann/json.hpp>
+#include "ApiClient.h"
+#include "TextSearchIndex.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief A form submission joined with its student, program and form type
+ */
+struct SubmissionView {
+    int id = 0;
+    int studentId = 0;
+    std::string studentName;
+    std::string studentEmail;
+    int formTypeId = 0;
+    std::string formType;       // form type code, "unknown" if not loaded
+    std::string formName;
+    std::string status;         // pending, approved, rejected, needs_revision
+    std::string submittedAt;
+    std::string reviewedAt;
+    std::string reviewedBy;
+    int curriculumId = 0;
+    std::string programName;
+};
+
+/**
+ * @brief Review queue filter; empty fields do not filter
+ */
+struct SubmissionFilter {
+    std::string status;
+    std::string formType;       // form type code
+    int curriculumId = 0;
+    std::string submittedOn;    // YYYY-MM-DD
+    std::string search;         // student name or email
+};
+
+struct FormTypeInfo {
+    int id = 0;
+    std::string code;
+    std::string name;
+};
+
+/**
+ * @brief Process-wide review queue index over form submissions
+ *
+ * Holds every submission with its student and form type keys, plus the
+ * student, program and form type names they join to. Submissions are
+ * indexed by status, form type, submission date and student, and students
+ * by name and email in a TextSearchIndex, so query() narrows to the
+ * smallest matching posting set and never calls the backend.
+ *
+ * refresh() reads only students and submissions whose updated_at moved
+ * (see DeltaReader); a full reload runs on first use and periodically to
+ * pick up deletions, form type and program changes. Reviews made in this
+ * process are applied at once with updateStatus(). Thread-safe singleton
+ * shared by all admin sessions.
+ */
+class SubmissionIndex {
+public:
+    // Singleton access
+    static SubmissionIndex& getInstance();
+
+    // Prevent copying
+    SubmissionIndex(const SubmissionIndex&) = delete;
+    SubmissionIndex& operator=(const SubmissionIndex&) = delete;
+
+    // Configuration
+    void setApiClient(std::shared_ptr<ApiClient> client);
+    bool hasApiClient() const;
+    void setRefreshInterval(int seconds);
+    void setRebuildInterval(int seconds);
+    void setPageSize(int rows);
+
+    // Background refresh lifecycle
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    /**
+     * @brief Apply changed rows (or reload everything if due)
+     * @return false if the backend could not be read
+     */
+    bool refresh();
+    bool rebuild();
+    bool isLoaded() const;
+
+    // Matching submissions sorted by student name, then submission id
+    std::vector<SubmissionView> query(const SubmissionFilter& filter) const;
+    bool getSubmission(int submissionId, SubmissionView& view) const;
+
+    std::map<std::string, int> countByStatus() const;
+    int countSubmittedOn(const std::string& date) const;
+    size_t size() const;
+
+    std::vector<FormTypeInfo> getFormTypes() const;
+    std::vector<std::pair<int, std::string>> getPrograms() const;   // (curriculum id, name)
+
+    // Local writes: a JSON:API FormSubmission or Student resource, or a review decision
+    void applySubmission(const nlohmann::json& row);
+    void applyStudent(const nlohmann::json& row);
+    bool updateStatus(int submissionId, const std::string& status,
+                      const std::string& reviewedAt, const std::string& reviewedBy);
+
+    // Newest updated_at applied for submissions
+    std::string getWatermark() const;
+
+    // Drop all data and configuration (used by tests)
+    void reset();
+
+    // Display name for a form type code when the form type table has none
+    static std::string defaultFormName(const std::string& code);
+
+private:
+    SubmissionIndex();
+    ~SubmissionIndex();
+
+    struct Submission {
+        int studentId = 0;
+        int formTypeId = 0;
+        std::string status;
+        std::string submittedAt;
+        std::string reviewedAt;
+        std::string reviewedBy;
+    };
+
+    struct StudentInfo {
+        std::string name;
+        std::string email;
+        std::string sortKey;    // lowercase name
+        int curriculumId = 0;
+    };
+
+    static bool parseSubmission(const nlohmann::json& row, int& id, Submission& submission);
+    static bool parseStudent(const nlohmann::json& row, int& id, StudentInfo& student);
+    bool loadLookups(const std::shared_ptr<ApiClient>& client,
+                     std::map<int, FormTypeInfo>& formTypes, std::map<int, std::string>& programs) const;
+    void refresherLoop();
+
+    // Callers hold refreshMutex_
+    bool loadAll();
+    bool loadChanges();
+
+    // Callers hold mutex_
+    void applySubmissionLocked(int id, const Submission& submission);
+    void applyStudentLocked(int id, const StudentInfo& student);
+    void indexSubmission(int id, const Submission& submission, bool add);
+    SubmissionView viewLocked(int id, const Submission& submission) const;
+    void clearLocked();
+
+    std::shared_ptr<ApiClient> apiClient_;
+    int refreshIntervalSeconds_;
+    int rebuildIntervalSeconds_;
+    int pageSize_;
+
+    std::unordered_map<int, Submission> submissions_;
+    std::unordered_map<int, StudentInfo> students_;
+    std::map<int, FormTypeInfo> formTypes_;
+    std::map<std::string, int> formTypeIdsByCode_;
+    std::map<int, std::string> programs_;
+
+    // Secondary indexes: key -> submission ids
+    std::map<std::string, std::set<int>> byStatus_;
+    std::map<int, std::set<int>> byFormType_;
+    std::map<std::string, std::set<int>> byDay_;
+    std::map<int, std::set<int>> byStudent_;
+    TextSearchIndex studentSearch_;
+
+    std::string submissionWatermark_;
+    std::string studentWatermark_;
+    bool loaded_;
+    std::chrono::steady_clock::time_point lastRebuild_;
+
+    bool running_;
+    bool stopRequested_;
+    std::thread refresher_;
+    std::condition_variable wakeRefresher_;
+    std::mutex refreshMutex_;                       // one refresh or rebuild at a time
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // SUBMISSION_INDEX_H
@@ -0,0 +1,517 @@
+#include "TextSearchIndex.h"
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <unordered_set>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+// Gram kind in the top byte, field index in the next; the rest is text
+constexpr uint64_t kWordPrefix = 1ull << 56;
+constexpr uint64_t kFieldPrefix = 2ull << 56;
+constexpr uint64_t kTrigram = 3ull << 56;
+constexpr uint64_t kWholeField = 4ull << 56;
+
+// Prefix grams cover the first one to three bytes
+constexpr size_t kMaxPrefix = 3;
+
+bool isWordByte(char c) {
+    auto byte = static_cast<unsigned char>(c);
+    return byte >= 0x80 || std::isalnum(byte);
+}
+
+bool isWordStart(const std::string& text, size_t pos) {
+    return isWordByte(text[pos]) && (pos == 0 || !isWordByte(text[pos - 1]));
+}
+
+uint64_t pack(const std::string& text, size_t pos, size_t len) {
+    uint64_t bytes = 0;
+    for (size_t i = 0; i < len; ++i) {
+        bytes = bytes << 8 | static_cast<unsigned char>(text[pos + i]);
+    }
+    return bytes;
+}
+
+uint64_t fieldBits(size_t field) {
+    return static_cast<uint64_t>(std::min<size_t>(field, 0xFF)) << 48;
+}
+
+uint64_t prefixGram(uint64_t kind, size_t field, const std::string& text, size_t pos, size_t len) {
+    return kind | fieldBits(field) | static_cast<uint64_t>(len) << 40 | pack(text, pos, len);
+}
+
+uint64_t trigramGram(size_t field, const std::string& text, size_t pos) {
+    return kTrigram | fieldBits(field) | pack(text, pos, 3);
+}
+
+uint64_t wholeFieldGram(size_t field, const std::string& text) {
+    return kWholeField | fieldBits(field) | (std::hash<std::string>()(text) & 0xFFFFFFFFFFFFull);
+}
+
+int fieldPenalty(size_t field) {
+    return 5 * static_cast<int>(field);
+}
+
+} // namespace
+
+// =============================================================================
+// TextSearchIndex
+// =============================================================================
+
+TextSearchIndex::TextSearchIndex()
+    : fieldCount_(0) {
+}
+
+std::string TextSearchIndex::fold(const std::string& text) {
+    std::string folded = text;
+    std::transform(folded.begin(), folded.end(), folded.begin(), [](char c) {
+        auto byte = static_cast<unsigned char>(c);
+        return byte < 0x80 ? static_cast<char>(std::tolower(byte)) : c;
+    });
+    return folded;
+}
+
+bool TextSearchIndex::upsert(const std::string& id, const std::vector<std::string>& fields) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    return upsertLocked(id, fields);
+}
+
+bool TextSearchIndex::remove(const std::string& id) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    return removeLocked(id);
+}
+
+size_t TextSearchIndex::sync(const std::vector<std::pair<std::string, std::vector<std::string>>>& records) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    size_t changed = 0;
+    std::unordered_set<std::string> present;
+    for (const auto& record : records) {
+        present.insert(record.first);
+        if (upsertLocked(record.first, record.second)) {
+            changed++;
+        }
+    }
+
+    std::vector<std::string> stale;
+    for (const auto& pair : slots_) {
+        if (present.count(pair.first) == 0) {
+            stale.push_back(pair.first);
+        }
+    }
+    for (const auto& id : stale) {
+        removeLocked(id);
+        changed++;
+    }
+    return changed;
+}
+
+bool TextSearchIndex::upsertLocked(const std::string& id, const std::vector<std::string>& fields) {
+    fieldCount_ = std::max(fieldCount_, fields.size());
+
+    std::vector<std::string> folded;
+    folded.reserve(fields.size());
+    for (const auto& field : fields) {
+        folded.push_back(fold(field));
+    }
+
+    auto existing = slots_.find(id);
+    if (existing != slots_.end()) {
+        Record& record = records_[existing->second];
+        if (record.fields == folded) {
+            return false;
+        }
+        auto oldGrams = gramsFor(record.fields);
+        record.fields = std::move(folded);
+        updatePostings(existing->second, oldGrams, gramsFor(record.fields));
+        return true;
+    }
+
+    uint32_t slot;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(records_.size());
+        records_.emplace_back();
+    }
+
+    records_[slot] = Record{id, std::move(folded)};
+    slots_[id] = slot;
+    updatePostings(slot, {}, gramsFor(records_[slot].fields));
+    return true;
+}
+
+bool TextSearchIndex::removeLocked(const std::string& id) {
+    auto it = slots_.find(id);
+    if (it == slots_.end()) {
+        return false;
+    }
+
+    uint32_t slot = it->second;
+    updatePostings(slot, gramsFor(records_[slot].fields), {});
+    records_[slot] = Record();
+    freeSlots_.push_back(slot);
+    slots_.erase(it);
+    return true;
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+std::vector<TextSearchIndex::Match> TextSearchIndex::search(const std::string& query, size_t limit) const {
+    std::vector<std::string> terms;
+    std::istringstream stream(fold(query));
+    std::string term;
+    while (stream >> term) {
+        if (std::find(terms.begin(), terms.end(), term) == terms.end()) {
+            terms.push_back(term);
+        }
+    }
+    if (terms.empty()) {
+        return {};
+    }
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return terms.size() == 1 ? searchTerm(terms.front(), limit) : searchAll(terms, limit);
+}
+
+std::vector<TextSearchIndex::Match> TextSearchIndex::searchTerm(const std::string& term, size_t limit) const {
+    // Per field, the records holding every trigram of the term. Prefix
+    // tiers of a long term are keyed on its first three bytes only, so
+    // their records are checked against these lists as well.
+    std::vector<Postings> substringMatches(fieldCount_);
+    bool longTerm = term.size() > kMaxPrefix;
+    if (term.size() >= 3) {
+        bool any = false;
+        for (size_t field = 0; field < fieldCount_; ++field) {
+            substringMatches[field] = fieldCandidates(term, field);
+            any = any || !substringMatches[field].empty();
+        }
+        if (!any) {
+            return {};
+        }
+    }
+
+    // Tiers in descending order of the best score a record in them can have
+    struct Tier {
+        const Postings* slots;
+        size_t field;
+        int bound;
+    };
+    size_t prefixLength = std::min(term.size(), kMaxPrefix);
+    std::vector<Tier> tiers;
+    for (size_t field = 0; field < fieldCount_; ++field) {
+        tiers.push_back({find(wholeFieldGram(field, term)), field, 100 - fieldPenalty(field)});
+    }
+    for (size_t field = 0; field < fieldCount_; ++field) {
+        tiers.push_back({find(prefixGram(kFieldPrefix, field, term, 0, prefixLength)), field,
+                         60 - fieldPenalty(field)});
+    }
+    for (size_t field = 0; field < fieldCount_; ++field) {
+        tiers.push_back({find(prefixGram(kWordPrefix, field, term, 0, prefixLength)), field,
+                         40 - fieldPenalty(field)});
+    }
+    for (size_t field = 0; field < fieldCount_ && term.size() >= 3; ++field) {
+        tiers.push_back({&substringMatches[field], field, 20 - fieldPenalty(field)});
+    }
+
+    std::vector<Match> matches;
+    std::map<int, size_t> scoreCounts;
+    std::unordered_set<uint32_t> seen;
+
+    auto enoughAtOrAbove = [&](int bound) {
+        if (limit == 0) {
+            return false;
+        }
+        size_t count = 0;
+        for (auto it = scoreCounts.rbegin(); it != scoreCounts.rend() && it->first >= bound; ++it) {
+            count += it->second;
+        }
+        return count >= limit;
+    };
+
+    for (const auto& tier : tiers) {
+        if (!tier.slots || tier.slots->empty()) {
+            continue;
+        }
+        // Nothing in this or a later tier can outrank what we already have
+        if (enoughAtOrAbove(tier.bound)) {
+            break;
+        }
+
+        const Postings& inField = substringMatches[tier.field];
+        for (uint32_t slot : *tier.slots) {
+            if (longTerm && !std::binary_search(inField.begin(), inField.end(), slot)) {
+                continue;
+            }
+            if (!seen.insert(slot).second) {
+                continue;
+            }
+            int score = scoreTerm(records_[slot], term);
+            if (score > 0) {
+                matches.push_back({records_[slot].id, score});
+                if (++scoreCounts[score] && enoughAtOrAbove(tier.bound)) {
+                    break;
+                }
+            }
+        }
+    }
+
+    std::stable_sort(matches.begin(), matches.end(),
+                     [](const Match& a, const Match& b) { return a.score > b.score; });
+    if (limit > 0 && matches.size() > limit) {
+        matches.resize(limit);
+    }
+    return matches;
+}
+
+std::vector<TextSearchIndex::Match> TextSearchIndex::searchAll(const std::vector<std::string>& terms,
+                                                               size_t limit) const {
+    // Most selective term first, then narrow by the others
+    std::vector<Postings> sets;
+    for (const auto& term : terms) {
+        sets.push_back(candidatesFor(term));
+        if (sets.back().empty()) {
+            return {};
+        }
+    }
+    std::sort(sets.begin(), sets.end(), [](const Postings& a, const Postings& b) { return a.size() < b.size(); });
+
+    Postings candidates = sets.front();
+    Postings narrowed;
+    for (size_t i = 1; i < sets.size() && !candidates.empty(); ++i) {
+        narrowed.clear();
+        std::set_intersection(candidates.begin(), candidates.end(), sets[i].begin(), sets[i].end(),
+                              std::back_inserter(narrowed));
+        candidates.swap(narrowed);
+    }
+
+    std::vector<Match> matches;
+    for (uint32_t slot : candidates) {
+        int total = 0;
+        for (const auto& term : terms) {
+            int score = scoreTerm(records_[slot], term);
+            if (score == 0) {
+                total = 0;
+                break;
+            }
+            total += score;
+        }
+        if (total > 0) {
+            matches.push_back({records_[slot].id, total});
+        }
+    }
+
+    std::stable_sort(matches.begin(), matches.end(),
+                     [](const Match& a, const Match& b) { return a.score > b.score; });
+    if (limit > 0 && matches.size() > limit) {
+        matches.resize(limit);
+    }
+    return matches;
+}
+
+TextSearchIndex::Postings TextSearchIndex::fieldCandidates(const std::string& term, size_t field) const {
+    std::vector<const Postings*> lists;
+    for (size_t pos = 0; pos + 2 < term.size(); ++pos) {
+        const Postings* list = find(trigramGram(field, term, pos));
+        if (!list) {
+            return {};
+        }
+        lists.push_back(list);
+    }
+    std::sort(lists.begin(), lists.end(), [](const Postings* a, const Postings* b) { return a->size() < b->size(); });
+    lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+    Postings candidates = *lists.front();
+    Postings narrowed;
+    for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i) {
+        narrowed.clear();
+        std::set_intersection(candidates.begin(), candidates.end(), lists[i]->begin(), lists[i]->end(),
+                              std::back_inserter(narrowed));
+        candidates.swap(narrowed);
+    }
+    return candidates;
+}
+
+TextSearchIndex::Postings TextSearchIndex::candidatesFor(const std::string& term) const {
+    // Long terms match anywhere in one field; short ones at a word or field start
+    std::vector<const Postings*> lists;
+    std::vector<Postings> fieldMatches;
+    for (size_t field = 0; field < fieldCount_; ++field) {
+        if (term.size() >= 3) {
+            fieldMatches.push_back(fieldCandidates(term, field));
+            continue;
+        }
+        for (uint64_t kind : {kWordPrefix, kFieldPrefix}) {
+            if (const Postings* list = find(prefixGram(kind, field, term, 0, term.size()))) {
+                lists.push_back(list);
+            }
+        }
+    }
+    for (const auto& matches : fieldMatches) {
+        lists.push_back(&matches);
+    }
+
+    Postings candidates;
+    Postings merged;
+    for (const Postings* list : lists) {
+        merged.clear();
+        std::set_union(candidates.begin(), candidates.end(), list->begin(), list->end(),
+                       std::back_inserter(merged));
+        candidates.swap(merged);
+    }
+    return candidates;
+}
+
+const TextSearchIndex::Postings* TextSearchIndex::find(uint64_t gram) const {
+    auto it = postings_.find(gram);
+    return it == postings_.end() ? nullptr : &it->second;
+}
+
+int TextSearchIndex::scoreTerm(const Record& record, const std::string& term) {
+    int best = 0;
+    for (size_t i = 0; i < record.fields.size(); ++i) {
+        const std::string& field = record.fields[i];
+        int score = 0;
+        if (field == term) {
+            score = 100;
+        } else if (field.compare(0, term.size(), term) == 0) {
+            score = 60;
+        } else {
+            for (size_t pos = field.find(term); pos != std::string::npos; pos = field.find(term, pos + 1)) {
+                if (isWordStart(field, pos)) {
+                    score = 40;
+                    break;
+                }
+                if (term.size() >= 3) {
+                    score = 20;
+                }
+            }
+        }
+
+        // Earlier fields (name before email before description) rank higher
+        if (score > 0) {
+            best = std::max(best, std::max(1, score - fieldPenalty(i)));
+        }
+    }
+    return best;
+}
+
+bool TextSearchIndex::contains(const std::string& id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return slots_.count(id) > 0;
+}
+
+size_t TextSearchIndex::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return slots_.size();
+}
+
+void TextSearchIndex::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    records_.clear();
+    freeSlots_.clear();
+    slots_.clear();
+    postings_.clear();
+    fieldCount_ = 0;
+}
+
+// =============================================================================
+// Grams and Postings
+// =============================================================================
+
+std::vector<uint64_t> TextSearchIndex::gramsFor(const std::vector<std::string>& fields) {
+    std::vector<uint64_t> grams;
+    for (size_t field = 0; field < fields.size(); ++field) {
+        const std::string& text = fields[field];
+        if (text.empty()) {
+            continue;
+        }
+
+        grams.push_back(wholeFieldGram(field, text));
+        for (size_t len = 1; len <= std::min(text.size(), kMaxPrefix); ++len) {
+            grams.push_back(prefixGram(kFieldPrefix, field, text, 0, len));
+        }
+        for (size_t pos = 0; pos < text.size(); ++pos) {
+            if (isWordStart(text, pos)) {
+                for (size_t len = 1; len <= std::min(text.size() - pos, kMaxPrefix); ++len) {
+                    grams.push_back(prefixGram(kWordPrefix, field, text, pos, len));
+                }
+            }
+            if (pos + 2 < text.size()) {
+                grams.push_back(trigramGram(field, text, pos));
+            }
+        }
+    }
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+void TextSearchIndex::updatePostings(uint32_t slot, const std::vector<uint64_t>& oldGrams,
+                                     const std::vector<uint64_t>& newGrams) {
+    // Only grams that actually changed touch their (possibly long) lists
+    std::vector<uint64_t> removed;
+    std::vector<uint64_t> added;
+    std::set_difference(oldGrams.begin(), oldGrams.end(), newGrams.begin(), newGrams.end(),
+                        std::back_inserter(removed));
+    std::set_difference(newGrams.begin(), newGrams.end(), oldGrams.begin(), oldGrams.end(),
+                        std::back_inserter(added));
+
+    for (uint64_t gram : removed) {
+        auto it = postings_.find(gram);
+        if (it == postings_.end()) {
+            continue;
+        }
+        auto& list = it->second;
+        auto pos = std::lower_bound(list.begin(), list.end(), slot);
+        if (pos != list.end() && *pos == slot) {
+            list.erase(pos);
+        }
+        if (list.empty()) {
+            postings_.erase(it);
+        }
+    }
+
+    for (uint64_t gram : added) {
+        auto& list = postings_[gram];
+        if (list.empty() || list.back() < slot) {
+            list.push_back(slot);
+        } else {
+            list.insert(std::lower_bound(list.begin(), list.end(), slot), slot);
+        }
+    }
+}
+
+// =============================================================================
+// SearchIndexRegistry
+// =============================================================================
+
+SearchIndexRegistry& SearchIndexRegistry::getInstance() {
+    static SearchIndexRegistry instance;
+    return instance;
+}
+
+std::shared_ptr<TextSearchIndex> SearchIndexRegistry::getIndex(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& index = indexes_[name];
+    if (!index) {
+        index = std::make_shared<TextSearchIndex>();
+    }
+    return index;
+}
+
+void SearchIndexRegistry::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    indexes_.clear();
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,139 @@
+#ifndef TEXT_SEARCH_INDEX_H
+#define TEXT_SEARCH_INDEX_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+#include <cstdint>
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Case-folded n-gram index over a few text fields per record
+ *
+ * Each record is an id plus an ordered list of fields (e.g. name, email,
+ * description); earlier fields rank higher. Fields are lowercased once when
+ * the record is indexed. Posting lists of record slots are kept for every
+ * trigram, for the first one to three letters of every word and of every
+ * field, and for every whole field value.
+ *
+ * A query is split on whitespace and every term must match. Terms of three
+ * or more characters match anywhere in a field; shorter terms match the
+ * start of a word. Results are ranked whole field, field prefix, word
+ * prefix, then substring, with earlier fields first; ties keep index order.
+ * A single-term search with a limit walks those tiers best-first and stops
+ * once the remaining tiers cannot beat what it already has, so broad terms
+ * cost about as much as narrow ones.
+ *
+ * Records are added, changed and removed incrementally, touching only the
+ * postings whose grams changed; sync() applies a freshly loaded list. Reads
+ * share a lock, so one index can serve every admin session.
+ */
+class TextSearchIndex {
+public:
+    struct Match {
+        std::string id;
+        int score;
+    };
+
+    TextSearchIndex();
+
+    // Prevent copying
+    TextSearchIndex(const TextSearchIndex&) = delete;
+    TextSearchIndex& operator=(const TextSearchIndex&) = delete;
+
+    /**
+     * @brief Add or replace a record
+     * @return false if the record was already indexed with the same text
+     */
+    bool upsert(const std::string& id, const std::vector<std::string>& fields);
+
+    bool remove(const std::string& id);
+
+    /**
+     * @brief Make the index hold exactly these records
+     * @return Number of records added, changed or removed
+     */
+    size_t sync(const std::vector<std::pair<std::string, std::vector<std::string>>>& records);
+
+    /**
+     * @brief Ranked matches, best first; limit 0 returns all of them
+     *
+     * An empty query matches nothing; callers show the unfiltered list.
+     */
+    std::vector<Match> search(const std::string& query, size_t limit = 0) const;
+
+    bool contains(const std::string& id) const;
+    size_t size() const;
+    void clear();
+
+    // Lowercase ASCII letters; other bytes (including UTF-8) are kept as-is
+    static std::string fold(const std::string& text);
+
+private:
+    using Postings = std::vector<uint32_t>;     // sorted record slots
+
+    struct Record {
+        std::string id;
+        std::vector<std::string> fields;        // folded
+    };
+
+    static std::vector<uint64_t> gramsFor(const std::vector<std::string>& fields);
+    static int scoreTerm(const Record& record, const std::string& term);
+
+    // Callers hold mutex_ (shared is enough)
+    const Postings* find(uint64_t gram) const;
+    Postings fieldCandidates(const std::string& term, size_t field) const;
+    Postings candidatesFor(const std::string& term) const;
+    std::vector<Match> searchTerm(const std::string& term, size_t limit) const;
+    std::vector<Match> searchAll(const std::vector<std::string>& terms, size_t limit) const;
+
+    // Callers hold mutex_ exclusively
+    bool upsertLocked(const std::string& id, const std::vector<std::string>& fields);
+    bool removeLocked(const std::string& id);
+    void updatePostings(uint32_t slot, const std::vector<uint64_t>& oldGrams,
+                        const std::vector<uint64_t>& newGrams);
+
+    std::vector<Record> records_;
+    std::vector<uint32_t> freeSlots_;
+    std::unordered_map<std::string, uint32_t> slots_;   // id -> slot
+    std::unordered_map<uint64_t, Postings> postings_;   // gram -> slots
+    size_t fieldCount_;                                 // most fields any record had
+    mutable std::shared_mutex mutex_;
+};
+
+/**
+ * @brief Process-wide named search indexes shared by all sessions
+ */
+class SearchIndexRegistry {
+public:
+    // Singleton access
+    static SearchIndexRegistry& getInstance();
+
+    // Prevent copying
+    SearchIndexRegistry(const SearchIndexRegistry&) = delete;
+    SearchIndexRegistry& operator=(const SearchIndexRegistry&) = delete;
+
+    // Returns the index with this name, creating an empty one on first use
+    std::shared_ptr<TextSearchIndex> getIndex(const std::string& name);
+
+    // Drop all indexes (used by tests)
+    void reset();
+
+private:
+    SearchIndexRegistry() = default;
+    ~SearchIndexRegistry() = default;
+
+    std::map<std::string, std::shared_ptr<TextSearchIndex>> indexes_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // TEXT_SEARCH_INDEX_H
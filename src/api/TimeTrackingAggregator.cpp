@@ -0,0 +1,491 @@
+#include "TimeTrackingAggregator.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+// A session nobody ended in this long was abandoned (closed tab, lost connection)
+constexpr std::chrono::hours kOpenSessionMaxAge{12};
+
+// 4xx other than timeout/throttling: the request itself was refused
+bool isRefused(int statusCode) {
+    return statusCode >= 400 && statusCode < 500 && statusCode != 408 && statusCode != 429;
+}
+
+} // namespace
+
+// Helper to get current timestamp in ISO format
+static std::string getCurrentTimestamp() {
+    auto now = std::chrono::system_clock::now();
+    auto time = std::chrono::system_clock::to_time_t(now);
+    std::ostringstream oss;
+    oss << std::put_time(std::gmtime(&time), "%Y-%m-%dT%H:%M:%SZ");
+    return oss.str();
+}
+
+TimeTrackingAggregator& TimeTrackingAggregator::getInstance() {
+    static TimeTrackingAggregator instance;
+    return instance;
+}
+
+TimeTrackingAggregator::TimeTrackingAggregator()
+    : flushIntervalSeconds_(30)
+    , batchSize_(200)
+    , nextSessionId_(1)
+    , batchEndpoint_(true)
+    , running_(false)
+    , stopRequested_(false) {
+}
+
+TimeTrackingAggregator::~TimeTrackingAggregator() {
+    // main() flushes through stop(); by static destruction the logger may be
+    // gone, so only end a flusher that was left running
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopRequested_ = true;
+    }
+    wakeFlusher_.notify_all();
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+}
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void TimeTrackingAggregator::setApiClient(std::shared_ptr<ApiClient> client) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    apiClient_ = client;
+}
+
+bool TimeTrackingAggregator::hasApiClient() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return apiClient_ != nullptr;
+}
+
+void TimeTrackingAggregator::setFlushInterval(int seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushIntervalSeconds_ = seconds > 0 ? seconds : 1;
+}
+
+int TimeTrackingAggregator::getFlushInterval() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return flushIntervalSeconds_;
+}
+
+void TimeTrackingAggregator::setBatchSize(size_t rows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batchSize_ = rows > 0 ? rows : 1;
+}
+
+size_t TimeTrackingAggregator::getBatchSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return batchSize_;
+}
+
+// =============================================================================
+// Background Flusher
+// =============================================================================
+
+void TimeTrackingAggregator::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    flusher_ = std::thread([this]() { flusherLoop(); });
+    LOG_DEBUG("TimeTracking", "Flusher started (interval " << flushIntervalSeconds_
+              << "s, batch " << batchSize_ << ")");
+}
+
+void TimeTrackingAggregator::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    wakeFlusher_.notify_all();
+
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+
+    // Final durable flush; anything still failing is reported, not dropped silently
+    flush();
+    int lostSeconds = getPendingSeconds();
+    if (lostSeconds > 0) {
+        LOG_ERROR("TimeTracking", "Shutdown with " << getPendingRowCount()
+                  << " unflushed time log rows (" << lostSeconds << "s)");
+    }
+}
+
+bool TimeTrackingAggregator::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+void TimeTrackingAggregator::flusherLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopRequested_) {
+        wakeFlusher_.wait_for(lock, std::chrono::seconds(flushIntervalSeconds_), [this]() {
+            return stopRequested_ || pending_.size() >= batchSize_;
+        });
+        if (stopRequested_) {
+            break;
+        }
+
+        lock.unlock();
+        expireOpenSessions(std::chrono::steady_clock::now());
+        flush();
+        lock.lock();
+    }
+}
+
+// =============================================================================
+// Heartbeats
+// =============================================================================
+
+TimeTrackingAggregator::BucketKey TimeTrackingAggregator::keyFor(const Models::StudentTimeLog& log) {
+    return std::make_tuple(log.getStudentId(), log.getEnrollmentId(), log.getCourseId(),
+                           log.getModuleId(), log.getContentId(),
+                           static_cast<int>(log.getActivityType()));
+}
+
+void TimeTrackingAggregator::mergeInto(Models::StudentTimeLog& target, const Models::StudentTimeLog& log) {
+    target.setDurationSeconds(target.getDurationSeconds() + log.getDurationSeconds());
+
+    // ISO-8601 timestamps order lexicographically
+    if (!log.getSessionStart().empty() &&
+        (target.getSessionStart().empty() || log.getSessionStart() < target.getSessionStart())) {
+        target.setSessionStart(log.getSessionStart());
+    }
+    if (log.getSessionEnd() > target.getSessionEnd()) {
+        target.setSessionEnd(log.getSessionEnd());
+    }
+}
+
+void TimeTrackingAggregator::mergePending(const Models::StudentTimeLog& log) {
+    auto key = keyFor(log);
+    auto it = pending_.find(key);
+    if (it == pending_.end()) {
+        Models::StudentTimeLog row = log;
+        row.setId("");
+        pending_.emplace(key, row);
+    } else {
+        mergeInto(it->second, log);
+    }
+}
+
+void TimeTrackingAggregator::record(const Models::StudentTimeLog& log) {
+    if (log.getDurationSeconds() <= 0) {
+        return;
+    }
+
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        mergePending(log);
+
+        auto courseIt = courseTotals_.find({log.getStudentId(), log.getCourseId()});
+        if (courseIt != courseTotals_.end()) {
+            courseIt->second += log.getDurationSeconds();
+        }
+        auto moduleIt = moduleTotals_.find({log.getStudentId(), log.getModuleId()});
+        if (moduleIt != moduleTotals_.end()) {
+            moduleIt->second += log.getDurationSeconds();
+        }
+
+        wake = running_ && pending_.size() >= batchSize_;
+    }
+
+    if (wake) {
+        wakeFlusher_.notify_one();
+    }
+}
+
+std::string TimeTrackingAggregator::beginSession(const Models::StudentTimeLog& log) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::string sessionId = "local-" + std::to_string(nextSessionId_++);
+    Models::StudentTimeLog session = log;
+    if (session.getSessionStart().empty()) {
+        session.setSessionStart(getCurrentTimestamp());
+    }
+    openSessions_[sessionId] = OpenSession{session, std::chrono::steady_clock::now()};
+    return sessionId;
+}
+
+bool TimeTrackingAggregator::endSession(const std::string& sessionId, int durationSeconds) {
+    Models::StudentTimeLog session;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = openSessions_.find(sessionId);
+        if (it == openSessions_.end()) {
+            return false;
+        }
+        session = it->second.log;
+        openSessions_.erase(it);
+    }
+
+    session.setSessionEnd(getCurrentTimestamp());
+    session.setDurationSeconds(durationSeconds);
+    session.setValidated(true);
+    session.setValidationMethod("automatic");
+    record(session);
+    return true;
+}
+
+size_t TimeTrackingAggregator::getOpenSessionCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return openSessions_.size();
+}
+
+size_t TimeTrackingAggregator::expireOpenSessions(std::chrono::steady_clock::time_point now) {
+    size_t expired = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = openSessions_.begin(); it != openSessions_.end();) {
+            if (now - it->second.openedAt >= kOpenSessionMaxAge) {
+                it = openSessions_.erase(it);
+                expired++;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    if (expired > 0) {
+        LOG_WARN("TimeTracking", "Dropped " << expired << " time sessions that were never ended");
+    }
+    return expired;
+}
+
+// =============================================================================
+// Seeding
+// =============================================================================
+
+TimeTrackingAggregator::SeedScope::SeedScope(TimeTrackingAggregator& aggregator, int studentId)
+    : aggregator_(aggregator)
+    , studentId_(studentId) {
+    std::unique_lock<std::mutex> lock(aggregator_.mutex_);
+    aggregator_.seedingStudents_[studentId_]++;
+
+    // Rows already being posted may or may not be in the persisted rows read next
+    aggregator_.inFlightDone_.wait(lock, [this]() {
+        for (const auto& row : aggregator_.inFlight_) {
+            if (row.getStudentId() == studentId_) return false;
+        }
+        return true;
+    });
+}
+
+TimeTrackingAggregator::SeedScope::~SeedScope() {
+    std::lock_guard<std::mutex> lock(aggregator_.mutex_);
+    auto it = aggregator_.seedingStudents_.find(studentId_);
+    if (it != aggregator_.seedingStudents_.end() && --it->second == 0) {
+        aggregator_.seedingStudents_.erase(it);
+    }
+}
+
+bool TimeTrackingAggregator::isSeeding(int studentId) const {
+    return seedingStudents_.find(studentId) != seedingStudents_.end();
+}
+
+// =============================================================================
+// Flushing
+// =============================================================================
+
+size_t TimeTrackingAggregator::postRows(const std::shared_ptr<ApiClient>& client,
+                                        const std::vector<Models::StudentTimeLog>& rows) {
+    bool useBatchEndpoint;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        useBatchEndpoint = batchEndpoint_;
+    }
+
+    if (useBatchEndpoint && rows.size() > 1) {
+        nlohmann::json payload;
+        payload["data"] = nlohmann::json::array();
+        for (const auto& row : rows) {
+            payload["data"].push_back({{"type", "StudentTimeLog"}, {"attributes", row.toJson()}});
+        }
+
+        auto response = client->post("/StudentTimeLog/batch", payload);
+        if (response.isSuccess()) {
+            return rows.size();
+        }
+        if (!isRefused(response.statusCode)) {
+            return 0;
+        }
+        if (response.statusCode == 404 || response.statusCode == 405) {
+            LOG_INFO("TimeTracking", "Backend has no /StudentTimeLog/batch; posting rows one at a time");
+            std::lock_guard<std::mutex> lock(mutex_);
+            batchEndpoint_ = false;
+        }
+        // Otherwise one row was refused; posting them singly finds it
+    }
+
+    size_t posted = 0;
+    for (const auto& row : rows) {
+        nlohmann::json payload;
+        payload["data"]["type"] = "StudentTimeLog";
+        payload["data"]["attributes"] = row.toJson();
+        if (!client->post("/StudentTimeLog", payload).isSuccess()) {
+            break;
+        }
+        posted++;
+    }
+    return posted;
+}
+
+int TimeTrackingAggregator::flush() {
+    // Serialize flushes so the flusher thread and shutdown never interleave
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+
+    std::shared_ptr<ApiClient> client;
+    size_t batchSize;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client = apiClient_;
+        batchSize = batchSize_;
+        if (!client || pending_.empty()) {
+            return 0;
+        }
+        // Rows of a student whose total is being seeded wait for the next flush
+        for (auto it = pending_.begin(); it != pending_.end();) {
+            if (isSeeding(it->second.getStudentId())) {
+                ++it;
+            } else {
+                inFlight_.push_back(std::move(it->second));
+                it = pending_.erase(it);
+            }
+        }
+    }
+
+    size_t posted = 0;
+    while (posted < inFlight_.size()) {
+        size_t count = std::min(batchSize, inFlight_.size() - posted);
+        std::vector<Models::StudentTimeLog> batch(inFlight_.begin() + static_cast<std::ptrdiff_t>(posted),
+                                                  inFlight_.begin() + static_cast<std::ptrdiff_t>(posted + count));
+        size_t handled = postRows(client, batch);
+        posted += handled;
+        if (handled < count) {
+            break;
+        }
+    }
+
+    size_t failed = inFlight_.size() - posted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = posted; i < inFlight_.size(); ++i) {
+            mergePending(inFlight_[i]);
+        }
+        inFlight_.clear();
+    }
+    inFlightDone_.notify_all();
+
+    if (failed > 0) {
+        LOG_WARN("TimeTracking", "Failed to flush " << failed
+                 << " time log rows; retrying on next flush");
+    }
+    LOG_DEBUG("TimeTracking", "Flushed " << posted << " compacted time log rows");
+
+    return static_cast<int>(posted);
+}
+
+size_t TimeTrackingAggregator::getPendingRowCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size() + inFlight_.size();
+}
+
+int TimeTrackingAggregator::getPendingSeconds() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return unflushedSeconds(-1, -1, -1);
+}
+
+// =============================================================================
+// Running Totals
+// =============================================================================
+
+int TimeTrackingAggregator::unflushedSeconds(int studentId, int courseId, int moduleId) const {
+    auto matches = [&](const Models::StudentTimeLog& log) {
+        return (studentId < 0 || log.getStudentId() == studentId) &&
+               (courseId < 0 || log.getCourseId() == courseId) &&
+               (moduleId < 0 || log.getModuleId() == moduleId);
+    };
+
+    int seconds = 0;
+    for (const auto& pair : pending_) {
+        if (matches(pair.second)) seconds += pair.second.getDurationSeconds();
+    }
+    for (const auto& log : inFlight_) {
+        if (matches(log)) seconds += log.getDurationSeconds();
+    }
+    return seconds;
+}
+
+bool TimeTrackingAggregator::hasCourseTotal(int studentId, int courseId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return courseTotals_.find({studentId, courseId}) != courseTotals_.end();
+}
+
+void TimeTrackingAggregator::seedCourseTotal(int studentId, int courseId, int persistedSeconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Persisted rows do not yet include buffered heartbeats
+    courseTotals_.emplace(TotalKey(studentId, courseId),
+                          persistedSeconds + unflushedSeconds(studentId, courseId, -1));
+}
+
+int TimeTrackingAggregator::getCourseTotal(int studentId, int courseId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = courseTotals_.find({studentId, courseId});
+    return it != courseTotals_.end() ? it->second : 0;
+}
+
+bool TimeTrackingAggregator::hasModuleTotal(int studentId, int moduleId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return moduleTotals_.find({studentId, moduleId}) != moduleTotals_.end();
+}
+
+void TimeTrackingAggregator::seedModuleTotal(int studentId, int moduleId, int persistedSeconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    moduleTotals_.emplace(TotalKey(studentId, moduleId),
+                          persistedSeconds + unflushedSeconds(studentId, -1, moduleId));
+}
+
+int TimeTrackingAggregator::getModuleTotal(int studentId, int moduleId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = moduleTotals_.find({studentId, moduleId});
+    return it != moduleTotals_.end() ? it->second : 0;
+}
+
+void TimeTrackingAggregator::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batchEndpoint_ = true;
+    pending_.clear();
+    inFlight_.clear();
+    openSessions_.clear();
+    courseTotals_.clear();
+    moduleTotals_.clear();
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,149 @@
+#ifndef TIME_TRACKING_AGGREGATOR_H
+#define TIME_TRACKING_AGGREGATOR_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <tuple>
+#include "ApiClient.h"
+#include "models/StudentProgress.h"
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Write-behind buffer for classroom time tracking
+ *
+ * Coalesces time heartbeats in memory by (student, enrollment, course,
+ * module, content, activity) and flushes the compacted StudentTimeLog rows
+ * in the background, either on a timer or when the number of pending rows
+ * reaches the batch size. Rows go out in one POST to /StudentTimeLog/batch
+ * per batch, or one at a time if the backend has no batch endpoint. Rows
+ * that fail to post are merged back into the buffer and retried on the next
+ * flush. Sessions begun but never ended are dropped after twelve hours.
+ *
+ * Running totals per (student, course) and (student, module) are kept in
+ * memory once seeded from the backend, so time getters do not re-sum log
+ * rows. A SeedScope holds back a student's rows from flushing while their
+ * persisted rows are read, so each second is counted exactly once. main()
+ * must call stop() on shutdown for the final synchronous flush; the
+ * destructor does not flush. Thread-safe singleton shared by all classroom
+ * sessions.
+ */
+class TimeTrackingAggregator {
+public:
+    // Singleton access
+    static TimeTrackingAggregator& getInstance();
+
+    // Prevent copying
+    TimeTrackingAggregator(const TimeTrackingAggregator&) = delete;
+    TimeTrackingAggregator& operator=(const TimeTrackingAggregator&) = delete;
+
+    // Configuration
+    void setApiClient(std::shared_ptr<ApiClient> client);
+    bool hasApiClient() const;
+    void setFlushInterval(int seconds);
+    int getFlushInterval() const;
+    void setBatchSize(size_t rows);
+    size_t getBatchSize() const;
+
+    // Background flusher lifecycle
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    // Heartbeats
+    void record(const Models::StudentTimeLog& log);
+    std::string beginSession(const Models::StudentTimeLog& log);
+    bool endSession(const std::string& sessionId, int durationSeconds);
+    size_t getOpenSessionCount() const;
+    size_t expireOpenSessions(std::chrono::steady_clock::time_point now);
+
+    // Flush all pending rows synchronously; returns the number posted
+    int flush();
+    size_t getPendingRowCount() const;
+    int getPendingSeconds() const;
+
+    /**
+     * @brief Keeps a student's buffered rows unposted while it is alive
+     * Create one before reading the student's persisted rows and seed the
+     * total before it goes out of scope. Waits for rows already being posted.
+     */
+    class SeedScope {
+    public:
+        SeedScope(TimeTrackingAggregator& aggregator, int studentId);
+        ~SeedScope();
+        SeedScope(const SeedScope&) = delete;
+        SeedScope& operator=(const SeedScope&) = delete;
+
+    private:
+        TimeTrackingAggregator& aggregator_;
+        int studentId_;
+    };
+
+    // Running totals (seeded from persisted logs on first use)
+    bool hasCourseTotal(int studentId, int courseId) const;
+    void seedCourseTotal(int studentId, int courseId, int persistedSeconds);
+    int getCourseTotal(int studentId, int courseId) const;
+
+    bool hasModuleTotal(int studentId, int moduleId) const;
+    void seedModuleTotal(int studentId, int moduleId, int persistedSeconds);
+    int getModuleTotal(int studentId, int moduleId) const;
+
+    // Drop all buffered state without flushing (used by tests)
+    void reset();
+
+private:
+    TimeTrackingAggregator();
+    ~TimeTrackingAggregator();
+
+    // (student, enrollment, course, module, content, activity)
+    using BucketKey = std::tuple<int, int, int, int, int, int>;
+    using TotalKey = std::pair<int, int>;
+
+    static BucketKey keyFor(const Models::StudentTimeLog& log);
+    static void mergeInto(Models::StudentTimeLog& target, const Models::StudentTimeLog& log);
+    void mergePending(const Models::StudentTimeLog& log);
+    int unflushedSeconds(int studentId, int courseId, int moduleId) const;
+    bool isSeeding(int studentId) const;
+    size_t postRows(const std::shared_ptr<ApiClient>& client,
+                    const std::vector<Models::StudentTimeLog>& rows);
+    void flusherLoop();
+
+    struct OpenSession {
+        Models::StudentTimeLog log;
+        std::chrono::steady_clock::time_point openedAt;
+    };
+
+    std::shared_ptr<ApiClient> apiClient_;
+    int flushIntervalSeconds_;
+    size_t batchSize_;
+
+    std::map<BucketKey, Models::StudentTimeLog> pending_;
+    std::vector<Models::StudentTimeLog> inFlight_;
+    std::map<std::string, OpenSession> openSessions_;
+    int nextSessionId_;
+    std::map<int, int> seedingStudents_;  // student id -> open SeedScopes
+    bool batchEndpoint_;                  // cleared once the backend answers 404/405
+
+    std::map<TotalKey, int> courseTotals_;
+    std::map<TotalKey, int> moduleTotals_;
+
+    mutable std::mutex mutex_;
+    std::mutex flushMutex_;
+    std::condition_variable wakeFlusher_;
+    std::condition_variable inFlightDone_;
+    std::thread flusher_;
+    bool running_;
+    bool stopRequested_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // TIME_TRACKING_AGGREGATOR_H
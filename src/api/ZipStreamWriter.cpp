@@ -0,0 +1,214 @@
+#include "ZipStreamWriter.h"
+#include <array>
+#include <ctime>
+
+namespace StudentIntake {
+namespace Api {
+
+namespace {
+
+const uint32_t kLocalHeaderSignature = 0x04034b50;
+const uint32_t kCentralHeaderSignature = 0x02014b50;
+const uint32_t kEndOfDirectorySignature = 0x06054b50;
+const uint32_t kZip64EndOfDirectorySignature = 0x06064b50;
+const uint32_t kZip64LocatorSignature = 0x07064b50;
+const uint16_t kVersion = 20;           // 2.0: stored entries, no extensions
+const uint16_t kZip64Version = 45;      // 4.5: ZIP64 extensions
+const uint16_t kZip64ExtraId = 0x0001;
+const uint16_t kUtf8NamesFlag = 0x0800;
+const uint16_t kMax16 = 0xFFFF;
+const uint32_t kMax32 = 0xFFFFFFFF;
+
+void put16(std::string& out, uint16_t value) {
+    out.push_back(static_cast<char>(value & 0xFF));
+    out.push_back(static_cast<char>((value >> 8) & 0xFF));
+}
+
+void put32(std::string& out, uint32_t value) {
+    put16(out, static_cast<uint16_t>(value & 0xFFFF));
+    put16(out, static_cast<uint16_t>(value >> 16));
+}
+
+void put64(std::string& out, uint64_t value) {
+    put32(out, static_cast<uint32_t>(value & kMax32));
+    put32(out, static_cast<uint32_t>(value >> 32));
+}
+
+// ZIP32 field value, or the 0xFFFFFFFF marker when the ZIP64 extra holds it
+uint32_t field32(uint64_t value) {
+    return value >= kMax32 ? kMax32 : static_cast<uint32_t>(value);
+}
+
+} // namespace
+
+ZipStreamWriter::ZipStreamWriter(Sink sink)
+    : sink_(std::move(sink))
+    , offset_(0)
+    , dosTime_(0)
+    , dosDate_(0)
+    , finished_(false)
+    , failed_(false) {
+    // Every entry carries the time the archive was started
+    std::time_t now = std::time(nullptr);
+    std::tm local = *std::localtime(&now);
+    dosTime_ = static_cast<uint16_t>((local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec / 2));
+    dosDate_ = static_cast<uint16_t>(((local.tm_year - 80) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday);
+}
+
+uint32_t ZipStreamWriter::crc32(const char* data, size_t size, uint32_t crc) {
+    static const std::array<uint32_t, 256> table = []() {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+bool ZipStreamWriter::write(const std::string& bytes) {
+    if (failed_) {
+        return false;
+    }
+    if (!sink_ || !sink_(bytes.data(), bytes.size())) {
+        failed_ = true;
+        return false;
+    }
+    offset_ += bytes.size();
+    return true;
+}
+
+bool ZipStreamWriter::addFile(const std::string& name, const std::string& data) {
+    if (finished_ || failed_ || name.empty() || name.size() > kMax16) {
+        return false;
+    }
+
+    Entry entry;
+    entry.name = name;
+    entry.crc = crc32(data.data(), data.size());
+    entry.size = data.size();
+    entry.offset = offset_;
+
+    // Sizes are known up front, so no data descriptor is needed. The local
+    // header carries no offset, so it only needs ZIP64 for a 4 GiB entry.
+    bool zip64 = entry.size >= kMax32;
+    std::string header;
+    header.reserve(30 + name.size() + 20);
+    put32(header, kLocalHeaderSignature);
+    put16(header, zip64 ? kZip64Version : kVersion);
+    put16(header, kUtf8NamesFlag);
+    put16(header, 0);                   // stored
+    put16(header, dosTime_);
+    put16(header, dosDate_);
+    put32(header, entry.crc);
+    put32(header, field32(entry.size)); // compressed size
+    put32(header, field32(entry.size)); // uncompressed size
+    put16(header, static_cast<uint16_t>(name.size()));
+    put16(header, zip64 ? 20 : 0);      // extra field length
+    header += name;
+    if (zip64) {
+        put16(header, kZip64ExtraId);
+        put16(header, 16);
+        put64(header, entry.size);
+        put64(header, entry.size);
+    }
+
+    if (!write(header) || !write(data)) {
+        return false;
+    }
+    entries_.push_back(std::move(entry));
+    return true;
+}
+
+bool ZipStreamWriter::finish() {
+    if (finished_ || failed_) {
+        return !failed_;
+    }
+
+    uint64_t directoryOffset = offset_;
+    std::string directory;
+    for (const auto& entry : entries_) {
+        // Only the values that do not fit go in the extra field, in this order
+        std::string extra;
+        if (entry.size >= kMax32) {
+            put64(extra, entry.size);
+            put64(extra, entry.size);
+        }
+        if (entry.offset >= kMax32) {
+            put64(extra, entry.offset);
+        }
+        uint16_t version = extra.empty() ? kVersion : kZip64Version;
+
+        put32(directory, kCentralHeaderSignature);
+        put16(directory, version);      // made by
+        put16(directory, version);      // needed to extract
+        put16(directory, kUtf8NamesFlag);
+        put16(directory, 0);
+        put16(directory, dosTime_);
+        put16(directory, dosDate_);
+        put32(directory, entry.crc);
+        put32(directory, field32(entry.size));
+        put32(directory, field32(entry.size));
+        put16(directory, static_cast<uint16_t>(entry.name.size()));
+        put16(directory, static_cast<uint16_t>(extra.empty() ? 0 : extra.size() + 4));
+        put16(directory, 0);            // comment length
+        put16(directory, 0);            // disk number
+        put16(directory, 0);            // internal attributes
+        put32(directory, 0);            // external attributes
+        put32(directory, field32(entry.offset));
+        directory += entry.name;
+        if (!extra.empty()) {
+            put16(directory, kZip64ExtraId);
+            put16(directory, static_cast<uint16_t>(extra.size()));
+            directory += extra;
+        }
+    }
+
+    uint64_t count = entries_.size();
+    uint64_t directorySize = directory.size();
+    bool zip64 = count >= kMax16 || directorySize >= kMax32 || directoryOffset >= kMax32;
+
+    std::string end;
+    if (zip64) {
+        uint64_t zip64EndOffset = directoryOffset + directorySize;
+        put32(end, kZip64EndOfDirectorySignature);
+        put64(end, 44);                 // size of the rest of this record
+        put16(end, kZip64Version);      // made by
+        put16(end, kZip64Version);      // needed to extract
+        put32(end, 0);                  // this disk
+        put32(end, 0);                  // disk with the directory
+        put64(end, count);
+        put64(end, count);
+        put64(end, directorySize);
+        put64(end, directoryOffset);
+
+        put32(end, kZip64LocatorSignature);
+        put32(end, 0);                  // disk with the ZIP64 end record
+        put64(end, zip64EndOffset);
+        put32(end, 1);                  // total disks
+    }
+
+    put32(end, kEndOfDirectorySignature);
+    put16(end, 0);                      // this disk
+    put16(end, 0);                      // disk with the directory
+    put16(end, static_cast<uint16_t>(count >= kMax16 ? kMax16 : count));
+    put16(end, static_cast<uint16_t>(count >= kMax16 ? kMax16 : count));
+    put32(end, field32(directorySize));
+    put32(end, field32(directoryOffset));
+    put16(end, 0);                      // comment length
+
+    finished_ = write(directory) && write(end);
+    return finished_;
+}
+
+} // namespace Api
+} // namespace StudentIntake
@@ -0,0 +1,72 @@
+#ifndef ZIP_STREAM_WRITER_H
+#define ZIP_STREAM_WRITER_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+namespace StudentIntake {
+namespace Api {
+
+/**
+ * @brief Writes a ZIP archive front to back into a byte sink
+ *
+ * Entries are written as soon as they are added and never revisited, so
+ * the archive can be sent to a client while later entries are still being
+ * produced. Only the central directory (about 60 bytes per entry) is kept
+ * until finish(). Entries are stored without deflate: the archive holds
+ * PDFs whose content streams are already compressed.
+ *
+ * Small archives are plain ZIP32. Entries that start or end past 4 GiB
+ * get ZIP64 extra fields, and an archive with more than 65535 entries or a
+ * directory past 4 GiB ends with the ZIP64 end-of-directory records, so an
+ * export never stops part-way because it grew too large. Not thread-safe.
+ */
+class ZipStreamWriter {
+public:
+    // Receives archive bytes in order; return false to abort the archive
+    using Sink = std::function<bool(const char* data, size_t size)>;
+
+    explicit ZipStreamWriter(Sink sink);
+
+    // Prevent copying
+    ZipStreamWriter(const ZipStreamWriter&) = delete;
+    ZipStreamWriter& operator=(const ZipStreamWriter&) = delete;
+
+    bool addFile(const std::string& name, const std::string& data);
+
+    // Write the central directory; no entries can be added afterwards
+    bool finish();
+
+    bool isFinished() const { return finished_; }
+    bool hasFailed() const { return failed_; }
+    size_t getEntryCount() const { return entries_.size(); }
+    uint64_t getBytesWritten() const { return offset_; }
+
+    static uint32_t crc32(const char* data, size_t size, uint32_t crc = 0);
+
+private:
+    struct Entry {
+        std::string name;
+        uint32_t crc = 0;
+        uint64_t size = 0;
+        uint64_t offset = 0;
+    };
+
+    bool write(const std::string& bytes);
+
+    Sink sink_;
+    std::vector<Entry> entries_;
+    uint64_t offset_;
+    uint16_t dosTime_;
+    uint16_t dosDate_;
+    bool finished_;
+    bool failed_;
+};
+
+} // namespace Api
+} // namespace StudentIntake
+
+#endif // ZIP_STREAM_WRITER_H
@@ -34,6 +34,29 @@ struct AppConfig {
     // Paths
     std::string configPath = "config/";
     std::string resourcesPath = "resources/";
+    std::string reportJobJournalPath = "report_jobs.journal";
+
+    // Rendered PDF cache
+    int pdfCacheMemoryMB = 64;
+    int pdfCacheDiskMB = 512;
+    std::string pdfCacheDirectory = "pdf_cache";       // must be ours and 0700; "" disables spilling
+
+    // Activity log write-behind queue
+    int activityLogBatchSize = 50;
+    int activityLogFlushIntervalMs = 1000;
+    int activityLogQueueCapacity = 10000;
+    std::string activityLogOverflowPolicy = "spill";   // block, drop-oldest or spill
+    std::string activityLogSpillPath = "activity_log.spill";
+
+    // Durable spool for audit events posted while the backend is down
+    std::string eventSpoolDirectory = "event_spool";
+    int eventSpoolSegmentKB = 4096;
+    int eventSpoolMaxMB = 64;
+    int eventSpoolReplayRate = 50;          // events per second once the backend is back
+    int eventSpoolRetryIntervalMs = 5000;
+
+    // Live tail of the activity log for open admin lists
+    int activityFeedPollIntervalMs = 15000; // writes by this server are pushed at once
 
     static AppConfig& getInstance() {
         static AppConfig instance;
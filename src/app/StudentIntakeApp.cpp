@@ -1,8 +1,11 @@
 #include "StudentIntakeApp.h"
 #include <Wt/WText.h>
 #include <Wt/WBreak.h>
+#include <Wt/WServer.h>
 #include <fstream>
 #include "utils/Logger.h"
+#include "curriculum/CurriculumRegistry.h"
+#include "api/AdminStatisticsService.h"
 
 namespace StudentIntake {
 namespace App {
@@ -38,6 +41,17 @@ StudentIntakeApp::StudentIntakeApp(const Wt::WEnvironment& env)
 }
 
 StudentIntakeApp::~StudentIntakeApp() {
+    // The Wt session is gone; don't leave the student session to the idle timeout
+    if (session_) {
+        Session::SessionManager::getInstance().removeSession(session_->getSessionId());
+    }
+}
+
+void StudentIntakeApp::notify(const Wt::WEvent& event) {
+    if (session_) {
+        session_->touch();
+    }
+    Wt::WApplication::notify(event);
 }
 
 void StudentIntakeApp::initialize() {
@@ -111,6 +125,7 @@ void StudentIntakeApp::initialize() {
 
                     LOG_DEBUG("StudentIntakeApp", "Student create payload: " << payload.dump());
                     auto createResponse = apiClient_->post("/Student", payload);
+                    Api::AdminStatisticsService::getInstance().applyStudentResponse(createResponse);
                     LOG_INFO("StudentIntakeApp", "Student create response - status: " << createResponse.statusCode
                              << ", body: " << createResponse.body.substr(0, 500));
                     if (createResponse.success) {
@@ -134,6 +149,7 @@ void StudentIntakeApp::initialize() {
                 if (session_) {
                     session_->setStudent(student);
                     session_->setLoggedIn(true);
+                    Session::SessionManager::getInstance().updateSessionIndex(session_);
                 }
 
                 // Update navigation
@@ -191,8 +207,16 @@ void StudentIntakeApp::setupServices() {
     // Create form factory
     formFactory_ = std::make_shared<Forms::FormFactory>();
 
-    // Create session
-    session_ = Session::SessionManager::getInstance().createSession();
+    // Create session; once it has been idle past the timeout, end this application
+    // too, since the application's reference is what keeps the session in memory
+    std::string appSessionId = sessionId();
+    session_ = Session::SessionManager::getInstance().createSession([appSessionId]() {
+        if (auto server = Wt::WServer::instance()) {
+            server->post(appSessionId, []() {
+                Wt::WApplication::instance()->quit();
+            });
+        }
+    });
 }
 
 void StudentIntakeApp::loadFormConfiguration() {
@@ -579,6 +603,7 @@ void StudentIntakeApp::showCompletion() {
 
 void StudentIntakeApp::handleLoginSuccess() {
     LOG_DEBUG("StudentIntakeApp", "handleLoginSuccess called");
+    Session::SessionManager::getInstance().updateSessionIndex(session_);
     navigationWidget_->refresh();
 
     // Check if returning student has a curriculum_id - if so, load the curriculum
@@ -588,14 +613,14 @@ void StudentIntakeApp::handleLoginSuccess() {
     if (!curriculumId.empty() && !session_->hasCurriculumSelected()) {
         // Load curriculum from manager
         LOG_DEBUG("StudentIntakeApp", "Loading curriculum from manager...");
-        auto curriculum = curriculumManager_->getCurriculum(curriculumId);
-        LOG_DEBUG("StudentIntakeApp", "Loaded curriculum id: '" << curriculum.getId() << "'");
+        auto curriculum = curriculumManager_->getCurriculumHandle(curriculumId);
+        LOG_DEBUG("StudentIntakeApp", "Loaded curriculum id: '" << (curriculum ? curriculum->getId() : "") << "'");
 
-        if (!curriculum.getId().empty()) {
+        if (curriculum) {
             session_->setCurrentCurriculum(curriculum);
 
             // Load required forms for this curriculum so we can check completion
-            auto requiredFormIds = curriculum.getRequiredForms();
+            auto requiredFormIds = curriculum->getRequiredForms();
             LOG_DEBUG("StudentIntakeApp", "Required forms count: " << requiredFormIds.size());
             session_->setRequiredFormIds(requiredFormIds);
         }
@@ -626,6 +651,7 @@ void StudentIntakeApp::handleRegistrationSuccess() {
     LOG_DEBUG("StudentIntakeApp", "Session student ID: '" << session_->getStudent().getId() << "'");
     LOG_DEBUG("StudentIntakeApp", "Session student email: '" << session_->getStudent().getEmail() << "'");
 
+    Session::SessionManager::getInstance().updateSessionIndex(session_);
     navigationWidget_->refresh();
     setState(AppState::CurriculumSelection);
 }
@@ -641,7 +667,8 @@ void StudentIntakeApp::handleLogout() {
         authManager_->logout(*session_);
     }
 
-    session_->reset();
+    // Through the manager: reset() issues a new session id
+    Session::SessionManager::getInstance().resetSession(session_);
     currentUser_ = Models::User();
 
     // Redirect to unified login at root
@@ -649,7 +676,7 @@ void StudentIntakeApp::handleLogout() {
 }
 
 void StudentIntakeApp::handleCurriculumSelected(const Models::Curriculum& curriculum) {
-    session_->setCurrentCurriculum(curriculum);
+    session_->setCurrentCurriculum(Curriculum::CurriculumRegistry::getInstance().intern(curriculum));
     session_->getStudent().setCurriculumId(curriculum.getId());
 
     // Update student profile on server
@@ -667,7 +694,7 @@ void StudentIntakeApp::handleChangeProgram() {
     session_->getStudent().resetCompletedForms();
 
     // Clear curriculum selection
-    session_->setCurrentCurriculum(Models::Curriculum());
+    session_->clearCurrentCurriculum();
     session_->getStudent().setCurriculumId("");
 
     // Clear required forms in session
@@ -897,6 +924,7 @@ void StudentIntakeApp::routeUserByRole(const Models::User& user) {
 
                     LOG_DEBUG("StudentIntakeApp", "Student create payload: " << payload.dump());
                     auto createResponse = apiClient_->post("/Student", payload);
+                    Api::AdminStatisticsService::getInstance().applyStudentResponse(createResponse);
                     LOG_INFO("StudentIntakeApp", "Student create response - status: " << createResponse.statusCode
                              << ", body: " << createResponse.body.substr(0, 500));
                     if (createResponse.success) {
@@ -920,6 +948,7 @@ void StudentIntakeApp::routeUserByRole(const Models::User& user) {
                 if (session_) {
                     session_->setStudent(student);
                     session_->setLoggedIn(true);
+                    Session::SessionManager::getInstance().updateSessionIndex(session_);
                 }
             }
 
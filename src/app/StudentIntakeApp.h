@@ -75,6 +75,10 @@ public:
     void setState(AppState state);
     AppState getState() const { return currentState_; }
 
+protected:
+    // Every request counts as session activity for idle expiry
+    void notify(const Wt::WEvent& event) override;
+
 private:
     void initialize();
     void setupServices();
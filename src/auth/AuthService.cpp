@@ -1,4 +1,6 @@
 #include "AuthService.h"
+#include "api/EventSpool.h"
+#include "utils/Logger.h"
 #include <regex>
 #include <random>
 #include <chrono>
@@ -129,10 +131,15 @@ void AuthService::recordLoginAttempt(const std::string& email, bool success,
     attrs["ip_address"] = ipAddress;
     attrs["user_agent"] = userAgent;
     attrs["created_at"] = getCurrentTimestamp();
+    attrs["client_event_id"] = Api::EventSpool::newEventId();
 
     auto payload = buildJsonApiPayload("LoginAudit", attrs);
-    // Fire and forget - don't wait for response
-    apiClient_->post("/LoginAudit", payload);
+    // Fire and forget - don't wait for response; kept on disk if the backend is down
+    Api::ApiResponse response = apiClient_->post("/LoginAudit", payload);
+    if (Api::EventSpool::isRetryable(response)
+        && !Api::EventSpool::getInstance().append("/LoginAudit", payload)) {
+        LOG_ERROR("AuthService", "Login audit for " << email << " lost: " << response.errorMessage);
+    }
 }
 
 // =============================================================================
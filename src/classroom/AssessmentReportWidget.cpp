@@ -1,5 +1,7 @@
 #include "AssessmentReportWidget.h"
+#include <Wt/WApplication.h>
 #include <Wt/WBreak.h>
+#include <Wt/WServer.h>
 #include <sstream>
 #include <iomanip>
 
@@ -256,6 +258,7 @@ void AssessmentReportWidget::createTimeLogSection() {
 
 void AssessmentReportWidget::createCertificateSection() {
     certificateSection_->clear();
+    issueCertificateButton_ = nullptr;
 
     // Only show certificate section if passed
     if (!report_.hasPassed()) {
@@ -299,14 +302,53 @@ void AssessmentReportWidget::createCertificateSection() {
         issueCertificateButton_->addStyleClass("btn btn-success");
         issueCertificateButton_->clicked().connect([this] {
             if (classroomService_) {
-                classroomService_->issueCertificate(report_.getId());
-                // Reload report to show certificate
-                loadReport(report_.getId());
+                requestCertificate();
+            } else {
+                certificateRequested_.emit();
             }
-            certificateRequested_.emit();
         });
     }
 }
 
+void AssessmentReportWidget::requestCertificate() {
+    issueCertificateButton_->setEnabled(false);
+    issueCertificateButton_->setText("Issuing Certificate...");
+
+    // Issued on the background job pool; the result is pushed back
+    auto app = Wt::WApplication::instance();
+    app->enableUpdates(true);
+    std::string sessionId = app->sessionId();
+    auto result = std::make_shared<Api::ReportJob>();
+    auto finished = app->bind(bindSafe([this, result]() {
+        onCertificateJobFinished(*result);
+    }));
+
+    std::string jobId = classroomService_->queueCertificate(report_.getId(),
+        [sessionId, result, finished](const Api::ReportJob& job) {
+            *result = job;
+            Wt::WServer::instance()->post(sessionId, finished);
+        });
+
+    if (jobId.empty()) {
+        app->enableUpdates(false);
+        issueCertificateButton_->setEnabled(true);
+        issueCertificateButton_->setText("Request Certificate");
+    }
+}
+
+void AssessmentReportWidget::onCertificateJobFinished(const Api::ReportJob& job) {
+    if (job.status == Api::ReportJobStatus::Completed) {
+        // Reload report to show certificate
+        loadReport(report_.getId());
+        certificateRequested_.emit();
+    } else if (issueCertificateButton_) {
+        issueCertificateButton_->setEnabled(true);
+        issueCertificateButton_->setText("Request Certificate");
+    }
+    auto app = Wt::WApplication::instance();
+    app->triggerUpdate();
+    app->enableUpdates(false);
+}
+
 } // namespace Classroom
 } // namespace StudentIntake
@@ -55,6 +55,8 @@ private:
     void createModuleBreakdownSection();
     void createTimeLogSection();
     void createCertificateSection();
+    void requestCertificate();
+    void onCertificateJobFinished(const Api::ReportJob& job);
 
     std::shared_ptr<Api::ClassroomService> classroomService_;
     Models::AssessmentReport report_;
@@ -1,9 +1,10 @@
 #include "AssessmentWidget.h"
+#include <Wt/WApplication.h>
 #include <Wt/WBreak.h>
+#include <Wt/WServer.h>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
-#include <random>
 
 namespace StudentIntake {
 namespace Classroom {
@@ -12,6 +13,8 @@ AssessmentWidget::AssessmentWidget()
     : studentId_(0)
     , enrollmentId_(0)
     , currentQuestionIndex_(0)
+    , autosaveInFlight_(false)
+    , submitted_(false)
     , remainingSeconds_(0)
     , isTimedAssessment_(false)
     , instructionsSection_(nullptr)
@@ -42,6 +45,9 @@ AssessmentWidget::~AssessmentWidget() {
     if (timer_) {
         timer_->stop();
     }
+    if (autosaveTimer_) {
+        autosaveTimer_->stop();
+    }
 }
 
 void AssessmentWidget::setupUI() {
@@ -244,25 +250,33 @@ void AssessmentWidget::loadQuestions() {
         return;
     }
 
-    questions_ = classroomService_->getAssessmentQuestions(currentAssessment_.getId());
-
-    // Shuffle questions if enabled
-    if (currentAssessment_.shufflesQuestions() && !questions_.empty()) {
-        std::random_device rd;
-        std::mt19937 g(rd());
-        std::shuffle(questions_.begin(), questions_.end(), g);
-    }
+    // Every attempt shares one parsed question set; only the order is per attempt,
+    // seeded from the attempt id so a resumed attempt keeps its layout
+    questionSet_ = classroomService_->getSharedQuestions(currentAssessment_);
+    permutation_ = Api::AttemptPermutation::create(
+        *questionSet_,
+        Api::AttemptPermutation::seedFor(currentAttempt_.getId(), currentAssessment_.getId()),
+        currentAssessment_.shufflesQuestions(),
+        currentAssessment_.shufflesAnswers());
 
     currentQuestionIndex_ = 0;
 }
 
+const Models::AssessmentQuestion& AssessmentWidget::questionAt(int displayIndex) const {
+    return (*questionSet_)[permutation_.sharedIndex(displayIndex)];
+}
+
+std::vector<Models::AnswerOption> AssessmentWidget::optionsAt(int displayIndex) const {
+    return permutation_.orderedOptions(questionAt(displayIndex), permutation_.sharedIndex(displayIndex));
+}
+
 void AssessmentWidget::displayQuestion(int questionIndex) {
-    if (questionIndex < 0 || questionIndex >= static_cast<int>(questions_.size())) {
+    if (questionIndex < 0 || questionIndex >= questionCount()) {
         return;
     }
 
     currentQuestionIndex_ = questionIndex;
-    const auto& question = questions_[questionIndex];
+    const auto& question = questionAt(questionIndex);
 
     // Update question text
     questionText_->setText("Question " + std::to_string(questionIndex + 1) + ": " + question.getQuestionText());
@@ -272,15 +286,8 @@ void AssessmentWidget::displayQuestion(int questionIndex) {
     radioGroup_.reset();
     checkboxes_.clear();
 
-    // Get answer options
-    auto options = question.getAnswerOptions();
-
-    // Shuffle options if enabled
-    if (currentAssessment_.shufflesAnswers() && !options.empty()) {
-        std::random_device rd;
-        std::mt19937 g(rd());
-        std::shuffle(options.begin(), options.end(), g);
-    }
+    // Answer options in this attempt's order
+    auto options = optionsAt(questionIndex);
 
     // Create answer inputs based on question type
     switch (question.getQuestionType()) {
@@ -337,12 +344,12 @@ void AssessmentWidget::displayAllQuestions() {
     // For displaying all questions at once (alternative UI)
     questionContainer_->clear();
 
-    for (size_t i = 0; i < questions_.size(); ++i) {
+    for (int i = 0; i < questionCount(); ++i) {
         auto qContainer = questionContainer_->addWidget(std::make_unique<Wt::WContainerWidget>());
         qContainer->addStyleClass("question-block");
 
         auto qText = qContainer->addWidget(std::make_unique<Wt::WText>(
-            "Question " + std::to_string(i + 1) + ": " + questions_[i].getQuestionText()));
+            "Question " + std::to_string(i + 1) + ": " + questionAt(i).getQuestionText()));
         qText->addStyleClass("question-text");
 
         // Add answers...
@@ -350,11 +357,11 @@ void AssessmentWidget::displayAllQuestions() {
 }
 
 void AssessmentWidget::saveCurrentAnswer() {
-    if (currentQuestionIndex_ < 0 || currentQuestionIndex_ >= static_cast<int>(questions_.size())) {
+    if (currentQuestionIndex_ < 0 || currentQuestionIndex_ >= questionCount()) {
         return;
     }
 
-    const auto& question = questions_[currentQuestionIndex_];
+    const auto& question = questionAt(currentQuestionIndex_);
     int questionId = std::stoi(question.getId());
 
     switch (question.getQuestionType()) {
@@ -364,10 +371,12 @@ void AssessmentWidget::saveCurrentAnswer() {
                 auto checkedButton = radioGroup_->checkedButton();
                 if (checkedButton) {
                     // Find which option was selected
-                    auto options = question.getAnswerOptions();
+                    auto options = optionsAt(currentQuestionIndex_);
                     int idx = radioGroup_->id(checkedButton);
-                    if (idx >= 0 && idx < static_cast<int>(options.size())) {
+                    if (idx >= 0 && idx < static_cast<int>(options.size()) &&
+                        singleAnswers_[questionId] != options[idx].id) {
                         singleAnswers_[questionId] = options[idx].id;
+                        dirtyQuestions_.insert(questionId);
                     }
                 }
             }
@@ -381,7 +390,11 @@ void AssessmentWidget::saveCurrentAnswer() {
                     selectedAnswers.push_back(checkbox->objectName());
                 }
             }
-            multipleAnswers_[questionId] = selectedAnswers;
+            auto existing = multipleAnswers_.find(questionId);
+            if (existing == multipleAnswers_.end() || existing->second != selectedAnswers) {
+                multipleAnswers_[questionId] = selectedAnswers;
+                dirtyQuestions_.insert(questionId);
+            }
             break;
         }
 
@@ -390,16 +403,81 @@ void AssessmentWidget::saveCurrentAnswer() {
     }
 }
 
+std::vector<Models::StudentAssessmentAnswer> AssessmentWidget::collectAnswers(
+        const std::set<int>& questionIds) const {
+    std::vector<Models::StudentAssessmentAnswer> answers;
+    int attemptId = currentAttempt_.getId().empty() ? 0 : std::stoi(currentAttempt_.getId());
+
+    for (int questionId : questionIds) {
+        Models::StudentAssessmentAnswer answer;
+        answer.setAttemptId(attemptId);
+        answer.setQuestionId(questionId);
+
+        auto multiple = multipleAnswers_.find(questionId);
+        auto single = singleAnswers_.find(questionId);
+        if (multiple != multipleAnswers_.end()) {
+            answer.setAnswersGiven(multiple->second);
+        } else if (single != singleAnswers_.end()) {
+            answer.setAnswerGiven(single->second);
+        } else {
+            continue;
+        }
+        answers.push_back(answer);
+    }
+
+    return answers;
+}
+
+void AssessmentWidget::autosaveAnswers() {
+    if (!classroomService_ || submitted_ || autosaveInFlight_ ||
+        dirtyQuestions_.empty() || currentAttempt_.getId().empty()) {
+        return;
+    }
+
+    std::set<int> batch;
+    batch.swap(dirtyQuestions_);
+    autosaveInFlight_ = true;
+
+    // The service calls back on a worker thread; hop back into this session
+    // through the server, and only if the widget still exists
+    auto app = Wt::WApplication::instance();
+    std::string sessionId = app->sessionId();
+    auto succeeded = std::make_shared<bool>(false);
+    auto finished = app->bind(bindSafe([this, batch, succeeded]() {
+        onAutosaveFinished(batch, *succeeded);
+    }));
+
+    classroomService_->saveAttemptAnswersAsync(currentAttempt_.getId(), collectAnswers(batch),
+        [sessionId, succeeded, finished](const Api::ClassroomResult& result) {
+            *succeeded = result.success;
+            Wt::WServer::instance()->post(sessionId, finished);
+        });
+}
+
+void AssessmentWidget::onAutosaveFinished(const std::set<int>& questionIds, bool success) {
+    autosaveInFlight_ = false;
+    if (submitted_) {
+        return;
+    }
+
+    // Failed answers are retried with the next batch
+    if (!success) {
+        dirtyQuestions_.insert(questionIds.begin(), questionIds.end());
+    }
+}
+
 void AssessmentWidget::onNextQuestion() {
     saveCurrentAnswer();
+    autosaveAnswers();
 
-    if (currentQuestionIndex_ < static_cast<int>(questions_.size()) - 1) {
+    if (currentQuestionIndex_ < questionCount() - 1) {
         displayQuestion(currentQuestionIndex_ + 1);
     }
 }
 
 void AssessmentWidget::onPreviousQuestion() {
     saveCurrentAnswer();
+    autosaveAnswers();
 
     if (currentQuestionIndex_ > 0) {
         displayQuestion(currentQuestionIndex_ - 1);
@@ -407,45 +485,53 @@ void AssessmentWidget::onPreviousQuestion() {
 }
 
 void AssessmentWidget::onSubmitAssessment() {
+    if (submitted_) {
+        return;
+    }
+
     saveCurrentAnswer();
 
     if (timer_) {
         timer_->stop();
     }
+    if (autosaveTimer_) {
+        autosaveTimer_->stop();
+    }
 
-    if (!classroomService_) {
+    if (!classroomService_ || !questionSet_) {
         return;
     }
 
-    // Submit all answers
-    for (const auto& question : questions_) {
-        int questionId = std::stoi(question.getId());
+    // Every buffered answer goes with the submission; the service waits out an
+    // autosave still in flight so it cannot land on the submitted attempt
+    std::set<int> answeredIds;
+    for (const auto& question : *questionSet_) {
+        answeredIds.insert(std::stoi(question.getId()));
+    }
+
+    int timeSpentSeconds = static_cast<int>(std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now() - questionsShownAt_).count());
 
-        if (question.getQuestionType() == Models::QuestionType::MultipleSelect) {
-            if (multipleAnswers_.count(questionId)) {
-                classroomService_->submitAnswer(
-                    std::stoi(currentAttempt_.getId()),
-                    questionId,
-                    "",
-                    multipleAnswers_[questionId]
-                );
-            }
-        } else {
-            if (singleAnswers_.count(questionId)) {
-                classroomService_->submitAnswer(
-                    std::stoi(currentAttempt_.getId()),
-                    questionId,
-                    singleAnswers_[questionId]
-                );
-            }
+    auto submission = classroomService_->submitAttempt(
+        currentAttempt_, collectAnswers(answeredIds), timeSpentSeconds);
+
+    if (!submission.result.success) {
+        if (timer_ && remainingSeconds_ > 0) {
+            timer_->start();
+        }
+        if (autosaveTimer_) {
+            autosaveTimer_->start();
         }
+        progressText_->setText("Your answers could not be submitted. Please try again.");
+        return;
     }
 
-    // Submit the assessment
-    auto result = classroomService_->submitAssessment(currentAttempt_.getId());
-
-    // Reload attempt to get results
-    currentAttempt_ = classroomService_->getAttemptDetails(currentAttempt_.getId());
+    submitted_ = true;
+    dirtyQuestions_.clear();
+    if (!submission.attempt.getId().empty()) {
+        currentAttempt_ = submission.attempt;
+    }
+    gradedAnswers_ = submission.answers;
 
     showResults();
 }
@@ -484,6 +570,15 @@ void AssessmentWidget::showQuestions() {
         timerDisplay_->hide();
     }
 
+    questionsShownAt_ = std::chrono::steady_clock::now();
+    autosaveTimer_ = std::make_unique<Wt::WTimer>();
+    autosaveTimer_->setInterval(std::chrono::seconds(30));
+    autosaveTimer_->timeout().connect([this] {
+        saveCurrentAnswer();
+        autosaveAnswers();
+    });
+    autosaveTimer_->start();
+
     displayQuestion(0);
     updateTimer();
 }
@@ -516,19 +611,20 @@ void AssessmentWidget::showResults() {
         auto reviewTitle = reviewContainer_->addWidget(std::make_unique<Wt::WText>("Review Your Answers"));
         reviewTitle->addStyleClass("review-title");
 
-        auto answers = classroomService_->getAttemptAnswers(currentAttempt_.getId());
+        const auto& answers = gradedAnswers_;
 
-        for (size_t i = 0; i < questions_.size(); ++i) {
+        for (int i = 0; i < questionCount(); ++i) {
+            const auto& question = questionAt(i);
             auto qReview = reviewContainer_->addWidget(std::make_unique<Wt::WContainerWidget>());
             qReview->addStyleClass("question-review");
 
             auto qText = qReview->addWidget(std::make_unique<Wt::WText>(
-                "Q" + std::to_string(i + 1) + ": " + questions_[i].getQuestionText()));
+                "Q" + std::to_string(i + 1) + ": " + question.getQuestionText()));
             qText->addStyleClass("review-question");
 
             // Find answer for this question
             for (const auto& answer : answers) {
-                if (answer.getQuestionId() == std::stoi(questions_[i].getId())) {
+                if (answer.getQuestionId() == std::stoi(question.getId())) {
                     std::string answerText = answer.getAnswerGiven();
                     if (answerText.empty() && !answer.getAnswersGiven().empty()) {
                         for (const auto& a : answer.getAnswersGiven()) {
@@ -544,7 +640,7 @@ void AssessmentWidget::showResults() {
                     // Show correct answer if enabled
                     if (currentAssessment_.showsCorrectAnswers() && !answer.isCorrect()) {
                         auto correctText = qReview->addWidget(std::make_unique<Wt::WText>(
-                            "Correct answer: " + questions_[i].getCorrectAnswer()));
+                            "Correct answer: " + question.getCorrectAnswer()));
                         correctText->addStyleClass("correct-answer");
                     }
                     break;
@@ -579,7 +675,7 @@ void AssessmentWidget::updateTimer() {
 
 void AssessmentWidget::updateNavigationButtons() {
     bool isFirst = (currentQuestionIndex_ == 0);
-    bool isLast = (currentQuestionIndex_ == static_cast<int>(questions_.size()) - 1);
+    bool isLast = (currentQuestionIndex_ == questionCount() - 1);
 
     prevButton_->setEnabled(!isFirst);
     nextButton_->setEnabled(!isLast);
@@ -601,7 +697,7 @@ void AssessmentWidget::updateProgressIndicator() {
     }
 
     progressText_->setText("Question " + std::to_string(currentQuestionIndex_ + 1) +
-                           " of " + std::to_string(questions_.size()));
+                           " of " + std::to_string(questionCount()));
 }
 
 } // namespace Classroom
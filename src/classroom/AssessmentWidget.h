@@ -9,9 +9,11 @@
 #include <Wt/WButtonGroup.h>
 #include <Wt/WSignal.h>
 #include <Wt/WTimer.h>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <map>
+#include <set>
 #include "api/ClassroomService.h"
 #include "models/Assessment.h"
 
@@ -25,7 +27,8 @@ namespace Classroom {
  * - Displaying questions one at a time or all at once
  * - Multiple choice, true/false, and multiple select questions
  * - Time limits and countdown timer
- * - Saving answers and submitting the assessment
+ * - Autosaving changed answers in the background
+ * - Submitting all answers and grading in a single request
  * - Showing results after submission
  */
 class AssessmentWidget : public Wt::WContainerWidget {
@@ -59,9 +62,15 @@ private:
     void setupResultsArea();
 
     void loadQuestions();
+    int questionCount() const { return static_cast<int>(permutation_.size()); }
+    const Models::AssessmentQuestion& questionAt(int displayIndex) const;
+    std::vector<Models::AnswerOption> optionsAt(int displayIndex) const;
     void displayQuestion(int questionIndex);
     void displayAllQuestions();
     void saveCurrentAnswer();
+    void autosaveAnswers();
+    void onAutosaveFinished(const std::set<int>& questionIds, bool success);
+    std::vector<Models::StudentAssessmentAnswer> collectAnswers(const std::set<int>& questionIds) const;
 
     void onNextQuestion();
     void onPreviousQuestion();
@@ -79,7 +88,10 @@ private:
     std::shared_ptr<Api::ClassroomService> classroomService_;
     Models::Assessment currentAssessment_;
     Models::StudentAssessmentAttempt currentAttempt_;
-    std::vector<Models::AssessmentQuestion> questions_;
+
+    // Shared, immutable question set plus this attempt's display order
+    Api::QuestionSet questionSet_;
+    Api::AttemptPermutation permutation_;
 
     int studentId_;
     int enrollmentId_;
@@ -89,6 +101,16 @@ private:
     std::map<int, std::string> singleAnswers_;
     std::map<int, std::vector<std::string>> multipleAnswers_;
 
+    // Autosave: questions changed since the last successful save
+    std::set<int> dirtyQuestions_;
+    std::unique_ptr<Wt::WTimer> autosaveTimer_;
+    bool autosaveInFlight_;
+    bool submitted_;
+    std::chrono::steady_clock::time_point questionsShownAt_;
+
+    // Graded answers returned with the submission, used by the review
+    std::vector<Models::StudentAssessmentAnswer> gradedAnswers_;
+
     // Timer
     std::unique_ptr<Wt::WTimer> timer_;
     int remainingSeconds_;
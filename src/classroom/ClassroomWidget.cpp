@@ -1,8 +1,11 @@
 #include "ClassroomWidget.h"
 #include "AssessmentWidget.h"
+#include "AssessmentReportWidget.h"
+#include <Wt/WApplication.h>
 #include <Wt/WBreak.h>
 #include <Wt/WImage.h>
 #include <Wt/WProgressBar.h>
+#include <Wt/WServer.h>
 #include <Wt/WTemplate.h>
 #include <Wt/WVideo.h>
 #include <sstream>
@@ -18,6 +21,8 @@ namespace Classroom {
 ClassroomWidget::ClassroomWidget()
     : currentModuleId_(0)
     , currentContentId_(0)
+    , reportPending_(false)
+    , progressWatch_(0)
     , currentActivity_(Models::ActivityType::Navigation)
     , isTracking_(false)
     , headerContainer_(nullptr)
@@ -31,12 +36,26 @@ ClassroomWidget::ClassroomWidget()
     , moduleListWidget_(nullptr)
     , contentViewerWidget_(nullptr)
     , assessmentWidget_(nullptr)
+    , reportWidget_(nullptr)
     , progressSidebar_(nullptr) {
     setupUI();
 }
 
 ClassroomWidget::~ClassroomWidget() {
     stopTimeTracking();
+    unwatchProgress();
+    if (reportPending_) {
+        Wt::WApplication::instance()->enableUpdates(false);
+    }
+}
+
+void ClassroomWidget::setClassroomService(std::shared_ptr<Api::ClassroomService> service) {
+    classroomService_ = service;
+    reportWidget_->setClassroomService(service);
+    prefetcher_.reset();
+    if (service) {
+        prefetcher_ = std::make_unique<Api::ContentPrefetcher>(service);
+    }
 }
 
 void ClassroomWidget::setupUI() {
@@ -112,6 +131,13 @@ void ClassroomWidget::setupMainContent() {
         currentActivity_ = Models::ActivityType::Navigation;
     });
 
+    // Completion report, shown when the background report job finishes
+    reportWidget_ = contentStack_->addWidget(std::make_unique<AssessmentReportWidget>());
+    reportWidget_->backClicked().connect([this] {
+        contentStack_->setCurrentWidget(moduleListWidget_);
+        currentActivity_ = Models::ActivityType::Navigation;
+    });
+
     // Show module list by default
     contentStack_->setCurrentWidget(moduleListWidget_);
 
@@ -127,7 +153,7 @@ void ClassroomWidget::setupSidebar() {
 }
 
 void ClassroomWidget::loadCourse(int courseId) {
-    if (!classroomService_) {
+    if (!classroomService_ || !prefetcher_) {
         return;
     }
 
@@ -154,6 +180,18 @@ void ClassroomWidget::loadCourse(int courseId) {
 
     // Load modules
     modules_ = classroomService_->getCourseModules(std::to_string(courseId));
+    prefetcher_->clear();
+
+    // Progress is loaded once per enrollment and kept in the session
+    unwatchProgress();
+    progress_ = session_->getEnrollmentProgress();
+    if (!progress_ || progress_->getEnrollmentId() != currentEnrollment_.getId()) {
+        progress_ = std::make_shared<Api::EnrollmentProgress>(classroomService_, studentId,
+                                                              currentEnrollment_.getId());
+        session_->setEnrollmentProgress(progress_);
+    }
+    progress_->load();
+    watchProgress();
 
     // Update UI
     updateCourseInfo();
@@ -171,6 +209,9 @@ void ClassroomWidget::refresh() {
 
     // Reload enrollment
     currentEnrollment_ = classroomService_->getEnrollment(currentEnrollment_.getId());
+    if (progress_) {
+        progress_->reconcile();
+    }
 
     // Update UI
     updateModuleList();
@@ -181,8 +222,12 @@ void ClassroomWidget::navigateToModule(int moduleId) {
     currentModuleId_ = moduleId;
     moduleSelected_.emit(moduleId);
 
+    if (!prefetcher_) {
+        return;
+    }
+
     // Load module contents and show in content viewer
-    auto contents = classroomService_->getModuleContents(std::to_string(moduleId));
+    auto contents = prefetcher_->getModuleContents(moduleId);
     if (!contents.empty()) {
         navigateToContent(std::stoi(contents[0].getId()));
     }
@@ -192,11 +237,21 @@ void ClassroomWidget::navigateToContent(int contentId) {
     currentContentId_ = contentId;
     contentSelected_.emit(contentId);
 
-    auto content = classroomService_->getContent(std::to_string(contentId));
+    if (!prefetcher_) {
+        return;
+    }
+
+    auto content = prefetcher_->getContent(contentId);
     contentViewerWidget_->setContent(content);
     contentViewerWidget_->setClassroomService(classroomService_);
     contentStack_->setCurrentWidget(contentViewerWidget_);
 
+    // Load what comes next while the student reads this item
+    if (content.getModuleId() > 0) {
+        currentModuleId_ = content.getModuleId();
+    }
+    prefetcher_->prefetchAfter(modules_, currentModuleId_, contentId);
+
     // Update activity type based on content
     switch (content.getContentType()) {
         case Models::ContentType::Reading:
@@ -216,7 +271,18 @@ void ClassroomWidget::navigateToContent(int contentId) {
 void ClassroomWidget::startAssessment(int assessmentId) {
     assessmentSelected_.emit(assessmentId);
 
-    auto assessment = classroomService_->getAssessment(std::to_string(assessmentId));
+    if (!classroomService_ || !prefetcher_) {
+        return;
+    }
+
+    // Module assessments are usually already prefetched
+    Models::Assessment assessment;
+    if (currentModuleId_ > 0) {
+        assessment = prefetcher_->getModuleAssessment(currentModuleId_);
+    }
+    if (assessment.getId() != std::to_string(assessmentId)) {
+        assessment = classroomService_->getAssessment(std::to_string(assessmentId));
+    }
     assessmentWidget_->setAssessment(assessment);
     assessmentWidget_->setClassroomService(classroomService_);
     assessmentWidget_->setEnrollmentId(std::stoi(currentEnrollment_.getId()));
@@ -242,25 +308,49 @@ void ClassroomWidget::updateModuleList() {
     }
 
     moduleListWidget_->setModules(modules_);
-
-    // Get progress for all modules
-    auto progressList = classroomService_->getModuleProgressList(currentEnrollment_.getId());
-    moduleListWidget_->setProgress(progressList);
+    moduleListWidget_->setProgress(progress_);
 }
 
 void ClassroomWidget::updateProgress() {
-    if (!progressSidebar_) {
+    if (!progressSidebar_ || !progress_) {
         return;
     }
 
     progressSidebar_->setCourse(currentCourse_);
     progressSidebar_->setEnrollment(currentEnrollment_);
 
-    auto progressList = classroomService_->getModuleProgressList(currentEnrollment_.getId());
-    progressSidebar_->setModuleProgress(progressList);
+    progressSidebar_->setModuleProgress(progress_->getModuleProgressList());
     progressSidebar_->updateProgress();
 }
 
+void ClassroomWidget::watchProgress() {
+    // Reconciliation runs on the progress worker; redraw on the session thread
+    // and push it, so updates stay enabled while watching
+    auto app = Wt::WApplication::instance();
+    app->enableUpdates(true);
+    std::string sessionId = app->sessionId();
+    auto redraw = app->bind(bindSafe([this]() {
+        updateModuleList();
+        updateProgress();
+        Wt::WApplication::instance()->triggerUpdate();
+    }));
+
+    progressWatch_ = progress_->setReconciledCallback([sessionId, redraw]() {
+        Wt::WServer::instance()->post(sessionId, redraw);
+    });
+}
+
+void ClassroomWidget::unwatchProgress() {
+    if (!progressWatch_) {
+        return;
+    }
+
+    // The progress is shared through the session; leave a newer view's callback alone
+    progress_->clearReconciledCallback(progressWatch_);
+    progressWatch_ = 0;
+    Wt::WApplication::instance()->enableUpdates(false);
+}
+
 void ClassroomWidget::onModuleClicked(int moduleId) {
     logTimeForCurrentActivity();
     navigateToModule(moduleId);
@@ -282,63 +372,36 @@ void ClassroomWidget::onBackClicked() {
 }
 
 void ClassroomWidget::onContentCompleted(int contentId) {
-    if (!classroomService_ || !session_) {
+    if (!classroomService_ || !prefetcher_ || !session_ || !progress_) {
         return;
     }
 
-    int studentId = std::stoi(session_->getStudent().getId());
-
-    // Get module progress
-    auto moduleProgress = classroomService_->getModuleProgress(studentId, currentModuleId_);
-
-    // Mark content as completed
-    classroomService_->completeContent(studentId, contentId,
-                                        std::stoi(moduleProgress.getId()));
+    // Mark content as completed; the backend write happens in the background
+    auto contents = prefetcher_->getModuleContents(currentModuleId_);
+    progress_->completeContent(currentModuleId_, contentId, contents.size());
 
     // Check if module is complete
-    auto contents = classroomService_->getModuleContents(std::to_string(currentModuleId_));
-    auto contentProgress = classroomService_->getModuleProgressList(currentEnrollment_.getId());
-
-    bool allComplete = true;
-    for (const auto& content : contents) {
-        if (content.isRequired()) {
-            auto progress = classroomService_->getContentProgress(studentId, std::stoi(content.getId()));
-            if (!progress.isCompleted()) {
-                allComplete = false;
-                break;
-            }
-        }
-    }
-
-    if (allComplete) {
+    if (progress_->areRequiredContentsCompleted(currentModuleId_, contents)) {
         onModuleCompleted(currentModuleId_);
+        return;
     }
 
+    updateModuleList();
     updateProgress();
 }
 
 void ClassroomWidget::onModuleCompleted(int moduleId) {
-    if (!classroomService_ || !session_) {
+    if (!classroomService_ || !session_ || !progress_) {
         return;
     }
 
     int studentId = std::stoi(session_->getStudent().getId());
-    classroomService_->completeModule(studentId, moduleId);
+    progress_->completeModule(moduleId);
 
     // Check if course is complete
-    auto progressList = classroomService_->getModuleProgressList(currentEnrollment_.getId());
-    int completedCount = 0;
-    for (const auto& prog : progressList) {
-        if (prog.isCompleted()) {
-            completedCount++;
-        }
-    }
-
-    if (completedCount >= static_cast<int>(modules_.size())) {
-        // Course complete - generate report
-        classroomService_->generateReport(studentId,
-                                           std::stoi(currentEnrollment_.getId()),
-                                           std::stoi(currentCourse_.getId()));
+    if (progress_->getCompletedModuleCount() >= static_cast<int>(modules_.size())) {
+        // Course complete - the report is built in the background
+        queueCompletionReport(studentId);
         courseCompleted_.emit();
     }
 
@@ -346,6 +409,58 @@ void ClassroomWidget::onModuleCompleted(int moduleId) {
     updateProgress();
 }
 
+void ClassroomWidget::queueCompletionReport(int studentId) {
+    int enrollmentId = std::stoi(currentEnrollment_.getId());
+    int courseId = std::stoi(currentCourse_.getId());
+
+    // Push the result to the browser when the job finishes
+    auto app = Wt::WApplication::instance();
+    if (!reportPending_) {
+        app->enableUpdates(true);
+        reportPending_ = true;
+    }
+    std::string sessionId = app->sessionId();
+    auto result = std::make_shared<Api::ReportJob>();
+    auto finished = app->bind(bindSafe([this, result]() {
+        onReportJobFinished(*result);
+    }));
+    auto notify = [sessionId, result, finished](const Api::ReportJob& job) {
+        *result = job;
+        Wt::WServer::instance()->post(sessionId, finished);
+    };
+
+    // The report is built from backend progress, so queue it once pending writes land
+    auto service = classroomService_;
+    progress_->whenDrained([service, studentId, enrollmentId, courseId, notify]() {
+        if (!service->queueReport(studentId, enrollmentId, courseId, notify).empty()) {
+            return;
+        }
+
+        // Job queue is full; build the report here instead, still off the request thread
+        auto report = service->generateReport(studentId, enrollmentId, courseId);
+        Api::ReportJob job;
+        job.status = report.success ? Api::ReportJobStatus::Completed : Api::ReportJobStatus::Failed;
+        job.reportId = report.id;
+        notify(job);
+    });
+}
+
+void ClassroomWidget::onReportJobFinished(const Api::ReportJob& job) {
+    if (job.status == Api::ReportJobStatus::Completed && !job.reportId.empty()) {
+        logTimeForCurrentActivity();
+        reportWidget_->loadReport(job.reportId);
+        contentStack_->setCurrentWidget(reportWidget_);
+        currentActivity_ = Models::ActivityType::Navigation;
+    }
+
+    auto app = Wt::WApplication::instance();
+    app->triggerUpdate();
+    if (reportPending_) {
+        app->enableUpdates(false);
+        reportPending_ = false;
+    }
+}
+
 void ClassroomWidget::onAssessmentCompleted(int assessmentId, double score, bool passed) {
     logTimeForCurrentActivity();
 
@@ -353,6 +468,10 @@ void ClassroomWidget::onAssessmentCompleted(int assessmentId, double score, bool
     contentStack_->setCurrentWidget(moduleListWidget_);
     currentActivity_ = Models::ActivityType::Navigation;
 
+    // Grading may have updated module progress on the backend
+    if (progress_) {
+        progress_->reconcile();
+    }
     updateProgress();
     updateModuleList();
 
@@ -425,8 +544,8 @@ void ModuleListWidget::setModules(const std::vector<Models::CourseModule>& modul
     updateDisplay();
 }
 
-void ModuleListWidget::setProgress(const std::vector<Models::StudentModuleProgress>& progress) {
-    progressList_ = progress;
+void ModuleListWidget::setProgress(std::shared_ptr<Api::EnrollmentProgress> progress) {
+    progress_ = progress;
     updateDisplay();
 }
 
@@ -437,13 +556,12 @@ void ModuleListWidget::updateDisplay() {
         auto moduleCard = moduleList_->addWidget(std::make_unique<Wt::WContainerWidget>());
         moduleCard->addStyleClass("module-card");
 
-        // Find progress for this module
+        // Progress and unlock state come from the in-memory enrollment model
         Models::StudentModuleProgress progress;
-        for (const auto& p : progressList_) {
-            if (p.getModuleId() == std::stoi(module.getId())) {
-                progress = p;
-                break;
-            }
+        bool unlocked = true;
+        if (progress_) {
+            progress = progress_->getModuleProgress(std::stoi(module.getId()));
+            unlocked = progress_->isModuleUnlocked(module);
         }
 
         // Status indicator
@@ -455,7 +573,7 @@ void ModuleListWidget::updateDisplay() {
         } else if (progress.getStatus() == Models::ProgressStatus::InProgress) {
             statusClass = "status-in-progress";
             statusText = "In Progress";
-        } else if (progress.isLocked()) {
+        } else if (!unlocked) {
             statusClass = "status-locked";
             statusText = "Locked";
         }
@@ -488,7 +606,7 @@ void ModuleListWidget::updateDisplay() {
         }
 
         // Click handler (if not locked)
-        if (!progress.isLocked()) {
+        if (unlocked) {
             int moduleId = std::stoi(module.getId());
             moduleCard->clicked().connect([this, moduleId] {
                 moduleClicked_.emit(moduleId);
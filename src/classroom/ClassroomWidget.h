@@ -9,6 +9,8 @@
 #include <memory>
 #include "session/StudentSession.h"
 #include "api/ClassroomService.h"
+#include "api/ContentPrefetcher.h"
+#include "api/EnrollmentProgress.h"
 #include "models/Course.h"
 #include "models/StudentProgress.h"
 
@@ -19,6 +21,7 @@ namespace Classroom {
 class ModuleListWidget;
 class ContentViewerWidget;
 class AssessmentWidget;
+class AssessmentReportWidget;
 class ProgressSidebarWidget;
 
 /**
@@ -38,7 +41,7 @@ public:
 
     // Session and service management
     void setSession(std::shared_ptr<Session::StudentSession> session) { session_ = session; }
-    void setClassroomService(std::shared_ptr<Api::ClassroomService> service) { classroomService_ = service; }
+    void setClassroomService(std::shared_ptr<Api::ClassroomService> service);
 
     /**
      * @brief Initialize the classroom for a specific course
@@ -81,6 +84,10 @@ private:
     void updateCourseInfo();
     void updateModuleList();
     void updateProgress();
+    void watchProgress();
+    void unwatchProgress();
+    void queueCompletionReport(int studentId);
+    void onReportJobFinished(const Api::ReportJob& job);
 
     void onModuleClicked(int moduleId);
     void onContentClicked(int contentId);
@@ -98,12 +105,20 @@ private:
     std::shared_ptr<Session::StudentSession> session_;
     std::shared_ptr<Api::ClassroomService> classroomService_;
 
+    // Read-ahead cache for content, module lists and module assessments
+    std::unique_ptr<Api::ContentPrefetcher> prefetcher_;
+
+    // Enrollment progress, owned by the session and shared with this view
+    std::shared_ptr<Api::EnrollmentProgress> progress_;
+
     // Current state
     Models::Course currentCourse_;
     Models::StudentCourseEnrollment currentEnrollment_;
     std::vector<Models::CourseModule> modules_;
     int currentModuleId_;
     int currentContentId_;
+    bool reportPending_;    // enableUpdates(true) held until the report job finishes
+    int progressWatch_;     // reconciled callback id on progress_, 0 when not watching
 
     // Time tracking
     std::chrono::steady_clock::time_point sessionStartTime_;
@@ -126,6 +141,7 @@ private:
     ModuleListWidget* moduleListWidget_;
     ContentViewerWidget* contentViewerWidget_;
     AssessmentWidget* assessmentWidget_;
+    AssessmentReportWidget* reportWidget_;
 
     // Sidebar
     ProgressSidebarWidget* progressSidebar_;
@@ -146,7 +162,7 @@ public:
     ModuleListWidget();
 
     void setModules(const std::vector<Models::CourseModule>& modules);
-    void setProgress(const std::vector<Models::StudentModuleProgress>& progress);
+    void setProgress(std::shared_ptr<Api::EnrollmentProgress> progress);
 
     Wt::Signal<int>& moduleClicked() { return moduleClicked_; }
 
@@ -155,7 +171,7 @@ private:
     void updateDisplay();
 
     std::vector<Models::CourseModule> modules_;
-    std::vector<Models::StudentModuleProgress> progressList_;
+    std::shared_ptr<Api::EnrollmentProgress> progress_;
 
     Wt::WContainerWidget* moduleList_;
     Wt::Signal<int> moduleClicked_;
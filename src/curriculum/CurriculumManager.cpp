@@ -1,4 +1,6 @@
 #include "CurriculumManager.h"
+#include "CurriculumRegistry.h"
+#include "api/TextSearchIndex.h"
 #include <fstream>
 #include <algorithm>
 
@@ -19,7 +21,10 @@ CurriculumManager::~CurriculumManager() {
 
 bool CurriculumManager::loadCurriculums() {
     if (apiService_) {
-        curriculums_ = apiService_->getCurriculums();
+        curriculums_.clear();
+        for (const auto& curriculum : apiService_->getCurriculums()) {
+            addCurriculum(curriculum);
+        }
         if (!curriculums_.empty()) {
             // Also load departments (from API or defaults)
             // For now, load default departments since API may not have department endpoint
@@ -51,7 +56,7 @@ bool CurriculumManager::loadFromConfig(const std::string& configPath) {
 
         if (config.contains("curriculums")) {
             for (const auto& item : config["curriculums"]) {
-                curriculums_.push_back(Models::Curriculum::fromJson(item));
+                addCurriculum(Models::Curriculum::fromJson(item));
             }
         }
 
@@ -79,7 +84,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     cs_bs.setCreditHours(120);
     cs_bs.setDurationSemesters(8);
     cs_bs.setRequiredForms({"personal_info", "emergency_contact", "academic_history"});
-    curriculums_.push_back(cs_bs);
+    addCurriculum(cs_bs);
 
     Models::Curriculum cs_ms("cs_ms", "Master of Science in Computer Science");
     cs_ms.setDescription("Advanced study in computer science with research opportunities.");
@@ -88,7 +93,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     cs_ms.setCreditHours(36);
     cs_ms.setDurationSemesters(4);
     cs_ms.setRequiredForms({"personal_info", "emergency_contact", "academic_history", "documents"});
-    curriculums_.push_back(cs_ms);
+    addCurriculum(cs_ms);
 
     // Business Department
     Models::Curriculum bus_bba("bus_bba", "Bachelor of Business Administration");
@@ -98,7 +103,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     bus_bba.setCreditHours(120);
     bus_bba.setDurationSemesters(8);
     bus_bba.setRequiredForms({"personal_info", "emergency_contact", "academic_history"});
-    curriculums_.push_back(bus_bba);
+    addCurriculum(bus_bba);
 
     Models::Curriculum bus_mba("bus_mba", "Master of Business Administration");
     bus_mba.setDescription("Professional graduate degree in business management.");
@@ -107,7 +112,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     bus_mba.setCreditHours(48);
     bus_mba.setDurationSemesters(4);
     bus_mba.setRequiredForms({"personal_info", "emergency_contact", "academic_history", "documents"});
-    curriculums_.push_back(bus_mba);
+    addCurriculum(bus_mba);
 
     // Engineering Department
     Models::Curriculum eng_bsee("eng_bsee", "Bachelor of Science in Electrical Engineering");
@@ -117,7 +122,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     eng_bsee.setCreditHours(128);
     eng_bsee.setDurationSemesters(8);
     eng_bsee.setRequiredForms({"personal_info", "emergency_contact", "academic_history", "medical_info"});
-    curriculums_.push_back(eng_bsee);
+    addCurriculum(eng_bsee);
 
     Models::Curriculum eng_bsme("eng_bsme", "Bachelor of Science in Mechanical Engineering");
     eng_bsme.setDescription("Design and analysis of mechanical systems.");
@@ -126,7 +131,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     eng_bsme.setCreditHours(128);
     eng_bsme.setDurationSemesters(8);
     eng_bsme.setRequiredForms({"personal_info", "emergency_contact", "academic_history", "medical_info"});
-    curriculums_.push_back(eng_bsme);
+    addCurriculum(eng_bsme);
 
     // Nursing Department
     Models::Curriculum nur_bsn("nur_bsn", "Bachelor of Science in Nursing");
@@ -136,7 +141,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     nur_bsn.setCreditHours(120);
     nur_bsn.setDurationSemesters(8);
     nur_bsn.setRequiredForms({"personal_info", "emergency_contact", "academic_history", "medical_info", "documents"});
-    curriculums_.push_back(nur_bsn);
+    addCurriculum(nur_bsn);
 
     // Arts and Sciences
     Models::Curriculum art_ba("art_ba", "Bachelor of Arts in Psychology");
@@ -146,7 +151,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     art_ba.setCreditHours(120);
     art_ba.setDurationSemesters(8);
     art_ba.setRequiredForms({"personal_info", "emergency_contact", "academic_history"});
-    curriculums_.push_back(art_ba);
+    addCurriculum(art_ba);
 
     // Certificate Programs
     Models::Curriculum cert_da("cert_da", "Certificate in Data Analytics");
@@ -156,7 +161,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     cert_da.setCreditHours(18);
     cert_da.setDurationSemesters(2);
     cert_da.setRequiredForms({"personal_info", "emergency_contact"});
-    curriculums_.push_back(cert_da);
+    addCurriculum(cert_da);
 
     Models::Curriculum cert_pm("cert_pm", "Certificate in Project Management");
     cert_pm.setDescription("Professional certificate in project management methodologies.");
@@ -165,7 +170,7 @@ void CurriculumManager::initializeDefaultCurriculums() {
     cert_pm.setCreditHours(15);
     cert_pm.setDurationSemesters(2);
     cert_pm.setRequiredForms({"personal_info", "emergency_contact"});
-    curriculums_.push_back(cert_pm);
+    addCurriculum(cert_pm);
 }
 
 void CurriculumManager::initializeDefaultDepartments() {
@@ -217,15 +222,26 @@ void CurriculumManager::initializeDefaultDepartments() {
     departments_.push_back(arts);
 }
 
+void CurriculumManager::addCurriculum(const Models::Curriculum& curriculum) {
+    if (auto handle = CurriculumRegistry::getInstance().intern(curriculum)) {
+        curriculums_.push_back(handle);
+    }
+}
+
 std::vector<Models::Curriculum> CurriculumManager::getAllCurriculums() const {
-    return curriculums_;
+    std::vector<Models::Curriculum> all;
+    all.reserve(curriculums_.size());
+    for (const auto& curriculum : curriculums_) {
+        all.push_back(*curriculum);
+    }
+    return all;
 }
 
 std::vector<Models::Curriculum> CurriculumManager::getActiveCurriculums() const {
     std::vector<Models::Curriculum> active;
     for (const auto& curriculum : curriculums_) {
-        if (curriculum.isActive()) {
-            active.push_back(curriculum);
+        if (curriculum->isActive()) {
+            active.push_back(*curriculum);
         }
     }
     return active;
@@ -235,8 +251,8 @@ std::vector<Models::Curriculum> CurriculumManager::getCurriculumsByDepartment(
     const std::string& department) const {
     std::vector<Models::Curriculum> result;
     for (const auto& curriculum : curriculums_) {
-        if (curriculum.getDepartment() == department) {
-            result.push_back(curriculum);
+        if (curriculum->getDepartment() == department) {
+            result.push_back(*curriculum);
         }
     }
     return result;
@@ -246,20 +262,25 @@ std::vector<Models::Curriculum> CurriculumManager::getCurriculumsByDegreeType(
     const std::string& degreeType) const {
     std::vector<Models::Curriculum> result;
     for (const auto& curriculum : curriculums_) {
-        if (curriculum.getDegreeType() == degreeType) {
-            result.push_back(curriculum);
+        if (curriculum->getDegreeType() == degreeType) {
+            result.push_back(*curriculum);
         }
     }
     return result;
 }
 
 Models::Curriculum CurriculumManager::getCurriculum(const std::string& curriculumId) const {
+    auto curriculum = getCurriculumHandle(curriculumId);
+    return curriculum ? *curriculum : Models::Curriculum();
+}
+
+Models::CurriculumPtr CurriculumManager::getCurriculumHandle(const std::string& curriculumId) const {
     for (const auto& curriculum : curriculums_) {
-        if (curriculum.getId() == curriculumId) {
+        if (curriculum->getId() == curriculumId) {
             return curriculum;
         }
     }
-    return Models::Curriculum();
+    return nullptr;
 }
 
 std::vector<Models::Department> CurriculumManager::getAllDepartments() const {
@@ -289,19 +310,14 @@ std::vector<std::string> CurriculumManager::getDegreeTypes() const {
 
 std::vector<Models::Curriculum> CurriculumManager::searchCurriculums(
     const std::string& query) const {
+    // The catalog is a few dozen programs, so a scan costs less than an index per application
     std::vector<Models::Curriculum> results;
-    std::string lowerQuery = query;
-    std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(), ::tolower);
+    std::string lowerQuery = Api::TextSearchIndex::fold(query);
 
     for (const auto& curriculum : curriculums_) {
-        std::string name = curriculum.getName();
-        std::string desc = curriculum.getDescription();
-        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
-        std::transform(desc.begin(), desc.end(), desc.begin(), ::tolower);
-
-        if (name.find(lowerQuery) != std::string::npos ||
-            desc.find(lowerQuery) != std::string::npos) {
-            results.push_back(curriculum);
+        if (Api::TextSearchIndex::fold(curriculum->getName()).find(lowerQuery) != std::string::npos ||
+            Api::TextSearchIndex::fold(curriculum->getDescription()).find(lowerQuery) != std::string::npos) {
+            results.push_back(*curriculum);
         }
     }
 
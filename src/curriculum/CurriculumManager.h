@@ -33,6 +33,7 @@ public:
     std::vector<Models::Curriculum> getCurriculumsByDepartment(const std::string& department) const;
     std::vector<Models::Curriculum> getCurriculumsByDegreeType(const std::string& degreeType) const;
     Models::Curriculum getCurriculum(const std::string& curriculumId) const;
+    Models::CurriculumPtr getCurriculumHandle(const std::string& curriculumId) const;  // shared; nullptr if unknown
 
     // Department access
     std::vector<Models::Department> getAllDepartments() const;
@@ -42,7 +43,7 @@ public:
     // Degree types
     std::vector<std::string> getDegreeTypes() const;
 
-    // Search and filter
+    // Search and filter (name or description contains the query, in catalog order)
     std::vector<Models::Curriculum> searchCurriculums(const std::string& query) const;
 
     // Check if data is loaded
@@ -54,10 +55,11 @@ public:
 
 private:
     std::shared_ptr<Api::FormSubmissionService> apiService_;
-    std::vector<Models::Curriculum> curriculums_;
+    std::vector<Models::CurriculumPtr> curriculums_;  // interned in CurriculumRegistry
     std::vector<Models::Department> departments_;
     bool isLoaded_;
 
+    void addCurriculum(const Models::Curriculum& curriculum);
     void initializeDefaultCurriculums();
     void initializeDefaultDepartments();
 };
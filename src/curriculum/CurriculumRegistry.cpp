@@ -0,0 +1,35 @@
+#include "CurriculumRegistry.h"
+
+namespace StudentIntake {
+namespace Curriculum {
+
+CurriculumRegistry& CurriculumRegistry::getInstance() {
+    static CurriculumRegistry instance;
+    return instance;
+}
+
+Models::CurriculumPtr CurriculumRegistry::intern(const Models::Curriculum& curriculum) {
+    if (curriculum.getId().empty()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& current = curriculums_[curriculum.getId()];
+    if (!current || *current != curriculum) {
+        current = std::make_shared<const Models::Curriculum>(curriculum);
+    }
+    return current;
+}
+
+size_t CurriculumRegistry::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return curriculums_.size();
+}
+
+void CurriculumRegistry::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    curriculums_.clear();
+}
+
+} // namespace Curriculum
+} // namespace StudentIntake
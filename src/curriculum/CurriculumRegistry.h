@@ -0,0 +1,53 @@
+#ifndef CURRICULUM_REGISTRY_H
+#define CURRICULUM_REGISTRY_H
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "models/Curriculum.h"
+
+namespace StudentIntake {
+namespace Curriculum {
+
+/**
+ * @brief Process-wide table of interned curricula
+ * Thread-safe singleton
+ *
+ * Every CurriculumManager and session holds its programs as handles from
+ * here, so each program exists once in memory however many sessions have
+ * selected it, and selecting one is a pointer copy. Interned curricula are
+ * never modified: interning a program whose content has changed registers
+ * a new version under its id, and sessions holding the old one keep it
+ * until they let go.
+ */
+class CurriculumRegistry {
+public:
+    // Singleton access
+    static CurriculumRegistry& getInstance();
+
+    // Prevent copying
+    CurriculumRegistry(const CurriculumRegistry&) = delete;
+    CurriculumRegistry& operator=(const CurriculumRegistry&) = delete;
+
+    /**
+     * @brief Shared handle for curriculum, registering it if new or changed
+     * A curriculum without an id (no selection) yields nullptr.
+     */
+    Models::CurriculumPtr intern(const Models::Curriculum& curriculum);
+
+    size_t size() const;
+    void clear();
+
+private:
+    CurriculumRegistry() = default;
+    ~CurriculumRegistry() = default;
+
+    std::unordered_map<std::string, Models::CurriculumPtr> curriculums_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Curriculum
+} // namespace StudentIntake
+
+#endif // CURRICULUM_REGISTRY_H
@@ -1,4 +1,5 @@
 #include "CurriculumSelector.h"
+#include "CurriculumRegistry.h"
 #include "utils/Logger.h"
 #include <Wt/WApplication.h>
 #include <Wt/WBreak.h>
@@ -425,7 +426,7 @@ void CurriculumSelector::handleSelectProgram(const Models::Curriculum& curriculu
         // For accredited mode or non-CDL programs, proceed directly
         LOG_INFO("CurriculumSelector", "Emitting curriculumSelected signal for: " << curriculum.getName());
         if (session_) {
-            session_->setCurrentCurriculum(curriculum);
+            session_->setCurrentCurriculum(CurriculumRegistry::getInstance().intern(curriculum));
             session_->getStudent().setCurriculumId(curriculum.getId());
             session_->getStudent().clearEndorsements();
         }
@@ -555,7 +556,7 @@ void CurriculumSelector::handleContinueWithEndorsements() {
 
     // Update session with selections
     if (session_) {
-        session_->setCurrentCurriculum(selectedBaseProgram_);
+        session_->setCurrentCurriculum(CurriculumRegistry::getInstance().intern(selectedBaseProgram_));
         session_->getStudent().setCurriculumId(selectedBaseProgram_.getId());
 
         // Clear and add endorsement IDs
@@ -2,6 +2,17 @@
 #include <Wt/WServer.h>
 #include "app/StudentIntakeApp.h"
 #include "admin/AdminApp.h"
+#include "app/AppConfig.h"
+#include "api/ActivityFeed.h"
+#include "api/ActivityLogQueue.h"
+#include "api/AdminStatisticsService.h"
+#include "api/EventSpool.h"
+#include "api/PdfCache.h"
+#include "api/PrefetchPool.h"
+#include "api/ReportJobQueue.h"
+#include "api/SubmissionIndex.h"
+#include "api/TimeTrackingAggregator.h"
+#include "session/SessionManager.h"
 #include "utils/Logger.h"
 #include <cstdlib>
 #include <iostream>
@@ -34,6 +45,33 @@ void displayBanner() {
     std::cout << "\n";
 }
 
+/**
+ * @brief Stop the background services started in main, in dependency order
+ *
+ * Safe to call when some were never started, so every exit path runs it.
+ */
+void stopServices() {
+    // Finish running report jobs; queued ones resume on next start
+    StudentIntake::Api::ReportJobQueue::getInstance().stop();
+    StudentIntake::Api::AdminStatisticsService::getInstance().stop();
+    StudentIntake::Api::SubmissionIndex::getInstance().stop();
+    StudentIntake::Api::ActivityFeed::getInstance().stop();
+    StudentIntake::Session::SessionManager::getInstance().stop();
+    StudentIntake::Api::PrefetchPool::getInstance().stop();
+
+    // Post queued audit events; what cannot be posted is kept in the spool
+    StudentIntake::Api::ActivityLogQueue::getInstance().stop();
+    auto& eventSpool = StudentIntake::Api::EventSpool::getInstance();
+    eventSpool.stop();
+    eventSpool.close();
+
+    // Flush buffered classroom time logs before exit
+    StudentIntake::Api::TimeTrackingAggregator::getInstance().stop();
+
+    // Write out the remaining log lines
+    StudentIntake::Logger::stop();
+}
+
 /**
  * @brief Application factory function for Student Portal
  */
@@ -71,9 +109,30 @@ int main(int argc, char** argv) {
             StudentIntake::Logger::setLevel(StudentIntake::LogLevel::INFO);
         }
 
+        // Per-component overrides, e.g. LOG_LEVELS=ApiClient=DEBUG,EventSpool=WARN
+        const char* componentLevels = std::getenv("LOG_LEVELS");
+        if (componentLevels) {
+            StudentIntake::Logger::setComponentLevels(componentLevels);
+        }
+
+        // LOG_FORMAT=json writes one JSON object per line for the log pipeline
+        const char* logFormat = std::getenv("LOG_FORMAT");
+        if (logFormat) {
+            StudentIntake::Logger::setFormatFromString(logFormat);
+        }
+
         // Show log level in output (useful for startup)
         StudentIntake::Logger::setShowLevel(true);
 
+        // LOG_FILE=path appends log lines to a file instead of stdout/stderr
+        const char* logFile = std::getenv("LOG_FILE");
+        if (logFile && !StudentIntake::Logger::setOutputFile(logFile)) {
+            LOG_WARN("Main", "Cannot open log file " << logFile << "; logging to the console");
+        }
+
+        // Log lines are written by one background thread from here on
+        StudentIntake::Logger::start();
+
         // Create and configure the server
         Wt::WServer server(argc, argv);
 
@@ -96,18 +155,90 @@ int main(int argc, char** argv) {
         LOG_INFO("Main", "  Classroom Portal:  http://localhost:8080/classroom");
         LOG_INFO("Main", "  Admin Portal:      http://localhost:8080/administration");
 
-        // Run the server
+        auto& config = StudentIntake::App::AppConfig::getInstance();
+
+        // Classroom time logs are buffered and flushed in the background until stopServices()
+        auto& timeTracker = StudentIntake::Api::TimeTrackingAggregator::getInstance();
+        timeTracker.setApiClient(std::make_shared<StudentIntake::Api::ApiClient>(config.apiBaseUrl));
+        timeTracker.start();
+
+        // Classroom read-ahead for every session runs on one small shared pool
+        auto& prefetchPool = StudentIntake::Api::PrefetchPool::getInstance();
+        prefetchPool.start();
+
+        // Resume report and certificate jobs left unfinished by the last run,
+        // before the first request can submit one
+        auto& reportJobs = StudentIntake::Api::ReportJobQueue::getInstance();
+        reportJobs.setJournalPath(config.reportJobJournalPath);
+        reportJobs.setApiClient(std::make_shared<StudentIntake::Api::ApiClient>(config.apiBaseUrl));
+        reportJobs.start();
+
+        // Keep admin dashboard counters warm for every admin session; pages
+        // only read snapshots, so the one client is set before any can load
+        auto& adminStatistics = StudentIntake::Api::AdminStatisticsService::getInstance();
+        adminStatistics.setApiClient(std::make_shared<StudentIntake::Api::ApiClient>(config.apiBaseUrl));
+        adminStatistics.start();
+
+        auto& pdfCache = StudentIntake::Api::PdfCache::getInstance();
+        pdfCache.setMemoryLimit(static_cast<size_t>(config.pdfCacheMemoryMB) * 1024 * 1024);
+        pdfCache.setDiskLimit(static_cast<size_t>(config.pdfCacheDiskMB) * 1024 * 1024);
+        pdfCache.setSpillDirectory(config.pdfCacheDirectory);
+
+        // Audit events the backend cannot take wait on disk until it recovers
+        auto& eventSpool = StudentIntake::Api::EventSpool::getInstance();
+        eventSpool.setApiClient(std::make_shared<StudentIntake::Api::ApiClient>(config.apiBaseUrl));
+        eventSpool.setSegmentSize(static_cast<size_t>(config.eventSpoolSegmentKB) * 1024);
+        eventSpool.setMaxBytes(static_cast<uint64_t>(config.eventSpoolMaxMB) * 1024 * 1024);
+        eventSpool.setReplayRate(config.eventSpoolReplayRate);
+        eventSpool.setReplayInterval(config.eventSpoolRetryIntervalMs);
+        if (eventSpool.open(config.eventSpoolDirectory)) {
+            eventSpool.start();
+        }
+
+        // Batch audit events instead of one POST per login, submission or review
+        auto& activityLog = StudentIntake::Api::ActivityLogQueue::getInstance();
+        activityLog.setApiClient(std::make_shared<StudentIntake::Api::ApiClient>(config.apiBaseUrl));
+        activityLog.setBatchSize(static_cast<size_t>(config.activityLogBatchSize));
+        activityLog.setFlushInterval(config.activityLogFlushIntervalMs);
+        activityLog.setCapacity(static_cast<size_t>(config.activityLogQueueCapacity));
+        activityLog.setOverflowPolicy(
+            StudentIntake::Api::ActivityLogQueue::policyFromString(config.activityLogOverflowPolicy));
+        activityLog.setSpillPath(config.activityLogSpillPath);
+        activityLog.start();
+
+        // New activities are read once and pushed to every open activity list
+        auto& activityFeed = StudentIntake::Api::ActivityFeed::getInstance();
+        activityFeed.setApiClient(std::make_shared<StudentIntake::Api::ApiClient>(config.apiBaseUrl));
+        activityFeed.setPollInterval(config.activityFeedPollIntervalMs);
+        activityFeed.start();
+
+        auto& submissionIndex = StudentIntake::Api::SubmissionIndex::getInstance();
+        submissionIndex.setApiClient(std::make_shared<StudentIntake::Api::ApiClient>(config.apiBaseUrl));
+        submissionIndex.start();
+
+        // Expire student sessions left idle longer than the session timeout
+        auto& sessionManager = StudentIntake::Session::SessionManager::getInstance();
+        sessionManager.setSessionTimeout(config.sessionTimeoutMinutes);
+        sessionManager.start();
+
+        // Run the server; every service above is ready before the first request
         if (server.start()) {
             // Wait for shutdown signal
             int sig = Wt::WServer::waitForShutdown();
             LOG_INFO("Main", "Shutdown (signal = " << sig << ")");
             server.stop();
+        } else {
+            LOG_ERROR("Main", "Server did not start");
         }
+
+        stopServices();
     } catch (const Wt::WServer::Exception& e) {
         LOG_ERROR("Main", "Server exception: " << e.what());
+        stopServices();
         return 1;
     } catch (const std::exception& e) {
         LOG_ERROR("Main", "Exception: " << e.what());
+        stopServices();
         return 1;
     }
 
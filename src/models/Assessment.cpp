@@ -52,7 +52,8 @@ Assessment::Assessment()
     , showCorrectAnswers_(false)
     , isActive_(true)
     , availableFrom_("")
-    , availableUntil_("") {
+    , availableUntil_("")
+    , updatedAt_("") {
 }
 
 Assessment::Assessment(const std::string& id, const std::string& title)
@@ -74,7 +75,8 @@ Assessment::Assessment(const std::string& id, const std::string& title)
     , showCorrectAnswers_(false)
     , isActive_(true)
     , availableFrom_("")
-    , availableUntil_("") {
+    , availableUntil_("")
+    , updatedAt_("") {
 }
 
 std::string Assessment::getAssessmentTypeString() const {
@@ -190,6 +192,8 @@ Assessment Assessment::fromJson(const nlohmann::json& json) {
         assessment.availableFrom_ = attrs["available_from"].get<std::string>();
     if (attrs.contains("available_until") && !attrs["available_until"].is_null())
         assessment.availableUntil_ = attrs["available_until"].get<std::string>();
+    if (attrs.contains("updated_at") && !attrs["updated_at"].is_null())
+        assessment.updatedAt_ = attrs["updated_at"].get<std::string>();
 
     return assessment;
 }
@@ -207,7 +211,8 @@ AssessmentQuestion::AssessmentQuestion()
     , correctAnswer_("")
     , explanation_("")
     , points_(1)
-    , isActive_(true) {
+    , isActive_(true)
+    , updatedAt_("") {
 }
 
 AssessmentQuestion::AssessmentQuestion(const std::string& id, const std::string& questionText)
@@ -219,7 +224,8 @@ AssessmentQuestion::AssessmentQuestion(const std::string& id, const std::string&
     , correctAnswer_("")
     , explanation_("")
     , points_(1)
-    , isActive_(true) {
+    , isActive_(true)
+    , updatedAt_("") {
 }
 
 std::string AssessmentQuestion::getQuestionTypeString() const {
@@ -351,6 +357,9 @@ AssessmentQuestion AssessmentQuestion::fromJson(const nlohmann::json& json) {
     if (attrs.contains("is_active") && !attrs["is_active"].is_null())
         question.isActive_ = attrs["is_active"].get<bool>();
 
+    if (attrs.contains("updated_at") && !attrs["updated_at"].is_null())
+        question.updatedAt_ = attrs["updated_at"].get<std::string>();
+
     return question;
 }
 
@@ -83,6 +83,7 @@ public:
     bool isActive() const { return isActive_; }
     std::string getAvailableFrom() const { return availableFrom_; }
     std::string getAvailableUntil() const { return availableUntil_; }
+    std::string getUpdatedAt() const { return updatedAt_; }
 
     // Setters
     void setId(const std::string& id) { id_ = id; }
@@ -105,6 +106,7 @@ public:
     void setActive(bool active) { isActive_ = active; }
     void setAvailableFrom(const std::string& timestamp) { availableFrom_ = timestamp; }
     void setAvailableUntil(const std::string& timestamp) { availableUntil_ = timestamp; }
+    void setUpdatedAt(const std::string& timestamp) { updatedAt_ = timestamp; }
 
     // Serialization
     nlohmann::json toJson() const;
@@ -138,6 +140,7 @@ private:
     bool isActive_;
     std::string availableFrom_;
     std::string availableUntil_;
+    std::string updatedAt_;
 };
 
 /**
@@ -161,6 +164,7 @@ public:
     std::string getExplanation() const { return explanation_; }
     int getPoints() const { return points_; }
     bool isActive() const { return isActive_; }
+    std::string getUpdatedAt() const { return updatedAt_; }
 
     // Setters
     void setId(const std::string& id) { id_ = id; }
@@ -176,6 +180,7 @@ public:
     void setExplanation(const std::string& explanation) { explanation_ = explanation; }
     void setPoints(int points) { points_ = points; }
     void setActive(bool active) { isActive_ = active; }
+    void setUpdatedAt(const std::string& timestamp) { updatedAt_ = timestamp; }
 
     // Serialization
     nlohmann::json toJson() const;
@@ -201,6 +206,7 @@ private:
     std::string explanation_;
     int points_;
     bool isActive_;
+    std::string updatedAt_;
 };
 
 /**
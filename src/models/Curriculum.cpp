@@ -81,6 +81,25 @@ bool Curriculum::requiresForm(const std::string& formId) const {
            != requiredForms_.end();
 }
 
+bool Curriculum::operator==(const Curriculum& other) const {
+    return id_ == other.id_
+        && code_ == other.code_
+        && name_ == other.name_
+        && description_ == other.description_
+        && department_ == other.department_
+        && departmentId_ == other.departmentId_
+        && degreeType_ == other.degreeType_
+        && creditHours_ == other.creditHours_
+        && durationSemesters_ == other.durationSemesters_
+        && durationInterval_ == other.durationInterval_
+        && requiredForms_ == other.requiredForms_
+        && prerequisites_ == other.prerequisites_
+        && isActive_ == other.isActive_
+        && isOnline_ == other.isOnline_
+        && isEndorsement_ == other.isEndorsement_
+        && cdlClass_ == other.cdlClass_;
+}
+
 // Form type ID mapping: string form ID <-> integer form_type_id
 int Curriculum::formIdToTypeId(const std::string& formId) {
     static const std::map<std::string, int> mapping = {
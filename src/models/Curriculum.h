@@ -1,6 +1,7 @@
 #ifndef CURRICULUM_H
 #define CURRICULUM_H
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -69,6 +70,10 @@ public:
     nlohmann::json toJson() const;
     static Curriculum fromJson(const nlohmann::json& json);
 
+    // Field-by-field comparison (toJson omits the id)
+    bool operator==(const Curriculum& other) const;
+    bool operator!=(const Curriculum& other) const { return !(*this == other); }
+
 private:
     std::string id_;
     std::string code_;  // Unique program code (required)
@@ -88,6 +93,11 @@ private:
     std::string cdlClass_;     // CDL class: "A", "B", or empty for non-CDL
 };
 
+/**
+ * @brief Shared, immutable curriculum as handed out by CurriculumRegistry
+ */
+using CurriculumPtr = std::shared_ptr<const Curriculum>;
+
 /**
  * @brief Department information
  */
@@ -345,6 +345,13 @@ Student Student::fromJson(const nlohmann::json& json) {
         student.status_ = attrs["status"].get<std::string>();
     }
 
+    // Handle createdAt/created_at
+    if (attrs.contains("createdAt") && attrs["createdAt"].is_string()) {
+        student.createdAt_ = attrs["createdAt"].get<std::string>();
+    } else if (attrs.contains("created_at") && attrs["created_at"].is_string()) {
+        student.createdAt_ = attrs["created_at"].get<std::string>();
+    }
+
     // Handle boolean fields with snake_case alternatives
     if (attrs.contains("isInternational") && attrs["isInternational"].is_boolean()) {
         student.isInternational_ = attrs["isInternational"].get<bool>();
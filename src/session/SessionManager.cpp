@@ -1,122 +1,460 @@
 #include "SessionManager.h"
+#include "utils/Logger.h"
 #include <algorithm>
 
 namespace StudentIntake {
 namespace Session {
 
+// =============================================================================
+// FormTypeCatalog
+// =============================================================================
+
+const Models::FormTypeInfo* FormTypeCatalog::find(const std::string& formId) const {
+    auto it = indexById.find(formId);
+    return it == indexById.end() ? nullptr : &formTypes[it->second];
+}
+
+// =============================================================================
+// SessionManager
+// =============================================================================
+
 SessionManager& SessionManager::getInstance() {
     static SessionManager instance;
     return instance;
 }
 
 SessionManager::SessionManager()
-    : sessionTimeoutMinutes_(60) {
+    : sessionCount_(0)
+    , formTypes_(std::make_shared<FormTypeCatalog>())
+    , sessionTimeoutMinutes_(60)
+    , epoch_(std::chrono::steady_clock::now())
+    , expiredSessions_(0)
+    , reclaimedBytes_(0)
+    , running_(false)
+    , stopRequested_(false) {
 }
 
 SessionManager::~SessionManager() {
+    stop();
 }
 
-std::shared_ptr<StudentSession> SessionManager::createSession() {
-    std::lock_guard<std::mutex> lock(mutex_);
+size_t SessionManager::shardIndex(const std::string& key) {
+    return std::hash<std::string>{}(key) % kShardCount;
+}
 
+std::shared_ptr<StudentSession> SessionManager::createSession(ExpiryHandler onExpired) {
     auto session = std::make_shared<StudentSession>();
-    sessions_[session->getSessionId()] = session;
+    std::string sessionId = session->getSessionId();
+    {
+        std::lock_guard<std::mutex> lock(shards_[shardIndex(sessionId)].mutex);
+        insertLocked(session, std::move(onExpired));
+    }
+    scheduleExpiry(sessionId, session->getLastActivity() + std::chrono::minutes(sessionTimeoutMinutes_.load()));
 
     if (onSessionCreated_) {
-        onSessionCreated_(session->getSessionId());
+        onSessionCreated_(sessionId);
     }
 
     return session;
 }
 
+void SessionManager::insertLocked(const std::shared_ptr<StudentSession>& session, ExpiryHandler onExpired) {
+    auto& shard = shards_[shardIndex(session->getSessionId())];
+    auto inserted = shard.sessions.emplace(session->getSessionId(),
+                                           SessionEntry{session, "", "", std::move(onExpired)});
+    if (inserted.second) {
+        sessionCount_++;
+    }
+}
+
 std::shared_ptr<StudentSession> SessionManager::getSession(const std::string& sessionId) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    const auto& shard = shards_[shardIndex(sessionId)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
 
-    auto it = sessions_.find(sessionId);
-    if (it != sessions_.end()) {
-        return it->second;
+    auto it = shard.sessions.find(sessionId);
+    if (it != shard.sessions.end()) {
+        return it->second.session;
     }
     return nullptr;
 }
 
 bool SessionManager::hasSession(const std::string& sessionId) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return sessions_.find(sessionId) != sessions_.end();
+    const auto& shard = shards_[shardIndex(sessionId)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.sessions.find(sessionId) != shard.sessions.end();
 }
 
 void SessionManager::removeSession(const std::string& sessionId) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    // Released after the lock, so a large session is not freed while holding it
+    std::shared_ptr<StudentSession> removed;
+    {
+        auto& shard = shards_[shardIndex(sessionId)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto it = shard.sessions.find(sessionId);
+        if (it == shard.sessions.end()) {
+            return;
+        }
+        reindexLocked(it->second, sessionId, "", "");
+        removed = std::move(it->second.session);
+        shard.sessions.erase(it);
+        sessionCount_--;
+    }
+
+    if (onSessionDestroyed_) {
+        onSessionDestroyed_(sessionId);
+    }
+}
+
+void SessionManager::resetSession(const std::shared_ptr<StudentSession>& session) {
+    if (!session) {
+        return;
+    }
+
+    std::string oldId = session->getSessionId();
+    bool registered = false;
+    ExpiryHandler onExpired;
+    {
+        auto& shard = shards_[shardIndex(oldId)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto it = shard.sessions.find(oldId);
+        if (it != shard.sessions.end() && it->second.session == session) {
+            reindexLocked(it->second, oldId, "", "");
+            onExpired = std::move(it->second.onExpired);
+            shard.sessions.erase(it);
+            sessionCount_--;
+            registered = true;
+        }
+    }
+
+    session->reset();
+    if (!registered) {
+        return;
+    }
+
+    std::string newId = session->getSessionId();
+    {
+        std::lock_guard<std::mutex> lock(shards_[shardIndex(newId)].mutex);
+        insertLocked(session, std::move(onExpired));
+    }
+    session->touch();
+    scheduleExpiry(newId, session->getLastActivity() + std::chrono::minutes(sessionTimeoutMinutes_.load()));
+
+    if (onSessionDestroyed_) {
+        onSessionDestroyed_(oldId);
+    }
+    if (onSessionCreated_) {
+        onSessionCreated_(newId);
+    }
+}
 
-    auto it = sessions_.find(sessionId);
-    if (it != sessions_.end()) {
-        if (onSessionDestroyed_) {
-            onSessionDestroyed_(sessionId);
+// =============================================================================
+// Idle Expiry
+// =============================================================================
+
+void SessionManager::start() {
+    std::lock_guard<std::mutex> lock(threadMutex_);
+    if (running_) {
+        return;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    expiryThread_ = std::thread([this]() { expiryLoop(); });
+    LOG_DEBUG("SessionManager", "Session expiry started (timeout " << sessionTimeoutMinutes_.load() << " min)");
+}
+
+void SessionManager::stop() {
+    {
+        std::lock_guard<std::mutex> lock(threadMutex_);
+        if (!running_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    wakeExpiry_.notify_all();
+
+    if (expiryThread_.joinable()) {
+        expiryThread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(threadMutex_);
+    running_ = false;
+    stopRequested_ = false;
+}
+
+bool SessionManager::isRunning() const {
+    std::lock_guard<std::mutex> lock(threadMutex_);
+    return running_;
+}
+
+void SessionManager::expiryLoop() {
+    std::unique_lock<std::mutex> lock(threadMutex_);
+    while (!stopRequested_) {
+        wakeExpiry_.wait_for(lock, kExpiryTick, [this]() { return stopRequested_; });
+        if (stopRequested_) {
+            break;
         }
-        sessions_.erase(it);
+        lock.unlock();
+        removeExpiredSessions(std::chrono::steady_clock::now());
+        lock.lock();
     }
 }
 
 void SessionManager::removeExpiredSessions() {
-    std::lock_guard<std::mutex> lock(mutex_);
+    removeExpiredSessions(std::chrono::steady_clock::now());
+}
+
+size_t SessionManager::removeExpiredSessions(std::chrono::steady_clock::time_point now) {
+    std::vector<std::string> due;
+    {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        wheel_.advance(tickAt(now, false), due);
+    }
+    if (due.empty()) {
+        // Owners of sessions expired earlier may have let go since
+        collectReleased();
+        return 0;
+    }
+
+    int timeoutMinutes = sessionTimeoutMinutes_.load();
+    auto timeout = std::chrono::minutes(timeoutMinutes);
+    std::vector<std::pair<std::string, SessionEntry>> expired;
+    std::vector<std::pair<std::string, std::chrono::steady_clock::time_point>> rearm;
+
+    // A timer for a session already removed (or reset to a new id) finds nothing
+    for (auto& sessionId : due) {
+        auto& shard = shards_[shardIndex(sessionId)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(sessionId);
+        if (it == shard.sessions.end()) {
+            continue;
+        }
+
+        auto deadline = it->second.session->getLastActivity() + timeout;
+        if (timeoutMinutes <= 0) {
+            rearm.emplace_back(std::move(sessionId), now + std::chrono::minutes(1));
+        } else if (deadline > now) {
+            rearm.emplace_back(std::move(sessionId), deadline);
+        } else {
+            reindexLocked(it->second, sessionId, "", "");
+            expired.emplace_back(std::move(sessionId), std::move(it->second));
+            shard.sessions.erase(it);
+            sessionCount_--;
+        }
+    }
 
-    // In a production environment, you would track last activity time
-    // and remove sessions that have been inactive for sessionTimeoutMinutes_
-    // For now, this is a placeholder for the cleanup logic
+    if (!rearm.empty()) {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        for (const auto& timer : rearm) {
+            wheel_.schedule(timer.first, tickAt(timer.second, true));
+        }
+    }
+
+    // Drop our references and run callbacks with no session lock held
+    {
+        std::lock_guard<std::mutex> lock(releaseMutex_);
+        for (auto& entry : expired) {
+            awaitingRelease_.push_back({entry.second.session, entry.second.session->estimateMemoryUsage()});
+            entry.second.session.reset();
+        }
+    }
+    expiredSessions_ += expired.size();
+
+    // An open application still holds its session; ending it is what frees the memory
+    for (const auto& entry : expired) {
+        if (entry.second.onExpired) {
+            entry.second.onExpired();
+        }
+    }
+    if (onSessionDestroyed_) {
+        for (const auto& entry : expired) {
+            onSessionDestroyed_(entry.first);
+        }
+    }
+    uint64_t reclaimed = collectReleased();
+
+    if (!expired.empty()) {
+        LOG_FIELDS(INFO, "SessionManager", "Expired idle sessions",
+                   {"expired", expired.size()}, {"reclaimed_bytes", reclaimed}, {"live", sessionCount_.load()});
+    }
+    return expired.size();
 }
 
-std::shared_ptr<StudentSession> SessionManager::getSessionByStudentId(const std::string& studentId) {
-    std::lock_guard<std::mutex> lock(mutex_);
+uint64_t SessionManager::collectReleased() {
+    uint64_t reclaimed = 0;
+    {
+        std::lock_guard<std::mutex> lock(releaseMutex_);
+        auto released = std::remove_if(awaitingRelease_.begin(), awaitingRelease_.end(),
+                                       [&reclaimed](const ReleaseWatch& watch) {
+                                           if (!watch.session.expired()) {
+                                               return false;
+                                           }
+                                           reclaimed += watch.bytes;
+                                           return true;
+                                       });
+        awaitingRelease_.erase(released, awaitingRelease_.end());
+    }
+    reclaimedBytes_ += reclaimed;
+    return reclaimed;
+}
+
+uint64_t SessionManager::tickAt(std::chrono::steady_clock::time_point time, bool roundUp) const {
+    if (time <= epoch_) {
+        return 0;
+    }
+    auto elapsed = time - epoch_;
+    auto ticks = std::chrono::duration_cast<std::chrono::seconds>(elapsed) / kExpiryTick;
+    if (roundUp && elapsed > ticks * kExpiryTick) {
+        ticks++;
+    }
+    return static_cast<uint64_t>(ticks);
+}
+
+void SessionManager::scheduleExpiry(const std::string& sessionId, std::chrono::steady_clock::time_point deadline) {
+    std::lock_guard<std::mutex> lock(wheelMutex_);
+    wheel_.schedule(sessionId, tickAt(deadline, true));
+}
+
+// =============================================================================
+// Secondary Indexes
+// =============================================================================
+
+void SessionManager::updateSessionIndex(const std::shared_ptr<StudentSession>& session) {
+    if (!session) {
+        return;
+    }
+
+    std::string sessionId = session->getSessionId();
+    std::string studentId;
+    std::string email;
+    if (session->isLoggedIn()) {
+        studentId = session->getStudent().getId();
+        email = session->getStudent().getEmail();
+    }
+
+    auto& shard = shards_[shardIndex(sessionId)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.sessions.find(sessionId);
+    if (it != shard.sessions.end() && it->second.session == session) {
+        reindexLocked(it->second, sessionId, studentId, email);
+    }
+}
+
+// Caller holds the session's shard lock; index locks nest inside it, never the reverse
+void SessionManager::reindexLocked(SessionEntry& entry, const std::string& sessionId,
+                                   const std::string& studentId, const std::string& email) {
+    if (entry.studentId != studentId) {
+        indexErase(studentIdIndex_, entry.studentId, sessionId);
+        indexInsert(studentIdIndex_, studentId, sessionId);
+        entry.studentId = studentId;
+    }
+    if (entry.email != email) {
+        indexErase(emailIndex_, entry.email, sessionId);
+        indexInsert(emailIndex_, email, sessionId);
+        entry.email = email;
+    }
+}
 
-    for (const auto& pair : sessions_) {
-        if (pair.second->getStudent().getId() == studentId) {
-            return pair.second;
+void SessionManager::indexInsert(Index& index, const std::string& key, const std::string& sessionId) {
+    if (key.empty()) {
+        return;
+    }
+    auto& shard = index[shardIndex(key)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.sessionIds.emplace(key, sessionId);
+}
+
+void SessionManager::indexErase(Index& index, const std::string& key, const std::string& sessionId) {
+    if (key.empty()) {
+        return;
+    }
+    auto& shard = index[shardIndex(key)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto range = shard.sessionIds.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == sessionId) {
+            shard.sessionIds.erase(it);
+            return;
         }
     }
-    return nullptr;
 }
 
-std::shared_ptr<StudentSession> SessionManager::getSessionByEmail(const std::string& email) {
-    std::lock_guard<std::mutex> lock(mutex_);
+std::shared_ptr<StudentSession> SessionManager::findIndexed(const Index& index, const std::string& key,
+                                                            std::string SessionEntry::*field) const {
+    if (key.empty()) {
+        return nullptr;
+    }
 
-    for (const auto& pair : sessions_) {
-        if (pair.second->getStudent().getEmail() == email) {
-            return pair.second;
+    std::vector<std::string> sessionIds;
+    {
+        const auto& shard = index[shardIndex(key)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto range = shard.sessionIds.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            sessionIds.push_back(it->second);
+        }
+    }
+
+    // The index lock is released first; recheck under the session's shard lock
+    for (const auto& sessionId : sessionIds) {
+        const auto& shard = shards_[shardIndex(sessionId)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.sessions.find(sessionId);
+        if (it != shard.sessions.end() && it->second.*field == key) {
+            return it->second.session;
         }
     }
     return nullptr;
 }
 
+std::shared_ptr<StudentSession> SessionManager::getSessionByStudentId(const std::string& studentId) {
+    return findIndexed(studentIdIndex_, studentId, &SessionEntry::studentId);
+}
+
+std::shared_ptr<StudentSession> SessionManager::getSessionByEmail(const std::string& email) {
+    return findIndexed(emailIndex_, email, &SessionEntry::email);
+}
+
+// =============================================================================
+// Form Configuration
+// =============================================================================
+
 void SessionManager::setFormTypeInfos(const std::vector<Models::FormTypeInfo>& formTypes) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    formTypeInfos_ = formTypes;
+    auto catalog = std::make_shared<FormTypeCatalog>();
+    catalog->formTypes = formTypes;
+    for (size_t i = 0; i < catalog->formTypes.size(); ++i) {
+        // First definition wins, matching the old linear search
+        catalog->indexById.emplace(catalog->formTypes[i].id, i);
+    }
+    std::atomic_store(&formTypes_, FormTypeCatalogPtr(std::move(catalog)));
 }
 
 std::vector<Models::FormTypeInfo> SessionManager::getFormTypeInfos() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return formTypeInfos_;
+    return getFormTypeCatalog()->formTypes;
 }
 
 Models::FormTypeInfo SessionManager::getFormTypeInfo(const std::string& formId) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    auto catalog = getFormTypeCatalog();
+    const Models::FormTypeInfo* info = catalog->find(formId);
+    return info ? *info : Models::FormTypeInfo{};
+}
 
-    for (const auto& info : formTypeInfos_) {
-        if (info.id == formId) {
-            return info;
-        }
-    }
-    return Models::FormTypeInfo{};
+FormTypeCatalogPtr SessionManager::getFormTypeCatalog() const {
+    return std::atomic_load(&formTypes_);
 }
 
 std::vector<std::string> SessionManager::calculateRequiredForms(
     const Models::Student& student,
     const Models::Curriculum& curriculum) const {
 
-    std::lock_guard<std::mutex> lock(mutex_);
+    auto catalog = getFormTypeCatalog();
 
     std::vector<std::string> requiredForms;
     int studentAge = student.getAge();
 
-    for (const auto& formInfo : formTypeInfos_) {
+    for (const auto& formInfo : catalog->formTypes) {
         bool isRequired = false;
 
         // Check if universally required
@@ -184,29 +522,43 @@ std::vector<std::string> SessionManager::calculateRequiredForms(
 
     // Sort by display order
     std::sort(requiredForms.begin(), requiredForms.end(),
-              [this](const std::string& a, const std::string& b) {
-                  int orderA = 0, orderB = 0;
-                  for (const auto& info : formTypeInfos_) {
-                      if (info.id == a) orderA = info.displayOrder;
-                      if (info.id == b) orderB = info.displayOrder;
-                  }
-                  return orderA < orderB;
+              [&catalog](const std::string& a, const std::string& b) {
+                  return catalog->find(a)->displayOrder < catalog->find(b)->displayOrder;
               });
 
     return requiredForms;
 }
 
+// =============================================================================
+// Statistics
+// =============================================================================
+
 size_t SessionManager::getActiveSessionCount() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return sessions_.size();
+    return sessionCount_.load();
 }
 
-std::vector<std::string> SessionManager::getActiveSessionIds() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+SessionStats SessionManager::getStats() const {
+    SessionStats stats;
+    stats.liveSessions = sessionCount_.load();
+    stats.expiredSessions = expiredSessions_.load();
+    stats.reclaimedBytes = reclaimedBytes_.load();
+    {
+        std::lock_guard<std::mutex> lock(releaseMutex_);
+        stats.awaitingRelease = awaitingRelease_.size();
+    }
+    std::lock_guard<std::mutex> lock(wheelMutex_);
+    stats.scheduledTimers = wheel_.size();
+    return stats;
+}
 
+std::vector<std::string> SessionManager::getActiveSessionIds() const {
     std::vector<std::string> ids;
-    for (const auto& pair : sessions_) {
-        ids.push_back(pair.first);
+    ids.reserve(sessionCount_.load());
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (const auto& pair : shard.sessions) {
+            ids.push_back(pair.first);
+        }
     }
     return ids;
 }
@@ -3,18 +3,65 @@
 
 #include <string>
 #include <memory>
-#include <map>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <thread>
+#include <unordered_map>
 #include <mutex>
 #include <functional>
 #include "StudentSession.h"
+#include "TimerWheel.h"
 #include "models/FormData.h"
 
 namespace StudentIntake {
 namespace Session {
 
+/**
+ * @brief Form types as published by setFormTypeInfos, with an id lookup
+ * Never modified after publication; readers share it.
+ */
+struct FormTypeCatalog {
+    std::vector<Models::FormTypeInfo> formTypes;        // in the order they were set
+    std::unordered_map<std::string, size_t> indexById;  // id -> position in formTypes
+
+    const Models::FormTypeInfo* find(const std::string& formId) const;
+};
+
+using FormTypeCatalogPtr = std::shared_ptr<const FormTypeCatalog>;
+
+struct SessionStats {
+    size_t liveSessions = 0;
+    uint64_t expiredSessions = 0;   // removed for being idle, since start
+    uint64_t reclaimedBytes = 0;    // estimated size of expired sessions, once their last holder let go
+    size_t awaitingRelease = 0;     // expired sessions their owner has not released yet
+    size_t scheduledTimers = 0;     // expiry timers in the wheel, including stale ones
+};
+
 /**
  * @brief Manages all active student sessions
  * Thread-safe singleton for session management
+ *
+ * Sessions are spread over shards by session id, each with its own lock, so
+ * requests for different sessions rarely wait on each other. Lookups by
+ * student id and email go through hash indexes (also sharded) instead of
+ * scanning every session; the indexes hold logged-in sessions only and are
+ * refreshed by updateSessionIndex() after a login and by resetSession() on
+ * logout. Form types are an immutable catalog swapped in as a whole, so
+ * readers take a pointer copy without locking.
+ *
+ * Idle sessions expire through a timer wheel with one-second ticks. Each
+ * session has one timer, set for its last activity plus the timeout; when it
+ * fires, a session touched since is re-armed from its new last activity
+ * instead of expired, so touch() itself costs one atomic store. After
+ * start(), a background thread advances the wheel every tick.
+ *
+ * Expiry only drops the manager's reference. The owner of a session (the Wt
+ * application) is told through the handler given to createSession() and is
+ * expected to end itself, which is what frees the session; reclaimedBytes
+ * counts a session only once its last reference is gone.
  */
 class SessionManager {
 public:
@@ -25,14 +72,36 @@ public:
     SessionManager(const SessionManager&) = delete;
     SessionManager& operator=(const SessionManager&) = delete;
 
+    // Called without any lock held when the session expires
+    using ExpiryHandler = std::function<void()>;
+
     // Session lifecycle
-    std::shared_ptr<StudentSession> createSession();
+    std::shared_ptr<StudentSession> createSession(ExpiryHandler onExpired = nullptr);
     std::shared_ptr<StudentSession> getSession(const std::string& sessionId);
     bool hasSession(const std::string& sessionId) const;
     void removeSession(const std::string& sessionId);
+
+    // Idle expiry
+    void start();
+    void stop();
+    bool isRunning() const;
     void removeExpiredSessions();
+    size_t removeExpiredSessions(std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Reset a session on logout and keep it registered under its new id
+     * StudentSession::reset() issues a new session id; calling it directly
+     * would leave the manager holding the old one.
+     */
+    void resetSession(const std::shared_ptr<StudentSession>& session);
 
-    // Session lookup
+    /**
+     * @brief Re-read the session's student id, email and login state into the indexes
+     * Call from the session's own thread after a login or a change of student.
+     */
+    void updateSessionIndex(const std::shared_ptr<StudentSession>& session);
+
+    // Session lookup (logged-in sessions only)
     std::shared_ptr<StudentSession> getSessionByStudentId(const std::string& studentId);
     std::shared_ptr<StudentSession> getSessionByEmail(const std::string& email);
 
@@ -40,6 +109,7 @@ public:
     void setFormTypeInfos(const std::vector<Models::FormTypeInfo>& formTypes);
     std::vector<Models::FormTypeInfo> getFormTypeInfos() const;
     Models::FormTypeInfo getFormTypeInfo(const std::string& formId) const;
+    FormTypeCatalogPtr getFormTypeCatalog() const;
 
     // Required forms calculation based on student data
     std::vector<std::string> calculateRequiredForms(const Models::Student& student,
@@ -48,12 +118,13 @@ public:
     // Statistics
     size_t getActiveSessionCount() const;
     std::vector<std::string> getActiveSessionIds() const;
+    SessionStats getStats() const;
 
-    // Configuration
+    // Configuration; a change applies to each session from its next timer, 0 disables expiry
     void setSessionTimeout(int minutes) { sessionTimeoutMinutes_ = minutes; }
     int getSessionTimeout() const { return sessionTimeoutMinutes_; }
 
-    // Callbacks for session events
+    // Callbacks for session events (called without any session lock held)
     using SessionCallback = std::function<void(const std::string&)>;
     void setOnSessionCreated(SessionCallback callback) { onSessionCreated_ = callback; }
     void setOnSessionDestroyed(SessionCallback callback) { onSessionDestroyed_ = callback; }
@@ -62,12 +133,71 @@ private:
     SessionManager();
     ~SessionManager();
 
-    std::map<std::string, std::shared_ptr<StudentSession>> sessions_;
-    std::vector<Models::FormTypeInfo> formTypeInfos_;
-    mutable std::mutex mutex_;
-    int sessionTimeoutMinutes_;
+    static constexpr size_t kShardCount = 32;
+    static constexpr std::chrono::seconds kExpiryTick{1};
+
+    struct SessionEntry {
+        std::shared_ptr<StudentSession> session;
+        std::string studentId;      // keys currently in the indexes, empty if not indexed
+        std::string email;
+        ExpiryHandler onExpired;
+    };
+
+    // An expired session still held elsewhere; counted as reclaimed once it is freed
+    struct ReleaseWatch {
+        std::weak_ptr<StudentSession> session;
+        size_t bytes;
+    };
+
+    struct SessionShard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, SessionEntry> sessions;
+    };
+
+    // key -> session ids; a student can be logged in from several browsers
+    struct IndexShard {
+        mutable std::mutex mutex;
+        std::unordered_multimap<std::string, std::string> sessionIds;
+    };
+
+    using Index = std::array<IndexShard, kShardCount>;
+
+    static size_t shardIndex(const std::string& key);
+    void insertLocked(const std::shared_ptr<StudentSession>& session, ExpiryHandler onExpired);
+    void reindexLocked(SessionEntry& entry, const std::string& sessionId,
+                       const std::string& studentId, const std::string& email);
+    static void indexInsert(Index& index, const std::string& key, const std::string& sessionId);
+    static void indexErase(Index& index, const std::string& key, const std::string& sessionId);
+    std::shared_ptr<StudentSession> findIndexed(const Index& index, const std::string& key,
+                                                std::string SessionEntry::*field) const;
+    uint64_t tickAt(std::chrono::steady_clock::time_point time, bool roundUp) const;
+    void scheduleExpiry(const std::string& sessionId, std::chrono::steady_clock::time_point deadline);
+    uint64_t collectReleased();
+    void expiryLoop();
+
+    std::array<SessionShard, kShardCount> shards_;
+    Index studentIdIndex_;
+    Index emailIndex_;
+    std::atomic<size_t> sessionCount_;
+    FormTypeCatalogPtr formTypes_;          // read and replaced with std::atomic_load/store
+    std::atomic<int> sessionTimeoutMinutes_;
     SessionCallback onSessionCreated_;
     SessionCallback onSessionDestroyed_;
+
+    // Expiry; wheel ticks count seconds from epoch_
+    std::chrono::steady_clock::time_point epoch_;
+    mutable std::mutex wheelMutex_;
+    TimerWheel wheel_;
+    std::atomic<uint64_t> expiredSessions_;
+    std::atomic<uint64_t> reclaimedBytes_;
+    mutable std::mutex releaseMutex_;
+    std::vector<ReleaseWatch> awaitingRelease_;
+
+    mutable std::mutex threadMutex_;
+    std::condition_variable wakeExpiry_;
+    std::thread expiryThread_;
+    bool running_;
+    bool stopRequested_;
 };
 
 } // namespace Session
@@ -26,12 +26,42 @@ StudentSession::StudentSession()
     : sessionId_(generateSessionId())
     , isLoggedIn_(false)
     , authToken_("")
-    , currentFormId_("") {
+    , currentFormId_("")
+    , lastActivity_(std::chrono::steady_clock::now().time_since_epoch().count()) {
 }
 
 StudentSession::~StudentSession() {
 }
 
+const Models::Curriculum& StudentSession::getCurrentCurriculum() const {
+    static const Models::Curriculum none;
+    return currentCurriculum_ ? *currentCurriculum_ : none;
+}
+
+void StudentSession::touch(std::chrono::steady_clock::time_point now) {
+    lastActivity_.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+std::chrono::steady_clock::time_point StudentSession::getLastActivity() const {
+    return std::chrono::steady_clock::time_point(
+        std::chrono::steady_clock::duration(lastActivity_.load(std::memory_order_relaxed)));
+}
+
+size_t StudentSession::estimateMemoryUsage() const {
+    // Serialized sizes stand in for the strings, vectors and maps behind each object
+    size_t bytes = sizeof(*this) + sessionId_.capacity() + authToken_.capacity() + currentFormId_.capacity();
+    bytes += student_.toJson().dump().size();
+    // Curricula are shared handles; only the pointers belong to the session
+    bytes += selectedEndorsements_.capacity() * sizeof(Models::CurriculumPtr);
+    for (const auto& pair : formDataCache_) {
+        bytes += sizeof(pair) + pair.first.capacity() + pair.second.toJson().dump().size();
+    }
+    for (const auto& formId : requiredFormIds_) {
+        bytes += sizeof(formId) + formId.capacity();
+    }
+    return bytes;
+}
+
 void StudentSession::setFormData(const std::string& formId, const Models::FormData& data) {
     Models::FormData mutableData = data;
     mutableData.setSessionId(sessionId_);
@@ -111,10 +141,12 @@ void StudentSession::reset() {
     isLoggedIn_ = false;
     authToken_.clear();
     student_ = Models::Student();
-    currentCurriculum_ = Models::Curriculum();
+    currentCurriculum_.reset();
+    selectedEndorsements_.clear();
     formDataCache_.clear();
     requiredFormIds_.clear();
     currentFormId_.clear();
+    enrollmentProgress_.reset();
 }
 
 void StudentSession::logout() {
@@ -123,6 +155,7 @@ void StudentSession::logout() {
     // Keep student data for potential re-login
     formDataCache_.clear();
     currentFormId_.clear();
+    enrollmentProgress_.reset();
 }
 
 } // namespace Session
@@ -4,6 +4,8 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <atomic>
+#include <chrono>
 #include <Wt/Auth/Login.h>
 #include <Wt/Dbo/Session.h>
 #include <Wt/Dbo/ptr.h>
@@ -12,6 +14,11 @@
 #include "models/Curriculum.h"
 
 namespace StudentIntake {
+
+namespace Api {
+class EnrollmentProgress;
+}
+
 namespace Session {
 
 /**
@@ -38,17 +45,16 @@ public:
     const Models::Student& getStudent() const { return student_; }
     void setStudent(const Models::Student& student) { student_ = student; }
 
-    // Curriculum (base program)
-    Models::Curriculum& getCurrentCurriculum() { return currentCurriculum_; }
-    const Models::Curriculum& getCurrentCurriculum() const { return currentCurriculum_; }
-    void setCurrentCurriculum(const Models::Curriculum& curriculum) { currentCurriculum_ = curriculum; }
-    bool hasCurriculumSelected() const { return !currentCurriculum_.getId().empty(); }
+    // Curriculum (base program); shared, immutable handles from CurriculumRegistry
+    const Models::Curriculum& getCurrentCurriculum() const;  // empty curriculum when none selected
+    void setCurrentCurriculum(Models::CurriculumPtr curriculum) { currentCurriculum_ = std::move(curriculum); }
+    void clearCurrentCurriculum() { currentCurriculum_.reset(); }
+    bool hasCurriculumSelected() const { return currentCurriculum_ && !currentCurriculum_->getId().empty(); }
 
     // Endorsements (vocational mode)
-    std::vector<Models::Curriculum>& getSelectedEndorsements() { return selectedEndorsements_; }
-    const std::vector<Models::Curriculum>& getSelectedEndorsements() const { return selectedEndorsements_; }
-    void setSelectedEndorsements(const std::vector<Models::Curriculum>& endorsements) { selectedEndorsements_ = endorsements; }
-    void addSelectedEndorsement(const Models::Curriculum& endorsement) { selectedEndorsements_.push_back(endorsement); }
+    const std::vector<Models::CurriculumPtr>& getSelectedEndorsements() const { return selectedEndorsements_; }
+    void setSelectedEndorsements(std::vector<Models::CurriculumPtr> endorsements) { selectedEndorsements_ = std::move(endorsements); }
+    void addSelectedEndorsement(Models::CurriculumPtr endorsement) { selectedEndorsements_.push_back(std::move(endorsement)); }
     void clearSelectedEndorsements() { selectedEndorsements_.clear(); }
 
     // Form data management
@@ -75,6 +81,17 @@ public:
     double getProgressPercentage() const;
     bool isIntakeComplete() const;
 
+    // Classroom progress for the enrollment currently open
+    std::shared_ptr<Api::EnrollmentProgress> getEnrollmentProgress() const { return enrollmentProgress_; }
+    void setEnrollmentProgress(std::shared_ptr<Api::EnrollmentProgress> progress) { enrollmentProgress_ = progress; }
+
+    // Activity tracking for idle expiry; safe to call from any thread
+    void touch(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    std::chrono::steady_clock::time_point getLastActivity() const;
+
+    // Approximate heap and object size, for the reclaimed-memory gauge
+    size_t estimateMemoryUsage() const;
+
     // Session state
     void reset();
     void logout();
@@ -84,11 +101,13 @@ private:
     bool isLoggedIn_;
     std::string authToken_;
     Models::Student student_;
-    Models::Curriculum currentCurriculum_;
-    std::vector<Models::Curriculum> selectedEndorsements_;
+    Models::CurriculumPtr currentCurriculum_;
+    std::vector<Models::CurriculumPtr> selectedEndorsements_;
     std::map<std::string, Models::FormData> formDataCache_;
     std::vector<std::string> requiredFormIds_;
     std::string currentFormId_;
+    std::shared_ptr<Api::EnrollmentProgress> enrollmentProgress_;
+    std::atomic<std::chrono::steady_clock::rep> lastActivity_;
 };
 
 } // namespace Session
@@ -0,0 +1,73 @@
+#include "TimerWheel.h"
+#include <algorithm>
+#include <utility>
+
+namespace StudentIntake {
+namespace Session {
+
+TimerWheel::TimerWheel(uint64_t startTick)
+    : current_(startTick)
+    , size_(0) {
+}
+
+void TimerWheel::schedule(const std::string& key, uint64_t deadlineTick) {
+    // The current tick's slot has already fired
+    place(Timer{key, std::max(deadlineTick, current_ + 1)});
+    size_++;
+}
+
+void TimerWheel::advance(uint64_t tick, std::vector<std::string>& expired) {
+    while (current_ < tick) {
+        ++current_;
+
+        // Bring timers from the upper levels down before firing this tick's slot
+        for (size_t level = kLevels - 1; level > 0; --level) {
+            uint64_t span = uint64_t(1) << (kSlotBits * level);
+            if ((current_ & (span - 1)) == 0) {
+                cascade(level);
+            }
+        }
+
+        std::vector<Timer> due;
+        due.swap(slots_[0][current_ & (kSlots - 1)]);
+        for (auto& timer : due) {
+            if (timer.deadline <= current_) {
+                expired.push_back(std::move(timer.key));
+                size_--;
+            } else {
+                place(std::move(timer));
+            }
+        }
+    }
+}
+
+// Level L holds timers due in under 64^(L+1) ticks, in the slot of their deadline's
+// level-L digit; it is emptied into the levels below when the wheel reaches that digit
+void TimerWheel::place(Timer timer) {
+    uint64_t deadline = std::max(timer.deadline, current_);
+    uint64_t delta = deadline - current_;
+
+    for (size_t level = 0; level < kLevels; ++level) {
+        if (delta < (uint64_t(1) << (kSlotBits * (level + 1)))) {
+            size_t slot = (deadline >> (kSlotBits * level)) & (kSlots - 1);
+            slots_[level][slot].push_back(std::move(timer));
+            return;
+        }
+    }
+
+    // Beyond the wheel: park at its far edge and re-place from there
+    uint64_t edge = current_ + (uint64_t(1) << (kSlotBits * kLevels)) - 1;
+    size_t slot = (edge >> (kSlotBits * (kLevels - 1))) & (kSlots - 1);
+    slots_[kLevels - 1][slot].push_back(std::move(timer));
+}
+
+void TimerWheel::cascade(size_t level) {
+    std::vector<Timer> timers;
+    timers.swap(slots_[level][(current_ >> (kSlotBits * level)) & (kSlots - 1)]);
+    for (auto& timer : timers) {
+        place(std::move(timer));
+    }
+}
+
+} // namespace Session
+} // namespace StudentIntake
@@ -0,0 +1,60 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace StudentIntake {
+namespace Session {
+
+/**
+ * @brief Hierarchical timer wheel keyed by string, in whole ticks
+ *
+ * Four levels of 64 slots: level 0 holds timers due within 64 ticks, level 1
+ * within 64^2, and so on (64^4 ticks, about 194 days at one tick a second).
+ * Scheduling and firing are O(1); a timer is moved down at most once per
+ * level as its deadline approaches. Timers are not cancelled: the owner
+ * checks, when one fires, whether it still applies. Not thread-safe.
+ */
+class TimerWheel {
+public:
+    static constexpr size_t kSlotBits = 6;
+    static constexpr size_t kSlots = size_t(1) << kSlotBits;
+    static constexpr size_t kLevels = 4;
+
+    explicit TimerWheel(uint64_t startTick = 0);
+
+    /**
+     * @brief Fire key once the wheel reaches deadlineTick
+     * A deadline at or before the current tick fires on the next advance.
+     */
+    void schedule(const std::string& key, uint64_t deadlineTick);
+
+    /**
+     * @brief Move to tick, appending the keys of every timer that fell due
+     */
+    void advance(uint64_t tick, std::vector<std::string>& expired);
+
+    uint64_t currentTick() const { return current_; }
+    size_t size() const { return size_; }
+
+private:
+    struct Timer {
+        std::string key;
+        uint64_t deadline;
+    };
+
+    void place(Timer timer);
+    void cascade(size_t level);
+
+    std::array<std::array<std::vector<Timer>, kSlots>, kLevels> slots_;
+    uint64_t current_;
+    size_t size_;
+};
+
+} // namespace Session
+} // namespace StudentIntake
+
+#endif // TIMER_WHEEL_H
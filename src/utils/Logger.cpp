@@ -0,0 +1,552 @@
+#include "Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+
+namespace StudentIntake {
+
+namespace {
+
+constexpr size_t kRingSlots = 8192;                 // power of two
+constexpr size_t kBatchBytes = 64 * 1024;           // write out when a batch grows past this
+constexpr int kWriterIdleMs = 100;
+
+// Timestamp re-rendered at most once a millisecond; the date and time once a second
+struct TimestampCache {
+    explicit TimestampCache(bool utcIso) : utc(utcIso) {}
+
+    bool utc;                   // "YYYY-MM-DDTHH:MM:SS.mmmZ" instead of local "YYYY-MM-DD HH:MM:SS.mmm "
+    int64_t millisecond = -1;
+    int64_t second = -1;
+    char text[32] = {0};
+    size_t length = 0;
+};
+
+// Per-thread formatting state: the line being built and the last timestamps rendered
+struct ThreadBuffer {
+    std::string line;
+    TimestampCache local{false};
+    TimestampCache utc{true};
+};
+
+ThreadBuffer& threadBuffer() {
+    thread_local ThreadBuffer buffer;
+    return buffer;
+}
+
+void appendTimestamp(TimestampCache& cache, std::string& line) {
+    auto now = std::chrono::system_clock::now();
+    int64_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+
+    if (ms != cache.millisecond) {
+        int64_t second = ms / 1000;
+        if (second != cache.second) {
+            std::time_t time = static_cast<std::time_t>(second);
+            std::tm tm;
+            if (cache.utc) {
+                gmtime_r(&time, &tm);
+            } else {
+                localtime_r(&time, &tm);
+            }
+            size_t length = std::strftime(cache.text, sizeof(cache.text),
+                                          cache.utc ? "%Y-%m-%dT%H:%M:%S" : "%Y-%m-%d %H:%M:%S", &tm);
+            cache.text[length] = '.';
+            cache.text[length + 4] = cache.utc ? 'Z' : ' ';
+            cache.length = length + 5;
+            cache.second = second;
+        }
+        int millis = static_cast<int>(ms % 1000);
+        char* digits = cache.text + cache.length - 4;
+        digits[0] = static_cast<char>('0' + millis / 100);
+        digits[1] = static_cast<char>('0' + millis / 10 % 10);
+        digits[2] = static_cast<char>('0' + millis % 10);
+        cache.millisecond = ms;
+    }
+    line.append(cache.text, cache.length);
+}
+
+void appendJsonString(std::string& line, std::string_view value) {
+    static const char* hex = "0123456789abcdef";
+    line += '"';
+    for (char c : value) {
+        switch (c) {
+            case '"':  line += "\\\""; break;
+            case '\\': line += "\\\\"; break;
+            case '\n': line += "\\n"; break;
+            case '\r': line += "\\r"; break;
+            case '\t': line += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    line += "\\u00";
+                    line += hex[(c >> 4) & 0xf];
+                    line += hex[c & 0xf];
+                } else {
+                    line += c;
+                }
+        }
+    }
+    line += '"';
+}
+
+void appendFieldValue(std::string& line, const LogField& field, bool json) {
+    char number[32];
+    switch (field.type()) {
+        case LogField::Type::Int:
+            std::snprintf(number, sizeof(number), "%lld", static_cast<long long>(field.intValue()));
+            line += number;
+            break;
+        case LogField::Type::Uint:
+            std::snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(field.uintValue()));
+            line += number;
+            break;
+        case LogField::Type::Double:
+            if (json && !std::isfinite(field.doubleValue())) {
+                line += "null";
+            } else {
+                std::snprintf(number, sizeof(number), "%.15g", field.doubleValue());
+                line += number;
+            }
+            break;
+        case LogField::Type::Bool:
+            line += field.boolValue() ? "true" : "false";
+            break;
+        case LogField::Type::String: {
+            const std::string& value = field.stringValue();
+            // Text output quotes only values that would not read back as one token
+            if (json || value.empty() || value.find_first_of(" \"=\t\n") != std::string::npos) {
+                appendJsonString(line, value);
+            } else {
+                line += value;
+            }
+            break;
+        }
+    }
+}
+
+// Thread's copy of the component overrides
+struct ComponentLevelCache {
+    uint64_t generation = UINT64_MAX;
+    std::vector<std::pair<std::string, LogLevel>> levels;
+};
+
+// Streams lent to LogMessage; one per nesting depth
+struct StreamPool {
+    std::vector<std::unique_ptr<std::ostringstream>> streams;
+    size_t depth = 0;
+};
+
+StreamPool& streamPool() {
+    thread_local StreamPool pool;
+    return pool;
+}
+
+void writeAll(FILE* out, std::string& batch) {
+    if (batch.empty()) {
+        return;
+    }
+    std::fwrite(batch.data(), 1, batch.size(), out);
+    std::fflush(out);
+    batch.clear();
+}
+
+} // namespace
+
+Logger::Logger()
+    : currentLevel_(LogLevel::INFO)
+    , showTimestamp_(false)
+    , showLevel_(true)
+    , format_(LogFormat::TEXT)
+    , levelsGeneration_(0)
+    , hasComponentLevels_(false)
+    , maxLevel_(static_cast<int>(LogLevel::INFO))
+    , slots_(new Slot[kRingSlots])
+    , mask_(kRingSlots - 1)
+    , enqueuePos_(0)
+    , dequeuePos_(0)
+    , file_(nullptr)
+    , stalls_(0)
+    , running_(false)
+    , stopRequested_(false)
+    , writerSleeping_(false)
+    , previousTerminate_(nullptr) {
+    for (size_t i = 0; i < kRingSlots; ++i) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // Whatever is still queued when the process exits is written out
+    std::atexit([]() { Logger::flush(); });
+}
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void Logger::setLevel(LogLevel level) {
+    Logger& logger = instance();
+    std::lock_guard<std::mutex> lock(logger.levelsMutex_);
+    logger.currentLevel_.store(level, std::memory_order_relaxed);
+    logger.updateMaxLevelLocked();
+}
+
+void Logger::setComponentLevel(const std::string& component, LogLevel level) {
+    Logger& logger = instance();
+    std::lock_guard<std::mutex> lock(logger.levelsMutex_);
+    bool found = false;
+    for (auto& entry : logger.componentLevels_) {
+        if (entry.first == component) {
+            entry.second = level;
+            found = true;
+        }
+    }
+    if (!found) {
+        logger.componentLevels_.emplace_back(component, level);
+    }
+    logger.updateMaxLevelLocked();
+}
+
+void Logger::clearComponentLevels() {
+    Logger& logger = instance();
+    std::lock_guard<std::mutex> lock(logger.levelsMutex_);
+    logger.componentLevels_.clear();
+    logger.updateMaxLevelLocked();
+}
+
+void Logger::setComponentLevels(const std::string& spec) {
+    size_t start = 0;
+    while (start < spec.size()) {
+        size_t end = spec.find(',', start);
+        if (end == std::string::npos) {
+            end = spec.size();
+        }
+        std::string entry = spec.substr(start, end - start);
+        size_t equals = entry.find('=');
+        LogLevel level;
+        if (equals != std::string::npos && equals > 0 && parseLevel(entry.substr(equals + 1), level)) {
+            setComponentLevel(entry.substr(0, equals), level);
+        }
+        start = end + 1;
+    }
+}
+
+void Logger::updateMaxLevelLocked() {
+    int maxLevel = static_cast<int>(currentLevel_.load(std::memory_order_relaxed));
+    for (const auto& entry : componentLevels_) {
+        maxLevel = std::max(maxLevel, static_cast<int>(entry.second));
+    }
+    maxLevel_.store(maxLevel, std::memory_order_relaxed);
+    hasComponentLevels_.store(!componentLevels_.empty(), std::memory_order_relaxed);
+    levelsGeneration_.fetch_add(1, std::memory_order_release);
+}
+
+LogLevel Logger::componentLevel(std::string_view component) {
+    Logger& logger = instance();
+    thread_local ComponentLevelCache cache;
+    uint64_t generation = logger.levelsGeneration_.load(std::memory_order_acquire);
+    if (cache.generation != generation) {
+        std::lock_guard<std::mutex> lock(logger.levelsMutex_);
+        cache.levels = logger.componentLevels_;
+        cache.generation = logger.levelsGeneration_.load(std::memory_order_relaxed);
+    }
+    for (const auto& entry : cache.levels) {
+        if (entry.first == component) {
+            return entry.second;
+        }
+    }
+    return getLevel();
+}
+
+std::ostringstream& Logger::acquireStream() {
+    StreamPool& pool = streamPool();
+    if (pool.depth == pool.streams.size()) {
+        pool.streams.push_back(std::make_unique<std::ostringstream>());
+    }
+    std::ostringstream& stream = *pool.streams[pool.depth++];
+
+    // Drop text and manipulators left by the previous message
+    stream.str(std::string());
+    stream.clear();
+    stream.flags(std::ios_base::dec | std::ios_base::skipws);
+    stream.precision(6);
+    stream.width(0);
+    stream.fill(' ');
+    return stream;
+}
+
+void Logger::releaseStream() {
+    streamPool().depth--;
+}
+
+bool Logger::setOutputFile(const std::string& path) {
+    Logger& logger = instance();
+    FILE* file = nullptr;
+    if (!path.empty()) {
+        file = std::fopen(path.c_str(), "a");
+        if (!file) {
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(logger.drainMutex_);
+    // Lines queued so far belong to the old output
+    logger.drain();
+    if (logger.file_) {
+        std::fclose(logger.file_);
+    }
+    logger.file_ = file;
+    return true;
+}
+
+LoggerStats Logger::getStats() {
+    Logger& logger = instance();
+    std::lock_guard<std::mutex> lock(logger.drainMutex_);
+    LoggerStats stats = logger.stats_;
+    stats.stalls = logger.stalls_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// =============================================================================
+// Writer Lifecycle
+// =============================================================================
+
+void Logger::start() {
+    Logger& logger = instance();
+    std::lock_guard<std::mutex> lock(logger.lifecycleMutex_);
+    if (logger.running_) {
+        return;
+    }
+
+    logger.stopRequested_ = false;
+    logger.writer_ = std::thread([&logger]() { logger.writerLoop(); });
+    logger.running_ = true;
+    logger.previousTerminate_ = std::set_terminate(&Logger::onTerminate);
+}
+
+void Logger::stop() {
+    Logger& logger = instance();
+    std::lock_guard<std::mutex> lock(logger.lifecycleMutex_);
+    if (!logger.running_) {
+        return;
+    }
+
+    logger.stopRequested_ = true;
+    {
+        std::lock_guard<std::mutex> wakeLock(logger.wakeMutex_);
+        logger.wakeWriter_.notify_all();
+    }
+    if (logger.writer_.joinable()) {
+        logger.writer_.join();
+    }
+    logger.running_ = false;
+    std::set_terminate(logger.previousTerminate_);
+    flush();
+}
+
+bool Logger::isRunning() {
+    return instance().running_.load();
+}
+
+void Logger::flush() {
+    Logger& logger = instance();
+    std::lock_guard<std::mutex> lock(logger.drainMutex_);
+    logger.drain();
+}
+
+void Logger::onTerminate() {
+    flush();
+    std::terminate_handler previous = instance().previousTerminate_;
+    if (previous && previous != &Logger::onTerminate) {
+        previous();
+    }
+    std::abort();
+}
+
+void Logger::writerLoop() {
+    while (true) {
+        size_t written;
+        {
+            std::lock_guard<std::mutex> lock(drainMutex_);
+            written = drain();
+        }
+        if (written > 0) {
+            continue;
+        }
+        if (stopRequested_) {
+            break;
+        }
+
+        // Producers only take wakeMutex_ while the writer is asleep
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        writerSleeping_.store(true);
+        if (!pending() && !stopRequested_) {
+            wakeWriter_.wait_for(lock, std::chrono::milliseconds(kWriterIdleMs));
+        }
+        writerSleeping_.store(false);
+    }
+}
+
+void Logger::wakeWriter() {
+    // Pairs with the writer publishing writerSleeping_ before it checks pending()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (writerSleeping_.load()) {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wakeWriter_.notify_one();
+    }
+}
+
+// =============================================================================
+// Producer Side
+// =============================================================================
+
+void Logger::write(LogLevel level, const std::string& component, const std::string& message,
+                   const LogField* fields, size_t count) {
+    Logger& logger = instance();
+    ThreadBuffer& buffer = threadBuffer();
+    std::string& line = buffer.line;
+    line.clear();
+
+    if (logger.format_.load(std::memory_order_relaxed) == LogFormat::JSON) {
+        // One object per line; the timestamp and level are always present
+        line += "{\"ts\":\"";
+        appendTimestamp(buffer.utc, line);
+        line += "\",\"level\":\"";
+        line += levelName(level);
+        line += '"';
+        if (!component.empty()) {
+            line += ",\"component\":";
+            appendJsonString(line, component);
+        }
+        line += ",\"msg\":";
+        appendJsonString(line, message);
+        for (size_t i = 0; i < count; ++i) {
+            line += ',';
+            appendJsonString(line, fields[i].key());
+            line += ':';
+            appendFieldValue(line, fields[i], true);
+        }
+        line += "}\n";
+    } else {
+        // Optional timestamp
+        if (logger.showTimestamp_.load(std::memory_order_relaxed)) {
+            appendTimestamp(buffer.local, line);
+        }
+
+        // Optional level prefix
+        if (logger.showLevel_.load(std::memory_order_relaxed)) {
+            switch (level) {
+                case LogLevel::DEBUG: line += "[DEBUG] "; break;
+                case LogLevel::INFO:  line += "[INFO]  "; break;
+                case LogLevel::WARN:  line += "[WARN]  "; break;
+                case LogLevel::ERROR: line += "[ERROR] "; break;
+                default: break;
+            }
+        }
+
+        // Component tag
+        if (!component.empty()) {
+            line += '[';
+            line += component;
+            line += "] ";
+        }
+
+        // Message, then fields as key=value
+        line += message;
+        for (size_t i = 0; i < count; ++i) {
+            line += ' ';
+            line += fields[i].key();
+            line += '=';
+            appendFieldValue(line, fields[i], false);
+        }
+        line += '\n';
+    }
+
+    bool error = level == LogLevel::ERROR;
+    while (!logger.enqueue(line, error)) {
+        // Ring full: make room rather than lose the line
+        logger.stalls_.fetch_add(1, std::memory_order_relaxed);
+        if (logger.running_) {
+            logger.wakeWriter();
+            std::this_thread::yield();
+        } else {
+            flush();
+        }
+    }
+
+    // Errors are on the output before LOG_ERROR returns; without the writer, so is everything
+    if (error || !logger.running_) {
+        flush();
+    } else {
+        logger.wakeWriter();
+    }
+}
+
+bool Logger::enqueue(std::string& line, bool error) {
+    size_t position = enqueuePos_.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &slots_[position & mask_];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (diff == 0) {
+            if (enqueuePos_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            position = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Swap rather than copy: the caller's buffer takes the slot's spare capacity
+    slot->line.swap(line);
+    slot->error = error;
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+// =============================================================================
+// Consumer Side (callers hold drainMutex_)
+// =============================================================================
+
+bool Logger::pending() const {
+    return enqueuePos_.load() != dequeuePos_.load();
+}
+
+size_t Logger::drain() {
+    FILE* out = file_ ? file_ : stdout;
+    FILE* err = file_ ? file_ : stderr;
+    size_t position = dequeuePos_.load(std::memory_order_relaxed);
+    size_t lines = 0;
+
+    while (true) {
+        Slot& slot = slots_[position & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;
+        }
+
+        // One output when writing to a file keeps lines in order
+        std::string& batch = slot.error && !file_ ? errBatch_ : outBatch_;
+        batch += slot.line;
+        slot.line.clear();
+        slot.sequence.store(position + mask_ + 1, std::memory_order_release);
+        ++position;
+        ++lines;
+
+        if (batch.size() >= kBatchBytes) {
+            writeAll(&batch == &errBatch_ ? err : out, batch);
+            stats_.batches++;
+        }
+    }
+    dequeuePos_.store(position, std::memory_order_release);
+
+    if (!outBatch_.empty() || !errBatch_.empty()) {
+        writeAll(out, outBatch_);
+        writeAll(err, errBatch_);
+        stats_.batches++;
+    }
+    stats_.lines += lines;
+    return lines;
+}
+
+} // namespace StudentIntake
@@ -6,6 +6,24 @@
 #include <mutex>
 #include <chrono>
 #include <iomanip>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <memory>
+#include <cstdio>
+#include <cstdint>
+#include <exception>
+#include <string_view>
+#include <type_traits>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+// Most verbose level compiled in (0 = NONE .. 4 = DEBUG). LOG_* macros above
+// it compile to nothing; set with -DLOG_COMPILED_LEVEL=INFO in CMake.
+#ifndef STUDENT_INTAKE_LOG_COMPILED_LEVEL
+#define STUDENT_INTAKE_LOG_COMPILED_LEVEL 4
+#endif
 
 namespace StudentIntake {
 
@@ -25,6 +43,131 @@ enum class LogLevel {
     DEBUG = 4
 };
 
+/**
+ * Output formats
+ * TEXT = [LEVEL] [Component] message key=value ...
+ * JSON = one object per line: ts, level, component, msg and the typed fields
+ */
+enum class LogFormat {
+    TEXT,
+    JSON
+};
+
+/**
+ * Typed key/value attached to a log line (LOG_FIELDS)
+ *
+ * Integers, floating point values and booleans keep their type in JSON
+ * output; anything else is stored as a string.
+ */
+class LogField {
+public:
+    enum class Type { Int, Uint, Double, Bool, String };
+
+    template<typename T>
+    LogField(const char* key, const T& value) : key_(key), int_(0) {
+        using V = std::decay_t<T>;
+        if constexpr (std::is_same_v<V, bool>) {
+            type_ = Type::Bool;
+            bool_ = value;
+        } else if constexpr (std::is_integral_v<V> && std::is_signed_v<V>) {
+            type_ = Type::Int;
+            int_ = static_cast<int64_t>(value);
+        } else if constexpr (std::is_integral_v<V>) {
+            type_ = Type::Uint;
+            uint_ = static_cast<uint64_t>(value);
+        } else if constexpr (std::is_floating_point_v<V>) {
+            type_ = Type::Double;
+            double_ = static_cast<double>(value);
+        } else if constexpr (std::is_convertible_v<const T&, std::string>) {
+            type_ = Type::String;
+            string_ = value;
+        } else {
+            type_ = Type::String;
+            std::ostringstream stream;
+            stream << value;
+            string_ = stream.str();
+        }
+    }
+
+    const char* key() const { return key_; }
+    Type type() const { return type_; }
+    int64_t intValue() const { return int_; }
+    uint64_t uintValue() const { return uint_; }
+    double doubleValue() const { return double_; }
+    bool boolValue() const { return bool_; }
+    const std::string& stringValue() const { return string_; }
+
+private:
+    const char* key_;
+    Type type_;
+    union {
+        int64_t int_;
+        uint64_t uint_;
+        double double_;
+        bool bool_;
+    };
+    std::string string_;
+};
+
+/**
+ * Counters for the logging backend
+ */
+struct LoggerStats {
+    uint64_t lines = 0;         // lines written
+    uint64_t batches = 0;       // writes to the output (one per drain)
+    uint64_t stalls = 0;        // times a producer found the ring full and waited
+};
+
+/**
+ * Per call site limit for LOG_RATE_LIMITED: at most perSecond lines in each
+ * wall-clock second; the next line written reports how many were dropped.
+ */
+class LogRateLimiter {
+public:
+    explicit LogRateLimiter(int perSecond)
+        : perSecond_(perSecond > 0 ? perSecond : 1), window_(0), count_(0), suppressed_(0) {}
+
+    // True if this line may be written; suppressed receives the lines dropped since the last one
+    bool allow(uint64_t& suppressed) {
+        int64_t second = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t window = window_.load(std::memory_order_relaxed);
+        if (second != window && window_.compare_exchange_strong(window, second, std::memory_order_relaxed)) {
+            count_.store(0, std::memory_order_relaxed);
+        }
+        if (count_.fetch_add(1, std::memory_order_relaxed) < perSecond_) {
+            suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+private:
+    const int perSecond_;
+    std::atomic<int64_t> window_;
+    std::atomic<int> count_;
+    std::atomic<uint64_t> suppressed_;
+};
+
+/**
+ * Per call site sampler for LOG_SAMPLED: writes the first of every n lines
+ */
+class LogSampler {
+public:
+    explicit LogSampler(uint64_t n) : n_(n > 0 ? n : 1), count_(0) {}
+
+    bool sample() {
+        return count_.fetch_add(1, std::memory_order_relaxed) % n_ == 0;
+    }
+
+    uint64_t rate() const { return n_; }
+
+private:
+    const uint64_t n_;
+    std::atomic<uint64_t> count_;
+};
+
 /**
  * Logger class for centralized logging with configurable levels
  *
@@ -34,42 +177,64 @@ enum class LogLevel {
  *   LOG_INFO("MyComponent", "Info message");
  *   LOG_WARN("MyComponent", "Warning message");
  *   LOG_ERROR("MyComponent", "Error message");
+ *
+ * Each line is formatted on the calling thread into a thread-local buffer
+ * (timestamps are cached per thread and re-rendered at most once a
+ * millisecond) and handed to a bounded lock-free ring. After start(), one
+ * writer thread drains the ring and writes whole batches to stdout/stderr or
+ * the file set with setOutputFile(); without it, the caller drains the ring
+ * itself. ERROR lines, flush(), stop() and std::terminate are written out
+ * before they return, so nothing logged before a crash or shutdown is lost.
  */
 class Logger {
 public:
+    // Never destroyed, so objects logging from their own destructors at exit stay safe
     static Logger& instance() {
-        static Logger logger;
-        return logger;
+        static Logger* logger = new Logger();
+        return *logger;
     }
 
     // Set the global log level
-    static void setLevel(LogLevel level) {
-        instance().currentLevel_ = level;
-    }
+    static void setLevel(LogLevel level);
 
     // Get the current log level
     static LogLevel getLevel() {
-        return instance().currentLevel_;
+        return instance().currentLevel_.load(std::memory_order_relaxed);
+    }
+
+    // Parse a level name (NONE, ERROR, WARN/WARNING, INFO, DEBUG; either case)
+    static bool parseLevel(const std::string& name, LogLevel& level) {
+        if (name == "NONE" || name == "none") {
+            level = LogLevel::NONE;
+        } else if (name == "ERROR" || name == "error") {
+            level = LogLevel::ERROR;
+        } else if (name == "WARN" || name == "warn" || name == "WARNING" || name == "warning") {
+            level = LogLevel::WARN;
+        } else if (name == "INFO" || name == "info") {
+            level = LogLevel::INFO;
+        } else if (name == "DEBUG" || name == "debug") {
+            level = LogLevel::DEBUG;
+        } else {
+            return false;
+        }
+        return true;
     }
 
     // Set level from string (useful for config files)
     static void setLevelFromString(const std::string& level) {
-        if (level == "NONE" || level == "none") {
-            setLevel(LogLevel::NONE);
-        } else if (level == "ERROR" || level == "error") {
-            setLevel(LogLevel::ERROR);
-        } else if (level == "WARN" || level == "warn" || level == "WARNING" || level == "warning") {
-            setLevel(LogLevel::WARN);
-        } else if (level == "INFO" || level == "info") {
-            setLevel(LogLevel::INFO);
-        } else if (level == "DEBUG" || level == "debug") {
-            setLevel(LogLevel::DEBUG);
+        LogLevel parsed;
+        if (parseLevel(level, parsed)) {
+            setLevel(parsed);
         }
     }
 
     // Get level as string
     static std::string getLevelString() {
-        switch (instance().currentLevel_) {
+        return levelName(getLevel());
+    }
+
+    static const char* levelName(LogLevel level) {
+        switch (level) {
             case LogLevel::NONE: return "NONE";
             case LogLevel::ERROR: return "ERROR";
             case LogLevel::WARN: return "WARN";
@@ -79,61 +244,113 @@ public:
         }
     }
 
-    // Check if a level should be logged
+    /**
+     * @brief Override the level for one component (e.g. "ApiClient" at DEBUG)
+     *
+     * Components without an override use the global level.
+     */
+    static void setComponentLevel(const std::string& component, LogLevel level);
+    static void clearComponentLevels();
+
+    // Apply "Component=LEVEL,Other=LEVEL" (the LOG_LEVELS environment variable)
+    static void setComponentLevels(const std::string& spec);
+
+    // False for levels compiled out with STUDENT_INTAKE_LOG_COMPILED_LEVEL
+    static constexpr bool compiledIn(LogLevel level) {
+        return static_cast<int>(level) <= STUDENT_INTAKE_LOG_COMPILED_LEVEL;
+    }
+
+    // Check if a level should be logged (global level only)
     static bool shouldLog(LogLevel level) {
-        return static_cast<int>(level) <= static_cast<int>(instance().currentLevel_);
+        return static_cast<int>(level) <= static_cast<int>(getLevel());
+    }
+
+    // Check if a level should be logged for a component
+    static bool shouldLog(LogLevel level, std::string_view component) {
+        Logger& logger = instance();
+        int wanted = static_cast<int>(level);
+        // Nothing anywhere is this verbose: the common case costs one load
+        if (wanted > logger.maxLevel_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        if (!logger.hasComponentLevels_.load(std::memory_order_relaxed)) {
+            return wanted <= static_cast<int>(getLevel());
+        }
+        return wanted <= static_cast<int>(componentLevel(component));
+    }
+
+    // Output format (text by default)
+    static void setFormat(LogFormat format) {
+        instance().format_.store(format, std::memory_order_relaxed);
+    }
+
+    static LogFormat getFormat() {
+        return instance().format_.load(std::memory_order_relaxed);
+    }
+
+    // "json" selects JSON lines; anything else text
+    static void setFormatFromString(const std::string& format) {
+        setFormat(format == "json" || format == "JSON" ? LogFormat::JSON : LogFormat::TEXT);
     }
 
     // Enable/disable timestamps
     static void setShowTimestamp(bool show) {
-        instance().showTimestamp_ = show;
+        instance().showTimestamp_.store(show, std::memory_order_relaxed);
     }
 
     // Enable/disable log level prefix
     static void setShowLevel(bool show) {
-        instance().showLevel_ = show;
+        instance().showLevel_.store(show, std::memory_order_relaxed);
     }
 
-    // Log a message at the specified level
-    template<typename T>
-    static void log(LogLevel level, const std::string& component, const T& message) {
-        if (!shouldLog(level)) return;
+    /**
+     * @brief Write all lines to a file (appending) instead of stdout/stderr
+     * @param path File to append to; empty restores console output
+     * @return false if the file cannot be opened (output is unchanged)
+     */
+    static bool setOutputFile(const std::string& path);
 
-        std::lock_guard<std::mutex> lock(instance().mutex_);
+    // Background writer lifecycle; stop() writes out everything queued
+    static void start();
+    static void stop();
+    static bool isRunning();
 
-        std::ostream& out = (level == LogLevel::ERROR) ? std::cerr : std::cout;
+    // Write out every line logged so far before returning
+    static void flush();
 
-        // Optional timestamp
-        if (instance().showTimestamp_) {
-            auto now = std::chrono::system_clock::now();
-            auto time = std::chrono::system_clock::to_time_t(now);
-            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now.time_since_epoch()) % 1000;
-            out << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S")
-                << "." << std::setfill('0') << std::setw(3) << ms.count() << " ";
-        }
+    static LoggerStats getStats();
 
-        // Optional level prefix
-        if (instance().showLevel_) {
-            switch (level) {
-                case LogLevel::DEBUG: out << "[DEBUG] "; break;
-                case LogLevel::INFO:  out << "[INFO]  "; break;
-                case LogLevel::WARN:  out << "[WARN]  "; break;
-                case LogLevel::ERROR: out << "[ERROR] "; break;
-                default: break;
-            }
-        }
+    // Log a message at the specified level
+    template<typename T>
+    static void log(LogLevel level, const std::string& component, const T& message) {
+        if (!shouldLog(level, component)) return;
+        std::ostringstream stream;
+        stream << message;
+        write(level, component, stream.str(), nullptr, 0);
+    }
 
-        // Component tag
-        if (!component.empty()) {
-            out << "[" << component << "] ";
-        }
+    static void log(LogLevel level, const std::string& component, const std::string& message) {
+        if (!shouldLog(level, component)) return;
+        write(level, component, message, nullptr, 0);
+    }
+
+    // Log a message with typed fields
+    static void log(LogLevel level, const std::string& component, const std::string& message,
+                    std::initializer_list<LogField> fields) {
+        if (!shouldLog(level, component)) return;
+        write(level, component, message, fields.begin(), fields.size());
+    }
 
-        // Message
-        out << message << std::endl;
-        out.flush();
+    static void log(LogLevel level, const std::string& component, const std::string& message,
+                    const LogField* fields, size_t count) {
+        if (!shouldLog(level, component)) return;
+        write(level, component, message, fields, count);
     }
 
+    // Reusable per-thread stream for the LOG_* macros (see LogMessage)
+    static std::ostringstream& acquireStream();
+    static void releaseStream();
+
     // Convenience methods
     template<typename T>
     static void debug(const std::string& component, const T& message) {
@@ -156,21 +373,72 @@ public:
     }
 
 private:
-    Logger() : currentLevel_(LogLevel::INFO), showTimestamp_(false), showLevel_(true) {}
+    Logger();
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
 
-    LogLevel currentLevel_;
-    bool showTimestamp_;
-    bool showLevel_;
-    std::mutex mutex_;
+    struct Slot {
+        std::atomic<size_t> sequence;
+        std::string line;
+        bool error = false;
+    };
+
+    // Format one line on the calling thread and queue it
+    static void write(LogLevel level, const std::string& component, const std::string& message,
+                      const LogField* fields, size_t count);
+
+    // Level for a component from this thread's copy of the overrides
+    static LogLevel componentLevel(std::string_view component);
+    void updateMaxLevelLocked();
+
+    bool enqueue(std::string& line, bool error);
+    size_t drain();
+    bool pending() const;
+    void writerLoop();
+    void wakeWriter();
+    static void onTerminate();
+
+    std::atomic<LogLevel> currentLevel_;
+    std::atomic<bool> showTimestamp_;
+    std::atomic<bool> showLevel_;
+    std::atomic<LogFormat> format_;
+
+    // Component overrides; threads copy them when the generation changes
+    std::mutex levelsMutex_;
+    std::vector<std::pair<std::string, LogLevel>> componentLevels_;
+    std::atomic<uint64_t> levelsGeneration_;
+    std::atomic<bool> hasComponentLevels_;
+    std::atomic<int> maxLevel_;         // most verbose of the global and component levels
+
+    // Bounded multi-producer ring; a slot is free for position p when its sequence is p
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    std::atomic<size_t> enqueuePos_;
+    std::atomic<size_t> dequeuePos_;    // advanced only under drainMutex_
+
+    // Output, owned by whoever holds drainMutex_
+    std::mutex drainMutex_;
+    FILE* file_;
+    std::string outBatch_;
+    std::string errBatch_;
+    LoggerStats stats_;
+    std::atomic<uint64_t> stalls_;
+
+    std::mutex lifecycleMutex_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeWriter_;
+    std::thread writer_;
+    std::atomic<bool> running_;
+    std::atomic<bool> stopRequested_;
+    std::atomic<bool> writerSleeping_;
+    std::terminate_handler previousTerminate_;
 };
 
 // Stream-style logging helper
 class LogStream {
 public:
     LogStream(LogLevel level, const std::string& component)
-        : level_(level), component_(component), active_(Logger::shouldLog(level)) {}
+        : level_(level), component_(component), active_(Logger::shouldLog(level, component)) {}
 
     ~LogStream() {
         if (active_) {
@@ -193,42 +461,98 @@ private:
     std::ostringstream stream_;
 };
 
+/**
+ * Message buffer used by the macros: borrows a per-thread ostringstream
+ * instead of constructing one (and its locale) for every line. Nested
+ * messages, e.g. a log call inside an operator<<, get their own stream.
+ */
+class LogMessage {
+public:
+    LogMessage() : stream_(Logger::acquireStream()) {}
+    ~LogMessage() { Logger::releaseStream(); }
+
+    LogMessage(const LogMessage&) = delete;
+    LogMessage& operator=(const LogMessage&) = delete;
+
+    std::ostream& stream() { return stream_; }
+    std::string str() const { return stream_.str(); }
+
+private:
+    std::ostringstream& stream_;
+};
+
 } // namespace StudentIntake
 
-// Convenience macros for logging with stream syntax
-// Usage: LOG_DEBUG("Component", "message " << variable << " more text");
-#define LOG_DEBUG(component, message) \
+// Shared body of the macros below. Levels above STUDENT_INTAKE_LOG_COMPILED_LEVEL
+// are constant-false and compile to nothing; the message is only formatted when
+// the level is enabled for the component.
+#define STUDENT_INTAKE_LOG_IF(level, component, message, fields, count) \
     do { \
-        if (StudentIntake::Logger::shouldLog(StudentIntake::LogLevel::DEBUG)) { \
-            std::ostringstream _log_ss; \
-            _log_ss << message; \
-            StudentIntake::Logger::debug(component, _log_ss.str()); \
+        if (StudentIntake::Logger::compiledIn(level) && StudentIntake::Logger::shouldLog(level, component)) { \
+            StudentIntake::LogMessage _log_msg; \
+            _log_msg.stream() << message; \
+            StudentIntake::Logger::log(level, component, _log_msg.str(), fields, count); \
         } \
     } while(0)
 
+// Convenience macros for logging with stream syntax
+// Usage: LOG_DEBUG("Component", "message " << variable << " more text");
+#define LOG_DEBUG(component, message) \
+    STUDENT_INTAKE_LOG_IF(StudentIntake::LogLevel::DEBUG, component, message, nullptr, 0)
+
 #define LOG_INFO(component, message) \
+    STUDENT_INTAKE_LOG_IF(StudentIntake::LogLevel::INFO, component, message, nullptr, 0)
+
+#define LOG_WARN(component, message) \
+    STUDENT_INTAKE_LOG_IF(StudentIntake::LogLevel::WARN, component, message, nullptr, 0)
+
+#define LOG_ERROR(component, message) \
+    STUDENT_INTAKE_LOG_IF(StudentIntake::LogLevel::ERROR, component, message, nullptr, 0)
+
+// Message with typed key/value fields (level is DEBUG, INFO, WARN or ERROR)
+// Usage: LOG_FIELDS(INFO, "ApiClient", "Request done", {"status", 200}, {"ms", 12.5});
+#define LOG_FIELDS(level, component, message, ...) \
     do { \
-        if (StudentIntake::Logger::shouldLog(StudentIntake::LogLevel::INFO)) { \
-            std::ostringstream _log_ss; \
-            _log_ss << message; \
-            StudentIntake::Logger::info(component, _log_ss.str()); \
+        if (StudentIntake::Logger::compiledIn(StudentIntake::LogLevel::level) && \
+            StudentIntake::Logger::shouldLog(StudentIntake::LogLevel::level, component)) { \
+            StudentIntake::LogMessage _log_msg; \
+            _log_msg.stream() << message; \
+            StudentIntake::Logger::log(StudentIntake::LogLevel::level, component, _log_msg.str(), {__VA_ARGS__}); \
         } \
     } while(0)
 
-#define LOG_WARN(component, message) \
+// At most perSecond lines per second from this call site; the next line
+// written carries a "suppressed" field with the number dropped
+// Usage: LOG_RATE_LIMITED(WARN, "ApiClient", 10, "Request failed with status " << code);
+#define LOG_RATE_LIMITED(level, component, perSecond, message) \
     do { \
-        if (StudentIntake::Logger::shouldLog(StudentIntake::LogLevel::WARN)) { \
-            std::ostringstream _log_ss; \
-            _log_ss << message; \
-            StudentIntake::Logger::warn(component, _log_ss.str()); \
+        if (StudentIntake::Logger::compiledIn(StudentIntake::LogLevel::level) && \
+            StudentIntake::Logger::shouldLog(StudentIntake::LogLevel::level, component)) { \
+            static StudentIntake::LogRateLimiter _log_limiter(perSecond); \
+            uint64_t _log_suppressed = 0; \
+            if (_log_limiter.allow(_log_suppressed)) { \
+                StudentIntake::LogField _log_field("suppressed", _log_suppressed); \
+                StudentIntake::LogMessage _log_msg; \
+                _log_msg.stream() << message; \
+                StudentIntake::Logger::log(StudentIntake::LogLevel::level, component, _log_msg.str(), \
+                                           &_log_field, _log_suppressed > 0 ? 1 : 0); \
+            } \
         } \
     } while(0)
 
-#define LOG_ERROR(component, message) \
+// Only the first of every n lines from this call site, tagged with "sample_rate"
+// Usage: LOG_SAMPLED(DEBUG, "SessionManager", 100, "Touched session " << id);
+#define LOG_SAMPLED(level, component, n, message) \
     do { \
-        if (StudentIntake::Logger::shouldLog(StudentIntake::LogLevel::ERROR)) { \
-            std::ostringstream _log_ss; \
-            _log_ss << message; \
-            StudentIntake::Logger::error(component, _log_ss.str()); \
+        if (StudentIntake::Logger::compiledIn(StudentIntake::LogLevel::level) && \
+            StudentIntake::Logger::shouldLog(StudentIntake::LogLevel::level, component)) { \
+            static StudentIntake::LogSampler _log_sampler(n); \
+            if (_log_sampler.sample()) { \
+                StudentIntake::LogField _log_field("sample_rate", _log_sampler.rate()); \
+                StudentIntake::LogMessage _log_msg; \
+                _log_msg.stream() << message; \
+                StudentIntake::Logger::log(StudentIntake::LogLevel::level, component, _log_msg.str(), \
+                                           &_log_field, 1); \
+            } \
         } \
     } while(0)
@@ -207,7 +207,7 @@ void DashboardWidget::updateCompletedFormsDisplay() {
     completedFormsList_->clear();
 
     // Get form type info from session manager
-    auto formTypeInfos = Session::SessionManager::getInstance().getFormTypeInfos();
+    auto formTypes = Session::SessionManager::getInstance().getFormTypeCatalog();
     auto completedFormIds = session_->getStudent().getCompletedForms();
 
     if (completedFormIds.empty()) {
@@ -218,13 +218,8 @@ void DashboardWidget::updateCompletedFormsDisplay() {
 
     for (const auto& formId : completedFormIds) {
         // Find form name from form type info
-        std::string formName = formId;
-        for (const auto& info : formTypeInfos) {
-            if (info.id == formId) {
-                formName = info.name;
-                break;
-            }
-        }
+        const Models::FormTypeInfo* info = formTypes->find(formId);
+        std::string formName = info ? info->name : formId;
 
         auto formItem = completedFormsList_->addWidget(std::make_unique<Wt::WContainerWidget>());
         formItem->addStyleClass("sidebar-form-item");
@@ -252,12 +247,12 @@ void DashboardWidget::updateRecommendedFormsDisplay() {
     recommendedFormsList_->clear();
 
     // Get form type info from session manager
-    auto formTypeInfos = Session::SessionManager::getInstance().getFormTypeInfos();
+    auto formTypes = Session::SessionManager::getInstance().getFormTypeCatalog();
     auto completedFormIds = session_->getStudent().getCompletedForms();
 
     // Find forms that are not required but available (optional forms)
     std::vector<Models::FormTypeInfo> recommendedForms;
-    for (const auto& info : formTypeInfos) {
+    for (const auto& info : formTypes->formTypes) {
         // Check if form is not already completed and is optional
         bool isCompleted = std::find(completedFormIds.begin(), completedFormIds.end(), info.id) != completedFormIds.end();
         if (!isCompleted && !info.isRequired) {
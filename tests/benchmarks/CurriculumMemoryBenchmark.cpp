@@ -0,0 +1,100 @@
+/**
+ * @brief Heap used by curricula across 5k student applications
+ *
+ * Every StudentIntakeApp owns a CurriculumManager loaded with the program
+ * catalog, and its session holds the one program the student is enrolled
+ * in (handleLoginSuccess). This builds 5k such pairs twice: once as before
+ * interning, with a private copy of the catalog per manager and of the
+ * program per session, and once through CurriculumManager and
+ * CurriculumRegistry as the application uses them. Both runs load real
+ * managers, so their departments count in each. Heap in use is read from
+ * mallinfo2() (glibc) and the cost of the bare managers and sessions is
+ * subtracted. Not part of ctest; run student_intake_curriculum_benchmark
+ * directly.
+ */
+
+#include <malloc.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "curriculum/CurriculumManager.h"
+#include "curriculum/CurriculumRegistry.h"
+#include "session/StudentSession.h"
+
+using namespace StudentIntake;
+using Curriculum::CurriculumManager;
+using Curriculum::CurriculumRegistry;
+using Session::StudentSession;
+
+namespace {
+
+constexpr size_t kAppCount = 5000;
+
+// What one student application keeps of the curricula
+struct App {
+    CurriculumManager manager;                      // no API service: loads the default catalog
+    std::vector<Models::Curriculum> catalogCopy;    // before interning, the manager's own copies
+    StudentSession session;
+};
+
+size_t heapInUse() {
+    malloc_trim(0);
+    return mallinfo2().uordblks;
+}
+
+// Heap added by kAppCount applications set up by load, less the bare ones
+template <typename Load>
+size_t measureApps(Load load) {
+    std::vector<std::unique_ptr<App>> apps;
+    apps.reserve(kAppCount);
+    for (size_t i = 0; i < kAppCount; ++i) {
+        apps.push_back(std::make_unique<App>());
+    }
+    size_t bare = heapInUse();
+
+    for (size_t i = 0; i < kAppCount; ++i) {
+        load(*apps[i], i);
+    }
+    return heapInUse() - bare;
+}
+
+void report(const char* name, size_t bytes) {
+    std::printf("%-18s %12zu bytes  %8.1f bytes/app\n", name, bytes,
+                static_cast<double>(bytes) / kAppCount);
+}
+
+} // namespace
+
+int main() {
+    std::vector<std::string> programIds;
+    {
+        CurriculumManager probe;
+        probe.loadCurriculums();
+        for (const auto& curriculum : probe.getAllCurriculums()) {
+            programIds.push_back(curriculum.getId());
+        }
+    }
+
+    // Copies per manager and per session, as before
+    size_t copies = measureApps([&](App& app, size_t i) {
+        app.manager.loadCurriculums();
+        app.catalogCopy = app.manager.getAllCurriculums();
+        app.session.setCurrentCurriculum(
+            std::make_shared<const Models::Curriculum>(app.manager.getCurriculum(programIds[i % programIds.size()])));
+    });
+
+    // Interned: managers and sessions hold handles to one copy per program
+    size_t interned = measureApps([&](App& app, size_t i) {
+        app.manager.loadCurriculums();
+        app.session.setCurrentCurriculum(app.manager.getCurriculumHandle(programIds[i % programIds.size()]));
+    });
+
+    std::printf("%zu applications, %zu programs in the catalog, %zu programs interned\n",
+                kAppCount, programIds.size(), CurriculumRegistry::getInstance().size());
+    report("per-app copies", copies);
+    report("interned handles", interned);
+    report("saved", copies > interned ? copies - interned : 0);
+    std::printf("reduction: %.1fx\n", static_cast<double>(copies) / interned);
+    return 0;
+}
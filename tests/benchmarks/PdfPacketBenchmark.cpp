@@ -0,0 +1,103 @@
+/**
+ * @brief PDF packet layout and render benchmark at 20 pages
+ *
+ * Builds a student packet of five forms with long free-text fields that
+ * lays out to 20 pages, then times the layout pass alone and, when libharu
+ * is available, the full render. Not part of ctest; run
+ * student_intake_pdf_benchmark directly.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "api/PdfGenerator.h"
+#include "api/PdfLayout.h"
+
+using namespace StudentIntake::Api;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kTargetPages = 20;
+
+std::string notes(size_t words) {
+    const char* vocabulary[] = {"patient", "reports", "seasonal", "allergies", "and", "completed",
+                                "coursework", "in", "mathematics", "with", "distinction", "prior"};
+    std::string text;
+    for (size_t i = 0; i < words; ++i) {
+        text += (i ? " " : "") + std::string(vocabulary[(i * 7) % 12]);
+    }
+    return text;
+}
+
+PdfFormData makeForm(size_t index, size_t rows) {
+    PdfFormData form;
+    form.formTitle = "Intake Form " + std::to_string(index + 1);
+    form.studentName = "Ada Lovelace";
+    form.submissionDate = "2024-03-01T09:00:00";
+    form.institutionName = "Analytical College";
+    form.fields.emplace_back("Section " + std::to_string(index + 1), "", "header");
+    for (size_t i = 0; i < rows; ++i) {
+        if (i % 6 == 5) {
+            form.fields.emplace_back("Notes " + std::to_string(i), notes(60 + i % 40));
+        } else if (i % 6 == 1) {
+            form.fields.emplace_back("Phone " + std::to_string(i), "5551234567", "phone");
+        } else {
+            form.fields.emplace_back("Field " + std::to_string(i), "Value " + std::to_string(i));
+        }
+    }
+    return form;
+}
+
+// Grow the forms until the packet lays out to the target page count
+std::vector<PdfFormData> makePacket() {
+    std::vector<PdfFormData> forms;
+    for (size_t rows = 10; ; ++rows) {
+        forms.clear();
+        for (size_t i = 0; i < 5; ++i) {
+            forms.push_back(makeForm(i, rows));
+        }
+        if (PdfLayout::layoutPacket(forms).size() >= kTargetPages) {
+            return forms;
+        }
+    }
+}
+
+double millisSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main() {
+    auto forms = makePacket();
+    auto pages = PdfLayout::layoutPacket(forms);
+    size_t commands = 0;
+    for (const auto& page : pages) {
+        commands += page.commands.size();
+    }
+    std::printf("packet: %zu forms, %zu pages, %zu draw commands\n", forms.size(), pages.size(), commands);
+
+    constexpr int kLayoutRuns = 200;
+    auto layoutStart = Clock::now();
+    for (int run = 0; run < kLayoutRuns; ++run) {
+        pages = PdfLayout::layoutPacket(forms);
+    }
+    std::printf("layout: %.3f ms per packet\n", millisSince(layoutStart) / kLayoutRuns);
+
+    if (!PdfGenerator::isAvailable()) {
+        std::printf("render: skipped, libharu not available\n");
+        return 0;
+    }
+
+    constexpr int kRenderRuns = 20;
+    PdfGenerator generator;
+    size_t bytes = 0;
+    auto renderStart = Clock::now();
+    for (int run = 0; run < kRenderRuns; ++run) {
+        bytes = generator.renderMultiFormPdf(forms, "Ada Lovelace").size();
+    }
+    std::printf("render: %.3f ms per packet, %zu bytes\n", millisSince(renderStart) / kRenderRuns, bytes);
+    return 0;
+}
@@ -0,0 +1,169 @@
+/**
+ * @brief SessionManager contention benchmark at 10k sessions and 32 threads
+ *
+ * Fills the manager with 10k logged-in sessions, then has 32 threads run a
+ * request-shaped mix of session, student id, email and form-type lookups.
+ * The same mix runs against a copy of the previous layout (one std::map,
+ * one mutex, linear scans for the secondary lookups) for comparison. Not
+ * part of ctest; run student_intake_session_benchmark directly.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "session/SessionManager.h"
+
+using namespace StudentIntake;
+using Session::SessionManager;
+using Session::StudentSession;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kSessionCount = 10000;
+constexpr size_t kThreadCount = 32;
+constexpr size_t kOpsPerThread = 4000;
+
+// The table as it was: every call takes the one lock, lookups by student scan
+class SingleLockSessionTable {
+public:
+    void add(const std::shared_ptr<StudentSession>& session) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sessions_[session->getSessionId()] = session;
+    }
+
+    std::shared_ptr<StudentSession> getSession(const std::string& sessionId) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sessions_.find(sessionId);
+        return it != sessions_.end() ? it->second : nullptr;
+    }
+
+    std::shared_ptr<StudentSession> getSessionByStudentId(const std::string& studentId) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& pair : sessions_) {
+            if (pair.second->getStudent().getId() == studentId) {
+                return pair.second;
+            }
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<StudentSession> getSessionByEmail(const std::string& email) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& pair : sessions_) {
+            if (pair.second->getStudent().getEmail() == email) {
+                return pair.second;
+            }
+        }
+        return nullptr;
+    }
+
+    void setFormTypeInfos(const std::vector<Models::FormTypeInfo>& formTypes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        formTypeInfos_ = formTypes;
+    }
+
+    std::vector<Models::FormTypeInfo> getFormTypeInfos() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return formTypeInfos_;
+    }
+
+private:
+    std::map<std::string, std::shared_ptr<StudentSession>> sessions_;
+    std::vector<Models::FormTypeInfo> formTypeInfos_;
+    mutable std::mutex mutex_;
+};
+
+std::vector<Models::FormTypeInfo> makeFormTypes() {
+    const char* ids[] = {"personal_info", "emergency_contact", "medical_info", "academic_history",
+                         "financial_aid", "documents", "consent"};
+    std::vector<Models::FormTypeInfo> formTypes;
+    for (int i = 0; i < 7; ++i) {
+        Models::FormTypeInfo info{};
+        info.id = ids[i];
+        info.name = std::string(ids[i]) + " form";
+        info.description = "Collected during intake for every new student in the program";
+        info.displayOrder = i + 1;
+        info.isRequired = i != 4;
+        info.requiredForStudentTypes = {"undergraduate", "graduate"};
+        formTypes.push_back(info);
+    }
+    return formTypes;
+}
+
+double millisSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// 70% session id, 10% student id, 10% email, 10% form types; ids chosen at random
+template <typename Table, typename FormTypes>
+double runMix(Table& table, const std::vector<std::string>& sessionIds, FormTypes formTypes) {
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 random(static_cast<unsigned>(t));
+            size_t found = 0;
+            for (size_t i = 0; i < kOpsPerThread; ++i) {
+                size_t n = random() % kSessionCount;
+                switch (i % 10) {
+                    case 0: found += table.getSessionByStudentId(std::to_string(n)) != nullptr; break;
+                    case 1: found += table.getSessionByEmail("student" + std::to_string(n) + "@example.com") != nullptr; break;
+                    case 2: found += formTypes(); break;
+                    default: found += table.getSession(sessionIds[n]) != nullptr; break;
+                }
+            }
+            if (found != kOpsPerThread) {
+                std::printf("thread %zu: %zu of %zu lookups succeeded\n", t, found, kOpsPerThread);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return millisSince(start);
+}
+
+void report(const char* name, double ms) {
+    double ops = static_cast<double>(kThreadCount * kOpsPerThread);
+    std::printf("%-22s %9.1f ms  %12.0f ops/s  %8.2f us/op\n", name, ms, ops / (ms / 1000.0), ms * 1000.0 / ops);
+}
+
+} // namespace
+
+int main() {
+    auto& manager = SessionManager::getInstance();
+    SingleLockSessionTable baseline;
+    auto formTypes = makeFormTypes();
+    manager.setFormTypeInfos(formTypes);
+    baseline.setFormTypeInfos(formTypes);
+
+    std::vector<std::string> sessionIds;
+    sessionIds.reserve(kSessionCount);
+    for (size_t i = 0; i < kSessionCount; ++i) {
+        auto session = manager.createSession();
+        Models::Student student;
+        student.setId(std::to_string(i));
+        student.setEmail("student" + std::to_string(i) + "@example.com");
+        session->setStudent(student);
+        session->setLoggedIn(true);
+        manager.updateSessionIndex(session);
+        baseline.add(session);
+        sessionIds.push_back(session->getSessionId());
+    }
+    std::printf("%zu sessions, %zu threads x %zu operations, %u hardware threads\n",
+                kSessionCount, kThreadCount, kOpsPerThread, std::thread::hardware_concurrency());
+
+    double before = runMix(baseline, sessionIds, [&baseline]() { return !baseline.getFormTypeInfos().empty(); });
+    double after = runMix(manager, sessionIds, [&manager]() { return !manager.getFormTypeCatalog()->formTypes.empty(); });
+
+    report("single lock + scans", before);
+    report("sharded + indexes", after);
+    std::printf("speedup: %.1fx\n", before / after);
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @brief Text search index benchmark at 100k records
+ *
+ * Builds a TextSearchIndex over synthetic name/email/description records and
+ * compares query latency with the lowercase-and-find scan the admin lists
+ * used before. Not part of ctest; run student_intake_benchmarks directly.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "api/TextSearchIndex.h"
+
+using namespace StudentIntake::Api;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kRecordCount = 100000;
+
+using Record = std::pair<std::string, std::vector<std::string>>;
+
+std::vector<Record> makeRecords() {
+    const char* firstNames[] = {"Ann", "Joanna", "Samuel", "Lee", "Maria", "Oliver", "Priya",
+                                "Tomas", "Grace", "Hiro", "Fatima", "Noah", "Ella", "Omar"};
+    const char* lastNames[] = {"Smith", "Brown", "Annis", "Park", "Garcia", "Nguyen", "Patel",
+                               "Kowalski", "Okafor", "Tanaka", "Haddad", "Murphy", "Rossi"};
+    const char* programs[] = {"Class A CDL", "Class B CDL", "Nursing Assistant", "Welding",
+                              "Culinary Arts", "Automotive Technology", "Medical Billing"};
+
+    std::vector<Record> records;
+    records.reserve(kRecordCount);
+    for (size_t i = 0; i < kRecordCount; ++i) {
+        std::string first = firstNames[i % 14];
+        std::string last = lastNames[(i / 14) % 13];
+        std::string name = first + " " + last + " " + std::to_string(i);
+        std::string email = first + "." + last + std::to_string(i) + "@example.com";
+        std::string description = std::string(programs[i % 7]) + " cohort " + std::to_string(i % 97);
+        records.push_back({std::to_string(i), {name, email, description}});
+    }
+    return records;
+}
+
+// The pre-index approach: lowercase every field of every record per query
+size_t linearScan(const std::vector<Record>& records, const std::string& query) {
+    std::string needle = query;
+    std::transform(needle.begin(), needle.end(), needle.begin(), ::tolower);
+
+    size_t found = 0;
+    for (const auto& record : records) {
+        for (std::string field : record.second) {
+            std::transform(field.begin(), field.end(), field.begin(), ::tolower);
+            if (field.find(needle) != std::string::npos) {
+                found++;
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+double microsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main() {
+    auto records = makeRecords();
+    TextSearchIndex index;
+
+    auto buildStart = Clock::now();
+    index.sync(records);
+    std::printf("build: %zu records in %.1f ms\n", index.size(), microsSince(buildStart) / 1000.0);
+
+    auto updateStart = Clock::now();
+    for (size_t i = 0; i < 1000; ++i) {
+        auto record = records[i * 97];
+        record.second[0] += " renamed";
+        index.upsert(record.first, record.second);
+    }
+    std::printf("upsert: %.2f us per changed record\n", microsSince(updateStart) / 1000.0);
+
+    const std::vector<std::string> queries = {"a", "pa", "ann", "kowal", "garcia 4242",
+                                              "welding", "@example", "99999", "zzz"};
+    std::printf("\n%-14s %10s %12s %12s\n", "query", "matches", "index (us)", "scan (us)");
+    for (const auto& query : queries) {
+        constexpr int kRuns = 20;
+        size_t matches = 0;
+        auto indexStart = Clock::now();
+        for (int run = 0; run < kRuns; ++run) {
+            matches = index.search(query, 50).size();
+        }
+        double indexMicros = microsSince(indexStart) / kRuns;
+
+        auto scanStart = Clock::now();
+        size_t scanned = linearScan(records, query);
+        double scanMicros = microsSince(scanStart);
+
+        std::printf("%-14s %10zu %12.1f %12.1f  (scan found %zu)\n",
+                    query.c_str(), matches, indexMicros, scanMicros, scanned);
+    }
+    return 0;
+}
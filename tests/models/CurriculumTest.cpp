@@ -440,3 +440,19 @@ TEST_F(CurriculumTest, FromJson_HandlesIntegerId) {
     Curriculum curriculum = Curriculum::fromJson(json);
     EXPECT_EQ(curriculum.getId(), "123");
 }
+
+// =============================================================================
+// Equality Tests
+// =============================================================================
+
+TEST_F(CurriculumTest, Equality_ComparesEveryField) {
+    Curriculum copy = accreditedProgram_;
+    EXPECT_EQ(copy, accreditedProgram_);
+
+    copy.addRequiredForm("extra_form");
+    EXPECT_NE(copy, accreditedProgram_);
+
+    Curriculum renumbered = accreditedProgram_;
+    renumbered.setId(accreditedProgram_.getId() + "0");
+    EXPECT_NE(renumbered, accreditedProgram_);
+}
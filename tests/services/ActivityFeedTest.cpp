@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "api/ActivityFeed.h"
+#include "api/ActivityLogService.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using TestUtils::FakeApiClient;
+
+namespace {
+
+std::vector<int> ids(const std::vector<StudentIntake::Models::ActivityLog>& activities) {
+    std::vector<int> result;
+    for (const auto& activity : activities) {
+        result.push_back(activity.getId());
+    }
+    return result;
+}
+
+template <typename Predicate>
+bool waitFor(Predicate predicate) {
+    for (int i = 0; i < 300 && !predicate(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return predicate();
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class ActivityFeedTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        client_ = std::make_shared<FakeApiClient>();
+        auto& feed = ActivityFeed::getInstance();
+        feed.stop();
+        feed.reset();
+        feed.setApiClient(client_);
+    }
+
+    void TearDown() override {
+        auto& feed = ActivityFeed::getInstance();
+        feed.stop();
+        feed.reset();
+    }
+
+    void add(int id, const std::string& createdAt, const std::string& actorType = "student") {
+        client_->putRow("ActivityLog", id, {{"created_at", createdAt}, {"actor_type", actorType},
+                                            {"action_type", "login"}, {"description", "Signed in"}});
+    }
+
+    std::shared_ptr<FakeApiClient> client_;
+};
+
+// =============================================================================
+// Keyset Pagination Tests
+// =============================================================================
+
+TEST_F(ActivityFeedTest, KeysetEndpoint_SortsByTimeAndIdAndFiltersBeforeTheCursor) {
+    ActivityFilter filter;
+    filter.actorType = "admin";
+    EXPECT_EQ(ActivityLogService::keysetEndpoint(filter, ActivityCursor(), 20),
+              "/ActivityLog?sort=-created_at,-id&page[limit]=20"
+              "&filter=%5B%7B%22name%22%3A%22actor_type%22%2C%22op%22%3A%22eq%22%2C%22val%22%3A%22admin%22%7D%5D");
+
+    ActivityCursor cursor;
+    cursor.createdAt = "2026-03-01 10:00:00";
+    cursor.id = 42;
+    cursor.ties = 2;
+    std::string endpoint = ActivityLogService::keysetEndpoint(ActivityFilter(), cursor, 20);
+    EXPECT_NE(endpoint.find("page[limit]=22"), std::string::npos);
+    EXPECT_NE(endpoint.find("created_at%22%2C%22op%22%3A%22le"), std::string::npos);
+}
+
+TEST_F(ActivityFeedTest, ActivityPage_WalksAllRowsOnceAcrossTimestampTies) {
+    // Five rows share one timestamp, so pages of two split the tie group
+    add(1, "2026-03-01 09:00:00");
+    for (int id = 2; id <= 6; ++id) {
+        add(id, "2026-03-01 10:00:00");
+    }
+    add(7, "2026-03-01 11:00:00");
+
+    ActivityLogService service(client_);
+    ActivityFilter filter;
+    filter.limit = 2;
+
+    std::vector<int> seen;
+    ActivityCursor cursor;
+    for (int pages = 0; pages < 10; ++pages) {
+        ActivityPage page = service.getActivityPage(filter, cursor);
+        ASSERT_TRUE(page.success);
+        auto pageIds = ids(page.activities);
+        seen.insert(seen.end(), pageIds.begin(), pageIds.end());
+        cursor = page.next;
+        if (!page.hasMore) {
+            break;
+        }
+    }
+    EXPECT_EQ(seen, (std::vector<int>{7, 6, 5, 4, 3, 2, 1}));
+}
+
+TEST_F(ActivityFeedTest, ActivityPage_ReportsFailureWhenTheBackendIsDown) {
+    client_->respond("GET", "/ActivityLog", 0);
+    ActivityLogService service(client_);
+    ActivityPage page = service.getActivityPage(ActivityFilter());
+    EXPECT_FALSE(page.success);
+    EXPECT_FALSE(page.hasMore);
+    EXPECT_TRUE(page.activities.empty());
+}
+
+TEST_F(ActivityFeedTest, FilterMatches_ChecksTheSameFieldsAsTheQuery) {
+    ActivityFilter filter;
+    filter.actorType = "admin";
+    auto activity = StudentIntake::Models::ActivityLog::createLogoutActivity(
+        StudentIntake::Models::ActorType::Admin, 3, "Grace Hopper", "grace@example.com");
+    EXPECT_TRUE(filter.matches(activity));
+
+    filter.actorId = 4;
+    EXPECT_FALSE(filter.matches(activity));
+    EXPECT_TRUE(ActivityFilter().matches(activity));
+}
+
+// =============================================================================
+// Live Tail Tests
+// =============================================================================
+
+TEST_F(ActivityFeedTest, NoSubscribers_NoQueries) {
+    auto& feed = ActivityFeed::getInstance();
+    feed.setPollInterval(5);
+    feed.start();
+    feed.notify();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(feed.getQueryCount(), 0);
+    EXPECT_TRUE(client_->endpoints().empty());
+}
+
+TEST_F(ActivityFeedTest, Subscribe_ReportsOnlyActivitiesStoredAfterwards) {
+    add(1, "2026-03-01 09:00:00");
+    add(2, "2026-03-01 09:01:00");
+
+    auto& feed = ActivityFeed::getInstance();
+    std::atomic<int> calls{0};
+    int subscription = feed.subscribe([&calls]() { calls++; });
+
+    EXPECT_EQ(feed.poll(), 0);
+    EXPECT_EQ(calls.load(), 0);
+
+    add(3, "2026-03-01 09:02:00");
+    add(4, "2026-03-01 09:03:00");
+    EXPECT_EQ(feed.poll(), 2);
+    EXPECT_EQ(calls.load(), 1);
+
+    uint64_t sequence = 0;
+    EXPECT_EQ(ids(feed.getSince(sequence)), (std::vector<int>{3, 4}));
+    EXPECT_TRUE(feed.getSince(sequence).empty());
+
+    feed.unsubscribe(subscription);
+}
+
+TEST_F(ActivityFeedTest, ManyListeners_ShareOneQueryPerPoll) {
+    auto& feed = ActivityFeed::getInstance();
+    std::atomic<int> calls{0};
+    std::vector<int> subscriptions;
+    for (int i = 0; i < 50; ++i) {
+        subscriptions.push_back(feed.subscribe([&calls]() { calls++; }));
+    }
+    int baselineQueries = feed.getQueryCount();
+    EXPECT_EQ(baselineQueries, 1);
+
+    add(1, "2026-03-01 09:00:00");
+    EXPECT_EQ(feed.poll(), 1);
+    EXPECT_EQ(feed.getQueryCount(), baselineQueries + 1);
+    EXPECT_EQ(calls.load(), 50);
+
+    for (int subscription : subscriptions) {
+        feed.unsubscribe(subscription);
+    }
+    EXPECT_EQ(feed.getSubscriberCount(), 0u);
+}
+
+TEST_F(ActivityFeedTest, Notify_WakesTheTailBeforeThePollInterval) {
+    auto& feed = ActivityFeed::getInstance();
+    feed.setPollInterval(60000);
+    feed.start();
+
+    std::atomic<int> calls{0};
+    int subscription = feed.subscribe([&calls]() { calls++; });
+    add(1, "2026-03-01 09:00:00");
+    feed.notify();
+
+    EXPECT_TRUE(waitFor([&]() { return calls.load() == 1; }));
+    feed.unsubscribe(subscription);
+}
+
+TEST_F(ActivityFeedTest, LastUnsubscribe_StopsTrackingUntilTheNextSubscriber) {
+    auto& feed = ActivityFeed::getInstance();
+    int subscription = feed.subscribe([]() {});
+    feed.unsubscribe(subscription);
+
+    // Stored while nobody watched: not reported to the next subscriber
+    add(1, "2026-03-01 09:00:00");
+    EXPECT_EQ(feed.poll(), 0);
+
+    std::atomic<int> calls{0};
+    subscription = feed.subscribe([&calls]() { calls++; });
+    EXPECT_EQ(feed.poll(), 0);
+    add(2, "2026-03-01 09:01:00");
+    EXPECT_EQ(feed.poll(), 1);
+    EXPECT_EQ(calls.load(), 1);
+    feed.unsubscribe(subscription);
+}
@@ -0,0 +1,253 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <unistd.h>
+#include "api/ActivityLogQueue.h"
+#include "api/ActivityLogService.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using TestUtils::FakeApiClient;
+
+namespace {
+
+// Event numbers in the order they were posted
+std::vector<int> postedEvents(const FakeApiClient& client) {
+    std::vector<int> events;
+    for (const auto& request : client.requests("POST")) {
+        const auto& data = request.payload["data"];
+        for (const auto& item : data.is_array() ? data : nlohmann::json::array({data})) {
+            events.push_back(item["attributes"].value("n", 0));
+        }
+    }
+    return events;
+}
+
+nlohmann::json event(int n) {
+    return {{"type", "ActivityLog"}, {"attributes", {{"action_type", "login"}, {"n", n}}}};
+}
+
+template <typename Predicate>
+bool waitFor(Predicate predicate) {
+    for (int i = 0; i < 200 && !predicate(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return predicate();
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class ActivityLogQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        spillPath_ = "/tmp/activity_queue_test_" + std::to_string(getpid()) + ".spill";
+        std::remove(spillPath_.c_str());
+        client_ = std::make_shared<FakeApiClient>();
+        auto& queue = ActivityLogQueue::getInstance();
+        queue.reset();
+        queue.setApiClient(client_);
+    }
+
+    void TearDown() override {
+        auto& queue = ActivityLogQueue::getInstance();
+        queue.stop();
+        queue.reset();
+        std::remove(spillPath_.c_str());
+    }
+
+    std::string spillPath_;
+    std::shared_ptr<FakeApiClient> client_;
+};
+
+// =============================================================================
+// Batching Tests
+// =============================================================================
+
+TEST_F(ActivityLogQueueTest, Flush_PostsEventsInBatches) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setBatchSize(3);
+    for (int i = 1; i <= 7; ++i) {
+        ASSERT_TRUE(queue.enqueue(event(i)));
+    }
+
+    EXPECT_EQ(queue.flush(), 7);
+    EXPECT_EQ(client_->endpoints("POST"), (std::vector<std::string>{
+        "/ActivityLog/batch", "/ActivityLog/batch", "/ActivityLog"}));
+    EXPECT_EQ(postedEvents(*client_), (std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+
+    auto stats = queue.getStats();
+    EXPECT_EQ(stats.enqueued, 7u);
+    EXPECT_EQ(stats.flushed, 7u);
+    EXPECT_EQ(stats.batches, 3u);
+    EXPECT_EQ(stats.depth, 0u);
+    EXPECT_EQ(stats.peakDepth, 7u);
+    EXPECT_GE(stats.maxFlushMs, stats.lastFlushMs);
+}
+
+TEST_F(ActivityLogQueueTest, Flusher_PostsWhenBatchFills) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setBatchSize(4);
+    queue.setFlushInterval(60000);
+    queue.start();
+
+    for (int i = 1; i <= 4; ++i) {
+        queue.enqueue(event(i));
+    }
+    EXPECT_TRUE(waitFor([&]() { return postedEvents(*client_).size() == 4; }));
+    EXPECT_EQ(client_->endpoints("POST").size(), 1u);
+}
+
+TEST_F(ActivityLogQueueTest, Flusher_PostsPartialBatchAfterInterval) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setBatchSize(100);
+    queue.setFlushInterval(20);
+    queue.start();
+
+    queue.enqueue(event(1));
+    EXPECT_TRUE(waitFor([&]() { return postedEvents(*client_).size() == 1; }));
+    EXPECT_GT(queue.getStats().maxQueueDelayMs, 0.0);
+}
+
+TEST_F(ActivityLogQueueTest, FailedBatch_IsRetriedOnNextFlush) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setBatchSize(10);
+    client_->respond("POST", "/ActivityLog/batch", 503);
+    queue.enqueue(event(1));
+    queue.enqueue(event(2));
+
+    EXPECT_EQ(queue.flush(), 0);
+    EXPECT_EQ(queue.getStats().failedBatches, 1u);
+    EXPECT_EQ(queue.getStats().depth, 2u);
+
+    client_->respond("POST", "/ActivityLog/batch", 201);
+    EXPECT_EQ(queue.flush(), 2);
+    EXPECT_EQ(queue.getStats().depth, 0u);
+}
+
+TEST_F(ActivityLogQueueTest, MissingBatchEndpoint_FallsBackToSinglePosts) {
+    auto& queue = ActivityLogQueue::getInstance();
+    client_->respond("POST", "/ActivityLog/batch", 404);
+    queue.enqueue(event(1));
+    queue.enqueue(event(2));
+    EXPECT_EQ(queue.flush(), 2);
+
+    // The batch endpoint is not tried again
+    queue.enqueue(event(3));
+    queue.enqueue(event(4));
+    EXPECT_EQ(queue.flush(), 2);
+    EXPECT_EQ(client_->endpoints("POST"), (std::vector<std::string>{
+        "/ActivityLog/batch", "/ActivityLog", "/ActivityLog", "/ActivityLog", "/ActivityLog"}));
+}
+
+TEST_F(ActivityLogQueueTest, RefusedEvent_IsCountedAndNotRetried) {
+    auto& queue = ActivityLogQueue::getInstance();
+    client_->respond("POST", "/ActivityLog", 422);
+    queue.enqueue(event(1));
+
+    EXPECT_EQ(queue.flush(), 0);
+    auto stats = queue.getStats();
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(stats.depth, 0u);
+    EXPECT_EQ(stats.failedBatches, 0u);
+}
+
+// =============================================================================
+// Overflow Tests
+// =============================================================================
+
+TEST_F(ActivityLogQueueTest, DropOldest_KeepsNewestEvents) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setCapacity(3);
+    queue.setOverflowPolicy(ActivityOverflowPolicy::DropOldest);
+    for (int i = 1; i <= 5; ++i) {
+        EXPECT_TRUE(queue.enqueue(event(i)));
+    }
+
+    queue.flush();
+    EXPECT_EQ(postedEvents(*client_), (std::vector<int>{3, 4, 5}));
+    EXPECT_EQ(queue.getStats().dropped, 2u);
+}
+
+TEST_F(ActivityLogQueueTest, Block_WaitsForRoomThenTimesOut) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setCapacity(1);
+    queue.setOverflowPolicy(ActivityOverflowPolicy::Block);
+    queue.setBlockTimeout(5000);
+    queue.enqueue(event(1));
+
+    bool accepted = false;
+    std::thread producer([&]() { accepted = queue.enqueue(event(2)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.flush();
+    producer.join();
+    EXPECT_TRUE(accepted);
+
+    queue.setBlockTimeout(10);
+    EXPECT_FALSE(queue.enqueue(event(3)));
+    EXPECT_EQ(queue.getStats().dropped, 1u);
+
+    queue.flush();
+    EXPECT_EQ(postedEvents(*client_), (std::vector<int>{1, 2}));
+}
+
+TEST_F(ActivityLogQueueTest, Spill_WritesOverflowAndReplaysInOrder) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setCapacity(2);
+    queue.setSpillPath(spillPath_);
+    for (int i = 1; i <= 5; ++i) {
+        EXPECT_TRUE(queue.enqueue(event(i)));
+    }
+    EXPECT_EQ(queue.getStats().spilled, 3u);
+    EXPECT_TRUE(std::ifstream(spillPath_).good());
+
+    EXPECT_EQ(queue.flush(), 5);
+    EXPECT_EQ(postedEvents(*client_), (std::vector<int>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(queue.getStats().replayed, 3u);
+    EXPECT_FALSE(std::ifstream(spillPath_).good());
+}
+
+TEST_F(ActivityLogQueueTest, Stop_SpillsUnpostedEventsForNextRun) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setSpillPath(spillPath_);
+    client_->respond("POST", "/ActivityLog/batch", 503);
+    queue.start();
+    queue.enqueue(event(1));
+    queue.enqueue(event(2));
+    queue.stop();
+    EXPECT_EQ(queue.getStats().depth, 0u);
+
+    // A later run replays the spill file
+    client_->respond("POST", "/ActivityLog/batch", 201);
+    queue.setSpillPath(spillPath_);
+    EXPECT_EQ(queue.flush(), 2);
+    auto posted = postedEvents(*client_);
+    EXPECT_EQ(std::vector<int>(posted.end() - 2, posted.end()), (std::vector<int>{1, 2}));
+}
+
+// =============================================================================
+// ActivityLogService Tests
+// =============================================================================
+
+TEST_F(ActivityLogQueueTest, ServiceConvenienceMethods_QueueWhileRunning) {
+    auto& queue = ActivityLogQueue::getInstance();
+    queue.setFlushInterval(60000);
+    queue.start();
+
+    ActivityLogService service(client_);
+    auto result = service.logLogin(7, "Ada Lovelace", "ada@example.com", "student", "10.0.0.1", true);
+    service.logFormSubmission(7, "Ada Lovelace", "ada@example.com", "personal_info", "Personal Information");
+
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(result.activityId, 0);
+    EXPECT_TRUE(client_->endpoints("POST").empty());
+    EXPECT_EQ(queue.getStats().depth, 2u);
+
+    EXPECT_EQ(queue.flush(), 2);
+    EXPECT_EQ(client_->endpoints("POST"), std::vector<std::string>{"/ActivityLog/batch"});
+}
@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "api/AdminStatisticsService.h"
+#include "api/ApiUtils.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using TestUtils::FakeApiClient;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class AdminStatisticsServiceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        today_ = AdminStatisticsService::localDate(std::chrono::system_clock::now());
+        client_ = std::make_shared<FakeApiClient>();
+        for (int id = 1; id <= 3; ++id) {
+            client_->putRow("Curriculum", id, {{"is_active", true}});
+        }
+        put({1, "Active", "1", "2024-01-05T10:00:00", "completed", "2024-01-05T10:00:00"});
+        put({2, "pending", "1", today_ + "T08:00:00", "in_progress", "2024-01-06T09:00:00"});
+        put({3, "active", "2", today_ + "T09:30:00", "approved", "2024-01-06T09:00:00"});
+
+        service().reset();
+        service().setApiClient(client_);
+        service().setPageSize(2);
+    }
+
+    void TearDown() override {
+        service().reset();
+    }
+
+    static AdminStatisticsService& service() {
+        return AdminStatisticsService::getInstance();
+    }
+
+    struct Row {
+        int id;
+        std::string status;
+        std::string curriculumId;
+        std::string createdAt;
+        std::string intakeStatus;
+        std::string updatedAt;
+    };
+
+    void put(const Row& row) {
+        client_->putRow("Student", row.id, {{"status", row.status},
+                                            {"curriculum_id", std::stoi(row.curriculumId)},
+                                            {"created_at", row.createdAt},
+                                            {"intake_status", row.intakeStatus},
+                                            {"updated_at", row.updatedAt}});
+    }
+
+    std::string today_;
+    std::shared_ptr<FakeApiClient> client_;
+};
+
+// =============================================================================
+// Snapshot Tests
+// =============================================================================
+
+TEST_F(AdminStatisticsServiceTest, Snapshot_IsEmptyUntilFirstLoad) {
+    auto snapshot = service().getSnapshot();
+
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_FALSE(snapshot->valid);
+    EXPECT_EQ(snapshot->totalStudents, 0);
+}
+
+TEST_F(AdminStatisticsServiceTest, Rebuild_CountsByStatusCurriculumAndDay) {
+    ASSERT_TRUE(service().refresh());
+    auto snapshot = service().getSnapshot();
+
+    EXPECT_TRUE(snapshot->valid);
+    EXPECT_EQ(snapshot->totalStudents, 3);
+    EXPECT_EQ(snapshot->todaysStudents, 2);
+    EXPECT_EQ(snapshot->completedIntakes, 2);
+    EXPECT_EQ(snapshot->activePrograms, 3);
+    EXPECT_EQ(snapshot->statusCount("active"), 2);
+    EXPECT_EQ(snapshot->statusCount("pending"), 1);
+    EXPECT_EQ(snapshot->curriculumCount("1"), 2);
+    EXPECT_EQ(snapshot->registrationsOn("2024-01-05"), 1);
+    EXPECT_LE(snapshot->ageSeconds(), 1);
+    EXPECT_EQ(service().getWatermark(), "2024-01-06T09:00:00");
+}
+
+TEST_F(AdminStatisticsServiceTest, Rebuild_PagesByIdAfterTheLastRowRead) {
+    ASSERT_TRUE(service().rebuild());
+
+    // Three rows, two per page: the second page starts after id 2, not at an offset
+    auto students = client_->endpoints("GET", "/Student?");
+    ASSERT_EQ(students.size(), 2u);
+    EXPECT_EQ(students[0].find("&filter="), std::string::npos);
+    EXPECT_NE(students[1].find(urlEncode(R"([{"name":"id","op":"gt","val":2}])")), std::string::npos);
+    for (const auto& endpoint : students) {
+        EXPECT_NE(endpoint.find("sort=id"), std::string::npos);
+        EXPECT_EQ(endpoint.find("page[offset]"), std::string::npos);
+    }
+}
+
+// =============================================================================
+// Delta Tests
+// =============================================================================
+
+TEST_F(AdminStatisticsServiceTest, Refresh_AppliesOnlyChangedRows) {
+    ASSERT_TRUE(service().refresh());
+    auto before = service().getSnapshot();
+    client_->takeRequests();
+
+    put({2, "active", "2", today_ + "T08:00:00", "completed", "2024-01-07T12:00:00"});
+    put({4, "pending", "2", today_ + "T11:00:00", "in_progress", "2024-01-07T12:00:00"});
+    ASSERT_TRUE(service().refresh());
+    auto after = service().getSnapshot();
+
+    // Deltas are requested from the watermark, not the whole table
+    auto endpoints = client_->endpoints("GET", "/Student?");
+    ASSERT_FALSE(endpoints.empty());
+    EXPECT_NE(endpoints.front().find("&filter="), std::string::npos);
+    EXPECT_NE(endpoints.front().find("sort=updated_at,id"), std::string::npos);
+
+    EXPECT_EQ(before->totalStudents, 3);    // Published snapshots never change
+    EXPECT_EQ(after->totalStudents, 4);
+    EXPECT_EQ(after->statusCount("active"), 3);
+    EXPECT_EQ(after->statusCount("pending"), 1);
+    EXPECT_EQ(after->curriculumCount("1"), 1);
+    EXPECT_EQ(after->curriculumCount("2"), 3);
+    EXPECT_EQ(after->completedIntakes, 3);
+    EXPECT_EQ(after->todaysStudents, 3);
+    EXPECT_EQ(service().getWatermark(), "2024-01-07T12:00:00");
+}
+
+TEST_F(AdminStatisticsServiceTest, Refresh_PagesThroughRowsSharingATimestamp) {
+    ASSERT_TRUE(service().refresh());
+
+    // Five rows with one updated_at and a page size of two
+    for (int id = 10; id < 15; ++id) {
+        put({id, "pending", "3", "2024-02-01T00:00:00", "in_progress", "2024-02-01T00:00:00"});
+    }
+    ASSERT_TRUE(service().refresh());
+
+    EXPECT_EQ(service().getSnapshot()->curriculumCount("3"), 5);
+    EXPECT_EQ(service().getStudentCount(), 8u);
+}
+
+TEST_F(AdminStatisticsServiceTest, Rebuild_DropsDeletedStudents) {
+    ASSERT_TRUE(service().refresh());
+    client_->eraseRow("Student", 1);
+
+    ASSERT_TRUE(service().refresh());
+    EXPECT_EQ(service().getSnapshot()->totalStudents, 3);   // Deltas cannot see deletions
+
+    ASSERT_TRUE(service().rebuild());
+    auto snapshot = service().getSnapshot();
+    EXPECT_EQ(snapshot->totalStudents, 2);
+    EXPECT_EQ(snapshot->registrationsOn("2024-01-05"), 0);
+    EXPECT_EQ(snapshot->byDay.count("2024-01-05"), 0u);
+}
+
+TEST_F(AdminStatisticsServiceTest, ApplyStudent_UpdatesCountersImmediately) {
+    ASSERT_TRUE(service().refresh());
+
+    service().applyStudent({{"id", 2}, {"attributes", {{"status", "pending"}, {"curriculum_id", 1},
+                                                        {"is_login_revoked", true}}}});
+    service().removeStudent("3");
+    auto snapshot = service().getSnapshot();
+
+    EXPECT_EQ(snapshot->statusCount("revoked"), 1);
+    EXPECT_EQ(snapshot->statusCount("pending"), 0);
+    EXPECT_EQ(snapshot->totalStudents, 2);
+    EXPECT_EQ(snapshot->completedIntakes, 1);
+}
+
+TEST_F(AdminStatisticsServiceTest, ApplyStudentResponse_AppliesTheWrittenRow) {
+    ASSERT_TRUE(service().refresh());
+
+    ApiResponse created;
+    created.statusCode = 201;
+    created.success = true;
+    created.body = nlohmann::json{{"data", {{"type", "Student"}, {"id", "9"},
+                                            {"attributes", {{"status", "pending"}, {"curriculum_id", 2},
+                                                            {"created_at", today_ + "T12:00:00"}}}}}}.dump();
+    service().applyStudentResponse(created);
+
+    ApiResponse failed;
+    failed.statusCode = 500;
+    failed.success = false;
+    failed.body = created.body;
+    service().applyStudentResponse(failed);
+
+    auto snapshot = service().getSnapshot();
+    EXPECT_EQ(snapshot->totalStudents, 4);
+    EXPECT_EQ(snapshot->todaysStudents, 3);
+    EXPECT_EQ(snapshot->statusCount("pending"), 2);
+}
+
+TEST_F(AdminStatisticsServiceTest, RequestRefresh_WakesTheRefresher) {
+    service().setRefreshInterval(3600);
+    service().start();
+    for (int i = 0; i < 200 && !service().getSnapshot()->valid; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(service().getSnapshot()->valid);
+
+    put({5, "pending", "2", today_ + "T13:00:00", "in_progress", "2024-01-08T00:00:00"});
+    service().requestRefresh();
+    for (int i = 0; i < 200 && service().getSnapshot()->totalStudents != 4; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    service().stop();
+
+    EXPECT_EQ(service().getSnapshot()->totalStudents, 4);
+}
+
+TEST_F(AdminStatisticsServiceTest, Start_LoadsInTheBackground) {
+    service().start();
+    for (int i = 0; i < 200 && !service().getSnapshot()->valid; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    service().stop();
+
+    EXPECT_TRUE(service().getSnapshot()->valid);
+    EXPECT_FALSE(service().isRunning());
+}
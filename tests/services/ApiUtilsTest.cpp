@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include "api/ApiUtils.h"
+
+using namespace StudentIntake::Api;
+
+// =============================================================================
+// Query String Tests
+// =============================================================================
+
+TEST(ApiUtilsTest, UrlEncode_KeepsUnreservedCharacters) {
+    EXPECT_EQ(urlEncode("a-Z_0.9~"), "a-Z_0.9~");
+    EXPECT_EQ(urlEncode("a b&c=%"), "a%20b%26c%3D%25");
+    EXPECT_EQ(urlEncode("[\"x\"]"), "%5B%22x%22%5D");
+}
+
+// =============================================================================
+// JSON:API Row Tests
+// =============================================================================
+
+TEST(ApiUtilsTest, IdString_AcceptsStringsAndNumbers) {
+    EXPECT_EQ(idString(nlohmann::json("17")), "17");
+    EXPECT_EQ(idString(nlohmann::json(17)), "17");
+    EXPECT_EQ(idString(nlohmann::json(nullptr)), "");
+}
+
+TEST(ApiUtilsTest, IntValue_ParsesNumericStringsAndDefaultsToZero) {
+    nlohmann::json attrs = {{"a", 4}, {"b", "12"}, {"c", "x"}, {"d", nullptr}};
+
+    EXPECT_EQ(intValue(attrs, "a"), 4);
+    EXPECT_EQ(intValue(attrs, "b"), 12);
+    EXPECT_EQ(intValue(attrs, "c"), 0);
+    EXPECT_EQ(intValue(attrs, "d"), 0);
+    EXPECT_EQ(intValue(attrs, "missing"), 0);
+    EXPECT_EQ(intValue(nlohmann::json("7")), 7);
+}
+
+TEST(ApiUtilsTest, StringValueAndAttributesOf_ReadResourcesAndPlainObjects) {
+    nlohmann::json resource = {{"id", "3"}, {"attributes", {{"name", "CDL"}, {"code", 5}}}};
+    nlohmann::json plain = {{"name", "CNA"}};
+
+    EXPECT_EQ(stringValue(attributesOf(resource), "name"), "CDL");
+    EXPECT_EQ(stringValue(attributesOf(resource), "code", "-"), "-");
+    EXPECT_EQ(stringValue(attributesOf(plain), "name"), "CNA");
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include "api/AssessmentGrader.h"
+#include "models/Assessment.h"
+
+using namespace StudentIntake::Api;
+using namespace StudentIntake::Models;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class AssessmentGraderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        assessment_ = Assessment("9", "Module 1 Quiz");
+        assessment_.setModuleId(3);
+        assessment_.setPassingScore(75);
+    }
+
+    static AssessmentQuestion makeChoice(int id, const std::string& correct,
+                                         QuestionType type = QuestionType::MultipleChoice) {
+        AssessmentQuestion question(std::to_string(id), "Question " + std::to_string(id));
+        question.setQuestionType(type);
+        for (const char* option : {"a", "b", "c", "d"}) {
+            question.addAnswerOption({option, std::string("Option ") + option, 0});
+        }
+        question.setCorrectAnswer(correct);
+        return question;
+    }
+
+    static AssessmentQuestion makeMultiSelect(int id, const std::vector<std::string>& correct) {
+        auto question = makeChoice(id, "", QuestionType::MultipleSelect);
+        question.setCorrectAnswers(correct);
+        return question;
+    }
+
+    static StudentAssessmentAnswer answer(int questionId, const std::string& given) {
+        StudentAssessmentAnswer a;
+        a.setQuestionId(questionId);
+        a.setAnswerGiven(given);
+        return a;
+    }
+
+    static StudentAssessmentAnswer answers(int questionId, const std::vector<std::string>& given) {
+        StudentAssessmentAnswer a;
+        a.setQuestionId(questionId);
+        a.setAnswersGiven(given);
+        return a;
+    }
+
+    Assessment assessment_;
+};
+
+// =============================================================================
+// Compilation Tests
+// =============================================================================
+
+TEST_F(AssessmentGraderTest, Compile_SkipsInactiveQuestionsAndSortsById) {
+    auto inactive = makeChoice(2, "a");
+    inactive.setActive(false);
+
+    auto key = AnswerKey::compile(assessment_, {makeChoice(7, "a"), inactive, makeChoice(4, "b")});
+
+    EXPECT_EQ(key.getAssessmentId(), 9);
+    EXPECT_EQ(key.getModuleId(), 3);
+    ASSERT_EQ(key.getQuestionCount(), 2u);
+    EXPECT_EQ(key.getQuestions()[0].questionId, 4);
+    EXPECT_EQ(key.find(2), nullptr);
+    EXPECT_EQ(key.find(7)->correctMask, 1u);
+}
+
+TEST_F(AssessmentGraderTest, Compile_MultiSelectBecomesBitmask) {
+    auto key = AnswerKey::compile(assessment_, {makeMultiSelect(1, {"b", "d"})});
+
+    EXPECT_EQ(key.find(1)->correctMask, (1u << 1) | (1u << 3));
+}
+
+// =============================================================================
+// Grading Tests
+// =============================================================================
+
+TEST_F(AssessmentGraderTest, Grade_SingleChoiceIsCaseInsensitive) {
+    auto key = AnswerKey::compile(assessment_, {makeChoice(1, "c")});
+
+    auto result = AssessmentGrader::grade(key, {answer(1, "C")});
+
+    EXPECT_EQ(result.correctAnswers, 1);
+    EXPECT_DOUBLE_EQ(result.score, 100.0);
+    EXPECT_TRUE(result.passed);
+    EXPECT_TRUE(result.gradedAnswers[0].isCorrect());
+}
+
+TEST_F(AssessmentGraderTest, Grade_MultiSelectRequiresExactSetInAnyOrder) {
+    auto key = AnswerKey::compile(assessment_, {makeMultiSelect(1, {"a", "c"}),
+                                                makeMultiSelect(2, {"a", "c"}),
+                                                makeMultiSelect(3, {"a", "c"})});
+
+    auto result = AssessmentGrader::grade(key, {
+        answers(1, {"c", "a"}),
+        answers(2, {"a", "c", "d"}),
+        answers(3, {"a", "x"})
+    });
+
+    ASSERT_EQ(result.gradedAnswers.size(), 3u);
+    EXPECT_TRUE(result.gradedAnswers[0].isCorrect());
+    EXPECT_FALSE(result.gradedAnswers[1].isCorrect());
+    EXPECT_FALSE(result.gradedAnswers[2].isCorrect());
+}
+
+TEST_F(AssessmentGraderTest, Grade_TrueFalseWithoutOptions) {
+    AssessmentQuestion question("1", "The sky is blue");
+    question.setQuestionType(QuestionType::TrueFalse);
+    question.setCorrectAnswer("True");
+
+    auto key = AnswerKey::compile(assessment_, {question});
+
+    EXPECT_TRUE(AssessmentGrader::grade(key, {answer(1, "true")}).passed);
+    EXPECT_FALSE(AssessmentGrader::grade(key, {answer(1, "false")}).passed);
+}
+
+TEST_F(AssessmentGraderTest, Grade_UnansweredAndDuplicateAnswersCountOnce) {
+    auto key = AnswerKey::compile(assessment_, {makeChoice(1, "a"), makeChoice(2, "b"),
+                                                makeChoice(3, "c"), makeChoice(4, "d")});
+
+    auto result = AssessmentGrader::grade(key, {answer(1, "a"), answer(1, "a"),
+                                                answer(2, "b"), answer(99, "a")});
+
+    EXPECT_EQ(result.totalQuestions, 4);
+    EXPECT_EQ(result.correctAnswers, 2);
+    EXPECT_EQ(result.gradedAnswers.size(), 2u);
+    EXPECT_DOUBLE_EQ(result.score, 50.0);
+    EXPECT_FALSE(result.passed);
+}
+
+TEST_F(AssessmentGraderTest, Grade_WeightsByPoints) {
+    auto heavy = makeChoice(1, "a");
+    heavy.setPoints(3);
+
+    auto key = AnswerKey::compile(assessment_, {heavy, makeChoice(2, "b")});
+    auto result = AssessmentGrader::grade(key, {answer(1, "a"), answer(2, "a")});
+
+    EXPECT_DOUBLE_EQ(result.pointsPossible, 4.0);
+    EXPECT_DOUBLE_EQ(result.score, 75.0);
+    EXPECT_TRUE(result.passed);
+    EXPECT_DOUBLE_EQ(result.gradedAnswers[0].getPointsEarned(), 3.0);
+}
+
+// =============================================================================
+// Cohort and Report Tests
+// =============================================================================
+
+TEST_F(AssessmentGraderTest, GradeCohort_RegradesAfterKeyCorrection) {
+    std::vector<AssessmentQuestion> questions;
+    for (int id = 1; id <= 50; ++id) {
+        questions.push_back(makeChoice(id, "a"));
+    }
+
+    std::map<std::string, std::vector<StudentAssessmentAnswer>> cohort;
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+        auto& given = cohort[std::to_string(attempt)];
+        for (int id = 1; id <= 50; ++id) {
+            given.push_back(answer(id, id == 50 && attempt % 2 == 0 ? "b" : "a"));
+        }
+    }
+
+    auto before = AssessmentGrader::gradeCohort(AnswerKey::compile(assessment_, questions), cohort);
+    questions.back().setCorrectAnswer("b");
+    auto after = AssessmentGrader::gradeCohort(AnswerKey::compile(assessment_, questions), cohort);
+
+    ASSERT_EQ(after.size(), 1000u);
+    EXPECT_EQ(before["0"].correctAnswers, 49);
+    EXPECT_EQ(after["0"].correctAnswers, 50);
+    EXPECT_EQ(before["1"].correctAnswers, 50);
+    EXPECT_EQ(after["1"].correctAnswers, 49);
+}
+
+TEST_F(AssessmentGraderTest, AddModuleScores_UsesBestAttempt) {
+    ModuleGradeInput module;
+    module.moduleId = 3;
+    module.moduleNumber = 1;
+    module.moduleTitle = "Vehicle Inspection";
+    module.completed = true;
+    module.attemptScores = {60.0, 90.0, 80.0};
+
+    AssessmentReport report;
+    AssessmentGrader::addModuleScores(report, {module, ModuleGradeInput()});
+
+    auto scores = report.getModuleScores();
+    ASSERT_EQ(scores.size(), 2u);
+    EXPECT_DOUBLE_EQ(scores[0].score, 90.0);
+    EXPECT_TRUE(scores[0].completed);
+    EXPECT_DOUBLE_EQ(scores[1].score, 0.0);
+}
@@ -0,0 +1,286 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include "api/ClassroomService.h"
+#include "api/QuestionBankCache.h"
+#include "models/Assessment.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using namespace StudentIntake::Models;
+using TestUtils::FakeApiClient;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class ClassroomServiceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        client_ = std::make_shared<FakeApiClient>();
+        client_->route("POST", kAnswers, [this](const FakeApiClient::Request& request) {
+            return answerAttempt(request);
+        });
+        service_ = std::make_unique<ClassroomService>(client_);
+        QuestionBankCache::getInstance().clear();
+    }
+
+    void TearDown() override {
+        QuestionBankCache::getInstance().clear();
+    }
+
+    static StudentAssessmentAttempt makeAttempt() {
+        StudentAssessmentAttempt attempt;
+        attempt.setId("12");
+        attempt.setAssessmentId(5);
+        return attempt;
+    }
+
+    // Two single-choice questions, "a" and "b" correct, passing at 70%;
+    // the backend reports the same rows, so the cached key is current
+    void primeKey(const std::string& secondUpdatedAt = "2024-03-01T09:00:00Z") {
+        Assessment assessment("5", "Quiz");
+        assessment.setPassingScore(70);
+        assessment.setUpdatedAt("2024-03-01T08:00:00Z");
+
+        std::vector<AssessmentQuestion> questions;
+        for (int id = 1; id <= 2; ++id) {
+            AssessmentQuestion question(std::to_string(id), "Question");
+            question.addAnswerOption({"a", "A", 1});
+            question.addAnswerOption({"b", "B", 2});
+            question.setCorrectAnswer(id == 1 ? "a" : "b");
+            question.setUpdatedAt("2024-03-01T09:00:00Z");
+            questions.push_back(question);
+        }
+        QuestionBankCache::getInstance().store(assessment, questions);
+
+        client_->respond("GET", "/Assessment/5", 200, {{"data", {
+            {"type", "Assessment"}, {"id", "5"},
+            {"attributes", {{"title", "Quiz"}, {"passing_score", 70}, {"updated_at", "2024-03-01T08:00:00Z"}}}
+        }}});
+        client_->respond("GET", kVersionQuery, 200, {{"data", {
+            {{"type", "AssessmentQuestion"}, {"id", "1"}, {"attributes", {{"updated_at", "2024-03-01T09:00:00Z"}}}},
+            {{"type", "AssessmentQuestion"}, {"id", "2"}, {"attributes", {{"updated_at", secondUpdatedAt}}}}
+        }}});
+    }
+
+    static constexpr const char* kAnswers = "/StudentAssessmentAttempt/12/answers";
+    static constexpr const char* kVersionQuery =
+        "/AssessmentQuestion?filter[assessment_id]=5&fields[AssessmentQuestion]=updated_at";
+
+    static StudentAssessmentAnswer makeAnswer(int questionId, const std::string& given) {
+        StudentAssessmentAnswer answer;
+        answer.setAttemptId(12);
+        answer.setQuestionId(questionId);
+        answer.setAnswerGiven(given);
+        return answer;
+    }
+
+    // Draft saves block until released, as a slow request would
+    void holdDrafts(bool hold) {
+        {
+            std::lock_guard<std::mutex> lock(answersMutex_);
+            holdDrafts_ = hold;
+        }
+        draftGate_.notify_all();
+    }
+
+    // finalize flag of every answers POST, in the order they reached the server
+    std::vector<bool> answerPosts() {
+        std::lock_guard<std::mutex> lock(answersMutex_);
+        return answerPosts_;
+    }
+
+    // "METHOD endpoint" of every request
+    std::vector<std::string> calls() const {
+        std::vector<std::string> result;
+        for (const auto& request : client_->requests()) {
+            result.push_back(request.method + " " + request.endpoint);
+        }
+        return result;
+    }
+
+    int bulkStatus_ = 200;
+    nlohmann::json bulkBody_;
+    std::shared_ptr<FakeApiClient> client_;
+    std::unique_ptr<ClassroomService> service_;
+
+private:
+    ApiResponse answerAttempt(const FakeApiClient::Request& request) {
+        bool finalize = request.payload["data"]["attributes"].value("finalize", false);
+        std::unique_lock<std::mutex> lock(answersMutex_);
+        if (!finalize) {
+            draftGate_.wait(lock, [this] { return !holdDrafts_; });
+        }
+        answerPosts_.push_back(finalize);
+        return FakeApiClient::reply(bulkStatus_, bulkBody_);
+    }
+
+    std::mutex answersMutex_;
+    std::condition_variable draftGate_;
+    bool holdDrafts_ = false;
+    std::vector<bool> answerPosts_;
+};
+
+// =============================================================================
+// Bulk Submission Tests
+// =============================================================================
+
+TEST_F(ClassroomServiceTest, SubmitAttempt_SendsAllAnswersInOneRequest) {
+    primeKey();
+    service_->submitAttempt(makeAttempt(), {makeAnswer(1, "a"), makeAnswer(2, "a")}, 300);
+
+    // The key is served from the cache; only the version check reads the backend
+    EXPECT_EQ(calls(), (std::vector<std::string>{"GET /Assessment/5", std::string("GET ") + kVersionQuery,
+                                                 "POST /StudentAssessmentAttempt/12/answers"}));
+
+    auto data = client_->requests("POST", kAnswers).at(0).payload["data"];
+    EXPECT_EQ(data["type"], "StudentAssessmentAttempt");
+    EXPECT_EQ(data["id"], "12");
+    EXPECT_TRUE(data["attributes"]["finalize"].get<bool>());
+    EXPECT_EQ(data["attributes"]["time_spent_seconds"], 300);
+    ASSERT_EQ(data["attributes"]["answers"].size(), 2u);
+
+    // Grades come from the local answer key
+    EXPECT_TRUE(data["attributes"]["answers"][0]["is_correct"].get<bool>());
+    EXPECT_FALSE(data["attributes"]["answers"][1]["is_correct"].get<bool>());
+    EXPECT_DOUBLE_EQ(data["attributes"]["score"].get<double>(), 50.0);
+    EXPECT_FALSE(data["attributes"]["passed"].get<bool>());
+}
+
+TEST_F(ClassroomServiceTest, SubmitAttempt_UsesLocalGradeWhenServerDoesNotGrade) {
+    primeKey();
+    bulkBody_ = {{"data", {{"type", "StudentAssessmentAttempt"}, {"id", "12"},
+                                   {"attributes", {{"status", "in_progress"}}}}}};
+
+    auto submission = service_->submitAttempt(makeAttempt(),
+                                              {makeAnswer(1, "A"), makeAnswer(2, "b")}, 60);
+
+    EXPECT_DOUBLE_EQ(submission.attempt.getScore(), 100.0);
+    EXPECT_TRUE(submission.attempt.hasPassed());
+    ASSERT_EQ(submission.answers.size(), 2u);
+    EXPECT_TRUE(submission.answers[0].isCorrect());
+}
+
+TEST_F(ClassroomServiceTest, SubmitAttempt_PrefersServerGradeWhenVerifying) {
+    bulkBody_ = {
+        {"data", {{"type", "StudentAssessmentAttempt"}, {"id", "12"},
+                  {"attributes", {{"status", "graded"}, {"score", 50.0}, {"passed", false},
+                                  {"total_questions", 2}, {"correct_answers", 1}}}}},
+        {"included", {
+            {{"type", "StudentAssessmentAnswer"}, {"id", "1"},
+             {"attributes", {{"question_id", 1}, {"answer_given", "a"}, {"is_correct", true}}}},
+            {{"type", "StudentAssessmentAnswer"}, {"id", "2"},
+             {"attributes", {{"question_id", 2}, {"answer_given", "b"}, {"is_correct", false}}}}
+        }}
+    };
+
+    service_->setServerVerification(true);
+    primeKey();
+    auto submission = service_->submitAttempt(makeAttempt(),
+                                              {makeAnswer(1, "a"), makeAnswer(2, "b")}, 60);
+
+    EXPECT_TRUE(submission.result.success);
+    EXPECT_EQ(submission.attempt.getId(), "12");
+    EXPECT_DOUBLE_EQ(submission.attempt.getScore(), 50.0);
+    EXPECT_EQ(submission.attempt.getCorrectAnswers(), 1);
+    ASSERT_EQ(submission.answers.size(), 2u);
+    EXPECT_EQ(submission.answers[1].getQuestionId(), 2);
+}
+
+TEST_F(ClassroomServiceTest, SubmitAttempt_FallsBackWhenBulkEndpointMissing) {
+    bulkStatus_ = 404;
+
+    primeKey();
+    service_->submitAttempt(makeAttempt(), {makeAnswer(1, "a"), makeAnswer(2, "b")}, 60);
+
+    auto requests = calls();
+    ASSERT_GT(requests.size(), 5u);
+    EXPECT_EQ(requests[3], "POST /StudentAssessmentAnswer");
+    EXPECT_EQ(requests[4], "POST /StudentAssessmentAnswer");
+}
+
+TEST_F(ClassroomServiceTest, GetAnswerKey_RefetchesWhenAQuestionWasEdited) {
+    primeKey("2024-03-04T12:00:00Z");
+    client_->respond("GET", "/AssessmentQuestion?filter[assessment_id]=5&sort=question_order", 200, {{"data", {
+        {{"type", "AssessmentQuestion"}, {"id", "1"},
+         {"attributes", {{"correct_answer", "a"}, {"updated_at", "2024-03-01T09:00:00Z"}}}},
+        {{"type", "AssessmentQuestion"}, {"id", "2"},
+         {"attributes", {{"correct_answer", "a"}, {"updated_at", "2024-03-04T12:00:00Z"}}}}
+    }}});
+
+    auto grade = service_->gradeAttempt(5, {makeAnswer(1, "a"), makeAnswer(2, "a")});
+
+    // Graded against the corrected key, not the cached one
+    EXPECT_EQ(calls().back(), "GET /AssessmentQuestion?filter[assessment_id]=5&sort=question_order");
+    EXPECT_EQ(grade.correctAnswers, 2);
+}
+
+TEST_F(ClassroomServiceTest, SaveAttemptAnswers_DoesNotFinalize) {
+    service_->saveAttemptAnswers("12", {makeAnswer(3, "c")});
+
+    auto posts = client_->requests("POST");
+    ASSERT_EQ(posts.size(), 1u);
+    auto attrs = posts[0].payload["data"]["attributes"];
+    EXPECT_FALSE(attrs["finalize"].get<bool>());
+    EXPECT_FALSE(attrs.contains("submitted_at"));
+}
+
+// =============================================================================
+// Autosave Ordering Tests
+// =============================================================================
+
+TEST_F(ClassroomServiceTest, SubmitAttempt_WaitsForDraftInFlight) {
+    primeKey();
+    bulkBody_ = {{"data", {{"type", "StudentAssessmentAttempt"}, {"id", "12"}}}};
+    holdDrafts(true);
+
+    std::promise<bool> draftSaved;
+    service_->saveAttemptAnswersAsync("12", {makeAnswer(1, "b")},
+        [&draftSaved](const ClassroomResult& result) { draftSaved.set_value(result.success); });
+
+    AttemptSubmission submission;
+    std::thread submitter([&] {
+        submission = service_->submitAttempt(makeAttempt(), {makeAnswer(1, "a"), makeAnswer(2, "b")}, 60);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(answerPosts().empty());
+
+    holdDrafts(false);
+    submitter.join();
+
+    EXPECT_TRUE(draftSaved.get_future().get());
+    EXPECT_TRUE(submission.result.success);
+    EXPECT_EQ(answerPosts(), (std::vector<bool>{false, true}));
+}
+
+TEST_F(ClassroomServiceTest, SaveAttemptAnswersAsync_DroppedAfterSubmission) {
+    primeKey();
+    bulkBody_ = {{"data", {{"type", "StudentAssessmentAttempt"}, {"id", "12"}}}};
+    service_->submitAttempt(makeAttempt(), {makeAnswer(1, "a"), makeAnswer(2, "b")}, 60);
+
+    bool saved = true;
+    service_->saveAttemptAnswersAsync("12", {makeAnswer(1, "b")},
+        [&saved](const ClassroomResult& result) { saved = result.success; });
+
+    EXPECT_FALSE(saved);
+    EXPECT_EQ(answerPosts(), std::vector<bool>{true});
+}
+
+TEST_F(ClassroomServiceTest, SaveAttemptAnswersAsync_ResumesAfterFailedSubmission) {
+    primeKey();
+    bulkStatus_ = 500;
+    auto submission = service_->submitAttempt(makeAttempt(), {makeAnswer(1, "a")}, 60);
+    ASSERT_FALSE(submission.result.success);
+
+    bulkStatus_ = 200;
+    std::promise<bool> draftSaved;
+    service_->saveAttemptAnswersAsync("12", {makeAnswer(2, "b")},
+        [&draftSaved](const ClassroomResult& result) { draftSaved.set_value(result.success); });
+
+    EXPECT_TRUE(draftSaved.get_future().get());
+    EXPECT_EQ(answerPosts(), (std::vector<bool>{true, false}));
+}
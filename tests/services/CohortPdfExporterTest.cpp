@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include "api/CohortPdfExporter.h"
+
+using namespace StudentIntake::Api;
+
+namespace {
+
+// Entry names and contents of a stored ZIP, walking the local headers
+std::map<std::string, std::string> readEntries(const std::string& archive, std::vector<std::string>* order = nullptr) {
+    auto read32 = [&archive](size_t offset) {
+        uint32_t value = 0;
+        for (int i = 3; i >= 0; --i) {
+            value = (value << 8) | static_cast<unsigned char>(archive[offset + i]);
+        }
+        return value;
+    };
+    auto read16 = [&archive](size_t offset) {
+        return static_cast<size_t>(static_cast<unsigned char>(archive[offset])
+                                   | (static_cast<unsigned char>(archive[offset + 1]) << 8));
+    };
+
+    std::map<std::string, std::string> entries;
+    size_t offset = 0;
+    while (offset + 30 <= archive.size() && read32(offset) == 0x04034b50u) {
+        size_t size = read32(offset + 18);
+        size_t nameLength = read16(offset + 26);
+        std::string name = archive.substr(offset + 30, nameLength);
+        entries[name] = archive.substr(offset + 30 + nameLength, size);
+        if (order) {
+            order->push_back(name);
+        }
+        offset += 30 + nameLength + size;
+    }
+    return entries;
+}
+
+SubmissionView submission(int studentId, int curriculumId, const std::string& submittedAt) {
+    SubmissionView view;
+    view.studentId = studentId;
+    view.curriculumId = curriculumId;
+    view.submittedAt = submittedAt;
+    return view;
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class CohortPdfExporterTest : public ::testing::Test {
+protected:
+    // Renders "%PDF-<id>" with a delay that makes later students finish first
+    static StudentPacket fakePacket(int studentId) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(studentId % 2 == 0 ? 20 : 1));
+        StudentPacket packet;
+        if (studentId == 13) {
+            packet.error = "Student record could not be loaded";
+            return packet;
+        }
+        packet.fileName = CohortPdfExporter::packetFileName(studentId, "Student " + std::to_string(studentId));
+        packet.pdf = "%PDF-" + std::to_string(studentId);
+        return packet;
+    }
+
+    ZipStreamWriter::Sink collect() {
+        return [this](const char* data, size_t size) {
+            archive_.append(data, size);
+            return true;
+        };
+    }
+
+    std::string archive_;
+};
+
+// =============================================================================
+// Export Tests
+// =============================================================================
+
+TEST_F(CohortPdfExporterTest, Run_WritesPacketsInRequestedOrder) {
+    CohortPdfExporter exporter(nullptr, 4, 3);
+    exporter.setRenderer(fakePacket);
+
+    std::vector<int> students = {2, 3, 4, 5, 6, 7, 8, 9};
+    ASSERT_TRUE(exporter.run(students, collect()));
+
+    std::vector<std::string> order;
+    auto entries = readEntries(archive_, &order);
+    ASSERT_EQ(order.size(), students.size());
+    for (size_t i = 0; i < students.size(); ++i) {
+        std::string id = std::to_string(students[i]);
+        EXPECT_EQ(order[i], "000" + id + "_Student_" + id + ".pdf");
+        EXPECT_EQ(entries[order[i]], "%PDF-" + id);
+    }
+}
+
+TEST_F(CohortPdfExporterTest, Run_KeepsPendingPacketsWithinWindow) {
+    CohortPdfExporter exporter(nullptr, 4, 2);
+    exporter.setRenderer(fakePacket);
+
+    // A slow sink lets rendered packets pile up if nothing holds the workers back
+    std::vector<int> students(24);
+    for (size_t i = 0; i < students.size(); ++i) {
+        students[i] = static_cast<int>(i) + 100;
+    }
+    ASSERT_TRUE(exporter.run(students, [this](const char* data, size_t size) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        archive_.append(data, size);
+        return true;
+    }));
+
+    EXPECT_LE(exporter.getPeakPendingPackets(), 2u);
+    EXPECT_EQ(readEntries(archive_).size(), students.size());
+}
+
+TEST_F(CohortPdfExporterTest, Run_ListsFailedStudentsAndReportsProgress) {
+    CohortPdfExporter exporter(nullptr, 2, 4);
+    exporter.setRenderer(fakePacket);
+    std::vector<CohortExportProgress> updates;
+    exporter.setProgressCallback([&updates](const CohortExportProgress& progress) {
+        updates.push_back(progress);
+    });
+
+    ASSERT_TRUE(exporter.run({12, 13, 14}, collect()));
+
+    auto entries = readEntries(archive_);
+    EXPECT_EQ(entries.size(), 3u);
+    ASSERT_EQ(entries.count("export_errors.txt"), 1u);
+    EXPECT_NE(entries["export_errors.txt"].find("13\tStudent record could not be loaded"), std::string::npos);
+
+    ASSERT_FALSE(updates.empty());
+    EXPECT_EQ(updates.front().completed, 0u);
+    const auto& last = updates.back();
+    EXPECT_TRUE(last.finished);
+    EXPECT_FALSE(last.cancelled);
+    EXPECT_EQ(last.total, 3u);
+    EXPECT_EQ(last.completed, 3u);
+    EXPECT_EQ(last.failed, 1u);
+    EXPECT_EQ(last.bytesWritten, archive_.size());
+}
+
+TEST_F(CohortPdfExporterTest, Run_StopsWhenSinkFails) {
+    CohortPdfExporter exporter(nullptr, 2, 2);
+    int rendered = 0;
+    std::mutex renderedMutex;
+    exporter.setRenderer([&](int studentId) {
+        std::lock_guard<std::mutex> lock(renderedMutex);
+        rendered++;
+        StudentPacket packet;
+        packet.fileName = CohortPdfExporter::packetFileName(studentId, "");
+        packet.pdf = "%PDF";
+        return packet;
+    });
+
+    std::vector<int> students(50, 0);
+    for (size_t i = 0; i < students.size(); ++i) {
+        students[i] = static_cast<int>(i) + 1;
+    }
+    size_t accepted = 0;
+    EXPECT_FALSE(exporter.run(students, [&accepted](const char*, size_t) { return ++accepted < 4; }));
+
+    EXPECT_TRUE(exporter.getProgress().cancelled);
+    EXPECT_LT(rendered, 50);
+}
+
+// =============================================================================
+// Selection Tests
+// =============================================================================
+
+TEST(CohortPdfExporterSelectionTest, SelectStudents_FiltersByProgramAndDateRange) {
+    std::vector<SubmissionView> submissions = {
+        submission(1, 5, "2024-03-01T09:00:00"),
+        submission(2, 5, "2024-02-28T23:59:00"),
+        submission(1, 5, "2024-03-02T09:00:00"),
+        submission(3, 6, "2024-03-05T10:00:00"),
+        submission(4, 5, ""),
+        submission(5, 5, "2024-03-31T08:00:00")
+    };
+
+    CohortFilter filter;
+    filter.curriculumId = 5;
+    filter.submittedFrom = "2024-03-01";
+    filter.submittedTo = "2024-03-31";
+    EXPECT_EQ(CohortPdfExporter::selectStudents(submissions, filter), (std::vector<int>{1, 5}));
+
+    EXPECT_EQ(CohortPdfExporter::selectStudents(submissions, CohortFilter()),
+              (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(CohortPdfExporterSelectionTest, PacketFileName_IsFilesystemSafe) {
+    EXPECT_EQ(CohortPdfExporter::packetFileName(42, "Ada  Lovelace"), "0042_Ada_Lovelace.pdf");
+    EXPECT_EQ(CohortPdfExporter::packetFileName(7, "O'Brien, Seán/"), "0007_O_Brien_Se_n.pdf");
+    EXPECT_EQ(CohortPdfExporter::packetFileName(12345, ""), "12345.pdf");
+}
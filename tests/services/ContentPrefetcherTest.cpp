@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include "api/ClassroomService.h"
+#include "api/ContentPrefetcher.h"
+#include "api/PrefetchPool.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using namespace StudentIntake::Models;
+using TestUtils::FakeApiClient;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class ContentPrefetcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        client_ = std::make_shared<FakeApiClient>();
+        catalog("Lesson text");
+        client_->putRow("Assessment", 7, {{"module_id", 2}, {"title", "Module 2 Quiz"}});
+        service_ = std::make_shared<ClassroomService>(client_);
+        modules_ = {CourseModule("1", "Module 1"), CourseModule("2", "Module 2")};
+        PrefetchPool::getInstance().start();
+    }
+
+    void TearDown() override {
+        client_->release();
+        PrefetchPool::getInstance().stop();
+    }
+
+    // A two-module course: module 1 holds content 10 and 11, module 2 holds
+    // content 20 and has assessment 7
+    void catalog(const std::string& bodyText) {
+        for (int id : {10, 11, 20}) {
+            client_->putRow("ModuleContent", id, {{"module_id", id / 10}, {"title", "Item " + std::to_string(id)},
+                                                  {"content_type", "reading"}, {"content_text", bodyText}});
+        }
+    }
+
+    std::shared_ptr<FakeApiClient> client_;
+    std::shared_ptr<ClassroomService> service_;
+    std::vector<CourseModule> modules_;
+};
+
+// =============================================================================
+// Cache Tests
+// =============================================================================
+
+TEST_F(ContentPrefetcherTest, GetContent_SecondReadServedFromMemory) {
+    ContentPrefetcher prefetcher(service_);
+
+    EXPECT_EQ(prefetcher.getContent(10).getTitle(), "Item 10");
+    EXPECT_EQ(prefetcher.getContent(10).getTitle(), "Item 10");
+
+    EXPECT_EQ(client_->countRequests(), 1u);
+    EXPECT_EQ(prefetcher.getHitCount(), 1u);
+    EXPECT_EQ(prefetcher.getMissCount(), 1u);
+}
+
+TEST_F(ContentPrefetcherTest, PrefetchAfter_WarmsNextItemWithinModule) {
+    ContentPrefetcher prefetcher(service_);
+    prefetcher.getModuleContents(1);
+
+    prefetcher.prefetchAfter(modules_, 1, 10);
+    prefetcher.waitIdle();
+    size_t before = client_->countRequests();
+
+    EXPECT_EQ(prefetcher.getContent(11).getTitle(), "Item 11");
+    EXPECT_EQ(prefetcher.getModuleContents(2).size(), 1u);
+    EXPECT_EQ(prefetcher.getModuleAssessment(2).getId(), "7");
+    EXPECT_EQ(client_->countRequests(), before);
+}
+
+TEST_F(ContentPrefetcherTest, PrefetchAfter_LastItemWarmsFirstItemOfNextModule) {
+    ContentPrefetcher prefetcher(service_);
+
+    prefetcher.prefetchAfter(modules_, 1, 11);
+    prefetcher.waitIdle();
+    size_t before = client_->countRequests();
+
+    EXPECT_EQ(prefetcher.getContent(20).getModuleId(), 2);
+    EXPECT_EQ(client_->countRequests(), before);
+}
+
+TEST_F(ContentPrefetcherTest, Store_EvictsLeastRecentlyUsedWithinBudget) {
+    catalog(std::string(300, 'x'));
+    ContentPrefetcher probe(service_);
+    probe.getContent(10);
+    size_t itemBytes = probe.getMemoryUsage();
+
+    ContentPrefetcher prefetcher(service_, itemBytes * 2 + itemBytes / 2);
+    prefetcher.getContent(10);
+    prefetcher.getContent(11);
+    prefetcher.getContent(10);   // 11 is now least recently used
+    prefetcher.getContent(20);
+
+    EXPECT_EQ(prefetcher.getEntryCount(), 2u);
+    EXPECT_LE(prefetcher.getMemoryUsage(), prefetcher.getMaxBytes());
+
+    size_t before = client_->countRequests();
+    prefetcher.getContent(10);
+    EXPECT_EQ(client_->countRequests(), before);
+    prefetcher.getContent(11);
+    EXPECT_EQ(client_->countRequests(), before + 1);
+}
+
+TEST_F(ContentPrefetcherTest, Store_SkipsItemsLargerThanBudget) {
+    catalog(std::string(4096, 'x'));
+    ContentPrefetcher prefetcher(service_, 1024);
+
+    EXPECT_EQ(prefetcher.getContent(10).getContentText().size(), 4096u);
+    EXPECT_EQ(prefetcher.getEntryCount(), 0u);
+}
+
+// =============================================================================
+// Cancellation Tests
+// =============================================================================
+
+TEST_F(ContentPrefetcherTest, Clear_DropsResultsOfJobInFlight) {
+    ContentPrefetcher prefetcher(service_);
+    client_->hold("GET", "/Assessment?");
+
+    prefetcher.prefetchAfter(modules_, 1, 11);
+    client_->waitUntilHeld();
+    prefetcher.clear();
+    client_->release();
+    prefetcher.waitIdle();
+
+    // The job was cancelled before it stored the assessment it was fetching
+    EXPECT_EQ(prefetcher.getEntryCount(), 0u);
+}
+
+TEST_F(ContentPrefetcherTest, Destructor_DoesNotWaitForJobInFlight) {
+    auto prefetcher = std::make_unique<ContentPrefetcher>(service_);
+    client_->hold("GET", "/Assessment?");
+    prefetcher->prefetchAfter(modules_, 1, 11);
+    client_->waitUntilHeld();
+
+    auto started = std::chrono::steady_clock::now();
+    prefetcher.reset();
+    auto elapsed = std::chrono::steady_clock::now() - started;
+
+    EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+    client_->release();
+}
+
+TEST_F(ContentPrefetcherTest, PrefetchAfter_DoesNothingWithoutPool) {
+    PrefetchPool::getInstance().stop();
+    ContentPrefetcher prefetcher(service_);
+
+    prefetcher.prefetchAfter(modules_, 1, 10);
+    prefetcher.waitIdle();
+
+    EXPECT_TRUE(client_->requests().empty());
+}
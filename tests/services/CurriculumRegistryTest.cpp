@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "curriculum/CurriculumRegistry.h"
+#include "session/StudentSession.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake;
+using Curriculum::CurriculumRegistry;
+using namespace TestUtils;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class CurriculumRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CurriculumRegistry::getInstance().clear();
+    }
+
+    void TearDown() override {
+        CurriculumRegistry::getInstance().clear();
+    }
+};
+
+// =============================================================================
+// Interning Tests
+// =============================================================================
+
+TEST_F(CurriculumRegistryTest, Intern_ReturnsTheSameHandleForEqualCurricula) {
+    auto& registry = CurriculumRegistry::getInstance();
+
+    auto first = registry.intern(TestFixtures::createVocationalProgram());
+    auto second = registry.intern(TestFixtures::createVocationalProgram());
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST_F(CurriculumRegistryTest, Intern_CurriculumWithoutIdReturnsNull) {
+    EXPECT_EQ(CurriculumRegistry::getInstance().intern(Models::Curriculum()), nullptr);
+    EXPECT_EQ(CurriculumRegistry::getInstance().size(), 0u);
+}
+
+TEST_F(CurriculumRegistryTest, Intern_ChangedCurriculumLeavesOldHandlesAlone) {
+    auto& registry = CurriculumRegistry::getInstance();
+    auto program = TestFixtures::createAccreditedProgram();
+    auto original = registry.intern(program);
+
+    program.setName("Renamed Program");
+    auto updated = registry.intern(program);
+
+    EXPECT_NE(original, updated);
+    EXPECT_EQ(original->getName(), TestFixtures::createAccreditedProgram().getName());
+    EXPECT_EQ(updated->getName(), "Renamed Program");
+    EXPECT_EQ(registry.intern(program), updated);
+    EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST_F(CurriculumRegistryTest, Sessions_ShareOneCurriculum) {
+    auto handle = CurriculumRegistry::getInstance().intern(TestFixtures::createVocationalProgram());
+
+    std::vector<Session::StudentSession> sessions(3);
+    for (auto& session : sessions) {
+        session.setCurrentCurriculum(CurriculumRegistry::getInstance().intern(TestFixtures::createVocationalProgram()));
+    }
+
+    for (const auto& session : sessions) {
+        EXPECT_EQ(&session.getCurrentCurriculum(), handle.get());
+    }
+    EXPECT_EQ(handle.use_count(), 5);  // registry, this test, three sessions
+}
+
+TEST_F(CurriculumRegistryTest, Clear_HandlesOutliveTheRegistryEntry) {
+    auto handle = CurriculumRegistry::getInstance().intern(TestFixtures::createEndorsementProgram());
+    std::string name = handle->getName();
+
+    CurriculumRegistry::getInstance().clear();
+
+    EXPECT_EQ(CurriculumRegistry::getInstance().size(), 0u);
+    EXPECT_NE(CurriculumRegistry::getInstance().intern(TestFixtures::createEndorsementProgram()), handle);
+    EXPECT_EQ(handle->getName(), name);
+}
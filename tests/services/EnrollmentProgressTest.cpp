@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include "api/ClassroomService.h"
+#include "api/EnrollmentProgress.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using namespace StudentIntake::Models;
+using TestUtils::FakeApiClient;
+
+namespace {
+
+nlohmann::json moduleRow(int id, int moduleId, const std::string& status) {
+    return {{"type", "StudentModuleProgress"}, {"id", std::to_string(id)},
+            {"attributes", {{"module_id", moduleId}, {"enrollment_id", 3}, {"status", status}}}};
+}
+
+nlohmann::json contentRow(int id, int contentId, int moduleProgressId) {
+    return {{"type", "StudentContentProgress"}, {"id", std::to_string(id)},
+            {"attributes", {{"content_id", contentId}, {"module_progress_id", moduleProgressId},
+                            {"status", "completed"}, {"completed", true}}}};
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class EnrollmentProgressTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Enrollment 3: module 1 in progress (row 5), module 2 locked behind
+        // module 1 (row 6), no completed content rows
+        client_ = std::make_shared<FakeApiClient>();
+        client_->respond("GET", "/StudentModuleProgress?", 200, {{"data", {moduleRow(5, 1, "in_progress")}}});
+        client_->respond("GET", "/StudentModuleProgress?filter[enrollment_id]=3", 200,
+                         {{"data", {moduleRow(5, 1, "in_progress"), moduleRow(6, 2, "locked")}}});
+        client_->respond("POST", "/StudentContentProgress", 201, {{"data", {{"id", "40"}}}});
+        client_->respond("PATCH", "/StudentModuleProgress/", 200, {{"data", {{"id", "5"}}}});
+        progress_ = std::make_unique<EnrollmentProgress>(
+            std::make_shared<ClassroomService>(client_), 8, "3");
+        progress_->load();
+    }
+
+    static CourseModule makeModule(int id, int prerequisiteId) {
+        CourseModule module(std::to_string(id), "Module " + std::to_string(id));
+        module.setPrerequisiteModuleId(prerequisiteId);
+        return module;
+    }
+
+    static ModuleContent makeContent(int id, bool required) {
+        ModuleContent content(std::to_string(id), "Item", ContentType::Reading);
+        content.setRequired(required);
+        return content;
+    }
+
+    void failWrites() {
+        client_->respond("POST", "/StudentContentProgress", 500);
+        client_->respond("PATCH", "/StudentModuleProgress/", 500);
+    }
+
+    std::shared_ptr<FakeApiClient> client_;
+    std::unique_ptr<EnrollmentProgress> progress_;
+};
+
+// =============================================================================
+// Loading and Lookup Tests
+// =============================================================================
+
+TEST_F(EnrollmentProgressTest, Load_FetchesProgressListOnce) {
+    progress_->load();
+    progress_->getModuleProgressList();
+    progress_->isModuleCompleted(1);
+
+    EXPECT_TRUE(progress_->isLoaded());
+    EXPECT_EQ(client_->countRequests("GET", "/StudentModuleProgress"), 1u);
+    EXPECT_EQ(progress_->getModuleProgress(2).getId(), "6");
+}
+
+TEST_F(EnrollmentProgressTest, IsModuleUnlocked_OpensWhenPrerequisiteCompletes) {
+    auto second = makeModule(2, 1);
+    EXPECT_TRUE(progress_->isModuleUnlocked(makeModule(1, 0)));
+    EXPECT_FALSE(progress_->isModuleUnlocked(second));
+
+    progress_->completeModule(1);
+
+    EXPECT_TRUE(progress_->isModuleUnlocked(second));
+    EXPECT_EQ(progress_->getCompletedModuleCount(), 1);
+}
+
+TEST_F(EnrollmentProgressTest, AreRequiredContentsCompleted_IgnoresOptionalItems) {
+    std::vector<ModuleContent> contents = {makeContent(10, true), makeContent(11, false),
+                                           makeContent(12, true)};
+
+    progress_->completeContent(1, 10, contents.size());
+    EXPECT_FALSE(progress_->areRequiredContentsCompleted(1, contents));
+
+    progress_->completeContent(1, 12, contents.size());
+    EXPECT_TRUE(progress_->areRequiredContentsCompleted(1, contents));
+    EXPECT_NEAR(progress_->getModuleProgress(1).getProgressPercentage(), 66.7, 0.1);
+}
+
+// =============================================================================
+// Reconciliation Tests
+// =============================================================================
+
+TEST_F(EnrollmentProgressTest, Load_ReadsCompletedItemsFromContentProgress) {
+    // An enrollment started before this model existed: completed_content_ids is
+    // empty and the completions are only in StudentContentProgress
+    client_->respond("GET", "/StudentContentProgress?filter[module_progress_id][in]=5,6", 200,
+                     {{"data", {contentRow(70, 10, 5), contentRow(71, 12, 5)}}});
+    EnrollmentProgress existing(std::make_shared<ClassroomService>(client_), 8, "3");
+    existing.load();
+
+    std::vector<ModuleContent> contents = {makeContent(10, true), makeContent(11, false),
+                                           makeContent(12, true)};
+    EXPECT_TRUE(existing.isContentCompleted(1, 10));
+    EXPECT_FALSE(existing.isContentCompleted(2, 10));
+    EXPECT_TRUE(existing.areRequiredContentsCompleted(1, contents));
+    EXPECT_EQ(client_->countRequests("GET", "/StudentContentProgress?filter[module_progress_id][in]=5,6"), 2u);
+}
+
+TEST_F(EnrollmentProgressTest, CompleteContent_WritesInBackground) {
+    progress_->completeContent(1, 10, 2);
+    EXPECT_TRUE(progress_->isContentCompleted(1, 10));
+
+    progress_->flush();
+
+    EXPECT_EQ(progress_->getPendingWriteCount(), 0u);
+    EXPECT_EQ(client_->countRequests("POST", "/StudentContentProgress"), 1u);
+    EXPECT_EQ(client_->countRequests("PATCH", "/StudentModuleProgress/5"), 1u);
+    EXPECT_EQ(client_->countRequests("GET", "/StudentModuleProgress?filter[enrollment_id]"), 1u);
+}
+
+TEST_F(EnrollmentProgressTest, FailedWrite_ReloadsFromBackend) {
+    std::atomic<int> reconciled{0};
+    progress_->setReconciledCallback([&reconciled]() { reconciled++; });
+    failWrites();
+
+    progress_->completeModule(1);
+    EXPECT_TRUE(progress_->isModuleCompleted(1));
+
+    progress_->flush();
+
+    EXPECT_FALSE(progress_->isModuleCompleted(1));
+    EXPECT_EQ(reconciled.load(), 1);
+}
+
+TEST_F(EnrollmentProgressTest, ClearReconciledCallback_KeepsNewerCallback) {
+    std::atomic<int> first{0};
+    std::atomic<int> second{0};
+    int firstId = progress_->setReconciledCallback([&first]() { first++; });
+    progress_->setReconciledCallback([&second]() { second++; });
+
+    // The first view goes away after the second one took over
+    progress_->clearReconciledCallback(firstId);
+    failWrites();
+    progress_->completeModule(1);
+    progress_->flush();
+
+    EXPECT_EQ(first.load(), 0);
+    EXPECT_EQ(second.load(), 1);
+}
+
+TEST_F(EnrollmentProgressTest, CompleteContent_PatchesOnlyChangedFields) {
+    progress_->completeContent(1, 10, 2);
+    progress_->flush();
+
+    auto attrs = client_->requests("PATCH").back().payload["data"]["attributes"];
+    EXPECT_EQ(attrs["completed_content_ids"], nlohmann::json::array({10}));
+    EXPECT_EQ(attrs["status"], "in_progress");
+    EXPECT_FALSE(attrs.contains("student_id"));
+    EXPECT_FALSE(attrs.contains("time_spent"));
+    EXPECT_FALSE(attrs.contains("best_score"));
+}
+
+TEST_F(EnrollmentProgressTest, WhenDrained_RunsAfterQueuedWrites) {
+    std::atomic<bool> ran{false};
+    progress_->whenDrained([&ran]() { ran = true; });
+    EXPECT_TRUE(ran.load());
+
+    ran = false;
+    progress_->completeModule(1);
+    progress_->whenDrained([this, &ran]() {
+        // The write this callback waited for has reached the backend
+        ran = client_->countRequests("PATCH", "/StudentModuleProgress/5") == 1;
+    });
+    progress_->flush();
+
+    EXPECT_TRUE(ran.load());
+}
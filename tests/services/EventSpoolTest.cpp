@@ -0,0 +1,341 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <dirent.h>
+#include <fstream>
+#include <set>
+#include <thread>
+#include <unistd.h>
+#include "api/EventSpool.h"
+#include "api/ActivityLogService.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using TestUtils::FakeApiClient;
+
+namespace {
+
+// Event numbers in the order they were posted
+std::vector<int> postedEvents(const FakeApiClient& client) {
+    std::vector<int> events;
+    for (const auto& request : client.requests("POST")) {
+        events.push_back(request.payload["data"]["attributes"].value("n", 0));
+    }
+    return events;
+}
+
+// A LoginAudit row the duplicate lookup by client_event_id finds
+void store(FakeApiClient& client, int id) {
+    client.putRow("LoginAudit", id, {{"client_event_id", "event-" + std::to_string(id)}});
+}
+
+nlohmann::json event(int n, size_t padding = 0) {
+    nlohmann::json payload;
+    payload["data"]["type"] = "LoginAudit";
+    payload["data"]["attributes"] = {{"n", n}, {"client_event_id", "event-" + std::to_string(n)},
+                                     {"user_agent", std::string(padding, 'x')}};
+    return payload;
+}
+
+size_t segmentFiles(const std::string& directory) {
+    size_t count = 0;
+    if (DIR* dir = opendir(directory.c_str())) {
+        while (dirent* item = readdir(dir)) {
+            std::string name = item->d_name;
+            count += name.size() > 4 && name.compare(name.size() - 4, 4, ".seg") == 0;
+        }
+        closedir(dir);
+    }
+    return count;
+}
+
+template <typename Predicate>
+bool waitFor(Predicate predicate, int timeoutMs = 3000) {
+    for (int i = 0; i < timeoutMs / 10 && !predicate(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return predicate();
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class EventSpoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory_ = "/tmp/event_spool_test_" + std::to_string(getpid());
+        client_ = std::make_shared<FakeApiClient>();
+        auto& spool = EventSpool::getInstance();
+        spool.reset();
+        spool.setApiClient(client_);
+        ASSERT_TRUE(spool.open(directory_));
+    }
+
+    void TearDown() override {
+        auto& spool = EventSpool::getInstance();
+        spool.stop();
+        spool.open(directory_);
+        spool.reset();
+    }
+
+    // Segment size only applies to new segments, so start from an empty directory
+    void reopenWithSegments(size_t segmentSize, uint64_t maxBytes) {
+        auto& spool = EventSpool::getInstance();
+        spool.reset();
+        spool.setApiClient(client_);
+        spool.setSegmentSize(segmentSize);
+        spool.setMaxBytes(maxBytes);
+        ASSERT_TRUE(spool.open(directory_));
+    }
+
+    std::string directory_;
+    std::shared_ptr<FakeApiClient> client_;
+};
+
+// =============================================================================
+// Append / Replay Tests
+// =============================================================================
+
+TEST_F(EventSpoolTest, Replay_PostsRecordsInOrderToTheirEndpoints) {
+    auto& spool = EventSpool::getInstance();
+    EXPECT_TRUE(spool.append("/LoginAudit", event(1)));
+    EXPECT_TRUE(spool.append("/ActivityLog", event(2)));
+    EXPECT_TRUE(spool.append("/LoginAudit", event(3)));
+    EXPECT_EQ(spool.getStats().pending, 3u);
+
+    EXPECT_EQ(spool.replay(), 3);
+    EXPECT_EQ(client_->endpoints("POST"), (std::vector<std::string>{"/LoginAudit", "/ActivityLog", "/LoginAudit"}));
+    EXPECT_EQ(postedEvents(*client_), (std::vector<int>{1, 2, 3}));
+
+    auto stats = spool.getStats();
+    EXPECT_EQ(stats.appended, 3u);
+    EXPECT_EQ(stats.delivered, 3u);
+    EXPECT_EQ(stats.pending, 0u);
+    EXPECT_EQ(spool.replay(), 0);
+}
+
+TEST_F(EventSpoolTest, BackendDown_KeepsRecordsForTheNextReplay) {
+    auto& spool = EventSpool::getInstance();
+    spool.append("/LoginAudit", event(1));
+    spool.append("/LoginAudit", event(2));
+
+    client_->respond("POST", "", 0);
+    EXPECT_EQ(spool.replay(), 0);
+    EXPECT_EQ(spool.getStats().failedReplays, 1u);
+    EXPECT_EQ(spool.getStats().pending, 2u);
+
+    client_->respond("POST", "", 201);
+    EXPECT_EQ(spool.replay(), 2);
+    auto posted = postedEvents(*client_);
+    EXPECT_EQ(std::vector<int>(posted.end() - 2, posted.end()), (std::vector<int>{1, 2}));
+}
+
+TEST_F(EventSpoolTest, DuplicateAndRefusedRecords_AreNotRetried) {
+    auto& spool = EventSpool::getInstance();
+    spool.append("/LoginAudit", event(1));
+    store(*client_, 1);
+    client_->respond("POST", "", 409);
+    EXPECT_EQ(spool.replay(), 1);
+    EXPECT_EQ(spool.getStats().duplicates, 1u);
+
+    spool.append("/LoginAudit", event(2));
+    client_->respond("POST", "", 422);
+    EXPECT_EQ(spool.replay(), 0);
+    EXPECT_EQ(spool.getStats().rejected, 1u);
+    EXPECT_EQ(spool.getStats().pending, 0u);
+}
+
+TEST_F(EventSpoolTest, StoredRecord_IsADuplicateWhateverStatusTheBackendGives) {
+    // ApiLogicServer may answer a unique violation with 500 or 400 instead of 409
+    auto& spool = EventSpool::getInstance();
+    spool.append("/LoginAudit", event(1));
+    spool.append("/LoginAudit", event(2));
+    store(*client_, 1);
+    store(*client_, 2);
+
+    client_->respond("POST", "", 500);
+    EXPECT_EQ(spool.replay(1), 1);
+    client_->respond("POST", "", 400);
+    EXPECT_EQ(spool.replay(), 1);
+
+    auto stats = spool.getStats();
+    EXPECT_EQ(stats.duplicates, 2u);
+    EXPECT_EQ(stats.rejected, 0u);
+    EXPECT_EQ(stats.failedReplays, 0u);
+    EXPECT_EQ(stats.pending, 0u);
+    ASSERT_FALSE(client_->endpoints("GET").empty());
+    EXPECT_EQ(client_->endpoints("GET").front(),
+              "/LoginAudit?filter[client_event_id]=event-1&page[limit]=1&fields[LoginAudit]=client_event_id");
+}
+
+TEST_F(EventSpoolTest, UnstoredRecord_StaysSpooledOnServerErrorAndIsRejectedOn409) {
+    auto& spool = EventSpool::getInstance();
+    spool.append("/LoginAudit", event(1));
+
+    client_->respond("POST", "", 500);
+    EXPECT_EQ(spool.replay(), 0);
+    EXPECT_EQ(spool.getStats().pending, 1u);
+    EXPECT_EQ(spool.getStats().failedReplays, 1u);
+
+    // A conflict on something other than client_event_id is not a duplicate
+    client_->respond("POST", "", 409);
+    EXPECT_EQ(spool.replay(), 0);
+    EXPECT_EQ(spool.getStats().duplicates, 0u);
+    EXPECT_EQ(spool.getStats().rejected, 1u);
+}
+
+TEST_F(EventSpoolTest, FailedLookup_KeepsRecordSpooledOnServerError) {
+    auto& spool = EventSpool::getInstance();
+    spool.append("/LoginAudit", event(1));
+    store(*client_, 1);
+    client_->respond("POST", "", 500);
+    client_->respond("GET", "/LoginAudit", 503);
+
+    EXPECT_EQ(spool.replay(), 0);
+    EXPECT_EQ(spool.getStats().pending, 1u);
+
+    client_->removeRoute("GET", "/LoginAudit");
+    EXPECT_EQ(spool.replay(), 1);
+    EXPECT_EQ(spool.getStats().duplicates, 1u);
+}
+
+// =============================================================================
+// Durability Tests
+// =============================================================================
+
+TEST_F(EventSpoolTest, Reopen_ResumesAfterTheLastReplayedRecord) {
+    auto& spool = EventSpool::getInstance();
+    for (int i = 1; i <= 5; ++i) {
+        spool.append("/LoginAudit", event(i));
+    }
+    EXPECT_EQ(spool.replay(2), 2);
+    spool.close();
+    EXPECT_FALSE(spool.append("/LoginAudit", event(6)));
+
+    ASSERT_TRUE(spool.open(directory_));
+    EXPECT_EQ(spool.getStats().pending, 3u);
+    EXPECT_EQ(spool.replay(), 3);
+    EXPECT_EQ(postedEvents(*client_), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST_F(EventSpoolTest, TornRecord_IsDiscardedOnRecovery) {
+    auto& spool = EventSpool::getInstance();
+    spool.append("/LoginAudit", event(1));
+    spool.append("/LoginAudit", event(2));
+    spool.close();
+
+    // Damage the body of the second record, as a crash mid-write would
+    std::string path = directory_ + "/000000000001.seg";
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    uint32_t length = 0;
+    file.seekg(16 + 4);
+    file.read(reinterpret_cast<char*>(&length), sizeof(length));
+    std::streamoff second = 16 + ((16 + length + 7) & ~7u);
+    file.seekp(second + 16 + 3);
+    file.put('#');
+    file.close();
+
+    ASSERT_TRUE(spool.open(directory_));
+    EXPECT_EQ(spool.getStats().pending, 1u);
+    EXPECT_EQ(spool.getStats().corrupt, 1u);
+
+    // New records are written over the torn one
+    spool.append("/LoginAudit", event(3));
+    EXPECT_EQ(spool.replay(), 2);
+    EXPECT_EQ(postedEvents(*client_), (std::vector<int>{1, 3}));
+}
+
+// =============================================================================
+// Segment and Size Limit Tests
+// =============================================================================
+
+TEST_F(EventSpoolTest, Segments_RotateAndAreDeletedOnceReplayed) {
+    reopenWithSegments(4096, 1024 * 1024);
+    auto& spool = EventSpool::getInstance();
+    for (int i = 1; i <= 40; ++i) {
+        ASSERT_TRUE(spool.append("/LoginAudit", event(i, 200)));
+    }
+    EXPECT_GT(spool.getStats().segments, 2u);
+    EXPECT_EQ(segmentFiles(directory_), spool.getStats().segments);
+
+    EXPECT_EQ(spool.replay(), 40);
+    EXPECT_EQ(spool.getStats().segments, 1u);
+    EXPECT_EQ(segmentFiles(directory_), 1u);
+    EXPECT_EQ(postedEvents(*client_).back(), 40);
+}
+
+TEST_F(EventSpoolTest, MaxBytes_RefusesEventsUntilReplayMakesRoom) {
+    reopenWithSegments(4096, 3 * 4096);
+    auto& spool = EventSpool::getInstance();
+
+    int appended = 0;
+    while (spool.append("/LoginAudit", event(appended, 200))) {
+        ASSERT_LT(++appended, 1000);
+    }
+    EXPECT_EQ(spool.getStats().full, 1u);
+    EXPECT_LE(spool.getStats().diskBytes, 3u * 4096);
+
+    EXPECT_EQ(spool.replay(), appended);
+    EXPECT_TRUE(spool.append("/LoginAudit", event(0, 200)));
+}
+
+// =============================================================================
+// Replayer Tests
+// =============================================================================
+
+TEST_F(EventSpoolTest, Replayer_DrainsAtTheConfiguredRate) {
+    auto& spool = EventSpool::getInstance();
+    spool.setReplayRate(4);
+    spool.setReplayInterval(10);
+    for (int i = 1; i <= 6; ++i) {
+        spool.append("/LoginAudit", event(i));
+    }
+    spool.start();
+
+    ASSERT_TRUE(waitFor([&]() { return postedEvents(*client_).size() >= 4; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(postedEvents(*client_).size(), 4u);
+
+    EXPECT_TRUE(waitFor([&]() { return spool.getStats().pending == 0; }));
+    EXPECT_EQ(postedEvents(*client_), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+}
+
+// =============================================================================
+// Integration Tests
+// =============================================================================
+
+TEST_F(EventSpoolTest, LogActivity_SpoolsWhenBackendIsUnreachable) {
+    client_->respond("POST", "", 503);
+    ActivityLogService service(client_);
+    auto activity = StudentIntake::Models::ActivityLog::createLogoutActivity(
+        StudentIntake::Models::ActorType::Student, 7, "Ada Lovelace", "ada@example.com");
+
+    auto result = service.logActivity(activity);
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(result.activityId, 0);
+    EXPECT_EQ(EventSpool::getInstance().getStats().pending, 1u);
+
+    client_->respond("POST", "", 201);
+    EXPECT_EQ(EventSpool::getInstance().replay(), 1);
+
+    // The replay carries the same client_event_id as the failed post
+    auto posts = client_->requests("POST");
+    ASSERT_EQ(posts.size(), 2u);
+    std::string eventId = posts[0].payload["data"]["attributes"].value("client_event_id", "");
+    EXPECT_EQ(eventId.size(), 36u);
+    EXPECT_EQ(posts[1].payload["data"]["attributes"].value("client_event_id", ""), eventId);
+}
+
+TEST_F(EventSpoolTest, NewEventId_IsAUniqueVersion4Uuid) {
+    std::set<std::string> ids;
+    for (int i = 0; i < 1000; ++i) {
+        std::string id = EventSpool::newEventId();
+        ASSERT_EQ(id.size(), 36u);
+        EXPECT_EQ(id[14], '4');
+        EXPECT_NE(std::string("89ab").find(id[19]), std::string::npos);
+        ids.insert(id);
+    }
+    EXPECT_EQ(ids.size(), 1000u);
+}
@@ -0,0 +1,273 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "api/PdfCache.h"
+#include "api/SubmissionIndex.h"
+
+using namespace StudentIntake::Api;
+
+namespace {
+
+bool fileExists(const std::string& path) {
+    return std::ifstream(path).good();
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class PdfCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/pdf_cache_test_XXXXXX";
+        spillDir_ = mkdtemp(pattern);
+        PdfCache::getInstance().reset();
+    }
+
+    void TearDown() override {
+        PdfCache::getInstance().reset();
+        SubmissionIndex::getInstance().reset();
+        rmdir(spillDir_.c_str());
+    }
+
+    static PdfFormData form(const std::string& title, const std::string& value) {
+        PdfFormData data;
+        data.formTitle = title;
+        data.studentName = "Ada Lovelace";
+        data.institutionName = "Analytical College";
+        data.fields.emplace_back("First Name", value);
+        return data;
+    }
+
+    static std::string key(const std::string& value) {
+        return PdfCache::makeKey({form("Personal Information Form", value)}, false, "", "v1");
+    }
+
+    // Spill files are named after the key plus a per-spill ticket
+    bool isSpilled(const std::string& cacheKey) const {
+        bool found = false;
+        if (DIR* dir = opendir(spillDir_.c_str())) {
+            while (dirent* item = readdir(dir)) {
+                found = found || std::string(item->d_name).compare(0, cacheKey.size(), cacheKey) == 0;
+            }
+            closedir(dir);
+        }
+        return found;
+    }
+
+    std::string spillDir_;
+};
+
+// =============================================================================
+// Key Tests
+// =============================================================================
+
+TEST_F(PdfCacheTest, MakeKey_ChangesWithEveryInput) {
+    std::vector<PdfFormData> forms = {form("Consent Form", "Ada")};
+    std::string base = PdfCache::makeKey(forms, false, "", "v1");
+
+    EXPECT_EQ(base, PdfCache::makeKey(forms, false, "", "v1"));
+    EXPECT_EQ(base.size(), 32u);
+    EXPECT_NE(base, PdfCache::makeKey(forms, false, "", "v2"));
+    EXPECT_NE(base, PdfCache::makeKey(forms, true, "Ada Lovelace", "v1"));
+    EXPECT_NE(base, PdfCache::makeKey({form("Consent Form", "Ada ")}, false, "", "v1"));
+
+    // Field boundaries are part of the key
+    PdfFormData shifted = forms[0];
+    shifted.fields[0] = PdfFormField("First Nam", "eAda");
+    EXPECT_NE(base, PdfCache::makeKey({shifted}, false, "", "v1"));
+}
+
+TEST_F(PdfCacheTest, SettingsVersion_ChangesWithAnySetting) {
+    std::map<std::string, std::string> settings = {{"institution_name", "Analytical College"}};
+    std::string version = PdfCache::settingsVersion(settings);
+
+    settings["contact_phone"] = "5551234567";
+    EXPECT_NE(version, PdfCache::settingsVersion(settings));
+}
+
+// =============================================================================
+// Memory and Spill Tests
+// =============================================================================
+
+TEST_F(PdfCacheTest, Get_ReturnsStoredDocument) {
+    auto& cache = PdfCache::getInstance();
+    std::string pdf;
+    EXPECT_FALSE(cache.get(key("Ada"), pdf));
+
+    cache.put(key("Ada"), "%PDF-ada", 42, 7);
+    ASSERT_TRUE(cache.get(key("Ada"), pdf));
+    EXPECT_EQ(pdf, "%PDF-ada");
+
+    auto stats = cache.getStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.memoryEntries, 1u);
+    EXPECT_EQ(stats.memoryBytes, 8u);
+}
+
+TEST_F(PdfCacheTest, Put_EvictsLeastRecentlyUsedWithoutSpillDirectory) {
+    auto& cache = PdfCache::getInstance();
+    cache.setMemoryLimit(20);
+
+    cache.put(key("a"), std::string(8, 'a'));
+    cache.put(key("b"), std::string(8, 'b'));
+    std::string pdf;
+    ASSERT_TRUE(cache.get(key("a"), pdf));      // b is now least recently used
+    cache.put(key("c"), std::string(8, 'c'));
+
+    EXPECT_TRUE(cache.get(key("a"), pdf));
+    EXPECT_FALSE(cache.get(key("b"), pdf));
+    EXPECT_TRUE(cache.get(key("c"), pdf));
+    EXPECT_LE(cache.getStats().memoryBytes, 20u);
+}
+
+TEST_F(PdfCacheTest, Evicted_DocumentsSpillToDiskAndPromoteBack) {
+    auto& cache = PdfCache::getInstance();
+    cache.setSpillDirectory(spillDir_);
+    cache.setMemoryLimit(20);
+
+    cache.put(key("a"), std::string(8, 'a'), 1);
+    cache.put(key("b"), std::string(8, 'b'), 2);
+    cache.put(key("c"), std::string(8, 'c'), 3);
+
+    auto stats = cache.getStats();
+    EXPECT_EQ(stats.memoryEntries, 2u);
+    EXPECT_EQ(stats.diskEntries, 1u);
+    EXPECT_TRUE(isSpilled(key("a")));
+
+    std::string pdf;
+    ASSERT_TRUE(cache.get(key("a"), pdf));
+    EXPECT_EQ(pdf, std::string(8, 'a'));
+    EXPECT_EQ(cache.getStats().diskHits, 1u);
+    EXPECT_FALSE(isSpilled(key("a")));
+
+    // Promoting a pushed b out to disk in turn
+    EXPECT_TRUE(isSpilled(key("b")));
+}
+
+TEST_F(PdfCacheTest, DiskLimit_DropsOldestSpilledDocuments) {
+    auto& cache = PdfCache::getInstance();
+    cache.setSpillDirectory(spillDir_);
+    cache.setMemoryLimit(10);
+    cache.setDiskLimit(10);
+
+    cache.put(key("a"), std::string(8, 'a'));
+    cache.put(key("b"), std::string(8, 'b'));   // a spills
+    cache.put(key("c"), std::string(8, 'c'));   // b spills, a is dropped
+
+    std::string pdf;
+    EXPECT_FALSE(cache.get(key("a"), pdf));
+    EXPECT_FALSE(isSpilled(key("a")));
+    EXPECT_LE(cache.getStats().diskBytes, 10u);
+}
+
+TEST_F(PdfCacheTest, SetSpillDirectory_RemovesDocumentsFromPreviousRun) {
+    std::string leftover = spillDir_ + "/" + key("old") + ".pdf";
+    std::string unrelated = spillDir_ + "/notes.txt";
+    std::ofstream(leftover) << "%PDF-old";
+    std::ofstream(unrelated) << "keep";
+
+    PdfCache::getInstance().setSpillDirectory(spillDir_);
+
+    EXPECT_FALSE(fileExists(leftover));
+    EXPECT_TRUE(fileExists(unrelated));
+    std::remove(unrelated.c_str());
+}
+
+TEST_F(PdfCacheTest, SetSpillDirectory_RefusesDirectoryOthersCanRead) {
+    chmod(spillDir_.c_str(), 0755);
+    auto& cache = PdfCache::getInstance();
+    cache.setSpillDirectory(spillDir_);
+    cache.setMemoryLimit(10);
+
+    cache.put(key("a"), std::string(8, 'a'));
+    cache.put(key("b"), std::string(8, 'b'));   // a is dropped, not spilled
+
+    EXPECT_FALSE(isSpilled(key("a")));
+    EXPECT_EQ(cache.getStats().diskEntries, 0u);
+    std::string pdf;
+    EXPECT_FALSE(cache.get(key("a"), pdf));
+}
+
+TEST_F(PdfCacheTest, SetSpillDirectory_RefusesSymlink) {
+    std::string link = spillDir_ + "_link";
+    ASSERT_EQ(symlink(spillDir_.c_str(), link.c_str()), 0);
+    auto& cache = PdfCache::getInstance();
+    cache.setSpillDirectory(link);
+    cache.setMemoryLimit(10);
+
+    cache.put(key("a"), std::string(8, 'a'));
+    cache.put(key("b"), std::string(8, 'b'));
+
+    EXPECT_FALSE(isSpilled(key("a")));
+    EXPECT_EQ(cache.getStats().diskEntries, 0u);
+    unlink(link.c_str());
+}
+
+TEST_F(PdfCacheTest, SetSpillDirectory_CreatesPrivateDirectory) {
+    std::string created = spillDir_ + "/spill";
+    PdfCache::getInstance().setSpillDirectory(created);
+
+    struct stat info;
+    ASSERT_EQ(lstat(created.c_str(), &info), 0);
+    EXPECT_TRUE(S_ISDIR(info.st_mode));
+    EXPECT_EQ(info.st_mode & 0777, 0700u);
+    PdfCache::getInstance().reset();
+    rmdir(created.c_str());
+}
+
+// =============================================================================
+// Invalidation Tests
+// =============================================================================
+
+TEST_F(PdfCacheTest, InvalidateStudent_DropsMemoryAndSpilledDocuments) {
+    auto& cache = PdfCache::getInstance();
+    cache.setSpillDirectory(spillDir_);
+    cache.setMemoryLimit(20);
+
+    cache.put(key("a"), std::string(8, 'a'), 42, 7);
+    cache.put(key("b"), std::string(8, 'b'), 42);
+    cache.put(key("c"), std::string(8, 'c'), 43);   // a spills
+
+    cache.invalidateStudent(42);
+
+    std::string pdf;
+    EXPECT_FALSE(cache.get(key("a"), pdf));
+    EXPECT_FALSE(cache.get(key("b"), pdf));
+    EXPECT_TRUE(cache.get(key("c"), pdf));
+    EXPECT_FALSE(isSpilled(key("a")));
+    EXPECT_EQ(cache.getStats().invalidations, 2u);
+}
+
+TEST_F(PdfCacheTest, InvalidateSubmission_DropsOnlyThatSubmission) {
+    auto& cache = PdfCache::getInstance();
+    cache.put(key("a"), "%PDF-a", 42, 7);
+    cache.put(key("b"), "%PDF-b", 42, 8);
+
+    cache.invalidateSubmission(7);
+
+    std::string pdf;
+    EXPECT_FALSE(cache.get(key("a"), pdf));
+    EXPECT_TRUE(cache.get(key("b"), pdf));
+}
+
+TEST_F(PdfCacheTest, ReviewDecision_InvalidatesStudentDocuments) {
+    auto& index = SubmissionIndex::getInstance();
+    index.reset();
+    index.applySubmission({{"type", "FormSubmission"}, {"id", "7"},
+                           {"attributes", {{"student_id", 42}, {"form_type_id", 1}, {"status", "pending"}}}});
+
+    auto& cache = PdfCache::getInstance();
+    cache.put(key("packet"), "%PDF-packet", 42);
+    ASSERT_TRUE(index.updateStatus(7, "approved", "2024-03-02T10:00:00", "Admin"));
+
+    std::string pdf;
+    EXPECT_FALSE(cache.get(key("packet"), pdf));
+}
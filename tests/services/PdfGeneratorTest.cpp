@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include "api/PdfGenerator.h"
+
+using namespace StudentIntake::Api;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class PdfGeneratorTest : public ::testing::Test {
+protected:
+    static PdfFormData sampleForm(const std::string& title) {
+        PdfFormData form;
+        form.formTitle = title;
+        form.studentName = "Ada Lovelace";
+        form.studentEmail = "ada@example.com";
+        form.submissionDate = "2024-03-01T09:00:00";
+        form.fields.emplace_back("Personal Information", "", "header");
+        form.fields.emplace_back("First Name", "Ada");
+        form.fields.emplace_back("Phone", "5551234567", "phone");
+        form.fields.emplace_back("Date of Birth", "1815-12-10", "date");
+        return form;
+    }
+
+    static bool isPdf(const std::string& bytes) {
+        return bytes.compare(0, 5, "%PDF-") == 0 && bytes.find("%%EOF") != std::string::npos;
+    }
+
+    PdfGenerator generator_;
+};
+
+// =============================================================================
+// Rendering Tests
+// =============================================================================
+
+TEST_F(PdfGeneratorTest, RenderFormPdf_ReturnsDocumentBytes) {
+    std::string bytes = generator_.renderFormPdf(sampleForm("Personal Information Form"));
+
+    if (!PdfGenerator::isAvailable()) {
+        EXPECT_TRUE(bytes.empty());
+        EXPECT_FALSE(generator_.getLastError().empty());
+        return;
+    }
+    EXPECT_TRUE(isPdf(bytes));
+    EXPECT_TRUE(generator_.getLastError().empty());
+}
+
+TEST_F(PdfGeneratorTest, RenderMultiFormPdf_ReturnsDocumentBytes) {
+    std::vector<PdfFormData> forms = {sampleForm("Personal Information Form"), sampleForm("Consent Form")};
+    std::string bytes = generator_.renderMultiFormPdf(forms, "Ada Lovelace");
+
+    if (!PdfGenerator::isAvailable()) {
+        EXPECT_TRUE(bytes.empty());
+        return;
+    }
+    EXPECT_TRUE(isPdf(bytes));
+    EXPECT_TRUE(generator_.renderMultiFormPdf({}, "Ada Lovelace").empty());
+}
+
+TEST_F(PdfGeneratorTest, GenerateFormPdf_WritesRenderedBytesToUniqueFiles) {
+    if (!PdfGenerator::isAvailable()) {
+        EXPECT_EQ(generator_.generateFormPdf(sampleForm("Form")), "");
+        return;
+    }
+
+    std::string first = generator_.generateFormPdf(sampleForm("Form"));
+    std::string second = generator_.generateFormPdf(sampleForm("Form"));
+    ASSERT_FALSE(first.empty());
+    EXPECT_NE(first, second);
+
+    std::ifstream file(first, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_TRUE(isPdf(contents));
+
+    std::remove(first.c_str());
+    std::remove(second.c_str());
+}
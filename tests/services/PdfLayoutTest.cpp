@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "api/PdfLayout.h"
+
+using namespace StudentIntake::Api;
+
+namespace {
+
+std::vector<const PdfDrawCommand*> textCommands(const PdfLayoutPage& page) {
+    std::vector<const PdfDrawCommand*> texts;
+    for (const auto& command : page.commands) {
+        if (command.type == PdfDrawCommand::Type::Text) {
+            texts.push_back(&command);
+        }
+    }
+    return texts;
+}
+
+const PdfDrawCommand* findText(const std::vector<PdfLayoutPage>& pages, const std::string& text,
+                               size_t* pageIndex = nullptr) {
+    for (size_t i = 0; i < pages.size(); ++i) {
+        for (const auto& command : pages[i].commands) {
+            if (command.type == PdfDrawCommand::Type::Text && command.text == text) {
+                if (pageIndex) {
+                    *pageIndex = i;
+                }
+                return &command;
+            }
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class PdfLayoutTest : public ::testing::Test {
+protected:
+    static PdfFormData sampleForm(size_t rows, const std::string& value = "Value") {
+        PdfFormData form;
+        form.formTitle = "Medical Information Form";
+        form.institutionName = "Analytical College";
+        form.submissionDate = "2024-03-01T09:00:00";
+        form.fields.emplace_back("Medical History", "", "header");
+        for (size_t i = 0; i < rows; ++i) {
+            form.fields.emplace_back("Field " + std::to_string(i), value);
+        }
+        return form;
+    }
+
+    static std::string longText(size_t words) {
+        std::string text;
+        for (size_t i = 0; i < words; ++i) {
+            text += (i ? " " : "") + std::string(i % 3 ? "history" : "allergies");
+        }
+        return text;
+    }
+};
+
+// =============================================================================
+// Font Metrics Tests
+// =============================================================================
+
+TEST_F(PdfLayoutTest, TextWidth_MatchesHelveticaMetrics) {
+    // Helvetica: H 722, e 556, l 222, o 556
+    EXPECT_FLOAT_EQ(PdfFontMetrics::textWidth("Hello", PdfFont::Regular, 10), 22.78f);
+    // Helvetica-Bold: H 722, e 556, l 278, o 611
+    EXPECT_FLOAT_EQ(PdfFontMetrics::textWidth("Hello", PdfFont::Bold, 10), 24.45f);
+    EXPECT_FLOAT_EQ(PdfFontMetrics::textWidth("", PdfFont::Regular, 10), 0.0f);
+    EXPECT_EQ(PdfFontMetrics::glyphWidth(PdfFont::Regular, ' '), 278);
+    EXPECT_EQ(PdfFontMetrics::glyphWidth(PdfFont::Bold, 'W'), 944);
+}
+
+TEST_F(PdfLayoutTest, WrapText_BreaksAtSpacesWithinWidth) {
+    std::string text = longText(40);
+    auto lines = PdfFontMetrics::wrapText(text, PdfFont::Regular, 10, 150);
+
+    ASSERT_GT(lines.size(), 1u);
+    std::string joined;
+    for (const auto& line : lines) {
+        EXPECT_LE(PdfFontMetrics::textWidth(line, PdfFont::Regular, 10), 150.0f);
+        EXPECT_NE(line.front(), ' ');
+        joined += (joined.empty() ? "" : " ") + line;
+    }
+    EXPECT_EQ(joined, text);
+}
+
+TEST_F(PdfLayoutTest, WrapText_KeepsNewlinesAndSplitsLongWords) {
+    auto lines = PdfFontMetrics::wrapText("Asthma\n\nPenicillin allergy\n", PdfFont::Regular, 10, 300);
+    EXPECT_EQ(lines, (std::vector<std::string>{"Asthma", "", "Penicillin allergy"}));
+
+    std::string word(200, 'm');
+    lines = PdfFontMetrics::wrapText(word, PdfFont::Regular, 10, 100);
+    ASSERT_GT(lines.size(), 1u);
+    size_t total = 0;
+    for (const auto& line : lines) {
+        EXPECT_LE(PdfFontMetrics::textWidth(line, PdfFont::Regular, 10), 100.0f);
+        total += line.size();
+    }
+    EXPECT_EQ(total, word.size());
+
+    // Multi-byte characters are never cut in half
+    lines = PdfFontMetrics::wrapText("\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9", PdfFont::Regular, 10, 12);
+    for (const auto& line : lines) {
+        EXPECT_EQ(line.size() % 2, 0u);
+    }
+
+    EXPECT_EQ(PdfFontMetrics::wrapText("", PdfFont::Regular, 10, 100), std::vector<std::string>{""});
+}
+
+// =============================================================================
+// Layout Tests
+// =============================================================================
+
+TEST_F(PdfLayoutTest, LayoutForm_FormatsValuesAndCentersHeader) {
+    PdfFormData form = sampleForm(0);
+    form.fields.emplace_back("Phone", "5551234567", "phone");
+    form.fields.emplace_back("Date of Birth", "1815-12-10", "date");
+
+    auto pages = PdfLayout::layoutForm(form, "Generated: today");
+    ASSERT_EQ(pages.size(), 1u);
+
+    EXPECT_NE(findText(pages, "(555) 123-4567"), nullptr);
+    EXPECT_NE(findText(pages, "December 10, 1815"), nullptr);
+    EXPECT_NE(findText(pages, "March 1, 2024"), nullptr);
+    EXPECT_NE(findText(pages, "Generated: today"), nullptr);
+
+    const PdfDrawCommand* title = findText(pages, "Analytical College");
+    ASSERT_NE(title, nullptr);
+    float width = PdfFontMetrics::textWidth("Analytical College", PdfFont::Bold, 18);
+    EXPECT_FLOAT_EQ(title->x + width / 2, PdfLayout::kPageWidth / 2);
+    EXPECT_EQ(title->font, PdfFont::Bold);
+}
+
+TEST_F(PdfLayoutTest, LayoutForm_WrapsLongValuesOnSeparateLines) {
+    PdfFormData form = sampleForm(0);
+    form.fields.emplace_back("Notes", longText(60));
+    form.fields.emplace_back("After", "x");
+
+    auto pages = PdfLayout::layoutForm(form, "");
+    ASSERT_EQ(pages.size(), 1u);
+
+    const PdfDrawCommand* label = findText(pages, "Notes");
+    const PdfDrawCommand* after = findText(pages, "After");
+    ASSERT_NE(label, nullptr);
+    ASSERT_NE(after, nullptr);
+
+    size_t valueLines = 0;
+    for (const auto* text : textCommands(pages[0])) {
+        if (text->text.find("history") != std::string::npos) {
+            valueLines++;
+            EXPECT_LE(text->x + PdfFontMetrics::textWidth(text->text, text->font, text->fontSize),
+                      PdfLayout::kPageWidth - PdfLayout::kMargin);
+            EXPECT_GT(text->y, after->y);
+        }
+    }
+    EXPECT_GT(valueLines, 1u);
+}
+
+TEST_F(PdfLayoutTest, LayoutForm_PaginatesAndKeepsContentAboveFooter) {
+    auto pages = PdfLayout::layoutForm(sampleForm(120), "Generated: today");
+    ASSERT_GT(pages.size(), 2u);
+
+    for (size_t i = 0; i < 120; ++i) {
+        EXPECT_NE(findText(pages, "Field " + std::to_string(i)), nullptr);
+    }
+    for (const auto& page : pages) {
+        for (const auto* text : textCommands(page)) {
+            EXPECT_LE(text->y, PdfLayout::kPageHeight - PdfLayout::kMargin);
+            if (text->text.compare(0, 6, "Field ") == 0) {
+                EXPECT_GE(text->y, PdfLayout::kMargin + 60);
+            }
+        }
+    }
+
+    // The footer is drawn once, on the last page
+    size_t footerPage = 0;
+    ASSERT_NE(findText(pages, "Generated: today", &footerPage), nullptr);
+    EXPECT_EQ(footerPage, pages.size() - 1);
+}
+
+TEST_F(PdfLayoutTest, LayoutForm_SplitsValueLongerThanAPage) {
+    PdfFormData form = sampleForm(0);
+    form.fields.emplace_back("Academic History", longText(2000));
+
+    auto pages = PdfLayout::layoutForm(form, "");
+    ASSERT_GT(pages.size(), 2u);
+
+    // The label is printed once; continuation lines fill the following pages
+    size_t labelPage = 99;
+    ASSERT_NE(findText(pages, "Academic History", &labelPage), nullptr);
+    EXPECT_EQ(labelPage, 0u);
+    for (const auto& page : pages) {
+        EXPECT_FALSE(textCommands(page).empty());
+    }
+}
+
+TEST_F(PdfLayoutTest, LayoutForm_KeepsSectionHeaderWithNextRow) {
+    PdfFormData form = sampleForm(0);
+    // Fill the first page up to just above the bottom
+    for (size_t i = 0; i < 200; ++i) {
+        form.fields.emplace_back("Row " + std::to_string(i), "v");
+        auto pages = PdfLayout::layoutForm(form, "");
+        if (pages.size() > 1) {
+            form.fields.pop_back();
+            break;
+        }
+    }
+    form.fields.emplace_back("Emergency Contact", "", "header");
+    form.fields.emplace_back("Contact Name", "Charles Babbage");
+
+    auto pages = PdfLayout::layoutForm(form, "");
+    size_t headerPage = 0;
+    size_t rowPage = 0;
+    ASSERT_NE(findText(pages, "Emergency Contact", &headerPage), nullptr);
+    ASSERT_NE(findText(pages, "Contact Name", &rowPage), nullptr);
+    EXPECT_EQ(headerPage, rowPage);
+}
+
+TEST_F(PdfLayoutTest, LayoutPacket_StartsEachFormOnANewPageAndNumbersPages) {
+    std::vector<PdfFormData> forms = {sampleForm(60), sampleForm(3), sampleForm(3)};
+    auto pages = PdfLayout::layoutPacket(forms);
+    ASSERT_EQ(pages.size(), 4u);
+
+    for (size_t i = 0; i < pages.size(); ++i) {
+        std::string number = "Page " + std::to_string(i + 1) + " of 4";
+        size_t page = 99;
+        ASSERT_NE(findText(pages, number, &page), nullptr) << number;
+        EXPECT_EQ(page, i);
+    }
+
+    size_t titles = 0;
+    for (const auto& page : pages) {
+        for (const auto* text : textCommands(page)) {
+            titles += text->text == "Medical Information Form";
+        }
+    }
+    EXPECT_EQ(titles, 3u);
+    EXPECT_TRUE(PdfLayout::layoutPacket({}).empty());
+}
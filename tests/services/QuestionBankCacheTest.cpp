@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "api/QuestionBankCache.h"
+#include "models/Assessment.h"
+
+using namespace StudentIntake::Api;
+using namespace StudentIntake::Models;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class QuestionBankCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cache().clear();
+        assessment_ = Assessment("42", "Final Exam");
+        assessment_.setUpdatedAt("2024-03-01T09:00:00Z");
+    }
+
+    void TearDown() override {
+        cache().clear();
+    }
+
+    static QuestionBankCache& cache() {
+        return QuestionBankCache::getInstance();
+    }
+
+    static std::vector<AssessmentQuestion> makeQuestions(int count) {
+        std::vector<AssessmentQuestion> questions;
+        for (int id = 1; id <= count; ++id) {
+            AssessmentQuestion question(std::to_string(id), "Question " + std::to_string(id));
+            for (const char* option : {"a", "b", "c", "d"}) {
+                question.addAnswerOption({option, option, 0});
+            }
+            question.setCorrectAnswer("a");
+            questions.push_back(question);
+        }
+        return questions;
+    }
+
+    Assessment assessment_;
+};
+
+// =============================================================================
+// Cache Tests
+// =============================================================================
+
+TEST_F(QuestionBankCacheTest, Store_SharesOneCopyAcrossLookups) {
+    auto questions = makeQuestions(25);
+    std::string version = QuestionBankCache::versionOf(assessment_, questions);
+    auto stored = cache().store(assessment_, questions);
+
+    auto first = cache().findQuestions("42", version);
+    auto second = cache().findQuestions("42", version);
+
+    EXPECT_EQ(first.get(), stored.get());
+    EXPECT_EQ(second.get(), stored.get());
+    EXPECT_EQ(cache().getHitCount(), 2u);
+    EXPECT_EQ(cache().findAnswerKey(42, version)->getQuestionCount(), 25u);
+}
+
+TEST_F(QuestionBankCacheTest, FindQuestions_MissesOnVersionChange) {
+    auto questions = makeQuestions(5);
+    cache().store(assessment_, questions);
+
+    EXPECT_EQ(cache().findQuestions("42", QuestionBankCache::versionOf("2024-03-02T09:00:00Z", "", 5)), nullptr);
+    EXPECT_EQ(cache().findQuestions("7", QuestionBankCache::versionOf(assessment_, questions)), nullptr);
+    EXPECT_EQ(cache().getMissCount(), 2u);
+}
+
+TEST_F(QuestionBankCacheTest, Version_ChangesWhenAQuestionChanges) {
+    auto questions = makeQuestions(5);
+    questions[2].setUpdatedAt("2024-03-01T10:00:00Z");
+    std::string stored = QuestionBankCache::versionOf(assessment_, questions);
+    cache().store(assessment_, questions);
+
+    // A key correction touches only the question row
+    auto edited = questions;
+    edited[4].setUpdatedAt("2024-03-05T08:00:00Z");
+    // A removed question leaves the newest timestamp as it was
+    auto removed = questions;
+    removed.pop_back();
+
+    EXPECT_EQ(stored, QuestionBankCache::versionOf(assessment_.getUpdatedAt(), "2024-03-01T10:00:00Z", 5));
+    EXPECT_EQ(cache().findAnswerKey(42, QuestionBankCache::versionOf(assessment_, edited)), nullptr);
+    EXPECT_EQ(cache().findAnswerKey(42, QuestionBankCache::versionOf(assessment_, removed)), nullptr);
+    EXPECT_NE(cache().findAnswerKey(42, stored), nullptr);
+}
+
+TEST_F(QuestionBankCacheTest, Store_NewVersionReplacesOldButKeepsReadersValid) {
+    auto oldSet = cache().store(assessment_, makeQuestions(5));
+
+    assessment_.setUpdatedAt("2024-03-02T09:00:00Z");
+    auto questions = makeQuestions(6);
+    std::string version = QuestionBankCache::versionOf(assessment_, questions);
+    cache().store(assessment_, questions);
+
+    EXPECT_EQ(cache().size(), 1u);
+    EXPECT_EQ(oldSet->size(), 5u);
+    EXPECT_EQ(cache().findQuestions("42", version)->size(), 6u);
+}
+
+// =============================================================================
+// Permutation Tests
+// =============================================================================
+
+TEST_F(QuestionBankCacheTest, Permutation_IsDeterministicPerAttempt) {
+    auto questions = makeQuestions(30);
+    auto seed = AttemptPermutation::seedFor("1001", "42");
+
+    auto first = AttemptPermutation::create(questions, seed, true, true);
+    auto again = AttemptPermutation::create(questions, seed, true, true);
+    auto other = AttemptPermutation::create(questions, AttemptPermutation::seedFor("1002", "42"), true, true);
+
+    EXPECT_EQ(first.questionOrder, again.questionOrder);
+    EXPECT_EQ(first.optionOrder, again.optionOrder);
+    EXPECT_NE(first.questionOrder, other.questionOrder);
+
+    auto sorted = first.questionOrder;
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        EXPECT_EQ(sorted[i], i);
+    }
+}
+
+TEST_F(QuestionBankCacheTest, Permutation_IdentityWhenShufflingDisabled) {
+    auto questions = makeQuestions(4);
+
+    auto permutation = AttemptPermutation::create(questions, 99, false, false);
+
+    EXPECT_EQ(permutation.questionOrder, (std::vector<uint16_t>{0, 1, 2, 3}));
+    auto options = permutation.orderedOptions(questions[2], 2);
+    ASSERT_EQ(options.size(), 4u);
+    EXPECT_EQ(options[0].id, "a");
+}
+
+TEST_F(QuestionBankCacheTest, Permutation_OrderedOptionsKeepAllOptions) {
+    auto questions = makeQuestions(3);
+
+    auto permutation = AttemptPermutation::create(questions, 7, false, true);
+    auto options = permutation.orderedOptions(questions[0], 0);
+
+    std::vector<std::string> ids;
+    for (const auto& option : options) {
+        ids.push_back(option.id);
+    }
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids, (std::vector<std::string>{"a", "b", "c", "d"}));
+}
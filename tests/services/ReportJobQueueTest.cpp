@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include "api/ReportJobQueue.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using TestUtils::FakeApiClient;
+
+namespace {
+
+nlohmann::json report(const std::string& id, bool issued) {
+    return {{"type", "AssessmentReport"}, {"id", id},
+            {"attributes", {{"certificate_issued", issued}}}};
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class ReportJobQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        journalPath_ = ::testing::TempDir() + "report_jobs_test.journal";
+        std::remove(journalPath_.c_str());
+        queue().reset();
+        // AssessmentReport endpoints; new reports get id 77
+        client_ = std::make_shared<FakeApiClient>();
+        client_->respond("GET", "/Course/", 200,
+                         {{"data", {{"type", "Course"}, {"id", "9"}, {"attributes", {{"name", "CDL"}}}}}});
+        client_->respond("GET", "/AssessmentReport/77", 200, {{"data", report("77", false)}});
+        client_->respond("POST", "/AssessmentReport", 201, {{"data", {{"type", "AssessmentReport"}, {"id", "77"}}}});
+        client_->respond("PATCH", "/AssessmentReport/", 200, {{"data", {{"type", "AssessmentReport"}, {"id", "77"}}}});
+        queue().setApiClient(client_);
+    }
+
+    void TearDown() override {
+        queue().reset();
+        std::remove(journalPath_.c_str());
+    }
+
+    static ReportJobQueue& queue() {
+        return ReportJobQueue::getInstance();
+    }
+
+    std::shared_ptr<FakeApiClient> client_;
+    std::string journalPath_;
+};
+
+// =============================================================================
+// Execution Tests
+// =============================================================================
+
+TEST_F(ReportJobQueueTest, SubmitReport_RunsInBackgroundAndCallsBack) {
+    queue().start();
+
+    std::mutex mutex;
+    ReportJob delivered;
+    auto jobId = queue().submitReport(4, 12, 9, [&](const ReportJob& job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        delivered = job;
+    });
+    queue().waitIdle();
+
+    EXPECT_EQ(jobId, "report-12");
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(delivered.status, ReportJobStatus::Completed);
+    EXPECT_EQ(delivered.reportId, "77");
+    EXPECT_EQ(client_->countRequests("POST", "/AssessmentReport"), 1u);
+}
+
+TEST_F(ReportJobQueueTest, Submit_SameJobTwiceRunsOnce) {
+    auto first = queue().submitReport(4, 12, 9);
+    auto second = queue().submitReport(4, 12, 9);
+    queue().start();
+    queue().waitIdle();
+
+    std::atomic<bool> calledBack{false};
+    auto third = queue().submitReport(4, 12, 9, [&](const ReportJob&) { calledBack = true; });
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first, third);
+    EXPECT_TRUE(calledBack.load());
+    EXPECT_EQ(client_->countRequests("POST", "/AssessmentReport"), 1u);
+}
+
+TEST_F(ReportJobQueueTest, RunJob_ReusesReportAlreadyOnBackend) {
+    client_->respond("GET", "/AssessmentReport?filter[enrollment_id]=", 200, {{"data", {report("55", false)}}});
+    client_->respond("GET", "/AssessmentReport/77", 200, {{"data", report("77", true)}});
+    queue().start();
+
+    auto reportJob = queue().submitReport(4, 12, 9);
+    auto certificateJob = queue().submitCertificate("77");
+    queue().waitIdle();
+
+    ReportJob job;
+    ASSERT_TRUE(queue().getJob(reportJob, job));
+    EXPECT_EQ(job.reportId, "55");
+    EXPECT_EQ(client_->countRequests("POST", "/AssessmentReport"), 0u);
+    EXPECT_EQ(client_->countRequests("PATCH", "/AssessmentReport/"), 0u);
+}
+
+TEST_F(ReportJobQueueTest, FailingJob_StopsAfterMaxAttempts) {
+    client_->respond("POST", "/AssessmentReport", 500);
+    queue().setMaxAttempts(2);
+    queue().setRetryDelay(1);
+    queue().start();
+
+    auto jobId = queue().submitReport(4, 12, 9);
+    queue().waitIdle();
+
+    ReportJob job;
+    ASSERT_TRUE(queue().getJob(jobId, job));
+    EXPECT_EQ(job.status, ReportJobStatus::Failed);
+    EXPECT_EQ(job.attempts, 2);
+    EXPECT_FALSE(job.error.empty());
+}
+
+TEST_F(ReportJobQueueTest, FailingJob_BacksOffBetweenAttempts) {
+    client_->respond("POST", "/AssessmentReport", 500);
+    queue().setMaxAttempts(3);
+    queue().setRetryDelay(40);
+    queue().start();
+
+    auto started = std::chrono::steady_clock::now();
+    queue().submitReport(4, 12, 9);
+    queue().waitIdle();
+    auto elapsed = std::chrono::steady_clock::now() - started;
+
+    // 40 ms before the second attempt, 80 ms before the third
+    EXPECT_GE(elapsed, std::chrono::milliseconds(120));
+    EXPECT_EQ(client_->countRequests("POST", "/AssessmentReport"), 3u);
+}
+
+TEST_F(ReportJobQueueTest, FinishedJobs_OnlyMostRecentAreKept) {
+    queue().setMaxFinishedJobs(2);
+    queue().start();
+
+    for (int enrollmentId = 1; enrollmentId <= 5; ++enrollmentId) {
+        queue().submitReport(4, enrollmentId, 9);
+        queue().waitIdle();
+    }
+
+    ReportJob job;
+    EXPECT_EQ(queue().getJobCount(), 2u);
+    EXPECT_FALSE(queue().getJob("report-1", job));
+    EXPECT_TRUE(queue().getJob("report-5", job));
+}
+
+TEST_F(ReportJobQueueTest, Submit_RejectsWhenQueueFull) {
+    queue().setMaxQueuedJobs(1);
+
+    EXPECT_FALSE(queue().submitReport(4, 12, 9).empty());
+    EXPECT_TRUE(queue().submitReport(5, 13, 9).empty());
+    EXPECT_EQ(queue().getQueuedCount(), 1u);
+}
+
+// =============================================================================
+// Journal Tests
+// =============================================================================
+
+TEST_F(ReportJobQueueTest, Journal_ResumesQueuedJobsAfterRestart) {
+    queue().setJournalPath(journalPath_);
+    auto jobId = queue().submitReport(4, 12, 9);
+
+    // Simulate a restart before any worker ran
+    queue().reset();
+    queue().setApiClient(client_);
+    queue().setJournalPath(journalPath_);
+    queue().start();
+    queue().waitIdle();
+
+    ReportJob job;
+    ASSERT_TRUE(queue().getJob(jobId, job));
+    EXPECT_EQ(job.status, ReportJobStatus::Completed);
+    EXPECT_EQ(client_->countRequests("POST", "/AssessmentReport"), 1u);
+}
+
+TEST_F(ReportJobQueueTest, Journal_IsCompactedWhileRunning) {
+    queue().setJournalPath(journalPath_);
+    queue().setMaxFinishedJobs(2);
+    queue().start();
+
+    // Three journal lines per job: queued, running, completed
+    for (int enrollmentId = 1; enrollmentId <= 100; ++enrollmentId) {
+        queue().submitReport(4, enrollmentId, 9);
+    }
+    queue().waitIdle();
+
+    std::ifstream journal(journalPath_);
+    size_t lines = 0;
+    for (std::string line; std::getline(journal, line);) {
+        lines++;
+    }
+    EXPECT_LT(lines, 100u);
+}
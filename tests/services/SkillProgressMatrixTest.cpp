@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "api/SkillProgressMatrix.h"
+#include "models/TrainingSession.h"
+
+using namespace StudentIntake::Api;
+using namespace StudentIntake::Models;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class SkillProgressMatrixTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        matrix().clear();
+
+        // 70 skills spans two words; every third one is optional
+        std::vector<SkillItem> items;
+        for (int id = 1; id <= 70; ++id) {
+            SkillItem item;
+            item.setId(std::to_string(id));
+            item.setName("Skill " + std::to_string(id));
+            item.setRequiresDemonstration(id % 3 != 0);
+            items.push_back(item);
+        }
+        matrix().setSkillItems(items);
+    }
+
+    void TearDown() override {
+        matrix().clear();
+    }
+
+    static SkillProgressMatrix& matrix() {
+        return SkillProgressMatrix::getInstance();
+    }
+
+    static StudentSkillProgress makeProgress(int skillId, bool validated, double hours = 0.0) {
+        StudentSkillProgress progress;
+        progress.setSkillItemId(skillId);
+        progress.setValidated(validated);
+        progress.setPracticeCount(1);
+        progress.setPracticeHours(hours);
+        return progress;
+    }
+
+    static SkillValidation makeValidation(int enrollmentId, int skillId,
+                                          ValidationResult result, bool critical = false) {
+        SkillValidation validation;
+        validation.setStudentId(100);
+        validation.setEnrollmentId(enrollmentId);
+        validation.setSkillItemId(skillId);
+        validation.setResult(result);
+        validation.setCriticalError(critical);
+        return validation;
+    }
+
+    static std::vector<StudentSkillProgress> allRequiredPassed() {
+        std::vector<StudentSkillProgress> progress;
+        for (int id = 1; id <= 70; ++id) {
+            if (id % 3 != 0) {
+                progress.push_back(makeProgress(id, true, 1.0));
+            }
+        }
+        return progress;
+    }
+};
+
+// =============================================================================
+// Catalog Tests
+// =============================================================================
+
+TEST_F(SkillProgressMatrixTest, SetSkillItems_CountsRequiredSkills) {
+    EXPECT_TRUE(matrix().hasSkillCatalog());
+    EXPECT_EQ(matrix().getSkillCount(), 70u);
+    EXPECT_EQ(matrix().getRequiredSkillCount(), 47u);
+}
+
+// =============================================================================
+// Readiness Tests
+// =============================================================================
+
+TEST_F(SkillProgressMatrixTest, HasPassedAllRequired_FalseForUnknownEnrollment) {
+    EXPECT_FALSE(matrix().hasEnrollment(1));
+    EXPECT_FALSE(matrix().hasPassedAllRequired(1));
+}
+
+TEST_F(SkillProgressMatrixTest, HasPassedAllRequired_TrueWhenEveryRequiredSkillValidated) {
+    matrix().loadEnrollment(100, 1, allRequiredPassed());
+
+    EXPECT_TRUE(matrix().hasPassedAllRequired(1));
+    EXPECT_TRUE(matrix().getRequiredSkillsNotPassed(1).empty());
+    EXPECT_DOUBLE_EQ(matrix().getPracticeHours(1), 47.0);
+}
+
+TEST_F(SkillProgressMatrixTest, RequiredSkillsNotPassed_ListsGapsAcrossWords) {
+    auto progress = allRequiredPassed();
+    progress.erase(std::remove_if(progress.begin(), progress.end(),
+        [](const StudentSkillProgress& p) {
+            return p.getSkillItemId() == 2 || p.getSkillItemId() == 68;
+        }), progress.end());
+    matrix().loadEnrollment(100, 1, progress);
+
+    auto missing = matrix().getRequiredSkillsNotPassed(1);
+    ASSERT_EQ(missing.size(), 2u);
+    EXPECT_EQ(missing[0].getId(), "2");
+    EXPECT_EQ(missing[1].getId(), "68");
+    EXPECT_EQ(missing[1].getName(), "Skill 68");
+    EXPECT_FALSE(matrix().hasPassedAllRequired(1));
+}
+
+// =============================================================================
+// Validation Update Tests
+// =============================================================================
+
+TEST_F(SkillProgressMatrixTest, ApplyValidation_PassingSetsPassedAndAttempted) {
+    matrix().loadEnrollment(100, 1, {});
+    matrix().applyValidation(makeValidation(1, 65, ValidationResult::Pass));
+
+    EXPECT_TRUE(matrix().hasPassedSkill(1, 65));
+    EXPECT_TRUE(matrix().hasAttemptedSkill(1, 65));
+    EXPECT_EQ(matrix().getPassedCount(1), 1);
+}
+
+TEST_F(SkillProgressMatrixTest, ApplyValidation_FailingRecordsAttemptAndCriticalError) {
+    matrix().loadEnrollment(100, 1, {});
+    matrix().applyValidation(makeValidation(1, 4, ValidationResult::Fail, true));
+
+    EXPECT_FALSE(matrix().hasPassedSkill(1, 4));
+    EXPECT_TRUE(matrix().hasAttemptedSkill(1, 4));
+    EXPECT_TRUE(matrix().hasCriticalError(1));
+}
+
+TEST_F(SkillProgressMatrixTest, ApplyValidation_WaitsForMinimumSuccessfulAttempts) {
+    SkillItem item;
+    item.setId("4");
+    item.setRequiresDemonstration(true);
+    item.setMinimumSuccessfulAttempts(3);
+    matrix().setSkillItems({item});
+
+    StudentSkillProgress earlier = makeProgress(4, false);
+    earlier.setSuccessfulCount(1);
+    matrix().loadEnrollment(100, 1, {earlier});
+
+    matrix().applyValidation(makeValidation(1, 4, ValidationResult::Pass));
+    EXPECT_FALSE(matrix().hasPassedSkill(1, 4));
+
+    matrix().applyValidation(makeValidation(1, 4, ValidationResult::Pass));
+    EXPECT_TRUE(matrix().hasPassedSkill(1, 4));
+}
+
+TEST_F(SkillProgressMatrixTest, LoadEnrollment_ClearsEarlierCriticalError) {
+    matrix().loadEnrollment(100, 1, {});
+    matrix().applyValidation(makeValidation(1, 4, ValidationResult::Fail, true));
+    ASSERT_TRUE(matrix().hasCriticalError(1));
+
+    matrix().loadEnrollment(100, 1, {});
+
+    EXPECT_FALSE(matrix().hasCriticalError(1));
+}
+
+TEST_F(SkillProgressMatrixTest, ApplyValidation_IgnoresEnrollmentsNotLoaded) {
+    matrix().applyValidation(makeValidation(9, 1, ValidationResult::Pass));
+
+    EXPECT_FALSE(matrix().hasEnrollment(9));
+}
+
+TEST_F(SkillProgressMatrixTest, InvalidateEnrollment_DropsRow) {
+    matrix().loadEnrollment(100, 1, allRequiredPassed());
+    matrix().invalidateEnrollment(1);
+
+    EXPECT_FALSE(matrix().hasEnrollment(1));
+    EXPECT_FALSE(matrix().hasPassedAllRequired(1));
+}
+
+TEST_F(SkillProgressMatrixTest, InvalidateAllEnrollments_KeepsCatalog) {
+    matrix().loadEnrollment(100, 1, allRequiredPassed());
+    matrix().loadEnrollment(101, 2, {});
+    matrix().invalidateAllEnrollments();
+
+    EXPECT_FALSE(matrix().hasEnrollment(1));
+    EXPECT_FALSE(matrix().hasEnrollment(2));
+    EXPECT_EQ(matrix().getSkillCount(), 70u);
+}
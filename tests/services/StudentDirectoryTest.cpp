@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "api/ApiUtils.h"
+#include "api/StudentDirectory.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using namespace StudentIntake::Models;
+using TestUtils::FakeApiClient;
+
+namespace {
+
+constexpr int kStudentCount = 100000;
+
+/**
+ * @brief Serves a synthetic Student table of studentCount rows, paged by
+ * page[offset]/page[limit] with the total in meta.count (optionally omitted);
+ * once failAfter requests were answered the backend goes away
+ */
+void serveStudents(FakeApiClient& client, int studentCount, bool sendCount = true, int failAfter = -1) {
+    auto serve = [&client, studentCount, sendCount, failAfter](const FakeApiClient::Request& request) {
+        if (failAfter >= 0 && client.countRequests() > static_cast<size_t>(failAfter)) {
+            return FakeApiClient::reply(503);
+        }
+
+        auto parameter = [&request](const std::string& name) {
+            std::string value = FakeApiClient::queryParameter(request.endpoint, name);
+            return value.empty() ? 0 : std::stoi(value);
+        };
+        int offset = parameter("page[offset]");
+        int limit = parameter("page[limit]");
+        nlohmann::json data = nlohmann::json::array();
+        for (int id = offset + 1; id <= std::min(offset + limit, studentCount); ++id) {
+            data.push_back({{"type", "Student"}, {"id", std::to_string(id)},
+                            {"attributes", {{"first_name", "Student"},
+                                            {"last_name", std::to_string(id)},
+                                            {"email", "s" + std::to_string(id) + "@example.com"},
+                                            {"status", "active"}}}});
+        }
+
+        nlohmann::json body = {{"data", data}};
+        if (sendCount) {
+            body["meta"] = {{"count", studentCount}};
+        }
+        return FakeApiClient::reply(200, body);
+    };
+    client.route("GET", "/Student", serve);
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class StudentDirectoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        client_ = std::make_shared<FakeApiClient>();
+        serveStudents(*client_, kStudentCount);
+        directory_ = std::make_unique<StudentDirectory>(client_, 50, 4);
+    }
+
+    std::shared_ptr<FakeApiClient> client_;
+    std::unique_ptr<StudentDirectory> directory_;
+};
+
+// =============================================================================
+// Query Building Tests
+// =============================================================================
+
+TEST_F(StudentDirectoryTest, BuildEndpoint_PushesFiltersAndSortToBackend) {
+    StudentQuery query;
+    query.search = "  ann ";
+    query.curriculumId = "3";
+    query.status = "pending";
+    query.sortField = "name";
+    query.sortAscending = false;
+
+    auto endpoint = StudentDirectory::buildEndpoint(query, 100, 50);
+
+    EXPECT_EQ(endpoint.rfind("/Student?page[offset]=100&page[limit]=50", 0), 0u);
+    EXPECT_NE(endpoint.find("&sort=-last_name,-first_name"), std::string::npos);
+    EXPECT_NE(endpoint.find("&filter[curriculum_id]=3"), std::string::npos);
+    EXPECT_NE(endpoint.find("&filter[is_login_revoked]=false"), std::string::npos);
+    EXPECT_NE(endpoint.find(urlEncode(R"({"name":"status","op":"ilike","val":"pending"})")), std::string::npos);
+    EXPECT_NE(endpoint.find("%25ann%25"), std::string::npos);
+}
+
+TEST_F(StudentDirectoryTest, BuildEndpoint_MatchesStatusWhateverItsCase) {
+    StudentQuery lower;
+    lower.status = "active";
+    StudentQuery upper;
+    upper.status = "Active";
+
+    EXPECT_EQ(StudentDirectory::buildEndpoint(upper, 0, 50), StudentDirectory::buildEndpoint(lower, 0, 50));
+    EXPECT_EQ(upper.key(), lower.key());
+
+    StudentQuery revoked;
+    revoked.status = "REVOKED";
+    EXPECT_NE(StudentDirectory::buildEndpoint(revoked, 0, 50).find("filter[is_login_revoked]=true"),
+              std::string::npos);
+}
+
+TEST_F(StudentDirectoryTest, BuildEndpoint_ActiveIncludesStudentsWithoutStatus) {
+    StudentQuery active;
+    active.status = "active";
+
+    auto endpoint = StudentDirectory::buildEndpoint(active, 0, 50);
+
+    EXPECT_NE(endpoint.find(urlEncode(R"({"or":[{"name":"status","op":"is_","val":null},)"
+                                      R"({"name":"status","op":"ilike","val":"active"}]})")),
+              std::string::npos);
+    EXPECT_EQ(StudentDirectory::parseStudent({{"id", 1}, {"attributes", {{"status", nullptr}}}}).getStatus(),
+              "active");
+}
+
+TEST_F(StudentDirectoryTest, BuildEndpoint_EscapesLikeWildcardsInSearch) {
+    EXPECT_EQ(StudentDirectory::escapeLike(R"(50%_off\x)"), R"(50\%\_off\\x)");
+
+    StudentQuery query;
+    query.search = "a_b";
+    auto endpoint = StudentDirectory::buildEndpoint(query, 0, 50);
+
+    EXPECT_NE(endpoint.find(urlEncode(R"("val":"%a\\_b%")")), std::string::npos);
+}
+
+TEST_F(StudentDirectoryTest, ParseStudent_RevokedFlagOverridesStatus) {
+    nlohmann::json data = {{"id", 7}, {"attributes", {{"email", "a@b.c"}, {"status", "Active"},
+                                                      {"curriculum_id", 2}, {"is_login_revoked", true}}}};
+
+    auto student = StudentDirectory::parseStudent(data);
+
+    EXPECT_EQ(student.getId(), "7");
+    EXPECT_EQ(student.getCurriculumId(), "2");
+    EXPECT_EQ(student.getStatus(), "revoked");
+}
+
+// =============================================================================
+// Paging Tests
+// =============================================================================
+
+TEST_F(StudentDirectoryTest, GetStudent_FetchesOnlyTheContainingPage) {
+    EXPECT_EQ(directory_->getTotalCount(), kStudentCount);
+
+    Student student;
+    ASSERT_TRUE(directory_->getStudent(75321, student));
+    EXPECT_EQ(student.getId(), "75322");
+    ASSERT_TRUE(directory_->getStudent(75330, student));
+
+    EXPECT_EQ(client_->countRequests(), 2u);
+    EXPECT_NE(client_->endpoints().back().find("page[offset]=75300&page[limit]=50"), std::string::npos);
+    EXPECT_FALSE(directory_->getStudent(kStudentCount, student));
+}
+
+TEST_F(StudentDirectoryTest, PrefetchAround_WarmsNeighbouringPages) {
+    Student student;
+    ASSERT_TRUE(directory_->getStudent(500, student));
+    directory_->prefetchAround(500);
+    directory_->waitIdle();
+    auto fetched = client_->countRequests();
+
+    ASSERT_TRUE(directory_->getStudent(450, student));
+    ASSERT_TRUE(directory_->getStudent(550, student));
+
+    EXPECT_EQ(fetched, 3u);
+    EXPECT_EQ(client_->countRequests(), fetched);
+    EXPECT_EQ(student.getId(), "551");
+}
+
+TEST_F(StudentDirectoryTest, PageCache_IsBoundedAndKeyedByQuery) {
+    Student student;
+    for (int page = 0; page < 6; ++page) {
+        directory_->getStudent(page * 50, student);
+    }
+    EXPECT_EQ(directory_->getCachedPageCount(), 4u);
+
+    // Switching filters and back reuses the pages of the first query
+    StudentQuery revoked;
+    revoked.status = "revoked";
+    directory_->setQuery(revoked);
+    directory_->getStudent(0, student);
+    EXPECT_NE(client_->endpoints().back().find("filter[is_login_revoked]=true"), std::string::npos);
+
+    directory_->setQuery(StudentQuery());
+    auto fetched = client_->countRequests();
+    directory_->getStudent(250, student);
+    EXPECT_EQ(client_->countRequests(), fetched);
+}
+
+TEST_F(StudentDirectoryTest, GetTotalCount_ProbesWhenMetaCountIsMissing) {
+    auto client = std::make_shared<FakeApiClient>();
+    serveStudents(*client, 1234, false);
+    StudentDirectory directory(client, 50, 4);
+
+    EXPECT_EQ(directory.getTotalCount(), 1234);
+    auto probes = client->countRequests();
+    EXPECT_LT(probes, 30u);
+
+    // The probed total is cached like meta.count
+    EXPECT_EQ(directory.getTotalCount(), 1234);
+    EXPECT_EQ(client->countRequests(), probes);
+
+    Student student;
+    ASSERT_TRUE(directory.getStudent(1233, student));
+    EXPECT_EQ(student.getId(), "1234");
+}
+
+TEST_F(StudentDirectoryTest, GetTotalCount_CachesFailedProbe) {
+    auto client = std::make_shared<FakeApiClient>();
+    serveStudents(*client, 1234, false, 1);
+    StudentDirectory directory(client, 50, 4);
+
+    EXPECT_EQ(directory.getTotalCount(), 50);
+    EXPECT_FALSE(directory.isTotalKnown());
+
+    // Not probed again until the cache is dropped
+    auto requests = client->countRequests();
+    EXPECT_EQ(directory.getTotalCount(), 50);
+    EXPECT_EQ(client->countRequests(), requests);
+
+    serveStudents(*client, 1234, false);
+    directory.invalidate();
+    EXPECT_EQ(directory.getTotalCount(), 1234);
+    EXPECT_TRUE(directory.isTotalKnown());
+}
+
+TEST_F(StudentDirectoryTest, CountStudents_ProbesWhenMetaCountIsMissing) {
+    auto client = std::make_shared<FakeApiClient>();
+    serveStudents(*client, 77, false);
+    StudentDirectory directory(client, 50, 4);
+
+    EXPECT_EQ(directory.countStudents(StudentQuery()), 77);
+
+    auto empty = std::make_shared<FakeApiClient>();
+    serveStudents(*empty, 0, false);
+    StudentDirectory emptyDirectory(empty, 50, 4);
+    EXPECT_EQ(emptyDirectory.countStudents(StudentQuery()), 0);
+    EXPECT_EQ(emptyDirectory.getTotalCount(), 0);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include "api/StudentDossier.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using TestUtils::FakeApiClient;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class StudentDossierTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Every section takes 100ms; anything unanswered fails
+        client_ = std::make_shared<FakeApiClient>();
+        client_->setLatency(std::chrono::milliseconds(100));
+        client_->respond("*", "", 500);
+        const std::string filter = "?filter[student_id]=42";
+
+        client_->respond("GET", "/Student/42", 200, {{"data", {{"type", "Student"}, {"id", "42"},
+            {"attributes", {{"first_name", "Ada"}, {"last_name", "Lovelace"}, {"email", "ada@example.com"}}}}}});
+        client_->respond("GET", "/FormSubmission" + filter, 200, {{"data", {
+            {{"type", "FormSubmission"}, {"id", "7"},
+             {"attributes", {{"form_type_id", 2}, {"status", "approved"}, {"submitted_at", "2024-03-01T09:00:00"}}}},
+            {{"type", "FormSubmission"}, {"id", "8"},
+             {"attributes", {{"form_type_id", 7}, {"status", nullptr}}}}
+        }}});
+        client_->respond("GET", "/EmergencyContact" + filter, 200, {{"data", {
+            {{"type", "EmergencyContact"}, {"id", "1"}, {"attributes", {{"first_name", "Charles"}}}},
+            {{"type", "EmergencyContact"}, {"id", "2"}, {"attributes", {{"first_name", "Mary"}}}}
+        }}});
+        client_->respond("GET", "/MedicalInfo" + filter, 200);
+        client_->respond("GET", "/AcademicHistory" + filter, 200);
+        client_->respond("GET", "/FinancialAid" + filter, 200);
+        client_->respond("GET", "/Consent" + filter, 200, {{"data", {
+            {{"type", "Consent"}, {"id", "3"}, {"attributes", {{"consent_type", "privacy_policy"}}}}
+        }}});
+        // /Document is left unanswered so that section fails
+    }
+
+    std::shared_ptr<FakeApiClient> client_;
+};
+
+// =============================================================================
+// Load Tests
+// =============================================================================
+
+TEST_F(StudentDossierTest, Load_IssuesAllRequestsConcurrently) {
+    StudentDossierLoader loader(client_);
+
+    auto started = std::chrono::steady_clock::now();
+    StudentDossier dossier = loader.load(42);
+    auto elapsed = std::chrono::steady_clock::now() - started;
+
+    EXPECT_EQ(client_->countRequests(), 8u);
+    EXPECT_GT(client_->peakInFlight(), 1);
+    // Eight sequential calls would take 800ms
+    EXPECT_LT(elapsed, std::chrono::milliseconds(600));
+}
+
+TEST_F(StudentDossierTest, Load_AssemblesTypedSections) {
+    StudentDossier dossier = StudentDossierLoader(client_).load(42);
+
+    EXPECT_EQ(dossier.studentId, 42);
+    EXPECT_EQ(dossier.studentName(), "Ada Lovelace");
+    EXPECT_EQ(dossier.studentEmail(), "ada@example.com");
+
+    ASSERT_EQ(dossier.submissions.size(), 2u);
+    const DossierSubmission* contact = dossier.findSubmission(7);
+    ASSERT_NE(contact, nullptr);
+    EXPECT_EQ(contact->formType, "emergency_contact");
+    EXPECT_EQ(contact->status, "approved");
+    EXPECT_EQ(contact->submittedAt, "2024-03-01T09:00:00");
+    EXPECT_EQ(dossier.findSubmission(8)->status, "pending");
+    EXPECT_EQ(dossier.findSubmission(99), nullptr);
+
+    ASSERT_EQ(dossier.emergencyContacts.size(), 2u);
+    EXPECT_EQ(dossier.emergencyContacts[1]["first_name"], "Mary");
+    ASSERT_EQ(dossier.consents.size(), 1u);
+    EXPECT_EQ(dossier.consents[0]["consent_type"], "privacy_policy");
+    EXPECT_TRUE(dossier.medicalInfo.empty());
+}
+
+TEST_F(StudentDossierTest, Load_FailedSectionLeavesDossierIncomplete) {
+    StudentDossier dossier = StudentDossierLoader(client_).load(42);
+
+    EXPECT_FALSE(dossier.complete);
+    EXPECT_TRUE(dossier.documents.empty());
+    EXPECT_TRUE(dossier.hasStudent());
+}
+
+TEST_F(StudentDossierTest, Load_WithoutClientReturnsEmptyDossier) {
+    StudentDossier dossier = StudentDossierLoader(nullptr).load(42);
+
+    EXPECT_FALSE(dossier.hasStudent());
+    EXPECT_EQ(dossier.studentName(), "Unknown Student");
+    EXPECT_TRUE(dossier.submissions.empty());
+}
+
+TEST(StudentDossierLoaderTest, FormTypeCode_MapsDefaultFormSet) {
+    EXPECT_EQ(StudentDossierLoader::formTypeCode(1), "personal_info");
+    EXPECT_EQ(StudentDossierLoader::formTypeCode(7), "consent");
+    EXPECT_EQ(StudentDossierLoader::formTypeCode(42), "unknown");
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "api/SubmissionIndex.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using TestUtils::FakeApiClient;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class SubmissionIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        client_ = std::make_shared<FakeApiClient>();
+        client_->putRow("FormType", 1, {{"code", "personal_info"}, {"name", "Personal Information"}});
+        client_->putRow("FormType", 2, {{"code", "consent"}, {"name", "Terms and Consent"}});
+        client_->putRow("Curriculum", 7, {{"name", "Class A CDL"}});
+
+        student(10, "Zoe", "Adams", 7, "2024-01-01T00:00:00");
+        student(11, "Ann", "Brown", 0, "2024-01-01T00:00:00");
+
+        submission(100, 10, 1, "pending", "2024-03-01T09:00:00", "2024-03-01T09:00:00");
+        submission(101, 10, 2, "approved", "2024-03-01T10:00:00", "2024-03-02T08:00:00");
+        submission(102, 11, 1, "pending", "2024-03-02T11:00:00", "2024-03-02T11:00:00");
+
+        index().reset();
+        index().setApiClient(client_);
+        index().setPageSize(2);
+    }
+
+    void TearDown() override {
+        index().reset();
+    }
+
+    void student(int id, const std::string& first, const std::string& last, int curriculumId,
+                 const std::string& updatedAt) {
+        client_->putRow("Student", id, {{"first_name", first}, {"last_name", last},
+                                        {"email", first + "@example.com"},
+                                        {"curriculum_id", curriculumId}, {"updated_at", updatedAt}});
+    }
+
+    void submission(int id, int studentId, int formTypeId, const std::string& status,
+                    const std::string& submittedAt, const std::string& updatedAt) {
+        client_->putRow("FormSubmission", id, {{"student_id", studentId}, {"form_type_id", formTypeId},
+                                               {"status", status}, {"submitted_at", submittedAt},
+                                               {"updated_at", updatedAt}});
+    }
+
+    static std::vector<int> ids(const std::vector<SubmissionView>& views) {
+        std::vector<int> result;
+        for (const auto& view : views) {
+            result.push_back(view.id);
+        }
+        return result;
+    }
+
+    static SubmissionIndex& index() {
+        return SubmissionIndex::getInstance();
+    }
+
+    std::shared_ptr<FakeApiClient> client_;
+};
+
+// =============================================================================
+// Query Tests
+// =============================================================================
+
+TEST_F(SubmissionIndexTest, Query_JoinsStudentProgramAndFormType) {
+    ASSERT_TRUE(index().refresh());
+
+    SubmissionView view;
+    ASSERT_TRUE(index().getSubmission(101, view));
+    EXPECT_EQ(view.studentName, "Zoe Adams");
+    EXPECT_EQ(view.studentEmail, "Zoe@example.com");
+    EXPECT_EQ(view.programName, "Class A CDL");
+    EXPECT_EQ(view.formType, "consent");
+    EXPECT_EQ(view.formName, "Terms and Consent");
+    EXPECT_EQ(view.status, "approved");
+}
+
+TEST_F(SubmissionIndexTest, Query_FiltersWithoutBackendCalls) {
+    ASSERT_TRUE(index().refresh());
+    client_->takeRequests();
+
+    SubmissionFilter pending;
+    pending.status = "pending";
+    EXPECT_EQ(ids(index().query(pending)), (std::vector<int>{102, 100}));
+
+    SubmissionFilter consent;
+    consent.formType = "consent";
+    EXPECT_EQ(ids(index().query(consent)), (std::vector<int>{101}));
+
+    SubmissionFilter program;
+    program.curriculumId = 7;
+    program.submittedOn = "2024-03-01";
+    EXPECT_EQ(ids(index().query(program)), (std::vector<int>{100, 101}));
+
+    SubmissionFilter search;
+    search.search = "ann";
+    search.status = "pending";
+    EXPECT_EQ(ids(index().query(search)), (std::vector<int>{102}));
+
+    // Sorted by student name, each student's forms together
+    EXPECT_EQ(ids(index().query(SubmissionFilter())), (std::vector<int>{102, 100, 101}));
+
+    EXPECT_EQ(client_->takeRequests().size(), 0u);
+}
+
+TEST_F(SubmissionIndexTest, Counts_ComeFromTheIndexes) {
+    ASSERT_TRUE(index().refresh());
+
+    auto counts = index().countByStatus();
+    EXPECT_EQ(counts["pending"], 2);
+    EXPECT_EQ(counts["approved"], 1);
+    EXPECT_EQ(index().countSubmittedOn("2024-03-01"), 2);
+    EXPECT_EQ(index().countSubmittedOn("2024-03-05"), 0);
+}
+
+// =============================================================================
+// Update Tests
+// =============================================================================
+
+TEST_F(SubmissionIndexTest, Refresh_AppliesUpdatedAtDeltas) {
+    ASSERT_TRUE(index().refresh());
+    index().setPageSize(50);
+    client_->takeRequests();
+
+    submission(100, 10, 1, "rejected", "2024-03-01T09:00:00", "2024-03-04T12:00:00");
+    submission(103, 11, 2, "pending", "2024-03-04T12:00:00", "2024-03-04T12:00:00");
+    student(11, "Annie", "Brown", 7, "2024-03-04T12:00:00");
+    ASSERT_TRUE(index().refresh());
+
+    // One short page each for students and submissions
+    EXPECT_EQ(client_->takeRequests().size(), 2u);
+    EXPECT_EQ(index().size(), 4u);
+    EXPECT_EQ(index().countByStatus()["rejected"], 1);
+    EXPECT_EQ(index().getWatermark(), "2024-03-04T12:00:00");
+
+    SubmissionFilter program;
+    program.curriculumId = 7;
+    EXPECT_EQ(ids(index().query(program)), (std::vector<int>{102, 103, 100, 101}));
+
+    SubmissionView view;
+    ASSERT_TRUE(index().getSubmission(103, view));
+    EXPECT_EQ(view.studentName, "Annie Brown");
+}
+
+TEST_F(SubmissionIndexTest, UpdateStatus_MovesSubmissionBetweenStatusIndexes) {
+    ASSERT_TRUE(index().refresh());
+
+    EXPECT_TRUE(index().updateStatus(102, "approved", "2024-03-05T10:00:00", "Admin"));
+    EXPECT_FALSE(index().updateStatus(999, "approved", "", ""));
+
+    SubmissionFilter pending;
+    pending.status = "pending";
+    EXPECT_EQ(ids(index().query(pending)), (std::vector<int>{100}));
+
+    SubmissionView view;
+    ASSERT_TRUE(index().getSubmission(102, view));
+    EXPECT_EQ(view.reviewedBy, "Admin");
+    EXPECT_EQ(index().countByStatus()["approved"], 2);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "api/TextSearchIndex.h"
+
+using namespace StudentIntake::Api;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class TextSearchIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        index_.upsert("1", {"Ann Smith", "ann.smith@example.com"});
+        index_.upsert("2", {"Joanna Brown", "jbrown@example.com"});
+        index_.upsert("3", {"Sam Annis", "sam@school.edu"});
+        index_.upsert("4", {"Ann", "ann@example.com"});
+    }
+
+    static std::vector<std::string> ids(const std::vector<TextSearchIndex::Match>& matches) {
+        std::vector<std::string> result;
+        for (const auto& match : matches) {
+            result.push_back(match.id);
+        }
+        return result;
+    }
+
+    TextSearchIndex index_;
+};
+
+// =============================================================================
+// Search Tests
+// =============================================================================
+
+TEST_F(TextSearchIndexTest, Search_IsCaseInsensitiveAndRanked) {
+    auto matches = index_.search("ANN");
+
+    // Whole name, then name prefix, then word prefix, then substring
+    EXPECT_EQ(ids(matches), (std::vector<std::string>{"4", "1", "3", "2"}));
+}
+
+TEST_F(TextSearchIndexTest, Search_ShortTermsMatchWordStarts) {
+    EXPECT_EQ(ids(index_.search("sa")), (std::vector<std::string>{"3"}));
+    EXPECT_TRUE(index_.search("nn").empty());
+}
+
+TEST_F(TextSearchIndexTest, Search_AllTermsMustMatch) {
+    EXPECT_EQ(ids(index_.search("ann example")), (std::vector<std::string>{"4", "1", "2"}));
+    EXPECT_EQ(ids(index_.search("school.edu")), (std::vector<std::string>{"3"}));
+    EXPECT_TRUE(index_.search("ann zzz").empty());
+    EXPECT_TRUE(index_.search("   ").empty());
+}
+
+TEST_F(TextSearchIndexTest, Search_LimitKeepsBestMatches) {
+    EXPECT_EQ(ids(index_.search("ann", 2)), (std::vector<std::string>{"4", "1"}));
+}
+
+// =============================================================================
+// Update Tests
+// =============================================================================
+
+TEST_F(TextSearchIndexTest, Upsert_ReplacesOldText) {
+    EXPECT_FALSE(index_.upsert("2", {"joanna brown", "JBROWN@example.com"}));
+    EXPECT_TRUE(index_.upsert("2", {"Joan Green", "jgreen@example.com"}));
+
+    EXPECT_TRUE(index_.search("brown").empty());
+    EXPECT_EQ(ids(index_.search("green")), (std::vector<std::string>{"2"}));
+}
+
+TEST_F(TextSearchIndexTest, Sync_AddsChangesAndRemoves) {
+    auto changed = index_.sync({
+        {"1", {"Ann Smith", "ann.smith@example.com"}},
+        {"3", {"Sam Annis", "sam.annis@school.edu"}},
+        {"5", {"Lee Park", "lee@example.com"}}
+    });
+
+    EXPECT_EQ(changed, 4u);  // 3 changed, 5 added, 2 and 4 removed
+    EXPECT_EQ(index_.size(), 3u);
+    EXPECT_FALSE(index_.contains("2"));
+    EXPECT_EQ(ids(index_.search("lee")), (std::vector<std::string>{"5"}));
+    EXPECT_EQ(ids(index_.search("ann")), (std::vector<std::string>{"1", "3"}));
+}
+
+TEST_F(TextSearchIndexTest, Registry_SharesIndexByName) {
+    auto& registry = SearchIndexRegistry::getInstance();
+    registry.reset();
+
+    registry.getIndex("users")->upsert("7", {"Shared User"});
+
+    EXPECT_TRUE(registry.getIndex("users")->contains("7"));
+    EXPECT_EQ(registry.getIndex("curricula")->size(), 0u);
+    registry.reset();
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include "api/TimeTrackingAggregator.h"
+#include "models/StudentProgress.h"
+#include "utils/TestUtils.h"
+
+using namespace StudentIntake::Api;
+using namespace StudentIntake::Models;
+using TestUtils::FakeApiClient;
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class TimeTrackingAggregatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        client_ = std::make_shared<FakeApiClient>();
+        client_->respond("POST", "/StudentTimeLog", 201);
+        tracker().reset();
+        tracker().setApiClient(client_);
+    }
+
+    void TearDown() override {
+        tracker().reset();
+        tracker().setApiClient(nullptr);
+    }
+
+    static TimeTrackingAggregator& tracker() {
+        return TimeTrackingAggregator::getInstance();
+    }
+
+    static StudentTimeLog makeHeartbeat(int moduleId, int contentId, int seconds,
+                                        const std::string& start = "2024-01-01T10:00:00Z") {
+        StudentTimeLog log;
+        log.setStudentId(7);
+        log.setEnrollmentId(3);
+        log.setCourseId(1);
+        log.setModuleId(moduleId);
+        log.setContentId(contentId);
+        log.setActivityType(ActivityType::Reading);
+        log.setSessionStart(start);
+        log.setSessionEnd(start);
+        log.setDurationSeconds(seconds);
+        return log;
+    }
+
+    std::shared_ptr<FakeApiClient> client_;
+};
+
+// =============================================================================
+// Coalescing Tests
+// =============================================================================
+
+TEST_F(TimeTrackingAggregatorTest, Record_CoalescesHeartbeatsForSameActivity) {
+    tracker().record(makeHeartbeat(10, 100, 15, "2024-01-01T10:00:30Z"));
+    tracker().record(makeHeartbeat(10, 100, 15, "2024-01-01T10:00:00Z"));
+    tracker().record(makeHeartbeat(10, 101, 20));
+
+    EXPECT_EQ(tracker().getPendingRowCount(), 2u);
+    EXPECT_EQ(tracker().getPendingSeconds(), 50);
+}
+
+TEST_F(TimeTrackingAggregatorTest, Record_IgnoresZeroDuration) {
+    tracker().record(makeHeartbeat(10, 100, 0));
+
+    EXPECT_EQ(tracker().getPendingRowCount(), 0u);
+}
+
+// =============================================================================
+// Flush Tests
+// =============================================================================
+
+TEST_F(TimeTrackingAggregatorTest, Flush_PostsOneCompactedRowPerKey) {
+    tracker().record(makeHeartbeat(10, 100, 15, "2024-01-01T10:00:30Z"));
+    tracker().record(makeHeartbeat(10, 100, 15, "2024-01-01T10:00:00Z"));
+
+    EXPECT_EQ(tracker().flush(), 1);
+    auto posts = client_->requests("POST");
+    ASSERT_EQ(posts.size(), 1u);
+    EXPECT_EQ(posts[0].endpoint, "/StudentTimeLog");
+
+    auto attrs = posts[0].payload["data"]["attributes"];
+    EXPECT_EQ(posts[0].payload["data"]["type"], "StudentTimeLog");
+    EXPECT_EQ(attrs["duration_seconds"], 30);
+    EXPECT_EQ(attrs["session_start"], "2024-01-01T10:00:00Z");
+    EXPECT_EQ(attrs["session_end"], "2024-01-01T10:00:30Z");
+    EXPECT_EQ(tracker().getPendingRowCount(), 0u);
+}
+
+TEST_F(TimeTrackingAggregatorTest, Flush_RequeuesRowsWhenBackendFails) {
+    client_->respond("POST", "/StudentTimeLog", 503);
+    tracker().record(makeHeartbeat(10, 100, 15));
+
+    EXPECT_EQ(tracker().flush(), 0);
+    EXPECT_EQ(tracker().getPendingSeconds(), 15);
+
+    client_->respond("POST", "/StudentTimeLog", 201);
+    client_->takeRequests();
+    tracker().record(makeHeartbeat(10, 100, 5));
+    EXPECT_EQ(tracker().flush(), 1);
+    EXPECT_EQ(client_->requests("POST")[0].payload["data"]["attributes"]["duration_seconds"], 20);
+}
+
+TEST_F(TimeTrackingAggregatorTest, Flush_PostsSeveralRowsInOneBatch) {
+    tracker().record(makeHeartbeat(10, 100, 15));
+    tracker().record(makeHeartbeat(10, 101, 20));
+    tracker().record(makeHeartbeat(11, 110, 25));
+
+    EXPECT_EQ(tracker().flush(), 3);
+    auto posts = client_->requests("POST");
+    ASSERT_EQ(posts.size(), 1u);
+    EXPECT_EQ(posts[0].endpoint, "/StudentTimeLog/batch");
+    ASSERT_EQ(posts[0].payload["data"].size(), 3u);
+    EXPECT_EQ(posts[0].payload["data"][0]["type"], "StudentTimeLog");
+    EXPECT_EQ(tracker().getPendingRowCount(), 0u);
+}
+
+TEST_F(TimeTrackingAggregatorTest, Flush_FallsBackToSingleRowsWithoutBatchEndpoint) {
+    client_->respond("POST", "/StudentTimeLog/batch", 404);
+    tracker().record(makeHeartbeat(10, 100, 15));
+    tracker().record(makeHeartbeat(10, 101, 20));
+
+    EXPECT_EQ(tracker().flush(), 2);
+    EXPECT_EQ(client_->endpoints("POST"),
+              (std::vector<std::string>{"/StudentTimeLog/batch", "/StudentTimeLog", "/StudentTimeLog"}));
+}
+
+// =============================================================================
+// Running Total Tests
+// =============================================================================
+
+TEST_F(TimeTrackingAggregatorTest, SeedCourseTotal_IncludesUnflushedTime) {
+    tracker().record(makeHeartbeat(10, 100, 40));
+    tracker().seedCourseTotal(7, 1, 600);
+
+    EXPECT_TRUE(tracker().hasCourseTotal(7, 1));
+    EXPECT_EQ(tracker().getCourseTotal(7, 1), 640);
+}
+
+TEST_F(TimeTrackingAggregatorTest, Record_UpdatesSeededTotals) {
+    tracker().seedCourseTotal(7, 1, 100);
+    tracker().seedModuleTotal(7, 10, 50);
+
+    tracker().record(makeHeartbeat(10, 100, 30));
+    tracker().record(makeHeartbeat(11, 110, 20));
+    tracker().flush();
+
+    EXPECT_EQ(tracker().getCourseTotal(7, 1), 150);
+    EXPECT_EQ(tracker().getModuleTotal(7, 10), 80);
+    EXPECT_FALSE(tracker().hasModuleTotal(7, 11));
+}
+
+TEST_F(TimeTrackingAggregatorTest, SeedScope_HoldsTheStudentsRowsUntilSeeded) {
+    tracker().record(makeHeartbeat(10, 100, 40));
+    {
+        TimeTrackingAggregator::SeedScope seeding(tracker(), 7);
+        EXPECT_EQ(tracker().flush(), 0);
+        EXPECT_EQ(tracker().getPendingSeconds(), 40);
+
+        // The persisted rows read now cannot include the held-back 40 seconds
+        tracker().seedCourseTotal(7, 1, 600);
+    }
+
+    EXPECT_EQ(tracker().flush(), 1);
+    EXPECT_EQ(tracker().getCourseTotal(7, 1), 640);
+}
+
+// =============================================================================
+// Session Tests
+// =============================================================================
+
+TEST_F(TimeTrackingAggregatorTest, EndSession_RecordsDurationForLocalSession) {
+    auto sessionId = tracker().beginSession(makeHeartbeat(10, 100, 0));
+
+    EXPECT_TRUE(tracker().endSession(sessionId, 90));
+    EXPECT_FALSE(tracker().endSession(sessionId, 90));
+    EXPECT_EQ(tracker().getPendingSeconds(), 90);
+}
+
+TEST_F(TimeTrackingAggregatorTest, ExpireOpenSessions_DropsAbandonedSessions) {
+    auto sessionId = tracker().beginSession(makeHeartbeat(10, 100, 0));
+    auto now = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(tracker().expireOpenSessions(now + std::chrono::hours(1)), 0u);
+    EXPECT_EQ(tracker().getOpenSessionCount(), 1u);
+
+    EXPECT_EQ(tracker().expireOpenSessions(now + std::chrono::hours(13)), 1u);
+    EXPECT_EQ(tracker().getOpenSessionCount(), 0u);
+    EXPECT_FALSE(tracker().endSession(sessionId, 90));
+}
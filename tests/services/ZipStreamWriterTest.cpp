@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include "api/ZipStreamWriter.h"
+
+using namespace StudentIntake::Api;
+
+namespace {
+
+uint32_t read32(const std::string& bytes, size_t offset) {
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) {
+        value = (value << 8) | static_cast<unsigned char>(bytes[offset + i]);
+    }
+    return value;
+}
+
+uint16_t read16(const std::string& bytes, size_t offset) {
+    return static_cast<uint16_t>(static_cast<unsigned char>(bytes[offset])
+                                 | (static_cast<unsigned char>(bytes[offset + 1]) << 8));
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class ZipStreamWriterTest : public ::testing::Test {
+protected:
+    ZipStreamWriter::Sink collect() {
+        return [this](const char* data, size_t size) {
+            archive_.append(data, size);
+            writes_++;
+            return true;
+        };
+    }
+
+    std::string archive_;
+    int writes_ = 0;
+};
+
+// =============================================================================
+// Archive Layout Tests
+// =============================================================================
+
+TEST(ZipStreamWriterCrcTest, Crc32_MatchesReferenceValue) {
+    std::string check = "123456789";
+    EXPECT_EQ(ZipStreamWriter::crc32(check.data(), check.size()), 0xCBF43926u);
+
+    // Incremental updates give the same result
+    uint32_t crc = ZipStreamWriter::crc32(check.data(), 4);
+    EXPECT_EQ(ZipStreamWriter::crc32(check.data() + 4, 5, crc), 0xCBF43926u);
+}
+
+TEST_F(ZipStreamWriterTest, AddFile_WritesLocalHeaderAndDataImmediately) {
+    ZipStreamWriter zip(collect());
+
+    ASSERT_TRUE(zip.addFile("a.pdf", "%PDF-1.4 first"));
+    EXPECT_GT(writes_, 0);
+    EXPECT_EQ(read32(archive_, 0), 0x04034b50u);
+    EXPECT_EQ(read16(archive_, 8), 0);              // stored
+    EXPECT_EQ(read32(archive_, 18), 14u);           // compressed size
+    EXPECT_EQ(read16(archive_, 26), 5);             // name length
+    EXPECT_EQ(archive_.substr(30, 5), "a.pdf");
+    EXPECT_EQ(archive_.substr(35), "%PDF-1.4 first");
+    EXPECT_EQ(zip.getBytesWritten(), archive_.size());
+}
+
+TEST_F(ZipStreamWriterTest, Finish_WritesCentralDirectory) {
+    ZipStreamWriter zip(collect());
+    ASSERT_TRUE(zip.addFile("a.pdf", "first"));
+    ASSERT_TRUE(zip.addFile("b.pdf", "second"));
+    size_t directoryOffset = archive_.size();
+    ASSERT_TRUE(zip.finish());
+    EXPECT_FALSE(zip.addFile("c.pdf", "late"));
+
+    // End of central directory record is the last 22 bytes
+    size_t end = archive_.size() - 22;
+    EXPECT_EQ(read32(archive_, end), 0x06054b50u);
+    EXPECT_EQ(read16(archive_, end + 10), 2);
+    EXPECT_EQ(read32(archive_, end + 16), directoryOffset);
+
+    // Second directory entry points at the second local header
+    size_t second = directoryOffset + 46 + 5;
+    EXPECT_EQ(read32(archive_, second), 0x02014b50u);
+    size_t localOffset = read32(archive_, second + 42);
+    EXPECT_EQ(read32(archive_, localOffset), 0x04034b50u);
+    EXPECT_EQ(archive_.substr(localOffset + 30, 5), "b.pdf");
+    EXPECT_EQ(read32(archive_, second + 16), ZipStreamWriter::crc32("second", 6));
+}
+
+TEST_F(ZipStreamWriterTest, SinkFailure_StopsArchive) {
+    int calls = 0;
+    ZipStreamWriter zip([&calls](const char*, size_t) { return ++calls < 2; });
+
+    EXPECT_FALSE(zip.addFile("a.pdf", "data"));
+    EXPECT_TRUE(zip.hasFailed());
+    EXPECT_FALSE(zip.addFile("b.pdf", "data"));
+    EXPECT_FALSE(zip.finish());
+}
+
+TEST_F(ZipStreamWriterTest, Finish_WritesZip64RecordsPastEntryLimit) {
+    ZipStreamWriter zip(collect());
+    const int count = 70000;
+    for (int i = 0; i < count; ++i) {
+        ASSERT_TRUE(zip.addFile(std::to_string(i) + ".pdf", "x"));
+    }
+    ASSERT_TRUE(zip.finish());
+
+    // ZIP32 end record marks its counts as stored in the ZIP64 end record
+    size_t end = archive_.size() - 22;
+    EXPECT_EQ(read32(archive_, end), 0x06054b50u);
+    EXPECT_EQ(read16(archive_, end + 10), 0xFFFF);
+
+    // ZIP64 locator precedes it and points at the ZIP64 end record
+    size_t locator = end - 20;
+    EXPECT_EQ(read32(archive_, locator), 0x07064b50u);
+    size_t zip64End = read32(archive_, locator + 8);
+    EXPECT_EQ(read32(archive_, zip64End), 0x06064b50u);
+    EXPECT_EQ(read32(archive_, zip64End + 32), static_cast<uint32_t>(count));   // total entries
+    size_t directoryOffset = read32(archive_, zip64End + 48);
+    EXPECT_EQ(read32(archive_, directoryOffset), 0x02014b50u);
+    EXPECT_EQ(zip64End, directoryOffset + static_cast<size_t>(read32(archive_, zip64End + 40)));
+}
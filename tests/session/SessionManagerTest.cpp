@@ -0,0 +1,360 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "session/SessionManager.h"
+#include "models/Curriculum.h"
+
+using namespace StudentIntake;
+using Session::SessionManager;
+
+namespace {
+
+Models::FormTypeInfo formType(const std::string& id, int displayOrder, bool isRequired) {
+    Models::FormTypeInfo info;
+    info.id = id;
+    info.name = id + " form";
+    info.displayOrder = displayOrder;
+    info.isRequired = isRequired;
+    info.requiredForInternational = false;
+    info.requiredForTransfer = false;
+    info.requiredForVeteran = false;
+    info.requiredForFinancialAid = false;
+    info.minAge = 0;
+    info.maxAge = 0;
+    return info;
+}
+
+void logIn(const std::shared_ptr<Session::StudentSession>& session,
+           const std::string& studentId, const std::string& email) {
+    Models::Student student;
+    student.setId(studentId);
+    student.setEmail(email);
+    session->setStudent(student);
+    session->setLoggedIn(true);
+    SessionManager::getInstance().updateSessionIndex(session);
+}
+
+// The wheel only moves forward, so each expiry test starts a day past the last
+std::chrono::steady_clock::time_point nextTestStart() {
+    static auto start = std::chrono::steady_clock::now();
+    start += std::chrono::hours(24);
+    return start;
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class SessionManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override { clear(); }
+    void TearDown() override { clear(); }
+
+    static void clear() {
+        auto& manager = SessionManager::getInstance();
+        manager.setOnSessionCreated(nullptr);
+        manager.setOnSessionDestroyed(nullptr);
+        for (const auto& id : manager.getActiveSessionIds()) {
+            manager.removeSession(id);
+        }
+        manager.setFormTypeInfos({});
+        manager.setSessionTimeout(60);
+
+        // Counts sessions a previous test released, so reclaimedBytes starts settled
+        manager.removeExpiredSessions(std::chrono::steady_clock::now());
+    }
+};
+
+// =============================================================================
+// Session Lifecycle Tests
+// =============================================================================
+
+TEST_F(SessionManagerTest, CreateAndRemove_TrackSessionsAcrossShards) {
+    auto& manager = SessionManager::getInstance();
+    std::vector<std::string> ids;
+    for (int i = 0; i < 100; ++i) {
+        ids.push_back(manager.createSession()->getSessionId());
+    }
+    EXPECT_EQ(manager.getActiveSessionCount(), 100u);
+    EXPECT_EQ(manager.getActiveSessionIds().size(), 100u);
+    EXPECT_TRUE(manager.hasSession(ids[42]));
+    EXPECT_EQ(manager.getSession(ids[42])->getSessionId(), ids[42]);
+
+    manager.removeSession(ids[42]);
+    manager.removeSession(ids[42]);
+    EXPECT_FALSE(manager.hasSession(ids[42]));
+    EXPECT_EQ(manager.getSession(ids[42]), nullptr);
+    EXPECT_EQ(manager.getActiveSessionCount(), 99u);
+}
+
+TEST_F(SessionManagerTest, Callbacks_RunWithoutHoldingTheSessionLock) {
+    auto& manager = SessionManager::getInstance();
+    std::vector<std::string> events;
+    // Calling back into the manager would deadlock if the shard were still locked
+    manager.setOnSessionCreated([&](const std::string& id) {
+        events.push_back("created " + std::to_string(manager.hasSession(id)));
+    });
+    manager.setOnSessionDestroyed([&](const std::string& id) {
+        events.push_back("destroyed " + std::to_string(manager.hasSession(id)));
+    });
+
+    auto session = manager.createSession();
+    manager.removeSession(session->getSessionId());
+
+    EXPECT_EQ(events, (std::vector<std::string>{"created 1", "destroyed 0"}));
+}
+
+// =============================================================================
+// Secondary Index Tests
+// =============================================================================
+
+TEST_F(SessionManagerTest, Lookup_FindsLoggedInSessionsByStudentIdAndEmail) {
+    auto& manager = SessionManager::getInstance();
+    auto anonymous = manager.createSession();
+    auto ada = manager.createSession();
+    logIn(ada, "7", "ada@example.com");
+
+    EXPECT_EQ(manager.getSessionByStudentId("7"), ada);
+    EXPECT_EQ(manager.getSessionByEmail("ada@example.com"), ada);
+    EXPECT_EQ(manager.getSessionByStudentId("8"), nullptr);
+    EXPECT_EQ(manager.getSessionByStudentId(""), nullptr);
+
+    // A student set but not logged in is not indexed
+    Models::Student student;
+    student.setId("9");
+    anonymous->setStudent(student);
+    manager.updateSessionIndex(anonymous);
+    EXPECT_EQ(manager.getSessionByStudentId("9"), nullptr);
+}
+
+TEST_F(SessionManagerTest, UpdateSessionIndex_FollowsAChangedStudent) {
+    auto& manager = SessionManager::getInstance();
+    auto session = manager.createSession();
+    logIn(session, "7", "old@example.com");
+    logIn(session, "7", "new@example.com");
+
+    EXPECT_EQ(manager.getSessionByEmail("old@example.com"), nullptr);
+    EXPECT_EQ(manager.getSessionByEmail("new@example.com"), session);
+    EXPECT_EQ(manager.getSessionByStudentId("7"), session);
+}
+
+TEST_F(SessionManagerTest, ResetSession_UnindexesAndKeepsTheNewId) {
+    auto& manager = SessionManager::getInstance();
+    auto session = manager.createSession();
+    std::string oldId = session->getSessionId();
+    logIn(session, "7", "ada@example.com");
+
+    manager.resetSession(session);
+
+    EXPECT_NE(session->getSessionId(), oldId);
+    EXPECT_FALSE(manager.hasSession(oldId));
+    EXPECT_EQ(manager.getSession(session->getSessionId()), session);
+    EXPECT_EQ(manager.getActiveSessionCount(), 1u);
+    EXPECT_EQ(manager.getSessionByStudentId("7"), nullptr);
+    EXPECT_EQ(manager.getSessionByEmail("ada@example.com"), nullptr);
+}
+
+TEST_F(SessionManagerTest, RemoveSession_KeepsTheStudentsOtherSessions) {
+    auto& manager = SessionManager::getInstance();
+    auto laptop = manager.createSession();
+    auto phone = manager.createSession();
+    logIn(laptop, "7", "ada@example.com");
+    logIn(phone, "7", "ada@example.com");
+
+    manager.removeSession(laptop->getSessionId());
+    EXPECT_EQ(manager.getSessionByStudentId("7"), phone);
+
+    manager.removeSession(phone->getSessionId());
+    EXPECT_EQ(manager.getSessionByStudentId("7"), nullptr);
+    EXPECT_EQ(manager.getSessionByEmail("ada@example.com"), nullptr);
+}
+
+TEST_F(SessionManagerTest, ConcurrentLoginsAndLogouts_LeaveConsistentIndexes) {
+    auto& manager = SessionManager::getInstance();
+    std::atomic<int> misses{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&manager, &misses, t]() {
+            for (int i = 0; i < 500; ++i) {
+                std::string studentId = std::to_string(t * 1000 + i);
+                auto session = manager.createSession();
+                logIn(session, studentId, studentId + "@example.com");
+                if (manager.getSessionByEmail(studentId + "@example.com") != session) {
+                    misses++;
+                }
+                if (i % 2) {
+                    manager.resetSession(session);
+                }
+                manager.removeSession(session->getSessionId());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(misses.load(), 0);
+    EXPECT_EQ(manager.getActiveSessionCount(), 0u);
+    EXPECT_EQ(manager.getSessionByStudentId("3007"), nullptr);
+}
+
+// =============================================================================
+// Form Type Catalog Tests
+// =============================================================================
+
+TEST_F(SessionManagerTest, FormTypeCatalog_IsAnImmutableSnapshot) {
+    auto& manager = SessionManager::getInstance();
+    manager.setFormTypeInfos({formType("personal_info", 1, true), formType("consent", 2, true)});
+    auto before = manager.getFormTypeCatalog();
+
+    manager.setFormTypeInfos({formType("medical_info", 1, false)});
+
+    ASSERT_EQ(before->formTypes.size(), 2u);
+    EXPECT_EQ(before->find("consent")->name, "consent form");
+    EXPECT_EQ(manager.getFormTypeCatalog()->find("consent"), nullptr);
+    EXPECT_EQ(manager.getFormTypeInfo("medical_info").name, "medical_info form");
+    EXPECT_EQ(manager.getFormTypeInfo("consent").id, "");
+    EXPECT_EQ(manager.getFormTypeInfos().size(), 1u);
+}
+
+TEST_F(SessionManagerTest, CalculateRequiredForms_SortsByDisplayOrder) {
+    auto& manager = SessionManager::getInstance();
+    auto transfer = formType("academic_history", 3, false);
+    transfer.requiredForCurriculums = {"cdl"};
+    manager.setFormTypeInfos({formType("consent", 9, true), formType("optional", 2, false),
+                              transfer, formType("personal_info", 1, true)});
+
+    Models::Curriculum curriculum;
+    curriculum.setId("cdl");
+    auto required = manager.calculateRequiredForms(Models::Student(), curriculum);
+
+    EXPECT_EQ(required, (std::vector<std::string>{"personal_info", "academic_history", "consent"}));
+}
+
+// =============================================================================
+// Idle Expiry Tests
+// =============================================================================
+
+TEST_F(SessionManagerTest, IdleSession_ExpiresAfterTheTimeout) {
+    auto& manager = SessionManager::getInstance();
+    auto start = nextTestStart();
+    std::vector<std::string> destroyed;
+    manager.setOnSessionDestroyed([&](const std::string& id) {
+        // Called outside the shard lock, so the manager can be used here
+        EXPECT_FALSE(manager.hasSession(id));
+        destroyed.push_back(id);
+    });
+    uint64_t expiredBefore = manager.getStats().expiredSessions;
+
+    auto session = manager.createSession();
+    std::string id = session->getSessionId();
+    logIn(session, "7", "ada@example.com");
+    session->touch(start);
+    session.reset();
+
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(59)), 0u);
+    EXPECT_TRUE(manager.hasSession(id));
+
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(61)), 1u);
+    EXPECT_FALSE(manager.hasSession(id));
+    EXPECT_EQ(manager.getSessionByStudentId("7"), nullptr);
+    EXPECT_EQ(destroyed, (std::vector<std::string>{id}));
+    EXPECT_EQ(manager.getStats().expiredSessions, expiredBefore + 1);
+    EXPECT_EQ(manager.getStats().liveSessions, 0u);
+}
+
+TEST_F(SessionManagerTest, TouchedSession_IsRearmedInsteadOfExpired) {
+    auto& manager = SessionManager::getInstance();
+    auto start = nextTestStart();
+    auto session = manager.createSession();
+    session->touch(start);
+
+    session->touch(start + std::chrono::minutes(50));
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(61)), 0u);
+    EXPECT_TRUE(manager.hasSession(session->getSessionId()));
+
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(109)), 0u);
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(111)), 1u);
+    EXPECT_FALSE(manager.hasSession(session->getSessionId()));
+}
+
+TEST_F(SessionManagerTest, ReclaimedBytes_CountOnlySessionsNothingElseHolds) {
+    auto& manager = SessionManager::getInstance();
+    auto start = nextTestStart();
+    auto held = manager.createSession();
+    auto released = manager.createSession();
+    held->touch(start);
+    released->touch(start);
+
+    Models::FormData form("personal_info", "7");
+    form.setField("notes", std::string(4096, 'x'));
+    released->setFormData("personal_info", form);
+    size_t releasedBytes = released->estimateMemoryUsage();
+    EXPECT_GT(releasedBytes, 4096u);
+    released.reset();
+
+    uint64_t reclaimedBefore = manager.getStats().reclaimedBytes;
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(61)), 2u);
+    EXPECT_EQ(manager.getStats().reclaimedBytes - reclaimedBefore, releasedBytes);
+}
+
+TEST_F(SessionManagerTest, HeldSession_IsCountedOnceItsOwnerReleasesIt) {
+    auto& manager = SessionManager::getInstance();
+    auto start = nextTestStart();
+    std::shared_ptr<Session::StudentSession> held;
+    int ended = 0;
+    held = manager.createSession([&ended]() { ended++; });
+    held->touch(start);
+    logIn(held, "7", "ada@example.com");
+    size_t heldBytes = held->estimateMemoryUsage();
+
+    uint64_t reclaimedBefore = manager.getStats().reclaimedBytes;
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(61)), 1u);
+    EXPECT_EQ(ended, 1);
+    EXPECT_EQ(manager.getStats().reclaimedBytes, reclaimedBefore);
+    EXPECT_EQ(manager.getStats().awaitingRelease, 1u);
+
+    // The owner ends; the next sweep counts what was freed
+    held.reset();
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(62)), 0u);
+    EXPECT_EQ(manager.getStats().reclaimedBytes - reclaimedBefore, heldBytes);
+    EXPECT_EQ(manager.getStats().awaitingRelease, 0u);
+}
+
+TEST_F(SessionManagerTest, ResetSession_KeepsTheExpiryHandler) {
+    auto& manager = SessionManager::getInstance();
+    auto start = nextTestStart();
+    int ended = 0;
+    auto session = manager.createSession([&ended]() { ended++; });
+    manager.resetSession(session);
+    session->touch(start);
+
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::minutes(61)), 1u);
+    EXPECT_EQ(ended, 1);
+}
+
+TEST_F(SessionManagerTest, ZeroTimeout_DisablesExpiry) {
+    auto& manager = SessionManager::getInstance();
+    auto start = nextTestStart();
+    manager.setSessionTimeout(0);
+    auto session = manager.createSession();
+    session->touch(start);
+
+    EXPECT_EQ(manager.removeExpiredSessions(start + std::chrono::hours(12)), 0u);
+    EXPECT_TRUE(manager.hasSession(session->getSessionId()));
+}
+
+TEST_F(SessionManagerTest, ExpiryThread_StartsAndStops) {
+    auto& manager = SessionManager::getInstance();
+    manager.start();
+    EXPECT_TRUE(manager.isRunning());
+    auto session = manager.createSession();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    EXPECT_TRUE(manager.hasSession(session->getSessionId()));
+    manager.stop();
+    EXPECT_FALSE(manager.isRunning());
+}
@@ -104,7 +104,7 @@ TEST_F(StudentSessionTest, SetCurrentCurriculum_UpdatesCurriculum) {
     curriculum.setId("10");
     curriculum.setName("Test Program");
 
-    session.setCurrentCurriculum(curriculum);
+    session.setCurrentCurriculum(std::make_shared<Models::Curriculum>(curriculum));
 
     EXPECT_EQ(session.getCurrentCurriculum().getId(), "10");
     EXPECT_EQ(session.getCurrentCurriculum().getName(), "Test Program");
@@ -117,11 +117,32 @@ TEST_F(StudentSessionTest, HasCurriculumSelected_ReturnsTrueWhenSet) {
 
     Models::Curriculum curriculum;
     curriculum.setId("10");
-    session.setCurrentCurriculum(curriculum);
+    session.setCurrentCurriculum(std::make_shared<Models::Curriculum>(curriculum));
 
     EXPECT_TRUE(session.hasCurriculumSelected());
 }
 
+TEST_F(StudentSessionTest, SetCurrentCurriculum_SharesTheHandle) {
+    Session::StudentSession first, second;
+    auto curriculum = std::make_shared<const Models::Curriculum>("10", "Test Program");
+
+    first.setCurrentCurriculum(curriculum);
+    second.setCurrentCurriculum(curriculum);
+
+    EXPECT_EQ(&first.getCurrentCurriculum(), &second.getCurrentCurriculum());
+    EXPECT_EQ(&first.getCurrentCurriculum(), curriculum.get());
+}
+
+TEST_F(StudentSessionTest, ClearCurrentCurriculum_LeavesEmptyCurriculum) {
+    Session::StudentSession session;
+    session.setCurrentCurriculum(std::make_shared<const Models::Curriculum>("10", "Test Program"));
+
+    session.clearCurrentCurriculum();
+
+    EXPECT_FALSE(session.hasCurriculumSelected());
+    EXPECT_EQ(session.getCurrentCurriculum().getId(), "");
+}
+
 // =============================================================================
 // Endorsement Tests
 // =============================================================================
@@ -133,10 +154,10 @@ TEST_F(StudentSessionTest, AddSelectedEndorsement_AddsToList) {
     endorsement.setId("100");
     endorsement.setName("Endorsement 1");
 
-    session.addSelectedEndorsement(endorsement);
+    session.addSelectedEndorsement(std::make_shared<Models::Curriculum>(endorsement));
 
     EXPECT_EQ(session.getSelectedEndorsements().size(), 1);
-    EXPECT_EQ(session.getSelectedEndorsements()[0].getId(), "100");
+    EXPECT_EQ(session.getSelectedEndorsements()[0]->getId(), "100");
 }
 
 TEST_F(StudentSessionTest, ClearSelectedEndorsements_RemovesAll) {
@@ -146,8 +167,8 @@ TEST_F(StudentSessionTest, ClearSelectedEndorsements_RemovesAll) {
     e1.setId("100");
     e2.setId("200");
 
-    session.addSelectedEndorsement(e1);
-    session.addSelectedEndorsement(e2);
+    session.addSelectedEndorsement(std::make_shared<Models::Curriculum>(e1));
+    session.addSelectedEndorsement(std::make_shared<Models::Curriculum>(e2));
     session.clearSelectedEndorsements();
 
     EXPECT_TRUE(session.getSelectedEndorsements().empty());
@@ -271,7 +292,7 @@ TEST_F(StudentSessionTest, Reset_ClearsAllState) {
 
     Models::Curriculum curriculum;
     curriculum.setId("10");
-    session.setCurrentCurriculum(curriculum);
+    session.setCurrentCurriculum(std::make_shared<Models::Curriculum>(curriculum));
 
     Models::FormData formData;
     formData.setFormId("personal_info");
@@ -350,3 +371,26 @@ TEST_F(StudentSessionTest, SetSessionId_StoresId) {
     session.setSessionId("session-abc-123");
     EXPECT_EQ(session.getSessionId(), "session-abc-123");
 }
+
+// =============================================================================
+// Activity Tracking Tests
+// =============================================================================
+
+TEST_F(StudentSessionTest, Touch_RecordsLastActivity) {
+    Session::StudentSession session;
+    auto later = std::chrono::steady_clock::now() + std::chrono::minutes(5);
+
+    session.touch(later);
+    EXPECT_EQ(session.getLastActivity(), later);
+}
+
+TEST_F(StudentSessionTest, EstimateMemoryUsage_GrowsWithFormData) {
+    Session::StudentSession session;
+    size_t empty = session.estimateMemoryUsage();
+
+    Models::FormData form("personal_info", "7");
+    form.setField("notes", std::string(2048, 'x'));
+    session.setFormData("personal_info", form);
+
+    EXPECT_GE(session.estimateMemoryUsage(), empty + 2048);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <set>
+#include "session/TimerWheel.h"
+
+using StudentIntake::Session::TimerWheel;
+
+namespace {
+
+std::vector<std::string> advanceTo(TimerWheel& wheel, uint64_t tick) {
+    std::vector<std::string> expired;
+    wheel.advance(tick, expired);
+    return expired;
+}
+
+} // namespace
+
+// =============================================================================
+// Scheduling Tests
+// =============================================================================
+
+TEST(TimerWheelTest, Timer_FiresAtItsDeadlineAndNotBefore) {
+    TimerWheel wheel;
+    wheel.schedule("a", 5);
+    EXPECT_EQ(wheel.size(), 1u);
+
+    EXPECT_TRUE(advanceTo(wheel, 4).empty());
+    EXPECT_EQ(advanceTo(wheel, 5), (std::vector<std::string>{"a"}));
+    EXPECT_EQ(wheel.size(), 0u);
+    EXPECT_TRUE(advanceTo(wheel, 500).empty());
+}
+
+TEST(TimerWheelTest, PastDeadline_FiresOnTheNextTick) {
+    TimerWheel wheel(100);
+    wheel.schedule("late", 40);
+    EXPECT_TRUE(advanceTo(wheel, 100).empty());
+    EXPECT_EQ(advanceTo(wheel, 101), (std::vector<std::string>{"late"}));
+}
+
+TEST(TimerWheelTest, UpperLevels_CascadeDownToTheExactTick) {
+    const uint64_t start = 1000003;
+    // One deadline per level, plus one past the wheel's 64^4 ticks
+    const std::vector<uint64_t> delays = {63, 64, 4095, 4096, 262143, 262144, 16777215, 16777216, 40000000};
+
+    for (uint64_t delay : delays) {
+        TimerWheel wheel(start);
+        wheel.schedule("t", start + delay);
+        EXPECT_TRUE(advanceTo(wheel, start + delay - 1).empty()) << delay;
+        EXPECT_EQ(advanceTo(wheel, start + delay), (std::vector<std::string>{"t"})) << delay;
+    }
+}
+
+TEST(TimerWheelTest, RandomSchedule_MatchesAReferenceTimerList) {
+    std::mt19937_64 random(7);
+    TimerWheel wheel(123456);
+    std::map<std::string, uint64_t> pending;
+    int next = 0;
+
+    for (int round = 0; round < 2000; ++round) {
+        for (int i = random() % 4; i > 0; --i) {
+            uint64_t span = uint64_t(1) << (random() % 22);
+            uint64_t deadline = wheel.currentTick() + random() % span;
+            std::string key = std::to_string(next++);
+            wheel.schedule(key, deadline);
+            pending[key] = std::max(deadline, wheel.currentTick() + 1);
+        }
+
+        uint64_t target = wheel.currentTick() + random() % 3000;
+        auto fired = advanceTo(wheel, target);
+        std::set<std::string> firedSet(fired.begin(), fired.end());
+        ASSERT_EQ(firedSet.size(), fired.size());
+
+        for (auto it = pending.begin(); it != pending.end();) {
+            bool due = it->second <= target;
+            ASSERT_EQ(firedSet.count(it->first) == 1, due) << "key " << it->first << " deadline " << it->second;
+            it = due ? pending.erase(it) : std::next(it);
+        }
+        ASSERT_EQ(wheel.size(), pending.size());
+    }
+}
@@ -0,0 +1,295 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <regex>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <unistd.h>
+#include "utils/Logger.h"
+
+using namespace StudentIntake;
+
+namespace {
+
+std::vector<std::string> readLines(const std::string& path) {
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+int evaluations = 0;
+
+int counted(int value) {
+    evaluations++;
+    return value;
+}
+
+} // namespace
+
+// =============================================================================
+// Test Fixture
+// =============================================================================
+
+class LoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = "/tmp/logger_test_" + std::to_string(getpid()) + ".log";
+        std::remove(path_.c_str());
+        ASSERT_TRUE(Logger::setOutputFile(path_));
+        Logger::setLevel(LogLevel::DEBUG);
+        Logger::setShowLevel(true);
+        Logger::setShowTimestamp(false);
+    }
+
+    void TearDown() override {
+        Logger::stop();
+        Logger::setOutputFile("");
+        Logger::setLevel(LogLevel::INFO);
+        Logger::clearComponentLevels();
+        Logger::setFormat(LogFormat::TEXT);
+        Logger::setShowTimestamp(false);
+        std::remove(path_.c_str());
+    }
+
+    std::string path_;
+};
+
+// =============================================================================
+// Formatting Tests
+// =============================================================================
+
+TEST_F(LoggerTest, Macros_WriteLevelComponentAndMessage) {
+    int value = 42;
+    LOG_DEBUG("Parser", "value " << value);
+    LOG_INFO("Parser", "ready");
+    LOG_WARN("", "no component");
+    LOG_ERROR("Parser", "failed: " << 1.5);
+
+    EXPECT_EQ(readLines(path_), (std::vector<std::string>{
+        "[DEBUG] [Parser] value 42",
+        "[INFO]  [Parser] ready",
+        "[WARN]  no component",
+        "[ERROR] [Parser] failed: 1.5"}));
+}
+
+TEST_F(LoggerTest, Level_FiltersLowerPriorityLines) {
+    Logger::setLevel(LogLevel::WARN);
+    LOG_DEBUG("Filter", "hidden");
+    LOG_INFO("Filter", "hidden");
+    LOG_WARN("Filter", "shown");
+    Logger::flush();
+
+    EXPECT_EQ(readLines(path_), (std::vector<std::string>{"[WARN]  [Filter] shown"}));
+}
+
+TEST_F(LoggerTest, Timestamp_HasMillisecondPrecision) {
+    Logger::setShowTimestamp(true);
+    LOG_INFO("Clock", "tick");
+    LOG_INFO("Clock", "tock");
+    Logger::flush();
+
+    auto lines = readLines(path_);
+    ASSERT_EQ(lines.size(), 2u);
+    std::regex format(R"(\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}\.\d{3} \[INFO\]  \[Clock\] t(i|o)ck)");
+    EXPECT_TRUE(std::regex_match(lines[0], format)) << lines[0];
+    EXPECT_TRUE(std::regex_match(lines[1], format)) << lines[1];
+}
+
+// =============================================================================
+// Background Writer Tests
+// =============================================================================
+
+TEST_F(LoggerTest, Writer_KeepsEveryLineAndPerThreadOrder) {
+    Logger::start();
+    ASSERT_TRUE(Logger::isRunning());
+
+    // More lines than the ring holds, so producers also wait for the writer
+    const int threads = 8;
+    const int perThread = 5000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([t]() {
+            for (int i = 0; i < perThread; ++i) {
+                LOG_INFO("Worker", t << " " << i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    Logger::flush();
+
+    auto lines = readLines(path_);
+    ASSERT_EQ(lines.size(), static_cast<size_t>(threads * perThread));
+    std::map<int, int> next;
+    for (const auto& line : lines) {
+        int thread = 0;
+        int index = 0;
+        ASSERT_EQ(std::sscanf(line.c_str(), "[INFO]  [Worker] %d %d", &thread, &index), 2) << line;
+        EXPECT_EQ(index, next[thread]++);
+    }
+    EXPECT_GE(Logger::getStats().lines, static_cast<uint64_t>(threads * perThread));
+}
+
+TEST_F(LoggerTest, Error_IsWrittenBeforeLogErrorReturns) {
+    Logger::start();
+    LOG_INFO("Crash", "before");
+    LOG_ERROR("Crash", "fatal");
+
+    // No flush: the error and everything queued ahead of it are already out
+    EXPECT_EQ(readLines(path_), (std::vector<std::string>{"[INFO]  [Crash] before", "[ERROR] [Crash] fatal"}));
+}
+
+TEST_F(LoggerTest, Stop_WritesQueuedLines) {
+    Logger::start();
+    for (int i = 0; i < 100; ++i) {
+        LOG_DEBUG("Shutdown", i);
+    }
+    Logger::stop();
+    EXPECT_FALSE(Logger::isRunning());
+    EXPECT_EQ(readLines(path_).size(), 100u);
+}
+
+// =============================================================================
+// Level Selection Tests
+// =============================================================================
+
+TEST_F(LoggerTest, DisabledLevel_DoesNotEvaluateTheMessage) {
+    static_assert(Logger::compiledIn(LogLevel::ERROR), "errors are always compiled in");
+
+    Logger::setLevel(LogLevel::INFO);
+    evaluations = 0;
+    LOG_DEBUG("Lazy", "value " << counted(1));
+    EXPECT_EQ(evaluations, 0);
+    LOG_INFO("Lazy", "value " << counted(2));
+    EXPECT_EQ(evaluations, 1);
+}
+
+TEST_F(LoggerTest, ComponentLevel_OverridesTheGlobalLevel) {
+    Logger::setLevel(LogLevel::INFO);
+    Logger::setComponentLevels("ApiClient=DEBUG,EventSpool=ERROR,Broken,Bad=LOUD");
+
+    EXPECT_TRUE(Logger::shouldLog(LogLevel::DEBUG, "ApiClient"));
+    EXPECT_FALSE(Logger::shouldLog(LogLevel::DEBUG, "AuthService"));
+    EXPECT_TRUE(Logger::shouldLog(LogLevel::INFO, "AuthService"));
+    EXPECT_FALSE(Logger::shouldLog(LogLevel::WARN, "EventSpool"));
+
+    LOG_DEBUG("ApiClient", "request");
+    LOG_DEBUG("AuthService", "hidden");
+    LOG_WARN("EventSpool", "hidden");
+    Logger::flush();
+    EXPECT_EQ(readLines(path_), (std::vector<std::string>{"[DEBUG] [ApiClient] request"}));
+
+    Logger::clearComponentLevels();
+    EXPECT_FALSE(Logger::shouldLog(LogLevel::DEBUG, "ApiClient"));
+}
+
+TEST_F(LoggerTest, ComponentLevel_ChangesReachOtherThreads) {
+    Logger::setLevel(LogLevel::WARN);
+    std::thread([]() { EXPECT_FALSE(Logger::shouldLog(LogLevel::INFO, "Worker")); }).join();
+
+    Logger::setComponentLevel("Worker", LogLevel::INFO);
+    std::thread([]() { EXPECT_TRUE(Logger::shouldLog(LogLevel::INFO, "Worker")); }).join();
+}
+
+// =============================================================================
+// Structured Output Tests
+// =============================================================================
+
+TEST_F(LoggerTest, Fields_AreAppendedAsKeyValuePairsInText) {
+    LOG_FIELDS(INFO, "ApiClient", "Response", {"status", 200}, {"ms", 12.5},
+               {"endpoint", "/Student/1"}, {"error", "not found"}, {"cached", false});
+    Logger::flush();
+
+    EXPECT_EQ(readLines(path_), (std::vector<std::string>{
+        "[INFO]  [ApiClient] Response status=200 ms=12.5 endpoint=/Student/1 error=\"not found\" cached=false"}));
+}
+
+TEST_F(LoggerTest, JsonFormat_WritesOneTypedObjectPerLine) {
+    Logger::setFormat(LogFormat::JSON);
+    size_t bytes = 2048;
+    LOG_FIELDS(WARN, "ApiClient", "Slow \"response\"\n", {"status", 503}, {"bytes", bytes},
+               {"ms", 812.25}, {"retry", true}, {"endpoint", "/ActivityLog"});
+    LOG_INFO("", "plain");
+    Logger::flush();
+
+    auto lines = readLines(path_);
+    ASSERT_EQ(lines.size(), 2u);
+    auto json = nlohmann::json::parse(lines[0]);
+    EXPECT_EQ(json["level"], "WARN");
+    EXPECT_EQ(json["component"], "ApiClient");
+    EXPECT_EQ(json["msg"], "Slow \"response\"\n");
+    EXPECT_TRUE(json["status"].is_number_integer());
+    EXPECT_EQ(json["status"], 503);
+    EXPECT_TRUE(json["bytes"].is_number_unsigned());
+    EXPECT_EQ(json["bytes"], 2048u);
+    EXPECT_DOUBLE_EQ(json["ms"].get<double>(), 812.25);
+    EXPECT_EQ(json["retry"], true);
+    EXPECT_EQ(json["endpoint"], "/ActivityLog");
+    EXPECT_TRUE(std::regex_match(json["ts"].get<std::string>(),
+                                 std::regex(R"(\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{3}Z)")));
+
+    auto plain = nlohmann::json::parse(lines[1]);
+    EXPECT_FALSE(plain.contains("component"));
+    EXPECT_EQ(plain["msg"], "plain");
+}
+
+// =============================================================================
+// Rate Limiting and Sampling Tests
+// =============================================================================
+
+TEST_F(LoggerTest, RateLimited_DropsLinesBeyondTheLimitAndReportsThem) {
+    for (int i = 0; i < 50; ++i) {
+        LOG_RATE_LIMITED(WARN, "ApiClient", 5, "Request failed " << i);
+    }
+    Logger::flush();
+    auto lines = readLines(path_);
+    ASSERT_GE(lines.size(), 5u);
+    // Normally all 50 fall in one second; a second boundary allows one more batch
+    EXPECT_LE(lines.size(), 10u);
+    EXPECT_EQ(lines[0], "[WARN]  [ApiClient] Request failed 0");
+
+    LogRateLimiter limiter(2);
+    uint64_t suppressed = 0;
+    EXPECT_TRUE(limiter.allow(suppressed));
+    EXPECT_TRUE(limiter.allow(suppressed));
+    EXPECT_FALSE(limiter.allow(suppressed));
+    EXPECT_FALSE(limiter.allow(suppressed));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    EXPECT_TRUE(limiter.allow(suppressed));
+    EXPECT_EQ(suppressed, 2u);
+}
+
+TEST_F(LoggerTest, Sampled_WritesOneLineInN) {
+    for (int i = 0; i < 100; ++i) {
+        LOG_SAMPLED(DEBUG, "Session", 25, "touch " << i);
+    }
+    Logger::flush();
+
+    EXPECT_EQ(readLines(path_), (std::vector<std::string>{
+        "[DEBUG] [Session] touch 0 sample_rate=25",
+        "[DEBUG] [Session] touch 25 sample_rate=25",
+        "[DEBUG] [Session] touch 50 sample_rate=25",
+        "[DEBUG] [Session] touch 75 sample_rate=25"}));
+}
+
+TEST_F(LoggerTest, NestedMessages_UseTheirOwnStream) {
+    struct Printer {
+        static std::string describe() {
+            LOG_DEBUG("Inner", "formatting " << std::hex << 255);
+            return "described";
+        }
+    };
+    LOG_INFO("Outer", "value " << Printer::describe() << " " << 10);
+    Logger::flush();
+
+    EXPECT_EQ(readLines(path_), (std::vector<std::string>{
+        "[DEBUG] [Inner] formatting ff",
+        "[INFO]  [Outer] value described 10"}));
+}
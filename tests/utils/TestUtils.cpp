@@ -1,6 +1,9 @@
 #include "utils/TestUtils.h"
+#include <algorithm>
+#include <cctype>
 #include <iomanip>
 #include <sstream>
+#include <thread>
 
 namespace TestUtils {
 
@@ -456,4 +459,388 @@ int DateTimeHelper::calculateAge(const std::chrono::system_clock::time_point& do
     return static_cast<int>(days / 365);
 }
 
+// =============================================================================
+// FakeApiClient
+// =============================================================================
+
+namespace {
+
+using StudentIntake::Api::ApiResponse;
+
+// Query string parameters in order, values decoded
+std::vector<std::pair<std::string, std::string>> queryParameters(const std::string& endpoint) {
+    std::vector<std::pair<std::string, std::string>> parameters;
+    size_t start = endpoint.find('?');
+    while (start != std::string::npos) {
+        size_t end = endpoint.find('&', start + 1);
+        std::string pair = endpoint.substr(start + 1, end == std::string::npos ? std::string::npos : end - start - 1);
+        size_t equals = pair.find('=');
+        std::string value = equals == std::string::npos ? "" : pair.substr(equals + 1);
+        if (!pair.empty()) {
+            parameters.emplace_back(pair.substr(0, equals), FakeApiClient::urlDecode(value));
+        }
+        start = end;
+    }
+    return parameters;
+}
+
+// Column value of a table row; "id" compares as a number
+nlohmann::json fieldOf(const nlohmann::json& row, const std::string& name) {
+    if (name == "id") {
+        return std::stoi(row["id"].get<std::string>());
+    }
+    const auto& attributes = row["attributes"];
+    return attributes.contains(name) ? attributes[name] : nlohmann::json();
+}
+
+std::string textOf(const nlohmann::json& value) {
+    return value.is_string() ? value.get<std::string>() : value.dump();
+}
+
+// Numbers compare as numbers, anything else by its text
+int compareValues(const nlohmann::json& a, const nlohmann::json& b) {
+    if (a.is_number() && b.is_number()) {
+        double x = a.get<double>();
+        double y = b.get<double>();
+        return x < y ? -1 : x > y ? 1 : 0;
+    }
+    return textOf(a).compare(textOf(b));
+}
+
+// SQL LIKE: % matches any run, _ any one character
+bool likeMatch(const std::string& text, const std::string& pattern, size_t t = 0, size_t p = 0) {
+    if (p == pattern.size()) {
+        return t == text.size();
+    }
+    if (pattern[p] == '%') {
+        for (size_t skip = t; skip <= text.size(); ++skip) {
+            if (likeMatch(text, pattern, skip, p + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return t < text.size() && (pattern[p] == '_' || pattern[p] == text[t]) &&
+           likeMatch(text, pattern, t + 1, p + 1);
+}
+
+std::string lowered(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+bool matchesClause(const nlohmann::json& row, const nlohmann::json& clause) {
+    if (clause.contains("or")) {
+        return std::any_of(clause["or"].begin(), clause["or"].end(),
+                           [&row](const nlohmann::json& inner) { return matchesClause(row, inner); });
+    }
+    if (clause.contains("and")) {
+        return std::all_of(clause["and"].begin(), clause["and"].end(),
+                           [&row](const nlohmann::json& inner) { return matchesClause(row, inner); });
+    }
+
+    nlohmann::json value = fieldOf(row, clause["name"]);
+    std::string op = clause["op"];
+    const auto& val = clause["val"];
+    if (op == "is_") {
+        return val.is_null() ? value.is_null() : !value.is_null() && compareValues(value, val) == 0;
+    }
+    if (value.is_null()) {
+        return false;
+    }
+    int order = compareValues(value, val);
+    if (op == "eq") return order == 0;
+    if (op == "ne") return order != 0;
+    if (op == "lt") return order < 0;
+    if (op == "le") return order <= 0;
+    if (op == "gt") return order > 0;
+    if (op == "ge") return order >= 0;
+    if (op == "ilike") return likeMatch(lowered(textOf(value)), lowered(textOf(val)));
+    return false;
+}
+
+} // namespace
+
+void FakeApiClient::route(const std::string& method, const std::string& prefix, Handler handler) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& existing : routes_) {
+        if (existing.method == method && existing.prefix == prefix) {
+            existing.handler = std::move(handler);
+            return;
+        }
+    }
+    routes_.push_back({method, prefix, std::move(handler)});
+}
+
+void FakeApiClient::respond(const std::string& method, const std::string& prefix, int status,
+                            const nlohmann::json& body) {
+    ApiResponse response = reply(status, body);
+    route(method, prefix, [response](const Request&) { return response; });
+}
+
+void FakeApiClient::removeRoute(const std::string& method, const std::string& prefix) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    routes_.erase(std::remove_if(routes_.begin(), routes_.end(), [&](const Route& route) {
+        return route.method == method && route.prefix == prefix;
+    }), routes_.end());
+}
+
+void FakeApiClient::putRow(const std::string& resource, int id, const nlohmann::json& attributes) {
+    nlohmann::json row = {{"type", resource}, {"id", std::to_string(id)}, {"attributes", attributes}};
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& rows = tables_[resource];
+    for (auto& existing : rows) {
+        if (existing["id"] == row["id"]) {
+            existing = std::move(row);
+            return;
+        }
+    }
+    rows.push_back(std::move(row));
+}
+
+void FakeApiClient::eraseRow(const std::string& resource, int id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& rows = tables_[resource];
+    rows.erase(std::remove_if(rows.begin(), rows.end(), [id](const nlohmann::json& row) {
+        return row["id"] == std::to_string(id);
+    }), rows.end());
+}
+
+ApiResponse FakeApiClient::serveTable(const std::string& endpoint) const {
+    std::string path = endpoint.substr(0, endpoint.find('?'));
+    size_t slash = path.find('/', 1);
+    std::string resource = path.substr(1, slash == std::string::npos ? std::string::npos : slash - 1);
+
+    std::vector<nlohmann::json> rows;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto table = tables_.find(resource);
+        if (table == tables_.end()) {
+            return reply(200);
+        }
+        rows = table->second;
+    }
+
+    if (slash != std::string::npos) {
+        std::string id = path.substr(slash + 1);
+        for (const auto& row : rows) {
+            if (row["id"] == id) {
+                return reply(200, {{"data", row}});
+            }
+        }
+        return reply(404, {{"errors", nlohmann::json::array()}});
+    }
+
+    size_t offset = 0;
+    size_t limit = rows.size();
+    std::vector<nlohmann::json> clauses;
+    std::vector<std::string> sortFields;
+    for (const auto& [name, value] : queryParameters(endpoint)) {
+        if (name == "filter") {
+            for (const auto& clause : nlohmann::json::parse(value)) {
+                clauses.push_back(clause);
+            }
+        } else if (name.rfind("filter[", 0) == 0 && name.find('[', 7) == std::string::npos) {
+            clauses.push_back({{"name", name.substr(7, name.size() - 8)}, {"op", "eq"}, {"val", value}});
+        } else if (name == "sort") {
+            std::istringstream fields(value);
+            for (std::string field; std::getline(fields, field, ',');) {
+                sortFields.push_back(field);
+            }
+        } else if (name == "page[offset]") {
+            offset = std::stoul(value);
+        } else if (name == "page[limit]") {
+            limit = std::stoul(value);
+        }
+    }
+
+    rows.erase(std::remove_if(rows.begin(), rows.end(), [&clauses](const nlohmann::json& row) {
+        return !std::all_of(clauses.begin(), clauses.end(),
+                            [&row](const nlohmann::json& clause) { return matchesClause(row, clause); });
+    }), rows.end());
+
+    std::stable_sort(rows.begin(), rows.end(), [&sortFields](const nlohmann::json& a, const nlohmann::json& b) {
+        for (const auto& field : sortFields) {
+            bool descending = field[0] == '-';
+            std::string name = descending ? field.substr(1) : field;
+            int order = compareValues(fieldOf(a, name), fieldOf(b, name));
+            if (order != 0) {
+                return descending ? order > 0 : order < 0;
+            }
+        }
+        return false;
+    });
+
+    nlohmann::json data = nlohmann::json::array();
+    for (size_t i = offset; i < std::min(rows.size(), offset + limit); ++i) {
+        data.push_back(rows[i]);
+    }
+    return reply(200, {{"data", data}, {"meta", {{"count", rows.size()}}}});
+}
+
+void FakeApiClient::setLatency(std::chrono::milliseconds latency) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    latency_ = latency;
+}
+
+void FakeApiClient::hold(const std::string& method, const std::string& prefix) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    holdMethod_ = method;
+    holdPrefix_ = prefix;
+    holding_ = true;
+}
+
+void FakeApiClient::waitUntilHeld(size_t count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [this, count]() { return held_ >= count; });
+}
+
+void FakeApiClient::release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    holding_ = false;
+    changed_.notify_all();
+}
+
+std::vector<FakeApiClient::Request> FakeApiClient::requests(const std::string& method,
+                                                            const std::string& prefix) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Request> matching;
+    for (const auto& request : requests_) {
+        if (matches(method, prefix, request)) {
+            matching.push_back(request);
+        }
+    }
+    return matching;
+}
+
+std::vector<std::string> FakeApiClient::endpoints(const std::string& method, const std::string& prefix) const {
+    std::vector<std::string> result;
+    for (const auto& request : requests(method, prefix)) {
+        result.push_back(request.endpoint);
+    }
+    return result;
+}
+
+size_t FakeApiClient::countRequests(const std::string& method, const std::string& prefix) const {
+    return requests(method, prefix).size();
+}
+
+std::vector<FakeApiClient::Request> FakeApiClient::takeRequests() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::move(requests_);
+}
+
+int FakeApiClient::peakInFlight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return peakInFlight_;
+}
+
+ApiResponse FakeApiClient::get(const std::string& endpoint) {
+    return dispatch("GET", endpoint, nlohmann::json());
+}
+
+ApiResponse FakeApiClient::post(const std::string& endpoint, const nlohmann::json& data) {
+    return dispatch("POST", endpoint, data);
+}
+
+ApiResponse FakeApiClient::put(const std::string& endpoint, const nlohmann::json& data) {
+    return dispatch("PUT", endpoint, data);
+}
+
+ApiResponse FakeApiClient::patch(const std::string& endpoint, const nlohmann::json& data) {
+    return dispatch("PATCH", endpoint, data);
+}
+
+ApiResponse FakeApiClient::del(const std::string& endpoint) {
+    return dispatch("DELETE", endpoint, nlohmann::json());
+}
+
+ApiResponse FakeApiClient::reply(int status, const nlohmann::json& body) {
+    ApiResponse response;
+    response.statusCode = status;
+    response.success = status >= 200 && status < 300;
+    if (status == 0) {
+        response.errorMessage = "Connection refused";
+    } else {
+        response.body = body.dump();
+    }
+    return response;
+}
+
+nlohmann::json FakeApiClient::emptyBody() {
+    return {{"data", nlohmann::json::array()}};
+}
+
+std::string FakeApiClient::queryParameter(const std::string& endpoint, const std::string& name) {
+    for (const auto& [key, value] : queryParameters(endpoint)) {
+        if (key == name) {
+            return value;
+        }
+    }
+    return "";
+}
+
+nlohmann::json FakeApiClient::filterClauses(const std::string& endpoint) {
+    std::string filter = queryParameter(endpoint, "filter");
+    return filter.empty() ? nlohmann::json::array() : nlohmann::json::parse(filter);
+}
+
+std::string FakeApiClient::urlDecode(const std::string& value) {
+    std::string decoded;
+    for (size_t i = 0; i < value.size(); ++i) {
+        if (value[i] == '%' && i + 2 < value.size()) {
+            decoded += static_cast<char>(std::stoi(value.substr(i + 1, 2), nullptr, 16));
+            i += 2;
+        } else {
+            decoded += value[i];
+        }
+    }
+    return decoded;
+}
+
+ApiResponse FakeApiClient::dispatch(const std::string& method, const std::string& endpoint,
+                                    const nlohmann::json& payload) {
+    Request request{method, endpoint, payload};
+    Handler handler;
+    std::chrono::milliseconds latency;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        requests_.push_back(request);
+        peakInFlight_ = std::max(peakInFlight_, ++inFlight_);
+        if (holding_ && matches(holdMethod_, holdPrefix_, request)) {
+            held_++;
+            changed_.notify_all();
+            changed_.wait(lock, [this]() { return !holding_; });
+        }
+
+        const Route* best = nullptr;
+        for (const auto& route : routes_) {
+            // The longest prefix wins; on a tie, a route for this method beats "*"
+            if (matches(route.method, route.prefix, request) &&
+                (!best || route.prefix.size() > best->prefix.size() ||
+                 (route.prefix.size() == best->prefix.size() && route.method != "*"))) {
+                best = &route;
+            }
+        }
+        if (best) {
+            handler = best->handler;
+        }
+        latency = latency_;
+    }
+
+    if (latency.count() > 0) {
+        std::this_thread::sleep_for(latency);
+    }
+    ApiResponse response = handler ? handler(request) : method == "GET" ? serveTable(endpoint) : reply(200);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    inFlight_--;
+    return response;
+}
+
+bool FakeApiClient::matches(const std::string& method, const std::string& prefix, const Request& request) {
+    return (method == "*" || method == request.method) && request.endpoint.rfind(prefix, 0) == 0;
+}
+
 } // namespace TestUtils
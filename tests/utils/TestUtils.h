@@ -1,8 +1,15 @@
 #ifndef TEST_UTILS_H
 #define TEST_UTILS_H
 
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <string>
+#include <vector>
 #include <nlohmann/json.hpp>
+#include "api/ApiClient.h"
 #include "models/Student.h"
 #include "models/EmergencyContact.h"
 #include "models/User.h"
@@ -90,6 +97,91 @@ public:
     static int calculateAge(const std::chrono::system_clock::time_point& dob);
 };
 
+/**
+ * @brief Configurable in-memory ApiClient for service tests
+ *
+ * Every request is recorded, then answered by the route whose endpoint
+ * prefix is the longest match for its method ("*" routes match any method).
+ * GETs no route answers are served from the JSON:API tables filled with
+ * putRow(); the rest get 200 with an empty data array. Handlers run outside
+ * the client's lock, so they may block or call back into the client.
+ */
+class FakeApiClient : public StudentIntake::Api::ApiClient {
+public:
+    struct Request {
+        std::string method;
+        std::string endpoint;
+        nlohmann::json payload;
+    };
+
+    using Handler = std::function<StudentIntake::Api::ApiResponse(const Request&)>;
+
+    // Routes; setting one again for the same method and prefix replaces it
+    void route(const std::string& method, const std::string& prefix, Handler handler);
+    void respond(const std::string& method, const std::string& prefix, int status,
+                 const nlohmann::json& body = emptyBody());
+    void removeRoute(const std::string& method, const std::string& prefix);
+
+    // Tables honour filter[field]=value, JSON filter clauses (eq, ne, lt, le,
+    // gt, ge, ilike, is_, or), sort and page[offset]/page[limit], report the
+    // matched total in meta.count and answer /Resource/{id}
+    void putRow(const std::string& resource, int id, const nlohmann::json& attributes);
+    void eraseRow(const std::string& resource, int id);
+    StudentIntake::Api::ApiResponse serveTable(const std::string& endpoint) const;
+
+    // Every request waits this long before it is answered
+    void setLatency(std::chrono::milliseconds latency);
+
+    // Park matching requests until release() so one can be caught in flight
+    void hold(const std::string& method, const std::string& prefix);
+    void waitUntilHeld(size_t count = 1);
+    void release();
+
+    // Recorded requests, optionally only those matching a method and prefix
+    std::vector<Request> requests(const std::string& method = "*", const std::string& prefix = "") const;
+    std::vector<std::string> endpoints(const std::string& method = "*", const std::string& prefix = "") const;
+    size_t countRequests(const std::string& method = "*", const std::string& prefix = "") const;
+    std::vector<Request> takeRequests();
+    int peakInFlight() const;
+
+    StudentIntake::Api::ApiResponse get(const std::string& endpoint) override;
+    StudentIntake::Api::ApiResponse post(const std::string& endpoint, const nlohmann::json& data) override;
+    StudentIntake::Api::ApiResponse put(const std::string& endpoint, const nlohmann::json& data) override;
+    StudentIntake::Api::ApiResponse patch(const std::string& endpoint, const nlohmann::json& data) override;
+    StudentIntake::Api::ApiResponse del(const std::string& endpoint) override;
+
+    // Response and query helpers for handlers; status 0 is an unreachable backend
+    static StudentIntake::Api::ApiResponse reply(int status, const nlohmann::json& body = emptyBody());
+    static nlohmann::json emptyBody();
+    static std::string queryParameter(const std::string& endpoint, const std::string& name);
+    static nlohmann::json filterClauses(const std::string& endpoint);
+    static std::string urlDecode(const std::string& value);
+
+private:
+    struct Route {
+        std::string method;
+        std::string prefix;
+        Handler handler;
+    };
+
+    StudentIntake::Api::ApiResponse dispatch(const std::string& method, const std::string& endpoint,
+                                             const nlohmann::json& payload);
+    static bool matches(const std::string& method, const std::string& prefix, const Request& request);
+
+    std::vector<Route> routes_;
+    std::map<std::string, std::vector<nlohmann::json>> tables_;
+    std::vector<Request> requests_;
+    std::chrono::milliseconds latency_{0};
+    std::string holdMethod_;
+    std::string holdPrefix_;
+    bool holding_ = false;
+    size_t held_ = 0;
+    int inFlight_ = 0;
+    int peakInFlight_ = 0;
+    std::condition_variable changed_;
+    mutable std::mutex mutex_;
+};
+
 } // namespace TestUtils
 
 #endif // TEST_UTILS_H